@@ -22,6 +22,7 @@ namespace components {
 /// * server::handlers::InspectRequests
 /// * server::handlers::Jemalloc
 /// * server::handlers::LogLevel
+/// * server::handlers::OpenMetrics
 /// * server::handlers::ServerMonitor
 /// * server::handlers::TestsControl
 /// * components::AuthCheckerSettings
@@ -4,6 +4,7 @@
 /// @brief @copybrief components::StatisticsStorage
 
 #include <userver/components/loggable_component_base.hpp>
+#include <userver/utils/statistics/metrics_registry.hpp>
 #include <userver/utils/statistics/metrics_storage.hpp>
 #include <userver/utils/statistics/storage.hpp>
 
@@ -16,10 +17,11 @@ namespace components {
 /// @ingroup userver_components
 ///
 /// @brief Component that keeps a utils::statistics::Storage storage for
-/// metrics.
+/// metrics and a utils::statistics::MetricsRegistry of labeled metrics.
 ///
-/// Returned references to utils::statistics::Storage live for a lifetime
-/// of the component and are safe for concurrent use.
+/// Returned references to utils::statistics::Storage and
+/// utils::statistics::MetricsRegistry live for a lifetime of the component
+/// and are safe for concurrent use.
 ///
 /// The component does **not** have any options for service config.
 ///
@@ -47,12 +49,21 @@ class StatisticsStorage final : public LoggableComponentBase {
     return metrics_storage_;
   }
 
+  utils::statistics::MetricsRegistry& GetMetricsRegistry() {
+    return metrics_registry_;
+  }
+
+  const utils::statistics::MetricsRegistry& GetMetricsRegistry() const {
+    return metrics_registry_;
+  }
+
   static yaml_config::Schema GetStaticConfigSchema();
 
  private:
   utils::statistics::Storage storage_;
   utils::statistics::MetricsStoragePtr metrics_storage_;
   std::vector<utils::statistics::Entry> metrics_storage_registration_;
+  utils::statistics::MetricsRegistry metrics_registry_;
 };
 
 template <>
@@ -0,0 +1,59 @@
+#pragma once
+
+/// @file userver/server/handlers/open_metrics.hpp
+/// @brief @copybrief server::handlers::OpenMetrics
+
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that returns metrics of the
+/// utils::statistics::MetricsRegistry in the OpenMetrics text format.
+///
+/// The handler is a monitor handler, so it runs on the
+/// `components.server.listener-monitor` listener.
+///
+/// The component has no service configuration except the
+/// @ref userver_http_handlers "common handler options".
+///
+/// The handler is a part of components::CommonServerComponentList().
+///
+/// ## Static configuration example:
+///
+/// @snippet components/common_server_component_list_test.cpp  Sample handler open metrics component config
+
+// clang-format on
+class OpenMetrics final : public HttpHandlerBase {
+ public:
+  OpenMetrics(const components::ComponentConfig& config,
+              const components::ComponentContext& component_context);
+
+  static constexpr std::string_view kName = "handler-open-metrics";
+
+  std::string HandleRequestThrow(const http::HttpRequest& request,
+                                 request::RequestContext&) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::string GetResponseDataForLogging(
+      const http::HttpRequest& request, request::RequestContext& context,
+      const std::string& response_data) const override;
+
+  const utils::statistics::MetricsRegistry& metrics_registry_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool
+    components::kHasValidate<server::handlers::OpenMetrics> = true;
+
+USERVER_NAMESPACE_END
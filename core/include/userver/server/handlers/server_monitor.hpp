@@ -26,6 +26,12 @@ namespace server::handlers {
 /// ## Scheme
 /// Accepts a path argument `prefix` and pass it to
 /// utils::statistics::Storage::GetAsJson()
+///
+/// An optional argument `format` switches the output to one of the streaming
+/// formats, that do not build the whole metrics tree in memory:
+/// * `prometheus` - utils::statistics::ToPrometheusFormat()
+/// * `graphite` - utils::statistics::ToGraphiteFormat()
+/// * `json` - utils::statistics::ToJsonFormat()
 
 // clang-format on
 class ServerMonitor final : public HttpHandlerBase {
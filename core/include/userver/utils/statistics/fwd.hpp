@@ -16,6 +16,8 @@ struct StatisticsRequest;
 class MetricsStorage;
 using MetricsStoragePtr = std::shared_ptr<MetricsStorage>;
 
+class MetricsRegistry;
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
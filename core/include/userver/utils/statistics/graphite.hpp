@@ -0,0 +1,21 @@
+#pragma once
+
+/// @file userver/utils/statistics/graphite.hpp
+/// @brief Statistics output in Graphite format.
+
+#include <string>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief Returns the metrics of `storage` in the Graphite plaintext format,
+/// labels are written as Graphite tags: `path;label=value value timestamp`.
+std::string ToGraphiteFormat(const Storage& storage,
+                             const StatisticsRequest& request);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,24 @@
+#pragma once
+
+/// @file userver/utils/statistics/json.hpp
+/// @brief Statistics output in flat JSON format.
+
+#include <string>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief Returns the metrics of `storage` as a JSON array of
+/// `{"path": "a.b", "labels": {"name": "value"}, "value": 42}` objects.
+///
+/// Unlike utils::statistics::Storage::GetAsJson() the result is serialized
+/// directly without building a formats::json::Value.
+std::string ToJsonFormat(const Storage& storage,
+                         const StatisticsRequest& request);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
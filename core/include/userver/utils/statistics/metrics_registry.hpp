@@ -0,0 +1,164 @@
+#pragma once
+
+/// @file userver/utils/statistics/metrics_registry.hpp
+/// @brief @copybrief utils::statistics::MetricsRegistry
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// Label of a utils::statistics::MetricsRegistry metric
+struct Label final {
+  std::string name;
+  std::string value;
+};
+
+/// @brief Monotonic counter of utils::statistics::MetricsRegistry
+class Counter final {
+ public:
+  void Add(std::uint64_t value = 1) noexcept { value_ += value; }
+
+  std::uint64_t Load() const noexcept { return value_.Load(); }
+
+ private:
+  RelaxedCounter<std::uint64_t> value_;
+};
+
+/// @brief Gauge of utils::statistics::MetricsRegistry
+class Gauge final {
+ public:
+  void Set(std::int64_t value) noexcept { value_ = value; }
+
+  void Add(std::int64_t value = 1) noexcept { value_ += value; }
+
+  void Sub(std::int64_t value = 1) noexcept { value_ -= value; }
+
+  std::int64_t Load() const noexcept { return value_.Load(); }
+
+ private:
+  RelaxedCounter<std::int64_t> value_;
+};
+
+/// @brief Histogram of utils::statistics::MetricsRegistry with fixed buckets
+///
+/// A value is accounted in the first bucket with the upper bound that is not
+/// less than the value, larger values go to the implicit `+Inf` bucket.
+/// Buckets, count and sum of the accounted values are kept since the start of
+/// the service and are exported as an OpenMetrics histogram.
+class Histogram final {
+ public:
+  /// Upper bounds of the default buckets, suitable for timings in milliseconds
+  static const std::vector<std::uint64_t> kDefaultBounds;
+
+  /// @param bounds strictly increasing upper bounds of the buckets
+  explicit Histogram(std::vector<std::uint64_t> bounds = kDefaultBounds);
+
+  void Account(std::uint64_t value) noexcept {
+    const auto bucket =
+        std::lower_bound(bounds_.begin(), bounds_.end(), value) -
+        bounds_.begin();
+    ++buckets_[bucket];
+    sum_ += value;
+  }
+
+  /// Returns the upper bounds of the buckets, except for the `+Inf` one
+  const std::vector<std::uint64_t>& GetBounds() const noexcept {
+    return bounds_;
+  }
+
+  /// Returns the number of the values in the bucket `index`, the last index
+  /// being `GetBounds().size()` for the `+Inf` bucket
+  std::uint64_t GetBucket(std::size_t index) const noexcept {
+    return buckets_[index].Load();
+  }
+
+  std::uint64_t GetSum() const noexcept { return sum_.Load(); }
+
+ private:
+  const std::vector<std::uint64_t> bounds_;
+  const std::unique_ptr<RelaxedCounter<std::uint64_t>[]> buckets_;
+  RelaxedCounter<std::uint64_t> sum_;
+};
+
+namespace impl::registry {
+struct Family;
+}  // namespace impl::registry
+
+// clang-format off
+
+/// @brief Registry of labeled metrics, that are exported in the OpenMetrics
+/// text format by the server::handlers::OpenMetrics handler.
+///
+/// Unlike utils::statistics::Storage the registry keeps the metrics itself:
+/// every metric is identified by its name and labels, the label part of the
+/// output is rendered once at registration. Rendering of the registry takes no
+/// locks and does not allocate memory for each metric, so scraping does not
+/// affect the code that updates metrics.
+///
+/// Registration of a metric takes a lock, so store the returned references
+/// and do not call Get* methods in the hot path:
+///
+/// @snippet utils/statistics/metrics_registry_test.cpp  Sample utils::statistics::MetricsRegistry usage
+///
+/// Metric names and label names must match the `[a-zA-Z_][a-zA-Z0-9_]*`
+/// pattern. The order of the labels does not matter, they are written sorted
+/// by name. Invalid names, duplicate label names, the reserved `le` and
+/// `quantile` label names and metrics of different types with the same name
+/// are reported via UINVARIANT.
+
+// clang-format on
+class MetricsRegistry final {
+ public:
+  MetricsRegistry();
+  ~MetricsRegistry();
+
+  MetricsRegistry(const MetricsRegistry&) = delete;
+  MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+  /// Returns the counter registering it on the first call
+  Counter& GetCounter(std::string_view name, const std::vector<Label>& labels);
+
+  /// Returns the gauge registering it on the first call
+  Gauge& GetGauge(std::string_view name, const std::vector<Label>& labels);
+
+  /// Returns the histogram registering it on the first call with the
+  /// Histogram::kDefaultBounds buckets
+  Histogram& GetHistogram(std::string_view name,
+                          const std::vector<Label>& labels);
+
+  /// Returns the histogram registering it on the first call with the buckets
+  /// of `bounds`. The buckets of an already registered histogram are kept.
+  Histogram& GetHistogram(std::string_view name,
+                          const std::vector<Label>& labels,
+                          std::vector<std::uint64_t> bounds);
+
+  /// Renders all the metrics in the OpenMetrics text format
+  std::string ToOpenMetricsFormat() const;
+
+ private:
+  template <typename Metric, typename... Args>
+  Metric& GetMetric(std::string_view name, std::vector<Label> labels,
+                    Args&&... args);
+
+  engine::Mutex mutex_;
+  std::vector<std::unique_ptr<impl::registry::Family>> families_;
+  std::unordered_map<std::string, impl::registry::Family*> families_by_name_;
+  std::atomic<impl::registry::Family*> first_family_{nullptr};
+  mutable std::atomic<std::size_t> last_output_size_{0};
+};
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -93,6 +93,9 @@ class MinMaxAvg final {
   void Add(const MinMaxAvg& other,
            [[maybe_unused]] Duration this_epoch_duration = Duration(),
            [[maybe_unused]] Duration before_this_epoch_duration = Duration()) {
+    // Empty `other` would otherwise overwrite the extremes with its zeroes
+    if (!other.count_.load(std::memory_order_acquire)) return;
+
     ValueType current_minimum = minimum_.load(std::memory_order_relaxed);
     while (current_minimum > other.minimum_.load(std::memory_order_relaxed) ||
            !count_.load(std::memory_order_relaxed)) {
@@ -0,0 +1,25 @@
+#pragma once
+
+/// @file userver/utils/statistics/prometheus.hpp
+/// @brief Statistics output in Prometheus format.
+
+#include <string>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief Returns the metrics of `storage` in the Prometheus text exposition
+/// format.
+///
+/// Characters that are not allowed in Prometheus metric and label names,
+/// including dots, are replaced with underscores. Samples of a metric are
+/// grouped together after a single `# TYPE <name> untyped` line.
+std::string ToPrometheusFormat(const Storage& storage,
+                               const StatisticsRequest& request);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,214 @@
+#pragma once
+
+/// @file userver/utils/statistics/sharded.hpp
+/// @brief @copybrief utils::statistics::ShardedCounter
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// Default number of shards of utils::statistics::ShardedCounter and
+/// utils::statistics::ShardedAccumulator
+inline constexpr std::size_t kDefaultShardsCount = 16;
+
+namespace impl {
+
+// Not std::hardware_destructive_interference_size: its value depends on
+// -mtune, and this constant affects the layout of types in public headers
+inline constexpr std::size_t kCacheLineSize = 64;
+
+std::size_t AcquireThreadShardIndex() noexcept;
+
+// Each thread gets its own index on the first call, indices are assigned in a
+// round-robin manner, so that threads of a task processor get different shards
+inline std::size_t GetThreadShardIndex() noexcept {
+  constexpr auto kUnassigned = static_cast<std::size_t>(-1);
+  thread_local std::size_t index = kUnassigned;
+  if (index == kUnassigned) index = AcquireThreadShardIndex();
+  return index;
+}
+
+template <std::size_t Shards>
+std::size_t GetShardIndex() noexcept {
+  static_assert(Shards > 0, "At least one shard is required");
+  return GetThreadShardIndex() % Shards;
+}
+
+}  // namespace impl
+
+// clang-format off
+
+/// @brief Atomic counter of type T that is split into cache line sized shards
+/// to avoid contention between threads.
+///
+/// Each thread modifies its own shard, reading the counter sums the values of
+/// all the shards. Use it instead of utils::statistics::RelaxedCounter or
+/// std::atomic for counters that are modified on every request by many
+/// threads and are rarely read. Each counter occupies `Shards` cache lines.
+///
+/// @snippet utils/statistics/sharded_test.cpp  Sample utils::statistics::ShardedCounter usage
+
+// clang-format on
+template <typename T, std::size_t Shards = kDefaultShardsCount>
+class ShardedCounter final {
+  static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>,
+                "only integral value types are supported in ShardedCounter");
+  static_assert(std::atomic<T>::is_always_lock_free,
+                "refusing to use locking atomics");
+
+ public:
+  using ValueType = T;
+
+  constexpr ShardedCounter() noexcept = default;
+  ShardedCounter(T desired) noexcept { Store(desired); }
+
+  ShardedCounter(const ShardedCounter& other) noexcept { Store(other.Load()); }
+
+  // NOLINTNEXTLINE(cert-oop54-cpp)
+  ShardedCounter& operator=(const ShardedCounter& other) noexcept {
+    Store(other.Load());
+    return *this;
+  }
+
+  ShardedCounter& operator=(T desired) noexcept {
+    Store(desired);
+    return *this;
+  }
+
+  /// Sums the values of all the shards
+  T Load() const noexcept {
+    T result{0};
+    for (const auto& shard : shards_) {
+      result += shard.value.load(std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  /// Stores the value into a single shard, not atomic with respect to
+  /// concurrent modifications
+  void Store(T desired) noexcept {
+    for (auto& shard : shards_) shard.value.store(0, std::memory_order_relaxed);
+    shards_[0].value.store(desired, std::memory_order_relaxed);
+  }
+
+  operator T() const noexcept { return Load(); }
+
+  void Add(T arg) noexcept {
+    shards_[impl::GetShardIndex<Shards>()].value.fetch_add(
+        arg, std::memory_order_relaxed);
+  }
+
+  void Sub(T arg) noexcept {
+    shards_[impl::GetShardIndex<Shards>()].value.fetch_sub(
+        arg, std::memory_order_relaxed);
+  }
+
+  ShardedCounter& operator++() noexcept {
+    Add(1);
+    return *this;
+  }
+
+  void operator++(int) noexcept { Add(1); }
+
+  ShardedCounter& operator--() noexcept {
+    Sub(1);
+    return *this;
+  }
+
+  void operator--(int) noexcept { Sub(1); }
+
+  ShardedCounter& operator+=(T arg) noexcept {
+    Add(arg);
+    return *this;
+  }
+
+  ShardedCounter& operator-=(T arg) noexcept {
+    Sub(arg);
+    return *this;
+  }
+
+  void Reset() noexcept { Store(0); }
+
+ private:
+  struct alignas(impl::kCacheLineSize) Shard final {
+    std::atomic<T> value{0};
+  };
+
+  std::array<Shard, Shards> shards_{};
+};
+
+// clang-format off
+
+/// @brief Accumulator, e.g. utils::statistics::Percentile or
+/// utils::statistics::MinMaxAvg, that is split into cache line aligned shards
+/// to avoid contention between threads.
+///
+/// Account() goes to the shard of the current thread, Get() merges all the
+/// shards via `Accumulator::Add`. The sharded accumulator could be used as a
+/// Counter of utils::statistics::RecentPeriod with the plain Accumulator as
+/// a Result:
+///
+/// @snippet utils/statistics/sharded_test.cpp  Sample utils::statistics::ShardedAccumulator usage
+///
+/// Note that memory usage is multiplied by `Shards`, that matters for big
+/// accumulators like utils::statistics::Percentile with thousands of buckets.
+
+// clang-format on
+template <typename Accumulator, std::size_t Shards = kDefaultShardsCount>
+class ShardedAccumulator final {
+ public:
+  using ValueType = Accumulator;
+
+  /// Accounts the value in the shard of the current thread
+  template <typename... Args>
+  void Account(const Args&... args) {
+    GetLocal().Account(args...);
+  }
+
+  /// Returns the shard of the current thread
+  Accumulator& GetLocal() noexcept {
+    return shards_[impl::GetShardIndex<Shards>()].value;
+  }
+
+  /// Returns the sum of all the shards
+  Accumulator Get() const {
+    Accumulator result;
+    AddTo(result);
+    return result;
+  }
+
+  /// Adds all the shards to `result`
+  void AddTo(Accumulator& result) const {
+    for (const auto& shard : shards_) result.Add(shard.value);
+  }
+
+  void Reset() {
+    for (auto& shard : shards_) shard.value.Reset();
+  }
+
+ private:
+  struct alignas(impl::kCacheLineSize) Shard final {
+    Accumulator value;
+  };
+
+  std::array<Shard, Shards> shards_;
+};
+
+/// Adds all the shards of `sharded` to `result`, allows the use of
+/// utils::statistics::ShardedAccumulator as a Counter of
+/// utils::statistics::RecentPeriod.
+template <typename Accumulator, std::size_t Shards>
+Accumulator& operator+=(Accumulator& result,
+                        const ShardedAccumulator<Accumulator, Shards>& sharded) {
+  sharded.AddTo(result);
+  return result;
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/utils/clang_format_workarounds.hpp>
 #include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -23,12 +24,18 @@ struct StatisticsRequest {
 using ExtenderFunc =
     std::function<formats::json::ValueBuilder(const StatisticsRequest&)>;
 
+/// Function that streams metrics into a utils::statistics::Writer. The
+/// request is passed to let the source skip the metrics that do not match
+/// the requested prefix.
+using WriterFunc = std::function<void(Writer&, const StatisticsRequest&)>;
+
 namespace impl {
 
 struct MetricsSource final {
   std::string prefix_path;
   std::vector<std::string> path_segments;
   ExtenderFunc extender;
+  WriterFunc writer;
 };
 
 using StorageData = std::list<MetricsSource>;
@@ -45,6 +52,12 @@ class Storage final {
   // Creates new Json::Value and calls every registered extender func over it.
   formats::json::ValueBuilder GetAsJson(const StatisticsRequest& request) const;
 
+  // Passes every metric of the matching sources to `builder` without building
+  // an intermediate tree. Metrics of ExtenderFunc sources are converted by
+  // utils::statistics::DumpMetric.
+  void VisitMetrics(BaseFormatBuilder& builder,
+                    const StatisticsRequest& request) const;
+
   // Must be called from StatisticsStorage only. Don't call it from user
   // components.
   void StopRegisteringExtenders();
@@ -56,6 +69,9 @@ class Storage final {
   Entry RegisterExtender(std::initializer_list<std::string> prefix,
                          ExtenderFunc func);
 
+  // Registers a source that streams metrics under the `common_prefix` path.
+  Entry RegisterWriter(std::string common_prefix, WriterFunc func);
+
   void UnregisterExtender(impl::StorageIterator iterator) noexcept;
 
  private:
@@ -0,0 +1,142 @@
+#pragma once
+
+/// @file userver/utils/statistics/writer.hpp
+/// @brief @copybrief utils::statistics::Writer
+
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include <userver/formats/json_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// Non-owning label name+value pair
+struct LabelView final {
+  std::string_view name;
+  std::string_view value;
+};
+
+/// Value of a single metric
+using MetricValue = std::variant<std::int64_t, std::uint64_t, double>;
+
+/// @brief Base class for the output formats of utils::statistics::Writer
+///
+/// Receives metrics one by one in the order they are written.
+class BaseFormatBuilder {
+ public:
+  virtual ~BaseFormatBuilder();
+
+  /// @param path dot separated path of the metric
+  /// @param labels labels of the metric, in the order of addition
+  /// @param value value of the metric
+  virtual void HandleMetric(std::string_view path,
+                            const std::vector<LabelView>& labels,
+                            const MetricValue& value) = 0;
+};
+
+namespace impl {
+
+struct WriterState final {
+  explicit WriterState(BaseFormatBuilder& builder) : builder(builder) {}
+
+  BaseFormatBuilder& builder;
+  std::string path;
+  std::deque<std::string> label_storage;
+  std::vector<LabelView> labels;
+  const void* innermost{nullptr};
+};
+
+}  // namespace impl
+
+/// @brief Streaming writer of metrics.
+///
+/// Each metric is passed to the output format right away without building an
+/// intermediate tree, which keeps memory usage of a statistics request low.
+///
+/// Writers must be used in a stack-like manner: a child writer obtained via
+/// operator[] or ValueWithLabels() should be destroyed before its parent is
+/// used again. For the same reason do not store a writer obtained from a
+/// temporary writer: write `auto a = writer["a"]; auto b = a["b"];` instead
+/// of `auto b = writer["a"]["b"];`.
+///
+/// @snippet utils/statistics/writer_test.cpp  Sample utils::statistics::Writer usage
+class Writer final {
+ public:
+  /// Creates a root writer with an optional path prefix
+  explicit Writer(impl::WriterState& state, std::string_view path = {});
+
+  Writer(Writer&& other) = delete;
+  Writer& operator=(Writer&&) = delete;
+  ~Writer();
+
+  /// Returns a writer for the `path` subnode of the current node
+  Writer operator[](std::string_view path);
+
+  /// Returns a writer for the current node that adds `labels` to all the
+  /// metrics written through it
+  Writer WithLabels(std::initializer_list<LabelView> labels);
+
+  /// Returns a writer for the current node that adds `label` to all the
+  /// metrics written through it
+  Writer WithLabel(LabelView label);
+
+  /// Writes the current node as a metric
+  template <typename T>
+  void operator=(const T& value) {
+    Write(value);
+  }
+
+  /// Writes the current node as a metric with additional `labels`
+  template <typename T>
+  void ValueWithLabels(const T& value,
+                       std::initializer_list<LabelView> labels) {
+    WithLabels(labels).Write(value);
+  }
+
+  /// Writes a metric value. Arithmetic types are written directly, other types
+  /// are passed to a `void DumpMetric(Writer&, const T&)` function found by
+  /// ADL.
+  template <typename T>
+  void Write(const T& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+      WriteValue(static_cast<std::int64_t>(value));
+    } else if constexpr (std::is_floating_point_v<T>) {
+      WriteValue(static_cast<double>(value));
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+      WriteValue(static_cast<std::int64_t>(value));
+    } else if constexpr (std::is_integral_v<T>) {
+      WriteValue(static_cast<std::uint64_t>(value));
+    } else {
+      DumpMetric(*this, value);
+    }
+  }
+
+ private:
+  Writer(Writer& parent, std::string_view path);
+  Writer(Writer& parent, std::initializer_list<LabelView> labels);
+
+  void WriteValue(MetricValue value);
+  void CheckInnermost() const;
+
+  impl::WriterState& state_;
+  const void* const previous_innermost_;
+  const std::size_t path_size_;
+  const std::size_t labels_size_;
+};
+
+/// Writes a legacy statistics tree built by a
+/// utils::statistics::ExtenderFunc, interpreting the
+/// utils::statistics::SolomonSkip() and other metadata as labels.
+void DumpMetric(Writer& writer, const formats::json::Value& tree);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
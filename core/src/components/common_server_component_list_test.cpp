@@ -206,6 +206,13 @@ components_manager:
         task_processor: monitor-task-processor
 # /// [Sample handler dns client control component config]
 # /// [Sample handler server monitor component config]
+# /// [Sample handler open metrics component config]
+# yaml
+    handler-open-metrics:
+        path: /metrics
+        method: GET
+        task_processor: monitor-task-processor
+# /// [Sample handler open metrics component config]
 # yaml
     handler-server-monitor:
         path: /*
@@ -539,10 +539,11 @@ void HttpHandlerBase::CheckRatelimit(
     throw ExceptionWithCode<HandlerErrorCode::kTooManyRequests>();
   }
 
-  auto max_requests_in_flight = GetConfig().max_requests_in_flight;
-  auto requests_in_flight = statistics.GetInFlight();
+  // Summing up the sharded in-flight counter is not free, so it is only done
+  // when the limit is actually configured
+  const auto& max_requests_in_flight = GetConfig().max_requests_in_flight;
   if (max_requests_in_flight &&
-      (requests_in_flight > *max_requests_in_flight)) {
+      (statistics.GetInFlight() > *max_requests_in_flight)) {
     tracing::SetThrottleReason(fmt::format("reached max_requests_in_flight={}",
                                            *max_requests_in_flight));
     statistics.IncrementTooManyRequestsInFlight();
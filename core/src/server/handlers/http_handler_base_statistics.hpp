@@ -11,13 +11,20 @@
 #include <userver/utils/statistics/http_codes.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/sharded.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server {
 namespace handlers {
 
-class HttpHandlerMethodStatistics final {
+/// Statistics of a handler method. TimingsCounter is the counter of
+/// utils::statistics::RecentPeriod, e.g. Percentile or
+/// utils::statistics::ShardedAccumulator<Percentile> to avoid contention
+/// between threads at the cost of memory. InFlightCounter is an atomic-like
+/// counter, e.g. std::atomic or utils::statistics::ShardedCounter.
+template <typename TimingsCounter, typename InFlightCounter>
+class BasicHttpHandlerMethodStatistics {
  public:
   void Account(unsigned int code, size_t ms) {
     reply_codes_.Account(code);
@@ -49,15 +56,23 @@ class HttpHandlerMethodStatistics final {
   size_t GetRateLimitReached() const { return rate_limit_reached_; }
 
  private:
-  utils::statistics::RecentPeriod<Percentile, Percentile,
+  utils::statistics::RecentPeriod<TimingsCounter, Percentile,
                                   utils::datetime::SteadyClock>
       timings_;
   utils::statistics::HttpCodes reply_codes_{400, 401, 499, 500};
-  std::atomic<size_t> in_flight_{0};
+  InFlightCounter in_flight_{0};
   std::atomic<size_t> too_many_requests_in_flight_{0};
   std::atomic<size_t> rate_limit_reached_{0};
 };
 
+// In-flight counter is modified twice per request by all the threads, so it
+// is sharded. Sharded timings would take Shards times more memory for each
+// of the RecentPeriod epochs of each method, so they are not.
+class HttpHandlerMethodStatistics final
+    : public BasicHttpHandlerMethodStatistics<
+          utils::statistics::Percentile<2048, unsigned int, 120>,
+          utils::statistics::ShardedCounter<size_t>> {};
+
 class HttpHandlerStatistics final {
  public:
   HttpHandlerMethodStatistics& GetStatisticByMethod(http::HttpMethod method);
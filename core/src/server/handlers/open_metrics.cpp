@@ -0,0 +1,48 @@
+#include <userver/server/handlers/open_metrics.hpp>
+
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/http/content_type.hpp>
+#include <userver/utils/statistics/metrics_registry.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+const USERVER_NAMESPACE::http::ContentType kOpenMetricsContentType =
+    "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+}  // namespace
+
+OpenMetrics::OpenMetrics(const components::ComponentConfig& config,
+                         const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context, /*is_monitor = */ true),
+      metrics_registry_(
+          component_context.FindComponent<components::StatisticsStorage>()
+              .GetMetricsRegistry()) {}
+
+std::string OpenMetrics::HandleRequestThrow(const http::HttpRequest& request,
+                                            request::RequestContext&) const {
+  request.GetHttpResponse().SetContentType(kOpenMetricsContentType);
+  return metrics_registry_.ToOpenMetricsFormat();
+}
+
+std::string OpenMetrics::GetResponseDataForLogging(const http::HttpRequest&,
+                                                   request::RequestContext&,
+                                                   const std::string&) const {
+  // Useless data for logs, no need to duplicate metrics in logs
+  return "<statistics data>";
+}
+
+yaml_config::Schema OpenMetrics::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("handler-open-metrics config");
+  return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
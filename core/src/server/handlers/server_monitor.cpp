@@ -3,8 +3,13 @@
 #include <userver/components/component_context.hpp>
 #include <userver/components/statistics_storage.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/http/content_type.hpp>
+#include <userver/server/handlers/exceptions.hpp>
 #include <userver/yaml_config/schema.hpp>
 
+#include <userver/utils/statistics/graphite.hpp>
+#include <userver/utils/statistics/json.hpp>
+#include <userver/utils/statistics/prometheus.hpp>
 #include <userver/utils/statistics/storage.hpp>
 #include <utils/statistics/value_builder_helpers.hpp>
 
@@ -12,6 +17,12 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::handlers {
 
+namespace {
+
+const std::string kFormatArg = "format";
+
+}  // namespace
+
 ServerMonitor::ServerMonitor(
     const components::ComponentConfig& config,
     const components::ComponentContext& component_context)
@@ -24,6 +35,31 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
                                               request::RequestContext&) const {
   utils::statistics::StatisticsRequest statistics_request;
   statistics_request.prefix = request.GetArg("prefix");
+
+  const auto& format = request.GetArg(kFormatArg);
+  if (!format.empty()) {
+    auto& response = request.GetHttpResponse();
+    if (format == "prometheus") {
+      response.SetContentType(
+          USERVER_NAMESPACE::http::content_type::kTextPlain);
+      return utils::statistics::ToPrometheusFormat(statistics_storage_,
+                                                   statistics_request);
+    } else if (format == "graphite") {
+      response.SetContentType(
+          USERVER_NAMESPACE::http::content_type::kTextPlain);
+      return utils::statistics::ToGraphiteFormat(statistics_storage_,
+                                                 statistics_request);
+    } else if (format == "json") {
+      response.SetContentType(
+          USERVER_NAMESPACE::http::content_type::kApplicationJson);
+      return utils::statistics::ToJsonFormat(statistics_storage_,
+                                             statistics_request);
+    }
+
+    std::string message = "unknown statistics format: " + format;
+    throw ClientError(InternalMessage{message}, ExternalBody{message});
+  }
+
   formats::json::ValueBuilder monitor_data =
       statistics_storage_.GetAsJson(statistics_request);
 
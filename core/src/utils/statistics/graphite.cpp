@@ -0,0 +1,76 @@
+#include <userver/utils/statistics/graphite.hpp>
+
+#include <iterator>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+// Same as in utils::graphite::EscapeName, except for '=' reserved for tags
+bool IsPrintable(char c) {
+  if (c == '-' || c == '_' || c == ':' || c == '/' || c == '[' || c == ']' ||
+      c == '(' || c == ')' || c == '"' || c == '?') {
+    return true;
+  }
+  if ('a' <= c && c <= 'z') return true;
+  if ('A' <= c && c <= 'Z') return true;
+  if ('0' <= c && c <= '9') return true;
+
+  return false;
+}
+
+class FormatBuilder final : public BaseFormatBuilder {
+ public:
+  explicit FormatBuilder(std::time_t timestamp) : timestamp_(timestamp) {}
+
+  void HandleMetric(std::string_view path, const std::vector<LabelView>& labels,
+                    const MetricValue& value) override {
+    AppendEscaped(path, /*allow_dots=*/true);
+    for (const auto& label : labels) {
+      buf_.push_back(';');
+      AppendEscaped(label.name, /*allow_dots=*/false);
+      buf_.push_back('=');
+      AppendEscaped(label.value, /*allow_dots=*/true);
+    }
+
+    std::visit(
+        [this](auto x) {
+          fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {} {}\n"), x,
+                         timestamp_);
+        },
+        value);
+  }
+
+  std::string Release() { return fmt::to_string(buf_); }
+
+ private:
+  void AppendEscaped(std::string_view s, bool allow_dots) {
+    for (const char c : s) {
+      buf_.push_back(IsPrintable(c) || (allow_dots && c == '.') ? c : '_');
+    }
+  }
+
+  const std::time_t timestamp_;
+  fmt::memory_buffer buf_;
+};
+
+}  // namespace
+
+std::string ToGraphiteFormat(const Storage& storage,
+                             const StatisticsRequest& request) {
+  FormatBuilder builder{utils::datetime::Timestamp()};
+  storage.VisitMetrics(builder, request);
+  return builder.Release();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
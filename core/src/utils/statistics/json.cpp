@@ -0,0 +1,58 @@
+#include <userver/utils/statistics/json.hpp>
+
+#include <optional>
+
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+class FormatBuilder final : public BaseFormatBuilder {
+ public:
+  FormatBuilder() : guard_(sb_) {}
+
+  void HandleMetric(std::string_view path, const std::vector<LabelView>& labels,
+                    const MetricValue& value) override {
+    formats::json::StringBuilder::ObjectGuard guard{sb_};
+    sb_.Key("path");
+    sb_.WriteString(path);
+
+    if (!labels.empty()) {
+      sb_.Key("labels");
+      formats::json::StringBuilder::ObjectGuard labels_guard{sb_};
+      for (const auto& label : labels) {
+        sb_.Key(label.name);
+        sb_.WriteString(label.value);
+      }
+    }
+
+    sb_.Key("value");
+    std::visit([this](auto x) { WriteToStream(x, sb_); }, value);
+  }
+
+  std::string Release() {
+    guard_.reset();
+    return sb_.GetString();
+  }
+
+ private:
+  formats::json::StringBuilder sb_;
+  std::optional<formats::json::StringBuilder::ArrayGuard> guard_;
+};
+
+}  // namespace
+
+std::string ToJsonFormat(const Storage& storage,
+                         const StatisticsRequest& request) {
+  FormatBuilder builder;
+  storage.VisitMetrics(builder, request);
+  return builder.Release();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
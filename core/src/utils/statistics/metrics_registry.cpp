@@ -0,0 +1,356 @@
+#include <userver/utils/statistics/metrics_registry.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl::registry {
+
+namespace {
+
+bool IsValidName(std::string_view name) {
+  if (name.empty()) return false;
+  const auto is_alpha = [](char c) {
+    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
+  };
+  if (!is_alpha(name.front())) return false;
+  for (const char c : name) {
+    if (!is_alpha(c) && !('0' <= c && c <= '9')) return false;
+  }
+  return true;
+}
+
+void AppendEscapedLabelValue(std::string& out, std::string_view value) {
+  for (const char c : value) {
+    switch (c) {
+      case '\\':
+        out += "\\\\";
+        break;
+      case '"':
+        out += "\\\"";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      default:
+        out += c;
+    }
+  }
+}
+
+void AppendLabel(std::string& out, std::string_view name,
+                 std::string_view value) {
+  out += out.back() == '{' ? "" : ",";
+  out += name;
+  out += "=\"";
+  AppendEscapedLabelValue(out, value);
+  out += '"';
+}
+
+// Renders `name{label="value",...} `
+std::string RenderSeriesPrefix(std::string_view name,
+                               const std::vector<Label>& labels,
+                               std::optional<Label> extra_label = {}) {
+  std::string result{name};
+  if (!labels.empty() || extra_label) {
+    result += '{';
+    for (const auto& label : labels) {
+      AppendLabel(result, label.name, label.value);
+    }
+    if (extra_label) AppendLabel(result, extra_label->name, extra_label->value);
+    result += '}';
+  }
+  result += ' ';
+  return result;
+}
+
+// Sorts the labels by name, so that the order of the labels does not create
+// separate series
+void NormalizeLabels(std::string_view name, std::vector<Label>& labels) {
+  std::sort(labels.begin(), labels.end(),
+            [](const Label& lhs, const Label& rhs) {
+              return lhs.name < rhs.name;
+            });
+  for (std::size_t i = 0; i < labels.size(); ++i) {
+    const auto& label_name = labels[i].name;
+    UINVARIANT(IsValidName(label_name),
+               fmt::format("Invalid label name '{}' of metric '{}'",
+                           label_name, name));
+    UINVARIANT(label_name != "le" && label_name != "quantile",
+               fmt::format("Reserved label name '{}' of metric '{}'",
+                           label_name, name));
+    UINVARIANT(i == 0 || labels[i - 1].name != label_name,
+               fmt::format("Duplicate label name '{}' of metric '{}'",
+                           label_name, name));
+  }
+}
+
+}  // namespace
+
+enum class Type { kCounter, kGauge, kHistogram };
+
+class SeriesBase {
+ public:
+  virtual ~SeriesBase() = default;
+
+  virtual void Render(std::string& out) const = 0;
+
+  std::atomic<SeriesBase*> next{nullptr};
+};
+
+namespace {
+
+template <typename Metric>
+class Series;
+
+template <>
+class Series<Counter> final : public SeriesBase {
+ public:
+  Series(std::string_view name, const std::vector<Label>& labels)
+      : prefix_(RenderSeriesPrefix(std::string{name} + "_total", labels)) {}
+
+  void Render(std::string& out) const override {
+    out += prefix_;
+    fmt::format_to(std::back_inserter(out), FMT_COMPILE("{}\n"),
+                   metric.Load());
+  }
+
+  Counter metric;
+
+ private:
+  const std::string prefix_;
+};
+
+template <>
+class Series<Gauge> final : public SeriesBase {
+ public:
+  Series(std::string_view name, const std::vector<Label>& labels)
+      : prefix_(RenderSeriesPrefix(name, labels)) {}
+
+  void Render(std::string& out) const override {
+    out += prefix_;
+    fmt::format_to(std::back_inserter(out), FMT_COMPILE("{}\n"),
+                   metric.Load());
+  }
+
+  Gauge metric;
+
+ private:
+  const std::string prefix_;
+};
+
+template <>
+class Series<Histogram> final : public SeriesBase {
+ public:
+  Series(std::string_view name, const std::vector<Label>& labels,
+         std::vector<std::uint64_t> bounds = Histogram::kDefaultBounds)
+      : metric(std::move(bounds)),
+        sum_prefix_(RenderSeriesPrefix(std::string{name} + "_sum", labels)),
+        count_prefix_(
+            RenderSeriesPrefix(std::string{name} + "_count", labels)) {
+    const auto bucket_name = std::string{name} + "_bucket";
+    const auto& metric_bounds = metric.GetBounds();
+    bucket_prefixes_.reserve(metric_bounds.size() + 1);
+    for (const auto bound : metric_bounds) {
+      bucket_prefixes_.push_back(RenderSeriesPrefix(
+          bucket_name, labels, Label{"le", std::to_string(bound)}));
+    }
+    bucket_prefixes_.push_back(
+        RenderSeriesPrefix(bucket_name, labels, Label{"le", "+Inf"}));
+  }
+
+  void Render(std::string& out) const override {
+    // Buckets are cumulative in the output
+    std::uint64_t count = 0;
+    for (std::size_t i = 0; i < bucket_prefixes_.size(); ++i) {
+      count += metric.GetBucket(i);
+      out += bucket_prefixes_[i];
+      fmt::format_to(std::back_inserter(out), FMT_COMPILE("{}\n"), count);
+    }
+    out += sum_prefix_;
+    fmt::format_to(std::back_inserter(out), FMT_COMPILE("{}\n"),
+                   metric.GetSum());
+    out += count_prefix_;
+    fmt::format_to(std::back_inserter(out), FMT_COMPILE("{}\n"), count);
+  }
+
+  Histogram metric;
+
+ private:
+  std::vector<std::string> bucket_prefixes_;
+  const std::string sum_prefix_;
+  const std::string count_prefix_;
+};
+
+template <typename Metric>
+constexpr Type kType = Type::kCounter;
+
+template <>
+constexpr Type kType<Gauge> = Type::kGauge;
+
+template <>
+constexpr Type kType<Histogram> = Type::kHistogram;
+
+std::string_view ToString(Type type) {
+  switch (type) {
+    case Type::kCounter:
+      return "counter";
+    case Type::kGauge:
+      return "gauge";
+    case Type::kHistogram:
+      return "histogram";
+  }
+  UINVARIANT(false, "Unexpected metric type");
+}
+
+}  // namespace
+
+struct Family final {
+  Family(std::string_view name, Type type)
+      : type(type),
+        header(fmt::format("# TYPE {} {}\n", name, ToString(type))) {}
+
+  const Type type;
+  const std::string header;
+
+  // guarded by MetricsRegistry::mutex_
+  std::vector<std::unique_ptr<SeriesBase>> series;
+  std::unordered_map<std::string, SeriesBase*> series_by_labels;
+
+  std::atomic<SeriesBase*> first_series{nullptr};
+  std::atomic<Family*> next{nullptr};
+};
+
+}  // namespace impl::registry
+
+const std::vector<std::uint64_t> Histogram::kDefaultBounds{
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000};
+
+Histogram::Histogram(std::vector<std::uint64_t> bounds)
+    : bounds_(std::move(bounds)),
+      buckets_(std::make_unique<RelaxedCounter<std::uint64_t>[]>(
+          bounds_.size() + 1)) {
+  UINVARIANT(std::adjacent_find(bounds_.begin(), bounds_.end(),
+                                std::greater_equal<>{}) == bounds_.end(),
+             "Histogram bounds must be strictly increasing");
+}
+
+MetricsRegistry::MetricsRegistry() = default;
+
+MetricsRegistry::~MetricsRegistry() = default;
+
+Counter& MetricsRegistry::GetCounter(std::string_view name,
+                                     const std::vector<Label>& labels) {
+  return GetMetric<Counter>(name, labels);
+}
+
+Gauge& MetricsRegistry::GetGauge(std::string_view name,
+                                 const std::vector<Label>& labels) {
+  return GetMetric<Gauge>(name, labels);
+}
+
+Histogram& MetricsRegistry::GetHistogram(std::string_view name,
+                                         const std::vector<Label>& labels) {
+  return GetMetric<Histogram>(name, labels);
+}
+
+Histogram& MetricsRegistry::GetHistogram(std::string_view name,
+                                         const std::vector<Label>& labels,
+                                         std::vector<std::uint64_t> bounds) {
+  return GetMetric<Histogram>(name, labels, std::move(bounds));
+}
+
+template <typename Metric, typename... Args>
+Metric& MetricsRegistry::GetMetric(std::string_view name,
+                                   std::vector<Label> labels, Args&&... args) {
+  using impl::registry::Family;
+  using impl::registry::Series;
+
+  UINVARIANT(impl::registry::IsValidName(name),
+             fmt::format("Invalid metric name '{}'", name));
+  impl::registry::NormalizeLabels(name, labels);
+  auto labels_key = impl::registry::RenderSeriesPrefix({}, labels);
+
+  std::lock_guard lock(mutex_);
+
+  auto family_it = families_by_name_.find(std::string{name});
+  Family* family = nullptr;
+  if (family_it != families_by_name_.end()) {
+    family = family_it->second;
+    UINVARIANT(family->type == impl::registry::kType<Metric>,
+               fmt::format("Metric '{}' is already registered with a "
+                           "different type",
+                           name));
+
+    const auto series_it = family->series_by_labels.find(labels_key);
+    if (series_it != family->series_by_labels.end()) {
+      return static_cast<Series<Metric>&>(*series_it->second).metric;
+    }
+  } else {
+    families_.push_back(
+        std::make_unique<Family>(name, impl::registry::kType<Metric>));
+    family = families_.back().get();
+    families_by_name_.emplace(std::string{name}, family);
+  }
+
+  auto series = std::make_unique<Series<Metric>>(
+      name, labels, std::forward<Args>(args)...);
+  auto& metric = series->metric;
+  family->series_by_labels.emplace(std::move(labels_key), series.get());
+  if (family->series.empty()) {
+    family->first_series.store(series.get(), std::memory_order_release);
+  } else {
+    family->series.back()->next.store(series.get(), std::memory_order_release);
+  }
+  family->series.push_back(std::move(series));
+
+  // Publish the family only after its first series is linked, so that readers
+  // never see empty families
+  if (family->series.size() == 1) {
+    if (families_.size() == 1) {
+      first_family_.store(family, std::memory_order_release);
+    } else {
+      families_[families_.size() - 2]->next.store(family,
+                                                  std::memory_order_release);
+    }
+  }
+
+  return metric;
+}
+
+std::string MetricsRegistry::ToOpenMetricsFormat() const {
+  std::string result;
+  // Reserving a bit more than the last time avoids reallocations in the
+  // common case of a stable set of metrics
+  const auto last_size = last_output_size_.load(std::memory_order_relaxed);
+  result.reserve(last_size + last_size / 8);
+
+  for (const auto* family = first_family_.load(std::memory_order_acquire);
+       family; family = family->next.load(std::memory_order_acquire)) {
+    result += family->header;
+    for (const auto* series =
+             family->first_series.load(std::memory_order_acquire);
+         series; series = series->next.load(std::memory_order_acquire)) {
+      series->Render(result);
+    }
+  }
+  result += "# EOF\n";
+
+  last_output_size_.store(result.size(), std::memory_order_relaxed);
+  return result;
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,116 @@
+#include <userver/utils/statistics/metrics_registry.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(MetricsRegistry, Sample) {
+  /// [Sample utils::statistics::MetricsRegistry usage]
+  utils::statistics::MetricsRegistry registry;
+
+  auto& requests =
+      registry.GetCounter("requests", {{"handler", "ping"}, {"code", "200"}});
+  auto& in_flight = registry.GetGauge("in_flight", {{"handler", "ping"}});
+  auto& timings = registry.GetHistogram("timings_ms", {{"handler", "ping"}});
+
+  // Hot path
+  in_flight.Add();
+  requests.Add();
+  timings.Account(5);
+  in_flight.Sub();
+  /// [Sample utils::statistics::MetricsRegistry usage]
+
+  EXPECT_EQ(registry.ToOpenMetricsFormat(),
+            "# TYPE requests counter\n"
+            "requests_total{code=\"200\",handler=\"ping\"} 1\n"
+            "# TYPE in_flight gauge\n"
+            "in_flight{handler=\"ping\"} 0\n"
+            "# TYPE timings_ms histogram\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"1\"} 0\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"2\"} 0\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"5\"} 1\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"10\"} 1\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"20\"} 1\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"50\"} 1\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"100\"} 1\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"200\"} 1\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"500\"} 1\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"1000\"} 1\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"2000\"} 1\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"5000\"} 1\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"10000\"} 1\n"
+            "timings_ms_bucket{handler=\"ping\",le=\"+Inf\"} 1\n"
+            "timings_ms_sum{handler=\"ping\"} 5\n"
+            "timings_ms_count{handler=\"ping\"} 1\n"
+            "# EOF\n");
+}
+
+UTEST(MetricsRegistry, HistogramBuckets) {
+  utils::statistics::MetricsRegistry registry;
+  auto& histogram = registry.GetHistogram("sizes", {}, {10, 100});
+  EXPECT_EQ(&histogram, &registry.GetHistogram("sizes", {}));
+
+  for (const auto value : {0, 10, 11, 100, 101, 1000}) {
+    histogram.Account(value);
+  }
+  EXPECT_EQ(registry.ToOpenMetricsFormat(),
+            "# TYPE sizes histogram\n"
+            "sizes_bucket{le=\"10\"} 2\n"
+            "sizes_bucket{le=\"100\"} 4\n"
+            "sizes_bucket{le=\"+Inf\"} 6\n"
+            "sizes_sum 1222\n"
+            "sizes_count 6\n"
+            "# EOF\n");
+
+  const std::vector<std::uint64_t> bad_bounds{10, 10};
+  EXPECT_UINVARIANT_FAILURE(
+      registry.GetHistogram("bad_bounds", {}, bad_bounds));
+}
+
+UTEST(MetricsRegistry, Labels) {
+  utils::statistics::MetricsRegistry registry;
+
+  auto& counter = registry.GetCounter("requests", {{"a", "1"}, {"b", "2"}});
+  EXPECT_EQ(&counter,
+            &registry.GetCounter("requests", {{"b", "2"}, {"a", "1"}}));
+
+  using Labels = std::vector<utils::statistics::Label>;
+  const Labels duplicate{{"a", "1"}, {"a", "2"}};
+  EXPECT_UINVARIANT_FAILURE(registry.GetCounter("requests", duplicate));
+  const Labels quantile{{"quantile", "0.5"}};
+  EXPECT_UINVARIANT_FAILURE(registry.GetGauge("load", quantile));
+  const Labels le{{"le", "1"}};
+  EXPECT_UINVARIANT_FAILURE(registry.GetGauge("load", le));
+  const Labels invalid{{"bad-name", "1"}};
+  EXPECT_UINVARIANT_FAILURE(registry.GetGauge("load", invalid));
+}
+
+UTEST(MetricsRegistry, SeriesAreGroupedByName) {
+  utils::statistics::MetricsRegistry registry;
+
+  auto& first = registry.GetCounter("errors", {{"kind", "a"}});
+  registry.GetGauge("connections", {}).Set(-3);
+  auto& second = registry.GetCounter("errors", {{"kind", "b\"\\\n"}});
+  EXPECT_NE(&first, &second);
+  EXPECT_EQ(&first, &registry.GetCounter("errors", {{"kind", "a"}}));
+
+  first.Add(2);
+  second.Add(3);
+  EXPECT_EQ(registry.ToOpenMetricsFormat(),
+            "# TYPE errors counter\n"
+            "errors_total{kind=\"a\"} 2\n"
+            "errors_total{kind=\"b\\\"\\\\\\n\"} 3\n"
+            "# TYPE connections gauge\n"
+            "connections -3\n"
+            "# EOF\n");
+}
+
+UTEST(MetricsRegistry, Empty) {
+  const utils::statistics::MetricsRegistry registry;
+  EXPECT_EQ(registry.ToOpenMetricsFormat(), "# EOF\n");
+}
+
+USERVER_NAMESPACE_END
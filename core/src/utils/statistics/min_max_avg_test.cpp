@@ -47,6 +47,12 @@ TEST(MinMaxAvg, Add) {
   CheckCurrent(mma, 0, 4, 2);
 }
 
+TEST(MinMaxAvg, AddEmpty) {
+  auto mma = GetFilledMma<1, 3>();
+  mma.Add(utils::statistics::MinMaxAvg<int>{});
+  CheckCurrent(mma, 1, 3, 2);
+}
+
 TEST(MinMaxAvg, Reset) {
   auto mma = GetFilledMma<1>();
   CheckCurrent(mma, 1, 1, 1);
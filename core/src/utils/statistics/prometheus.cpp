@@ -0,0 +1,148 @@
+#include <userver/utils/statistics/prometheus.hpp>
+
+#include <cmath>
+#include <iterator>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+bool IsAlpha(char c) {
+  return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
+}
+
+bool IsAlnum(char c) { return IsAlpha(c) || ('0' <= c && c <= '9'); }
+
+// Samples of a metric must be contiguous and preceded by a single TYPE line,
+// while different sources may write samples of the same metric. The samples
+// are grouped by the metric name and written in the order of the first
+// appearance of the name.
+class FormatBuilder final : public BaseFormatBuilder {
+ public:
+  void HandleMetric(std::string_view path, const std::vector<LabelView>& labels,
+                    const MetricValue& value) override {
+    name_.clear();
+    AppendName(name_, path, /*allow_colon=*/true);
+    auto [it, inserted] = family_indices_.try_emplace(name_, families_.size());
+    if (inserted) families_.push_back(Family{name_, {}});
+    auto& out = families_[it->second].samples;
+
+    out += name_;
+    if (!labels.empty()) {
+      out.push_back('{');
+      bool first = true;
+      for (const auto& label : labels) {
+        if (!first) out.push_back(',');
+        first = false;
+        AppendName(out, label.name, /*allow_colon=*/false);
+        out.push_back('=');
+        AppendLabelValue(out, label.value);
+      }
+      out.push_back('}');
+    }
+
+    out.push_back(' ');
+    std::visit(utils::Overloaded{[&out](double x) { AppendDouble(out, x); },
+                                 [&out](auto x) {
+                                   fmt::format_to(std::back_inserter(out),
+                                                  FMT_COMPILE("{}"), x);
+                                 }},
+               value);
+    out.push_back('\n');
+  }
+
+  std::string Release() {
+    std::size_t size = 0;
+    for (const auto& family : families_) {
+      size += kTypePrefix.size() + family.name.size() + kTypeSuffix.size() +
+              family.samples.size();
+    }
+
+    std::string result;
+    result.reserve(size);
+    for (const auto& family : families_) {
+      result += kTypePrefix;
+      result += family.name;
+      result += kTypeSuffix;
+      result += family.samples;
+    }
+    return result;
+  }
+
+ private:
+  struct Family {
+    std::string name;
+    std::string samples;
+  };
+
+  // The kind of the metrics is unknown to the writer
+  static constexpr std::string_view kTypePrefix = "# TYPE ";
+  static constexpr std::string_view kTypeSuffix = " untyped\n";
+
+  static void AppendName(std::string& out, std::string_view name,
+                         bool allow_colon) {
+    if (name.empty() || !IsAlpha(name.front())) out.push_back('_');
+
+    for (const char c : name) {
+      out.push_back(IsAlnum(c) || (allow_colon && c == ':') ? c : '_');
+    }
+  }
+
+  static void AppendLabelValue(std::string& out, std::string_view value) {
+    out.push_back('"');
+    for (const char c : value) {
+      switch (c) {
+        case '\\':
+          out += "\\\\";
+          break;
+        case '"':
+          out += "\\\"";
+          break;
+        case '\n':
+          out += "\\n";
+          break;
+        default:
+          out.push_back(c);
+      }
+    }
+    out.push_back('"');
+  }
+
+  static void AppendDouble(std::string& out, double x) {
+    if (std::isnan(x)) {
+      out += "NaN";
+    } else if (std::isinf(x)) {
+      out += x > 0 ? "+Inf" : "-Inf";
+    } else {
+      fmt::format_to(std::back_inserter(out), FMT_COMPILE("{}"), x);
+    }
+  }
+
+  std::string name_;
+  std::unordered_map<std::string, std::size_t> family_indices_;
+  std::vector<Family> families_;
+};
+
+}  // namespace
+
+std::string ToPrometheusFormat(const Storage& storage,
+                               const StatisticsRequest& request) {
+  FormatBuilder builder;
+  storage.VisitMetrics(builder, request);
+  return builder.Release();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <userver/utils/statistics/min_max_avg.hpp>
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/sharded.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Percentile = utils::statistics::Percentile<2048, std::uint32_t, 120>;
+using MinMaxAvg = utils::statistics::MinMaxAvg<std::uint32_t>;
+
+// Shared between the benchmark threads
+utils::statistics::RelaxedCounter<std::uint64_t> relaxed_counter;
+utils::statistics::ShardedCounter<std::uint64_t> sharded_counter;
+Percentile percentile;
+utils::statistics::ShardedAccumulator<Percentile> sharded_percentile;
+MinMaxAvg min_max_avg;
+utils::statistics::ShardedAccumulator<MinMaxAvg> sharded_min_max_avg;
+
+}  // namespace
+
+template <typename Counter>
+void ContendedIncrement(benchmark::State& state, Counter& counter) {
+  for (auto _ : state) {
+    ++counter;
+  }
+}
+
+void statistics_contended_relaxed_counter(benchmark::State& state) {
+  ContendedIncrement(state, relaxed_counter);
+}
+BENCHMARK(statistics_contended_relaxed_counter)
+    ->RangeMultiplier(2)
+    ->ThreadRange(1, 64);
+
+void statistics_contended_sharded_counter(benchmark::State& state) {
+  ContendedIncrement(state, sharded_counter);
+}
+BENCHMARK(statistics_contended_sharded_counter)
+    ->RangeMultiplier(2)
+    ->ThreadRange(1, 64);
+
+template <typename Accumulator>
+void ContendedAccount(benchmark::State& state, Accumulator& accumulator) {
+  // Most of the values hit the same buckets, like timings of a fast handler
+  std::uint32_t value = 0;
+  for (auto _ : state) {
+    accumulator.Account(value++ % 4);
+  }
+}
+
+void statistics_contended_percentile(benchmark::State& state) {
+  ContendedAccount(state, percentile);
+}
+BENCHMARK(statistics_contended_percentile)
+    ->RangeMultiplier(2)
+    ->ThreadRange(1, 64);
+
+void statistics_contended_sharded_percentile(benchmark::State& state) {
+  ContendedAccount(state, sharded_percentile);
+}
+BENCHMARK(statistics_contended_sharded_percentile)
+    ->RangeMultiplier(2)
+    ->ThreadRange(1, 64);
+
+void statistics_contended_min_max_avg(benchmark::State& state) {
+  ContendedAccount(state, min_max_avg);
+}
+BENCHMARK(statistics_contended_min_max_avg)
+    ->RangeMultiplier(2)
+    ->ThreadRange(1, 64);
+
+void statistics_contended_sharded_min_max_avg(benchmark::State& state) {
+  ContendedAccount(state, sharded_min_max_avg);
+}
+BENCHMARK(statistics_contended_sharded_min_max_avg)
+    ->RangeMultiplier(2)
+    ->ThreadRange(1, 64);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,124 @@
+#include <userver/utils/statistics/sharded.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/min_max_avg.hpp>
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kThreads = 8;
+constexpr std::size_t kIterations = 10000;
+
+template <typename Func>
+void RunInThreads(Func func) {
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < kThreads; ++i) threads.emplace_back(func);
+  for (auto& thread : threads) thread.join();
+}
+
+}  // namespace
+
+TEST(ShardedCounter, Sample) {
+  /// [Sample utils::statistics::ShardedCounter usage]
+  utils::statistics::ShardedCounter<std::size_t> in_flight;
+
+  ++in_flight;
+  in_flight += 2;
+  --in_flight;
+  EXPECT_EQ(in_flight.Load(), 2);
+  /// [Sample utils::statistics::ShardedCounter usage]
+}
+
+TEST(ShardedCounter, Concurrent) {
+  utils::statistics::ShardedCounter<std::uint64_t> counter;
+  utils::statistics::ShardedCounter<std::int64_t> gauge;
+
+  RunInThreads([&] {
+    for (std::size_t i = 0; i < kIterations; ++i) {
+      ++counter;
+      ++gauge;
+      --gauge;
+    }
+    --gauge;
+  });
+
+  EXPECT_EQ(counter.Load(), kThreads * kIterations);
+  EXPECT_EQ(gauge.Load(), -static_cast<std::int64_t>(kThreads));
+}
+
+TEST(ShardedCounter, StoreAndReset) {
+  utils::statistics::ShardedCounter<std::uint32_t, 4> counter;
+  counter = 10;
+  counter.Add(5);
+  const auto copy = counter;
+  EXPECT_EQ(copy.Load(), 15);
+
+  counter.Reset();
+  EXPECT_EQ(counter.Load(), 0);
+  EXPECT_EQ(copy.Load(), 15);
+}
+
+TEST(ShardedAccumulator, Sample) {
+  /// [Sample utils::statistics::ShardedAccumulator usage]
+  using Percentile = utils::statistics::Percentile<100>;
+  using ShardedPercentile = utils::statistics::ShardedAccumulator<Percentile>;
+
+  utils::statistics::RecentPeriod<ShardedPercentile, Percentile,
+                                  utils::datetime::SteadyClock>
+      timings;
+
+  timings.GetCurrentCounter().Account(42);
+
+  const Percentile result = timings.GetCurrentCounter().Get();
+  EXPECT_EQ(result.GetPercentile(100), 42);
+  /// [Sample utils::statistics::ShardedAccumulator usage]
+}
+
+TEST(ShardedAccumulator, ConcurrentPercentile) {
+  utils::statistics::ShardedAccumulator<utils::statistics::Percentile<100>>
+      percentile;
+
+  RunInThreads([&] {
+    for (std::size_t i = 0; i < kIterations; ++i) percentile.Account(i % 100);
+  });
+
+  const auto result = percentile.Get();
+  EXPECT_EQ(result.Count(), kThreads * kIterations);
+  EXPECT_EQ(result.GetPercentile(50), 50);
+  EXPECT_EQ(result.GetPercentile(100), 99);
+
+  percentile.Reset();
+  EXPECT_EQ(percentile.Get().Count(), 0);
+}
+
+TEST(ShardedAccumulator, MinMaxAvg) {
+  using MinMaxAvg = utils::statistics::MinMaxAvg<int>;
+  utils::statistics::ShardedAccumulator<MinMaxAvg, 4> mma;
+
+  RunInThreads([&] {
+    for (int i = 1; i <= 3; ++i) mma.Account(i);
+  });
+
+  // Shards that were not used must not affect the minimum
+  const auto current = mma.Get().GetCurrent();
+  EXPECT_EQ(current.minimum, 1);
+  EXPECT_EQ(current.maximum, 3);
+  EXPECT_EQ(current.average, 2);
+
+  MinMaxAvg result;
+  result.Account(5);
+  result += mma;
+  EXPECT_EQ(result.GetCurrent().minimum, 1);
+  EXPECT_EQ(result.GetCurrent().maximum, 5);
+}
+
+USERVER_NAMESPACE_END
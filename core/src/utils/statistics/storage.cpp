@@ -1,10 +1,12 @@
 #include <userver/utils/statistics/storage.hpp>
 
 #include <utility>
+#include <variant>
 
 #include <userver/formats/common/utils.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/metadata.hpp>
 #include <userver/utils/text.hpp>
 #include <utils/statistics/value_builder_helpers.hpp>
 
@@ -21,6 +23,63 @@ constexpr int kVersion = 2;
 
 namespace utils::statistics {
 
+namespace {
+
+// Rebuilds the legacy tree from the metrics of a WriterFunc source. Labels
+// become nested nodes marked by SolomonChildrenAreLabelValues.
+class JsonTreeBuilder final : public BaseFormatBuilder {
+ public:
+  void HandleMetric(std::string_view path, const std::vector<LabelView>& labels,
+                    const MetricValue& value) override {
+    auto node_path = formats::common::SplitPathString(path);
+    for (const auto& label : labels) {
+      if (node_path.empty()) {
+        SolomonChildrenAreLabelValues(result_, std::string{label.name});
+      } else {
+        SolomonChildrenAreLabelValues(
+            formats::common::GetAtPath(result_, std::vector(node_path)),
+            std::string{label.name});
+      }
+      node_path.emplace_back(label.value);
+    }
+
+    auto leaf = std::visit(
+        [](auto x) { return formats::json::ValueBuilder{x}; }, value);
+    if (node_path.empty()) {
+      result_ = std::move(leaf);
+    } else {
+      formats::common::GetAtPath(result_, std::move(node_path)) =
+          std::move(leaf);
+    }
+  }
+
+  formats::json::ValueBuilder Extract() { return std::move(result_); }
+
+ private:
+  formats::json::ValueBuilder result_;
+};
+
+bool IsPrefixMatching(const impl::MetricsSource& source,
+                      const StatisticsRequest& request) {
+  return utils::text::StartsWith(source.prefix_path, request.prefix) ||
+         utils::text::StartsWith(request.prefix, source.prefix_path);
+}
+
+formats::json::ValueBuilder GetSourceAsJson(const impl::MetricsSource& source,
+                                            const StatisticsRequest& request) {
+  if (!source.writer) return source.extender(request);
+
+  JsonTreeBuilder builder;
+  impl::WriterState state{builder};
+  {
+    Writer writer{state};
+    source.writer(writer, request);
+  }
+  return builder.Extract();
+}
+
+}  // namespace
+
 Storage::Storage() : may_register_extenders_(true) {}
 
 formats::json::ValueBuilder Storage::GetAsJson(
@@ -31,30 +90,48 @@ formats::json::ValueBuilder Storage::GetAsJson(
   std::shared_lock lock(mutex_);
 
   for (const auto& entry : metrics_sources_) {
-    if (utils::text::StartsWith(entry.prefix_path, request.prefix) ||
-        utils::text::StartsWith(request.prefix, entry.prefix_path)) {
+    if (IsPrefixMatching(entry, request)) {
       LOG_DEBUG() << "Getting statistics for prefix=" << entry.prefix_path;
       SetSubField(result, std::vector(entry.path_segments),
-                  entry.extender(request));
+                  GetSourceAsJson(entry, request));
     }
   }
 
   return result;
 }
 
+void Storage::VisitMetrics(BaseFormatBuilder& builder,
+                           const StatisticsRequest& request) const {
+  impl::WriterState state{builder};
+
+  std::shared_lock lock(mutex_);
+
+  for (const auto& entry : metrics_sources_) {
+    if (!IsPrefixMatching(entry, request)) continue;
+
+    LOG_DEBUG() << "Getting statistics for prefix=" << entry.prefix_path;
+    Writer writer{state, entry.prefix_path};
+    if (entry.writer) {
+      entry.writer(writer, request);
+    } else {
+      DumpMetric(writer, entry.extender(request).ExtractValue());
+    }
+  }
+}
+
 void Storage::StopRegisteringExtenders() { may_register_extenders_ = false; }
 
 Entry Storage::RegisterExtender(std::string prefix, ExtenderFunc func) {
   auto prefix_split = formats::common::SplitPathString(prefix);
   return DoRegisterExtender(impl::MetricsSource{
-      std::move(prefix), std::move(prefix_split), std::move(func)});
+      std::move(prefix), std::move(prefix_split), std::move(func), {}});
 }
 
 Entry Storage::RegisterExtender(std::vector<std::string> prefix,
                                 ExtenderFunc func) {
   auto prefix_joined = JoinPath(prefix);
   return DoRegisterExtender(impl::MetricsSource{
-      std::move(prefix_joined), std::move(prefix), std::move(func)});
+      std::move(prefix_joined), std::move(prefix), std::move(func), {}});
 }
 
 Entry Storage::RegisterExtender(std::initializer_list<std::string> prefix,
@@ -62,6 +139,12 @@ Entry Storage::RegisterExtender(std::initializer_list<std::string> prefix,
   return RegisterExtender(std::vector(prefix), std::move(func));
 }
 
+Entry Storage::RegisterWriter(std::string common_prefix, WriterFunc func) {
+  auto prefix_split = formats::common::SplitPathString(common_prefix);
+  return DoRegisterExtender(impl::MetricsSource{
+      std::move(common_prefix), std::move(prefix_split), {}, std::move(func)});
+}
+
 Entry Storage::DoRegisterExtender(impl::MetricsSource&& source) {
   UASSERT_MSG(may_register_extenders_.load(),
               "You may not register statistics extender outside of component "
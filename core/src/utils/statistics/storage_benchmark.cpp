@@ -0,0 +1,166 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/utils/statistics/json.hpp>
+#include <userver/utils/statistics/metadata.hpp>
+#include <userver/utils/statistics/prometheus.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kComponentsCount = 100;
+constexpr std::size_t kHandlersCount = 10;
+constexpr std::size_t kCodesCount = 10;
+
+// component-N.handler-M.{by-code.metric-K{http_code=...}, timing}: 100
+// components with 10 handlers each, 10 codes * `metrics_per_code` + 1 metrics
+// per handler
+struct SyntheticService {
+  explicit SyntheticService(std::size_t metrics_per_code) {
+    for (std::size_t i = 0; i < metrics_per_code; ++i) {
+      metric_names.push_back("metric-" + std::to_string(i));
+    }
+    for (std::size_t i = 0; i < kHandlersCount; ++i) {
+      handler_names.push_back("handler-" + std::to_string(i));
+    }
+    for (std::size_t i = 0; i < kCodesCount; ++i) {
+      codes.push_back(std::to_string(200 + i));
+    }
+  }
+
+  formats::json::ValueBuilder GetAsJson() const {
+    formats::json::ValueBuilder result;
+    for (const auto& handler : handler_names) {
+      auto handler_json = result[handler];
+      for (const auto& code : codes) {
+        auto code_json = handler_json["by-code"][code];
+        for (const auto& metric : metric_names) {
+          code_json[metric] = 42;
+        }
+      }
+      utils::statistics::SolomonChildrenAreLabelValues(handler_json["by-code"],
+                                                       "http_code");
+      handler_json["timing"] = 1.5;
+    }
+    return result;
+  }
+
+  void Write(utils::statistics::Writer& writer) const {
+    for (const auto& handler : handler_names) {
+      auto handler_writer = writer[handler];
+      {
+        auto by_code_writer = handler_writer["by-code"];
+        for (const auto& code : codes) {
+          auto code_writer = by_code_writer.WithLabel({"http_code", code});
+          for (const auto& metric : metric_names) {
+            code_writer[metric] = 42;
+          }
+        }
+      }
+      handler_writer["timing"] = 1.5;
+    }
+  }
+
+  std::vector<std::string> metric_names;
+  std::vector<std::string> handler_names;
+  std::vector<std::string> codes;
+};
+
+enum class SourceType { kExtender, kWriter };
+
+std::vector<utils::statistics::Entry> RegisterSources(
+    utils::statistics::Storage& storage, const SyntheticService& service,
+    SourceType type) {
+  std::vector<utils::statistics::Entry> entries;
+  for (std::size_t i = 0; i < kComponentsCount; ++i) {
+    auto prefix = "component-" + std::to_string(i);
+    if (type == SourceType::kExtender) {
+      entries.push_back(storage.RegisterExtender(
+          std::move(prefix),
+          [&service](const auto&) { return service.GetAsJson(); }));
+    } else {
+      entries.push_back(storage.RegisterWriter(
+          std::move(prefix),
+          [&service](utils::statistics::Writer& writer, const auto&) {
+            service.Write(writer);
+          }));
+    }
+  }
+  return entries;
+}
+
+std::size_t GetMetricsCount(std::size_t metrics_per_code) {
+  return kComponentsCount * kHandlersCount *
+         (kCodesCount * metrics_per_code + 1);
+}
+
+}  // namespace
+
+void statistics_scrape_legacy_json(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const SyntheticService service(state.range(0));
+    utils::statistics::Storage storage;
+    const auto entries =
+        RegisterSources(storage, service, SourceType::kExtender);
+
+    for (auto _ : state) {
+      const auto json = storage.GetAsJson({}).ExtractValue();
+      benchmark::DoNotOptimize(formats::json::ToString(json));
+    }
+    state.counters["metrics"] = GetMetricsCount(state.range(0));
+  });
+}
+BENCHMARK(statistics_scrape_legacy_json)->Arg(1)->Arg(10);
+
+void statistics_scrape_json(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const SyntheticService service(state.range(0));
+    utils::statistics::Storage storage;
+    const auto entries = RegisterSources(storage, service, SourceType::kWriter);
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(utils::statistics::ToJsonFormat(storage, {}));
+    }
+    state.counters["metrics"] = GetMetricsCount(state.range(0));
+  });
+}
+BENCHMARK(statistics_scrape_json)->Arg(1)->Arg(10);
+
+void statistics_scrape_prometheus(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const SyntheticService service(state.range(0));
+    utils::statistics::Storage storage;
+    const auto entries = RegisterSources(storage, service, SourceType::kWriter);
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          utils::statistics::ToPrometheusFormat(storage, {}));
+    }
+    state.counters["metrics"] = GetMetricsCount(state.range(0));
+  });
+}
+BENCHMARK(statistics_scrape_prometheus)->Arg(1)->Arg(10);
+
+void statistics_scrape_prometheus_legacy_extenders(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const SyntheticService service(state.range(0));
+    utils::statistics::Storage storage;
+    const auto entries =
+        RegisterSources(storage, service, SourceType::kExtender);
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          utils::statistics::ToPrometheusFormat(storage, {}));
+    }
+    state.counters["metrics"] = GetMetricsCount(state.range(0));
+  });
+}
+BENCHMARK(statistics_scrape_prometheus_legacy_extenders)->Arg(1)->Arg(10);
+
+USERVER_NAMESPACE_END
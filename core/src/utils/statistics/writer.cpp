@@ -0,0 +1,143 @@
+#include <userver/utils/statistics/writer.hpp>
+
+#include <optional>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+const std::string kMetadata = "$meta";
+
+const std::string kMetadataSolomonSkip = "solomon_skip";
+const std::string kMetadataSolomonRename = "solomon_rename";
+const std::string kMetadataSolomonLabel = "solomon_label";
+const std::string kMetadataSolomonChildrenLabels = "solomon_children_labels";
+
+void DumpNode(Writer& writer, const formats::json::Value& node);
+
+void DumpChild(Writer& parent, const std::string& name,
+               const formats::json::Value& child,
+               const std::optional<std::string>& children_label) {
+  if (children_label) {
+    auto writer = parent.WithLabel({*children_label, name});
+    DumpNode(writer, child);
+    return;
+  }
+
+  if (child.IsObject() && child.HasMember(kMetadata)) {
+    const auto meta = child[kMetadata];
+    if (meta[kMetadataSolomonSkip].As<bool>(false)) {
+      DumpNode(parent, child);
+      return;
+    }
+    if (meta.HasMember(kMetadataSolomonLabel)) {
+      const auto label = meta[kMetadataSolomonLabel].As<std::string>();
+      auto writer = parent.WithLabel({label, name});
+      DumpNode(writer, child);
+      return;
+    }
+    if (meta.HasMember(kMetadataSolomonRename)) {
+      auto writer = parent[meta[kMetadataSolomonRename].As<std::string>()];
+      DumpNode(writer, child);
+      return;
+    }
+  }
+
+  auto writer = parent[name];
+  DumpNode(writer, child);
+}
+
+void DumpNode(Writer& writer, const formats::json::Value& node) {
+  if (node.IsObject()) {
+    std::optional<std::string> children_label;
+    if (node.HasMember(kMetadata)) {
+      children_label = node[kMetadata][kMetadataSolomonChildrenLabels]
+                           .As<std::optional<std::string>>();
+    }
+    for (auto it = node.begin(); it != node.end(); ++it) {
+      const auto name = it.GetName();
+      if (name == kMetadata) continue;
+      DumpChild(writer, name, *it, children_label);
+    }
+  } else if (node.IsInt64()) {
+    writer = node.As<std::int64_t>();
+  } else if (node.IsUInt64()) {
+    writer = node.As<std::uint64_t>();
+  } else if (node.IsDouble()) {
+    writer = node.As<double>();
+  }
+}
+
+}  // namespace
+
+BaseFormatBuilder::~BaseFormatBuilder() = default;
+
+Writer::Writer(impl::WriterState& state, std::string_view path)
+    : state_(state),
+      previous_innermost_(state.innermost),
+      path_size_(state.path.size()),
+      labels_size_(state.labels.size()) {
+  if (!path.empty()) {
+    if (!state_.path.empty()) state_.path += '.';
+    state_.path += path;
+  }
+  state_.innermost = this;
+}
+
+Writer::Writer(Writer& parent, std::string_view path)
+    : Writer(parent.state_, path) {
+  UASSERT_MSG(previous_innermost_ == &parent,
+              "Writer was used while its child writer is alive");
+}
+
+Writer::Writer(Writer& parent, std::initializer_list<LabelView> labels)
+    : Writer(parent.state_) {
+  UASSERT_MSG(previous_innermost_ == &parent,
+              "Writer was used while its child writer is alive");
+  for (const auto& label : labels) {
+    const auto& name = state_.label_storage.emplace_back(label.name);
+    const auto& value = state_.label_storage.emplace_back(label.value);
+    state_.labels.push_back({name, value});
+  }
+}
+
+Writer::~Writer() {
+  UASSERT_MSG(state_.innermost == this,
+              "Writers were destroyed not in the reverse order of creation");
+  state_.innermost = previous_innermost_;
+  state_.path.resize(path_size_);
+  state_.label_storage.resize(labels_size_ * 2);
+  state_.labels.resize(labels_size_);
+}
+
+Writer Writer::operator[](std::string_view path) { return {*this, path}; }
+
+Writer Writer::WithLabels(std::initializer_list<LabelView> labels) {
+  return {*this, labels};
+}
+
+Writer Writer::WithLabel(LabelView label) { return {*this, {label}}; }
+
+void Writer::WriteValue(MetricValue value) {
+  CheckInnermost();
+  state_.builder.HandleMetric(state_.path, state_.labels, value);
+}
+
+void Writer::CheckInnermost() const {
+  UASSERT_MSG(state_.innermost == this,
+              "Writer was used while its child writer is alive");
+}
+
+void DumpMetric(Writer& writer, const formats::json::Value& tree) {
+  DumpNode(writer, tree);
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
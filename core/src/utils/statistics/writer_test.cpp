@@ -0,0 +1,175 @@
+#include <userver/utils/statistics/writer.hpp>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/mock_now.hpp>
+#include <userver/utils/statistics/graphite.hpp>
+#include <userver/utils/statistics/json.hpp>
+#include <userver/utils/statistics/metadata.hpp>
+#include <userver/utils/statistics/percentile_format_json.hpp>
+#include <userver/utils/statistics/prometheus.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/text.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// [Sample utils::statistics::Writer usage]
+namespace samples {
+
+struct ComponentMetrics {
+  std::uint64_t ok_requests;
+  std::uint64_t failed_requests;
+  double load;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ComponentMetrics& metrics) {
+  writer["requests"].ValueWithLabels(metrics.ok_requests, {{"status", "ok"}});
+  writer["requests"].ValueWithLabels(metrics.failed_requests,
+                                     {{"status", "error"}});
+  writer["load"] = metrics.load;
+}
+
+}  // namespace samples
+
+UTEST(StatisticsWriter, Sample) {
+  utils::statistics::Storage storage;
+  const samples::ComponentMetrics metrics{5, 1, 0.5};
+  auto entry = storage.RegisterWriter(
+      "my-component",
+      [&metrics](utils::statistics::Writer& writer, const auto&) {
+        writer["my-cache"] = metrics;
+      });
+
+  EXPECT_EQ(utils::statistics::ToPrometheusFormat(storage, {}),
+            "# TYPE my_component_my_cache_requests untyped\n"
+            "my_component_my_cache_requests{status=\"ok\"} 5\n"
+            "my_component_my_cache_requests{status=\"error\"} 1\n"
+            "# TYPE my_component_my_cache_load untyped\n"
+            "my_component_my_cache_load 0.5\n");
+}
+/// [Sample utils::statistics::Writer usage]
+
+UTEST(StatisticsWriter, LegacyExtender) {
+  utils::statistics::Storage storage;
+  auto entry = storage.RegisterExtender("legacy", [](const auto&) {
+    formats::json::ValueBuilder result;
+    result["skipped"]["a"] = 1;
+    utils::statistics::SolomonSkip(result["skipped"]);
+    result["renamed"]["b"] = 2;
+    utils::statistics::SolomonRename(result["renamed"], "new-name");
+    result["by-host"]["host1"]["c"] = 3;
+    utils::statistics::SolomonLabelValue(result["by-host"]["host1"], "host");
+    result["timings"] = utils::statistics::PercentileToJson(
+        utils::statistics::Percentile<10>{}, {50});
+    result["text"] = "not a metric";
+    return result;
+  });
+
+  EXPECT_EQ(utils::statistics::ToPrometheusFormat(storage, {}),
+            "# TYPE legacy_a untyped\n"
+            "legacy_a 1\n"
+            "# TYPE legacy_new_name_b untyped\n"
+            "legacy_new_name_b 2\n"
+            "# TYPE legacy_by_host_c untyped\n"
+            "legacy_by_host_c{host=\"host1\"} 3\n"
+            "# TYPE legacy_timings untyped\n"
+            "legacy_timings{percentile=\"p50\"} 0\n");
+}
+
+UTEST(StatisticsWriter, Formats) {
+  utils::statistics::Storage storage;
+  auto entry = storage.RegisterWriter(
+      "component", [](utils::statistics::Writer& writer, const auto&) {
+        auto errors_writer = writer["errors"];
+        auto errors = errors_writer.WithLabels({{"code", "500"}});
+        errors["count"] = 3;
+        errors.ValueWithLabels(-1.5, {{"kind", "a;b=\"c\""}});
+      });
+  auto other_entry = storage.RegisterWriter(
+      "other",
+      [](utils::statistics::Writer& writer, const auto&) { writer["x"] = 1; });
+
+  EXPECT_EQ(utils::statistics::ToPrometheusFormat(storage, {"component"}),
+            "# TYPE component_errors_count untyped\n"
+            "component_errors_count{code=\"500\"} 3\n"
+            "# TYPE component_errors untyped\n"
+            "component_errors{code=\"500\",kind=\"a;b=\\\"c\\\"\"} -1.5\n");
+
+  utils::datetime::MockNowSet(std::chrono::system_clock::from_time_t(100));
+  EXPECT_EQ(utils::statistics::ToGraphiteFormat(storage, {"component"}),
+            "component.errors.count;code=500 3 100\n"
+            "component.errors;code=500;kind=a_b_\"c\" -1.5 100\n");
+  utils::datetime::MockNowUnset();
+
+  EXPECT_EQ(formats::json::FromString(
+                utils::statistics::ToJsonFormat(storage, {"component"})),
+            formats::json::FromString(R"([
+              {"path": "component.errors.count", "labels": {"code": "500"},
+               "value": 3},
+              {"path": "component.errors",
+               "labels": {"code": "500", "kind": "a;b=\"c\""}, "value": -1.5}
+            ])"));
+}
+
+UTEST(StatisticsWriter, PrometheusGroupsSamples) {
+  utils::statistics::Storage storage;
+  auto first_entry = storage.RegisterWriter(
+      "", [](utils::statistics::Writer& writer, const auto&) {
+        writer["requests"].ValueWithLabels(1, {{"source", "first"}});
+        writer["errors"] = 2;
+      });
+  auto second_entry = storage.RegisterWriter(
+      "", [](utils::statistics::Writer& writer, const auto&) {
+        writer["requests"].ValueWithLabels(3, {{"source", "second"}});
+      });
+
+  EXPECT_EQ(utils::statistics::ToPrometheusFormat(storage, {}),
+            "# TYPE requests untyped\n"
+            "requests{source=\"first\"} 1\n"
+            "requests{source=\"second\"} 3\n"
+            "# TYPE errors untyped\n"
+            "errors 2\n");
+}
+
+UTEST(StatisticsWriter, RequestPrefix) {
+  utils::statistics::Storage storage;
+  auto entry = storage.RegisterWriter(
+      "component", [](utils::statistics::Writer& writer,
+                      const utils::statistics::StatisticsRequest& request) {
+        if (utils::text::StartsWith("component.a", request.prefix)) {
+          writer["a"] = 1;
+        }
+        if (utils::text::StartsWith("component.b", request.prefix)) {
+          writer["b"] = 2;
+        }
+      });
+
+  EXPECT_EQ(utils::statistics::ToPrometheusFormat(storage, {"component.b"}),
+            "# TYPE component_b untyped\n"
+            "component_b 2\n");
+  EXPECT_EQ(utils::statistics::ToPrometheusFormat(storage, {"component"}),
+            "# TYPE component_a untyped\n"
+            "component_a 1\n"
+            "# TYPE component_b untyped\n"
+            "component_b 2\n");
+}
+
+UTEST(StatisticsWriter, GetAsJson) {
+  utils::statistics::Storage storage;
+  auto entry = storage.RegisterWriter(
+      "component", [](utils::statistics::Writer& writer, const auto&) {
+        writer["a"]["b"] = 1;
+        writer["a"]["c"].ValueWithLabels(2, {{"label", "value"}});
+      });
+
+  const auto json = storage.GetAsJson({""}).ExtractValue();
+  EXPECT_EQ(json["component"]["a"]["b"].As<int>(), 1);
+  EXPECT_EQ(json["component"]["a"]["c"]["value"].As<int>(), 2);
+  EXPECT_EQ(
+      json["component"]["a"]["c"]["$meta"]["solomon_children_labels"]
+          .As<std::string>(),
+      "label");
+}
+
+USERVER_NAMESPACE_END
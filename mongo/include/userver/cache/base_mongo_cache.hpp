@@ -4,6 +4,9 @@
 /// @brief @copybrief components::MongoCache
 
 #include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -11,10 +14,13 @@
 #include <userver/cache/caching_component_base.hpp>
 #include <userver/cache/mongo_cache_type_traits.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/formats/bson/binary.hpp>
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/options.hpp>
 #include <userver/tracing/span.hpp>
@@ -30,6 +36,9 @@ inline const std::string kFetchAndParseStage = "fetch_and_parse";
 inline constexpr std::chrono::milliseconds kCpuRelaxThreshold{10};
 inline constexpr std::chrono::milliseconds kCpuRelaxInterval{2};
 
+inline constexpr std::chrono::milliseconds kChangeStreamMaxAwaitTime{10};
+inline constexpr std::size_t kMaxChangeEventsPerUpdate = 100000;
+
 namespace impl {
 
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
@@ -108,10 +117,39 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///   // Whether update part of the cache even if failed to parse some documents
 ///   static constexpr bool kAreInvalidDocumentsSkipped = false;
 ///
+///   // Whether incremental updates apply the events of the collection change
+///   // stream instead of querying kMongoUpdateFieldName (optional)
+///   static constexpr bool kUseChangeStream = true;
+///
+///   // Whether the next batch of the collection is requested while the
+///   // current one is parsed (optional)
+///   static constexpr bool kUseCursorPrefetch = true;
+///
+///   // Optional function that converts `_id` of a deleted document to the key
+///   // of the cache map, used with kUseChangeStream
+///   static KeyType GetKeyFromId(const formats::bson::Value& id) {
+///     return id.As<formats::bson::Oid>().ToString();
+///   }
+///   // (default implementation calls id.As<KeyType>())
+///
 ///   // Component to get the collections
 ///   using MongoCollectionsComponent = components::MongoCollections;
 /// };
 /// ```
+///
+/// ## Updates from change stream:
+/// With `kUseChangeStream` an incremental update resumes the change stream of
+/// the collection after the last seen event, applies the inserted, replaced,
+/// updated and deleted documents to a copy of the cache and stores the resume
+/// token. A full update opens the change stream before reading the
+/// collection, so the changes made during the full read are applied by the
+/// next incremental update. The resume token is saved in the cache dumps.
+///
+/// If the token is invalidated (it is too old for the oplog, the collection is
+/// dropped or renamed) or missing, a full update is performed instead.
+///
+/// Change streams require a replica set or a sharded cluster, MongoDB 4.0.7+.
+/// Custom find operation is not supported as the events are not filtered.
 
 // clang-format on
 
@@ -131,11 +169,36 @@ class MongoCache
   static yaml_config::Schema GetStaticConfigSchema();
 
  private:
+  using DataType = typename MongoCacheTraits::DataType;
+  using KeyType = typename DataType::key_type;
+
   void Update(cache::UpdateType type,
               const std::chrono::system_clock::time_point& last_update,
               const std::chrono::system_clock::time_point& now,
               cache::UpdateStatisticsScope& stats_scope) override;
 
+  void WriteContents(dump::Writer& writer,
+                     const DataType& contents) const override;
+
+  std::unique_ptr<const DataType> ReadContents(
+      dump::Reader& reader) const override;
+
+  /// Returns false if a full update is required
+  bool UpdateFromChangeStream(cache::UpdateStatisticsScope& stats_scope);
+
+  storages::mongo::ChangeStream OpenChangeStream(
+      std::optional<formats::bson::Document> resume_token) const;
+
+  std::optional<formats::bson::Document> GetChangeStreamStartToken() const;
+
+  std::optional<formats::bson::Document> GetResumeToken() const;
+
+  void SetResumeToken(
+      const DataType* data,
+      std::optional<formats::bson::Document> resume_token) const;
+
+  KeyType GetKeyFromId(const formats::bson::Value& id) const;
+
   typename MongoCacheTraits::ObjectType DeserializeObject(
       const formats::bson::Document& doc) const;
 
@@ -152,6 +215,11 @@ class MongoCache
   const storages::mongo::Collection* const mongo_collection_;
   const std::chrono::system_clock::duration correction_;
   std::size_t cpu_relax_iterations_{0};
+
+  // The resume token is valid only for the cache data it was stored with
+  mutable engine::Mutex resume_token_mutex_;
+  mutable const DataType* resume_token_data_{nullptr};
+  mutable std::optional<formats::bson::Document> resume_token_;
 };
 
 template <class MongoCacheTraits>
@@ -177,10 +245,11 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
           typename MongoCacheTraits::DataType>::GetAllowedUpdateTypes() ==
           cache::AllowedUpdateTypes::kFullAndIncremental &&
       !mongo_cache::impl::kHasUpdateFieldName<MongoCacheTraits> &&
-      !mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
+      !mongo_cache::impl::kHasFindOperation<MongoCacheTraits> &&
+      !mongo_cache::impl::kIsChangeStreamUsed<MongoCacheTraits>) {
     throw std::logic_error(
         "Incremental update support is requested in config but no update field "
-        "name is specified in traits of '" +
+        "name or change stream is specified in traits of '" +
         components::GetCurrentComponentName(config) + "' cache");
   }
   if (correction_.count() < 0) {
@@ -206,6 +275,17 @@ void MongoCache<MongoCacheTraits>::Update(
     cache::UpdateStatisticsScope& stats_scope) {
   namespace sm = storages::mongo;
 
+  std::optional<formats::bson::Document> resume_token;
+  if constexpr (mongo_cache::impl::kIsChangeStreamUsed<MongoCacheTraits>) {
+    if (type == cache::UpdateType::kIncremental) {
+      if (UpdateFromChangeStream(stats_scope)) return;
+      LOG_WARNING() << "Falling back to full update of cache "
+                    << MongoCacheTraits::kName;
+      type = cache::UpdateType::kFull;
+    }
+    resume_token = GetChangeStreamStartToken();
+  }
+
   auto* collection = mongo_collection_;
   auto find_op = GetFindOperation(type, last_update, now, correction_);
   auto cursor = collection->Execute(find_op);
@@ -255,6 +335,13 @@ void MongoCache<MongoCacheTraits>::Update(
   }
 
   const auto elapsed_time = scope.ElapsedTotal(kFetchAndParseStage);
+  if (const auto prefetch_stats = cursor.GetPrefetchStatistics()) {
+    LOG_DEBUG() << fmt::format(
+        "Cache {} read {} batches, waited for the data {}us, processed the "
+        "data {}us",
+        kName, prefetch_stats->batches, prefetch_stats->wait_time.count(),
+        prefetch_stats->process_time.count());
+  }
   if (elapsed_time > kCpuRelaxThreshold) {
     cpu_relax_iterations_ = static_cast<std::size_t>(
         static_cast<double>(doc_count) / (elapsed_time / kCpuRelaxInterval));
@@ -267,8 +354,186 @@ void MongoCache<MongoCacheTraits>::Update(
   scope.Reset();
 
   const auto size = new_cache->size();
+  if constexpr (mongo_cache::impl::kIsChangeStreamUsed<MongoCacheTraits>) {
+    SetResumeToken(new_cache.get(), std::move(resume_token));
+  }
+  this->Set(std::move(new_cache));
+  stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::WriteContents(
+    dump::Writer& writer, const DataType& contents) const {
+  if constexpr (mongo_cache::impl::kIsChangeStreamUsed<MongoCacheTraits>) {
+    std::string resume_token;
+    {
+      std::lock_guard<engine::Mutex> lock(resume_token_mutex_);
+      if (resume_token_data_ == &contents && resume_token_) {
+        resume_token = formats::bson::ToBinaryString(*resume_token_).ToString();
+      }
+    }
+    // An empty token makes the first update after the load a full one
+    writer.Write(resume_token);
+  }
+  CachingComponentBase<DataType>::WriteContents(writer, contents);
+}
+
+template <class MongoCacheTraits>
+std::unique_ptr<const typename MongoCacheTraits::DataType>
+MongoCache<MongoCacheTraits>::ReadContents(dump::Reader& reader) const {
+  if constexpr (mongo_cache::impl::kIsChangeStreamUsed<MongoCacheTraits>) {
+    const auto resume_token = reader.Read<std::string>();
+    auto contents = CachingComponentBase<DataType>::ReadContents(reader);
+    SetResumeToken(contents.get(),
+                   resume_token.empty()
+                       ? std::nullopt
+                       : std::make_optional(
+                             formats::bson::FromBinaryString(resume_token)));
+    return contents;
+  } else {
+    return CachingComponentBase<DataType>::ReadContents(reader);
+  }
+}
+
+template <class MongoCacheTraits>
+bool MongoCache<MongoCacheTraits>::UpdateFromChangeStream(
+    cache::UpdateStatisticsScope& stats_scope) {
+  namespace sm = storages::mongo;
+
+  auto resume_token = GetResumeToken();
+  if (!resume_token) return false;
+
+  auto scope =
+      tracing::Span::CurrentSpan().CreateScopeTime("read_change_stream");
+  std::vector<formats::bson::Document> events;
+  try {
+    auto stream = OpenChangeStream(std::move(resume_token));
+    // Resumes after the last read event next time if there are more
+    while (events.size() < kMaxChangeEventsPerUpdate) {
+      auto event = stream.Next();
+      if (!event) break;
+      events.push_back(std::move(*event));
+    }
+    resume_token = stream.GetResumeToken();
+  } catch (const sm::ServerException& e) {
+    // Most probably the token is not in the oplog anymore
+    LOG_WARNING() << "Failed to resume change stream of cache "
+                  << MongoCacheTraits::kName << ": " << e;
+    return false;
+  }
+  if (!resume_token) return false;
+
+  if (events.empty()) {
+    const auto current_cache = this->GetUnsafe();
+    SetResumeToken(current_cache.Get(), std::move(resume_token));
+    LOG_INFO() << "No changes in cache " << MongoCacheTraits::kName;
+    stats_scope.FinishNoChanges();
+    return true;
+  }
+
+  scope.Reset("copy_data");
+  auto new_cache = GetData(cache::UpdateType::kIncremental);
+
+  scope.Reset(kFetchAndParseStage);
+  for (const auto& event : events) {
+    stats_scope.IncreaseDocumentsReadCount(1);
+
+    const auto operation_type = event["operationType"].As<std::string>();
+    if (operation_type == "insert" || operation_type == "replace" ||
+        operation_type == "update") {
+      const auto full_document = event["fullDocument"];
+      // The document is deleted after the update, the deletion follows
+      if (full_document.IsMissing() || full_document.IsNull()) continue;
+
+      try {
+        auto object = DeserializeObject(formats::bson::Document(full_document));
+        auto key = (object.*MongoCacheTraits::kKeyField);
+        (*new_cache)[key] = std::move(object);
+      } catch (const std::exception& e) {
+        LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                            << MongoCacheTraits::kName << ", _id="
+                            << event["documentKey"]["_id"]
+                                   .template ConvertTo<std::string>()
+                            << ", what(): " << e;
+        stats_scope.IncreaseDocumentsParseFailures(1);
+
+        if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+      }
+    } else if (operation_type == "delete") {
+      new_cache->erase(GetKeyFromId(event["documentKey"]["_id"]));
+    } else if (operation_type == "invalidate" || operation_type == "drop" ||
+               operation_type == "rename" ||
+               operation_type == "dropDatabase") {
+      LOG_WARNING() << "Change stream of cache " << MongoCacheTraits::kName
+                    << " is invalidated by '" << operation_type << "' event";
+      return false;
+    }
+  }
+
+  scope.Reset();
+
+  const auto size = new_cache->size();
+  SetResumeToken(new_cache.get(), std::move(resume_token));
   this->Set(std::move(new_cache));
   stats_scope.Finish(size);
+  return true;
+}
+
+template <class MongoCacheTraits>
+storages::mongo::ChangeStream MongoCache<MongoCacheTraits>::OpenChangeStream(
+    std::optional<formats::bson::Document> resume_token) const {
+  namespace sm = storages::mongo;
+
+  sm::operations::Watch watch_op;
+  watch_op.SetOption(sm::options::FullDocumentLookup{});
+  watch_op.SetOption(sm::options::MaxAwaitTime{kChangeStreamMaxAwaitTime});
+  if (resume_token) {
+    watch_op.SetOption(sm::options::ResumeAfter{std::move(*resume_token)});
+  }
+  if (MongoCacheTraits::kIsSecondaryPreferred) {
+    watch_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+  return mongo_collection_->Execute(watch_op);
+}
+
+template <class MongoCacheTraits>
+std::optional<formats::bson::Document>
+MongoCache<MongoCacheTraits>::GetChangeStreamStartToken() const {
+  try {
+    return OpenChangeStream(std::nullopt).GetResumeToken();
+  } catch (const storages::mongo::ServerException& e) {
+    // Incremental updates fall back to full ones
+    LOG_WARNING() << "Failed to open change stream of cache "
+                  << MongoCacheTraits::kName << ": " << e;
+    return std::nullopt;
+  }
+}
+
+template <class MongoCacheTraits>
+std::optional<formats::bson::Document>
+MongoCache<MongoCacheTraits>::GetResumeToken() const {
+  std::lock_guard<engine::Mutex> lock(resume_token_mutex_);
+  return resume_token_;
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::SetResumeToken(
+    const DataType* data,
+    std::optional<formats::bson::Document> resume_token) const {
+  std::lock_guard<engine::Mutex> lock(resume_token_mutex_);
+  resume_token_data_ = data;
+  resume_token_ = std::move(resume_token);
+}
+
+template <class MongoCacheTraits>
+typename MongoCache<MongoCacheTraits>::KeyType
+MongoCache<MongoCacheTraits>::GetKeyFromId(
+    const formats::bson::Value& id) const {
+  if constexpr (mongo_cache::impl::kHasGetKeyFromId<MongoCacheTraits>) {
+    return MongoCacheTraits::GetKeyFromId(id);
+  } else {
+    return id.As<KeyType>();
+  }
 }
 
 template <class MongoCacheTraits>
@@ -319,6 +584,9 @@ MongoCache<MongoCacheTraits>::GetFindOperation(
   if (MongoCacheTraits::kIsSecondaryPreferred) {
     find_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
   }
+  if constexpr (mongo_cache::impl::kIsCursorPrefetchUsed<MongoCacheTraits>) {
+    find_op.SetOption(sm::options::Prefetch{});
+  }
   return find_op;
 }
 
@@ -99,6 +99,45 @@ template <typename T>
 inline constexpr bool kHasInvalidDocumentsSkipped =
     meta::kIsDetected<HasInvalidDocumentsSkipped, T>;
 
+template <typename T>
+using HasUseChangeStream = decltype(T::kUseChangeStream);
+template <typename T>
+inline constexpr bool kHasUseChangeStream =
+    meta::kIsDetected<HasUseChangeStream, T>;
+
+template <typename T>
+constexpr bool IsChangeStreamUsed() {
+  if constexpr (kHasUseChangeStream<T>) {
+    return T::kUseChangeStream;
+  } else {
+    return false;
+  }
+}
+template <typename T>
+inline constexpr bool kIsChangeStreamUsed = IsChangeStreamUsed<T>();
+
+template <typename T>
+using HasUseCursorPrefetch = decltype(T::kUseCursorPrefetch);
+template <typename T>
+inline constexpr bool kHasUseCursorPrefetch =
+    meta::kIsDetected<HasUseCursorPrefetch, T>;
+
+template <typename T>
+constexpr bool IsCursorPrefetchUsed() {
+  if constexpr (kHasUseCursorPrefetch<T>) {
+    return T::kUseCursorPrefetch;
+  } else {
+    return false;
+  }
+}
+template <typename T>
+inline constexpr bool kIsCursorPrefetchUsed = IsCursorPrefetchUsed<T>();
+
+template <typename T>
+using HasGetKeyFromId = decltype(T::GetKeyFromId);
+template <typename T>
+inline constexpr bool kHasGetKeyFromId = meta::kIsDetected<HasGetKeyFromId, T>;
+
 template <typename>
 struct ClassByMemberPointer {};
 template <typename T, typename C>
@@ -127,6 +166,20 @@ struct CheckTraits {
                          bool>,
           "Mongo cache traits must specify kUseDefaultFindOperation as bool");
     }
+    if constexpr (kHasUseChangeStream<MongoCacheTraits>) {
+      static_assert(
+          std::is_same_v<
+              std::decay_t<decltype(MongoCacheTraits::kUseChangeStream)>,
+              bool>,
+          "Mongo cache traits must specify kUseChangeStream as bool");
+    }
+    if constexpr (kHasUseCursorPrefetch<MongoCacheTraits>) {
+      static_assert(
+          std::is_same_v<
+              std::decay_t<decltype(MongoCacheTraits::kUseCursorPrefetch)>,
+              bool>,
+          "Mongo cache traits must specify kUseCursorPrefetch as bool");
+    }
   }
 
   static_assert(kHasCollectionsField<MongoCacheTraits>,
@@ -165,6 +218,12 @@ struct CheckTraits {
                 "const std::chrono::system_clock::time_point& now, "
                 "const std::chrono::system_clock::duration& correction)");
 
+  static_assert(!kIsChangeStreamUsed<MongoCacheTraits> ||
+                    !kHasFindOperation<MongoCacheTraits>,
+                "Mongo cache traits must not specify find operation for "
+                "the updates from change stream, the change events are not "
+                "filtered");
+
   static_assert(kHasDeserializeObject<MongoCacheTraits> ||
                     kHasDefaultDeserializeObject<MongoCacheTraits>,
                 "Mongo cache traits must specify deserialize object");
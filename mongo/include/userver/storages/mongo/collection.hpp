@@ -11,6 +11,7 @@
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/value.hpp>
 #include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/write_result.hpp>
@@ -117,6 +118,13 @@ class Collection {
   template <typename... Options>
   Cursor Aggregate(formats::bson::Value pipeline, Options&&... options);
 
+  /// @brief Opens a change stream of the collection
+  /// @note Requires a replica set or a sharded cluster.
+  /// @see options::ResumeAfter
+  /// @see options::FullDocumentLookup
+  template <typename... Options>
+  ChangeStream Watch(Options&&... options) const;
+
   /// @name Prepared operation executors
   /// @{
   size_t Execute(const operations::Count&) const;
@@ -131,6 +139,7 @@ class Collection {
   WriteResult Execute(const operations::FindAndRemove&);
   WriteResult Execute(operations::Bulk&&);
   Cursor Execute(const operations::Aggregate&);
+  ChangeStream Execute(const operations::Watch&) const;
   /// @}
  private:
   std::shared_ptr<impl::CollectionImpl> impl_;
@@ -285,6 +294,13 @@ Cursor Collection::Aggregate(formats::bson::Value pipeline,
   return Execute(aggregate);
 }
 
+template <typename... Options>
+ChangeStream Collection::Watch(Options&&... options) const {
+  operations::Watch watch_op;
+  (watch_op.SetOption(std::forward<Options>(options)), ...);
+  return Execute(watch_op);
+}
+
 }  // namespace storages::mongo
 
 USERVER_NAMESPACE_END
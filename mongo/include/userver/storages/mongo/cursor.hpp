@@ -3,8 +3,11 @@
 /// @file userver/storages/mongo/cursor.hpp
 /// @brief @copybrief storages::mongo::Cursor
 
+#include <chrono>
+#include <cstddef>
 #include <iterator>
 #include <memory>
+#include <optional>
 
 #include <userver/formats/bson/document.hpp>
 
@@ -15,6 +18,16 @@ namespace impl {
 class CursorImpl;
 }  // namespace impl
 
+/// Statistics of the cursor read-ahead, see options::Prefetch
+struct CursorPrefetchStatistics {
+  /// Time the reader has waited for the documents to arrive
+  std::chrono::microseconds wait_time{0};
+  /// Time the reader has spent processing the documents between the reads
+  std::chrono::microseconds process_time{0};
+  /// Number of the batches received from the server
+  std::size_t batches{0};
+};
+
 /// Interface for MongoDB query cursors
 class Cursor {
  public:
@@ -61,6 +74,9 @@ class Cursor {
   Iterator begin();
   Iterator end();
 
+  /// Returns the read-ahead statistics if options::Prefetch is set
+  std::optional<CursorPrefetchStatistics> GetPrefetchStatistics() const;
+
  private:
   std::unique_ptr<impl::CursorImpl> impl_;
 };
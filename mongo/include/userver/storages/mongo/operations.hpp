@@ -95,12 +95,13 @@ class Find {
   void SetOption(options::Tailable);
   void SetOption(const options::Comment&);
   void SetOption(const options::MaxServerTime&);
+  void SetOption(const options::Prefetch&);
 
  private:
   friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
 
   class Impl;
-  static constexpr size_t kSize = 80;
+  static constexpr size_t kSize = 104;
   static constexpr size_t kAlignment = 8;
   // MAC_COMPAT: std::string size differs
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
@@ -321,12 +322,46 @@ class Aggregate {
   void SetOption(const options::Hint&);
   void SetOption(const options::Comment&);
   void SetOption(const options::MaxServerTime&);
+  void SetOption(const options::Prefetch&);
 
  private:
   friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
 
   class Impl;
-  static constexpr size_t kSize = 112;
+  static constexpr size_t kSize = 136;
+  static constexpr size_t kAlignment = 8;
+  // MAC_COMPAT: std::string size differs
+  utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
+};
+
+/// @brief Opens a change stream of the collection
+/// @see https://docs.mongodb.com/manual/changeStreams/
+class Watch {
+ public:
+  /// Watches all the changes of the collection
+  Watch();
+
+  /// Watches the changes passing through an aggregation pipeline
+  explicit Watch(formats::bson::Value pipeline);
+  ~Watch();
+
+  Watch(const Watch&);
+  Watch(Watch&&) noexcept;
+  Watch& operator=(const Watch&);
+  Watch& operator=(Watch&&) noexcept;
+
+  void SetOption(const options::ReadPreference&);
+  void SetOption(options::ReadPreference::Mode);
+  void SetOption(options::ReadConcern);
+  void SetOption(const options::ResumeAfter&);
+  void SetOption(options::FullDocumentLookup);
+  void SetOption(const options::MaxAwaitTime&);
+
+ private:
+  friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
+
+  class Impl;
+  static constexpr size_t kSize = 72;
   static constexpr size_t kAlignment = 8;
   // MAC_COMPAT: std::string size differs
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
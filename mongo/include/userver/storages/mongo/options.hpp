@@ -284,6 +284,60 @@ class MaxServerTime {
   std::chrono::milliseconds value_;
 };
 
+/// @brief Enables the read-ahead of the cursor: the next batches of the
+/// results are requested in background while the current one is processed
+/// @note The prefetched documents are kept in memory until they are read.
+/// @see Cursor::GetPrefetchStatistics
+class Prefetch {
+ public:
+  /// Prefetches up to 2 batches or 16 MiB of documents
+  Prefetch() = default;
+
+  Prefetch(size_t max_batches, size_t max_bytes)
+      : max_batches_(max_batches), max_bytes_(max_bytes) {}
+
+  /// Maximum number of the batches buffered ahead of the reader
+  size_t MaxBatches() const { return max_batches_; }
+
+  /// Maximum total size of the documents buffered ahead of the reader
+  size_t MaxBytes() const { return max_bytes_; }
+
+ private:
+  size_t max_batches_{2};
+  size_t max_bytes_{16 * 1024 * 1024};
+};
+
+/// @brief Resumes a change stream after the event with the specified token
+/// @see https://docs.mongodb.com/manual/changeStreams/#resume-a-change-stream
+class ResumeAfter {
+ public:
+  explicit ResumeAfter(formats::bson::Document token)
+      : token_(std::move(token)) {}
+
+  const formats::bson::Document& Value() const { return token_; }
+
+ private:
+  formats::bson::Document token_;
+};
+
+/// @brief Adds the current version of the document to the change events of
+/// updates
+/// @note The document might have been changed again since the update.
+class FullDocumentLookup {};
+
+/// @brief Specifies the time the server waits for new change events before
+/// returning an empty batch
+class MaxAwaitTime {
+ public:
+  explicit MaxAwaitTime(const std::chrono::milliseconds& value)
+      : value_(value) {}
+
+  const std::chrono::milliseconds& Value() const { return value_; }
+
+ private:
+  std::chrono::milliseconds value_;
+};
+
 }  // namespace storages::mongo::options
 
 USERVER_NAMESPACE_END
@@ -41,6 +41,19 @@ struct CorrectMongoCacheTraits {
       const std::chrono::system_clock::duration& correction);
 };
 
+struct ChangeStreamMongoCacheTraits {
+  static constexpr int kMongoCollectionsField = 0;
+  static constexpr int kKeyField = 0;
+  using DataType = std::unordered_map<int, int>;
+
+  static constexpr bool kIsSecondaryPreferred = true;
+  static constexpr bool kAreInvalidDocumentsSkipped = true;
+  static constexpr bool kUseDefaultDeserializeObject = true;
+  static constexpr bool kUseDefaultFindOperation = true;
+  static constexpr bool kUseChangeStream = true;
+  static constexpr bool kUseCursorPrefetch = true;
+};
+
 struct IncorrectReturnTypeOfFindOperation {
   static int GetFindOperation(
       cache::UpdateType type,
@@ -75,4 +88,19 @@ TEST(CheckTraits, CorrectTraits) {
   mongo_cache::impl::CheckTraits<CorrectMongoCacheTraits>{};
 }
 
+TEST(CheckTraits, ChangeStream) {
+  EXPECT_FALSE(
+      mongo_cache::impl::kIsChangeStreamUsed<CorrectMongoCacheTraits>);
+  EXPECT_TRUE(
+      mongo_cache::impl::kIsChangeStreamUsed<ChangeStreamMongoCacheTraits>);
+  mongo_cache::impl::CheckTraits<ChangeStreamMongoCacheTraits>{};
+}
+
+TEST(CheckTraits, CursorPrefetch) {
+  EXPECT_FALSE(
+      mongo_cache::impl::kIsCursorPrefetchUsed<CorrectMongoCacheTraits>);
+  EXPECT_TRUE(
+      mongo_cache::impl::kIsCursorPrefetchUsed<ChangeStreamMongoCacheTraits>);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,64 @@
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
+
+#include <bson/bson.h>
+#include <mongoc/mongoc.h>
+
+#include <userver/storages/mongo/mongo_error.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::cdriver {
+namespace {
+
+formats::bson::Document CopyDocument(const bson_t* native) {
+  return formats::bson::Document(
+      formats::bson::impl::MutableBson::CopyNative(native).Extract());
+}
+
+}  // namespace
+
+CDriverChangeStreamImpl::CDriverChangeStreamImpl(
+    cdriver::CDriverPoolImpl::BoundClientPtr client,
+    cdriver::ChangeStreamPtr stream,
+    std::shared_ptr<stats::ReadOperationStatistics> stats_ptr)
+    : client_(std::move(client)),
+      stream_(std::move(stream)),
+      stats_ptr_(std::move(stats_ptr)) {
+  UASSERT(client_ && stream_);
+}
+
+std::optional<formats::bson::Document> CDriverChangeStreamImpl::Next() {
+  stats::OperationStopwatch<stats::ReadOperationStatistics> next_sw(
+      stats_ptr_, stats::ReadOperationStatistics::kGetMore);
+
+  const bson_t* event_bson = nullptr;
+  if (mongoc_change_stream_next(stream_.get(), &event_bson)) {
+    // Most of the events are read from the already received batch
+    next_sw.Discard();
+    return CopyDocument(event_bson);
+  }
+
+  MongoError error;
+  const bson_t* error_reply = nullptr;
+  if (mongoc_change_stream_error_document(stream_.get(), error.GetNative(),
+                                          &error_reply)) {
+    next_sw.AccountError(error.GetKind());
+    error.Throw("Error iterating over change stream");
+  }
+  next_sw.AccountSuccess();
+  return std::nullopt;
+}
+
+std::optional<formats::bson::Document>
+CDriverChangeStreamImpl::GetResumeToken() const {
+  const bson_t* token = mongoc_change_stream_get_resume_token(stream_.get());
+  if (!token) return std::nullopt;
+  return CopyDocument(token);
+}
+
+}  // namespace storages::mongo::impl::cdriver
+
+USERVER_NAMESPACE_END
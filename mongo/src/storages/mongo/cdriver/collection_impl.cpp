@@ -12,11 +12,13 @@
 #include <userver/utils/text.hpp>
 
 #include <formats/bson/wrappers.hpp>
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
 #include <storages/mongo/operations_common.hpp>
 #include <storages/mongo/operations_impl.hpp>
+#include <storages/mongo/prefetch_cursor_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -104,6 +106,13 @@ impl::cdriver::FindAndModifyOptsPtr CopyFindAndModifyOptions(
   return result;
 }
 
+Cursor MakeCursor(std::unique_ptr<CursorImpl> cursor_impl,
+                  const std::optional<options::Prefetch>& prefetch) {
+  if (!prefetch) return Cursor(std::move(cursor_impl));
+  return Cursor(
+      std::make_unique<PrefetchCursorImpl>(std::move(cursor_impl), *prefetch));
+}
+
 }  // namespace
 
 CDriverCollectionImpl::CDriverCollectionImpl(PoolImplPtr pool_impl,
@@ -188,8 +197,10 @@ Cursor CDriverCollectionImpl::Execute(const operations::Find& find_op) const {
   impl::cdriver::CursorPtr cdriver_cursor(mongoc_collection_find_with_opts(
       collection.get(), native_filter_bson_ptr, impl::GetNative(options),
       find_op.impl_->read_prefs.Get()));
-  return Cursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
-      std::move(client), std::move(cdriver_cursor), std::move(stats_ptr)));
+  return MakeCursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
+                        std::move(client), std::move(cdriver_cursor),
+                        std::move(stats_ptr)),
+                    find_op.impl_->prefetch);
 }
 
 WriteResult CDriverCollectionImpl::Execute(
@@ -491,8 +502,41 @@ Cursor CDriverCollectionImpl::Execute(
   impl::cdriver::CursorPtr cdriver_cursor(mongoc_collection_aggregate(
       collection.get(), MONGOC_QUERY_NONE, native_pipeline_bson_ptr,
       impl::GetNative(options), aggregate_op.impl_->read_prefs.Get()));
-  return Cursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
-      std::move(client), std::move(cdriver_cursor), std::move(stats_ptr)));
+  return MakeCursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
+                        std::move(client), std::move(cdriver_cursor),
+                        std::move(stats_ptr)),
+                    aggregate_op.impl_->prefetch);
+}
+
+ChangeStream CDriverCollectionImpl::Execute(
+    const operations::Watch& watch_op) const {
+  auto span = MakeSpan("mongo_watch");
+  auto [client, collection] = GetCDriverCollection();
+  auto stats_ptr = statistics_->read[watch_op.impl_->read_prefs_desc];
+
+  if (watch_op.impl_->read_prefs) {
+    mongoc_collection_set_read_prefs(collection.get(),
+                                     watch_op.impl_->read_prefs.Get());
+  }
+
+  MongoError error;
+  stats::OperationStopwatch watch_sw(stats_ptr,
+                                     stats::ReadOperationStatistics::kWatch);
+  auto pipeline_doc = watch_op.impl_->pipeline.GetInternalArrayDocument();
+  const bson_t* native_pipeline_bson_ptr = pipeline_doc.GetBson().get();
+  // The stream keeps a copy of the collection
+  cdriver::ChangeStreamPtr stream(
+      mongoc_collection_watch(collection.get(), native_pipeline_bson_ptr,
+                              impl::GetNative(watch_op.impl_->options)));
+  const bson_t* error_reply = nullptr;
+  if (mongoc_change_stream_error_document(stream.get(), error.GetNative(),
+                                          &error_reply)) {
+    watch_sw.AccountError(error.GetKind());
+    error.Throw("Error opening change stream");
+  }
+  watch_sw.AccountSuccess();
+  return ChangeStream(std::make_unique<cdriver::CDriverChangeStreamImpl>(
+      std::move(client), std::move(stream), std::move(stats_ptr)));
 }
 
 cdriver::CDriverPoolImpl::BoundClientPtr
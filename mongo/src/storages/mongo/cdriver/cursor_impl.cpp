@@ -70,7 +70,8 @@ void CDriverCursorImpl::Next() {
       break;
     }
   }
-  if (batch_num_before == mongoc_cursor_get_batch_num(cursor_.get())) {
+  batch_num_ = mongoc_cursor_get_batch_num(cursor_.get());
+  if (batch_num_before == batch_num_) {
     cursor_next_sw.Discard();
   } else if (!error) {
     cursor_next_sw.AccountSuccess();
@@ -86,6 +87,13 @@ void CDriverCursorImpl::Next() {
   }
 }
 
+int CDriverCursorImpl::GetBatchNum() const { return batch_num_; }
+
+std::optional<CursorPrefetchStatistics>
+CDriverCursorImpl::GetPrefetchStatistics() const {
+  return std::nullopt;
+}
+
 }  // namespace storages::mongo::impl::cdriver
 
 USERVER_NAMESPACE_END
@@ -27,8 +27,14 @@ class CDriverCursorImpl : public CursorImpl {
   const formats::bson::Document& Current() const override;
   void Next() override;
 
+  int GetBatchNum() const override;
+
+  std::optional<CursorPrefetchStatistics> GetPrefetchStatistics()
+      const override;
+
  private:
   std::optional<formats::bson::Document> current_;
+  int batch_num_{-1};
   cdriver::CDriverPoolImpl::BoundClientPtr client_;
   cdriver::CursorPtr cursor_;
   std::shared_ptr<stats::ReadOperationStatistics> stats_ptr_;
@@ -57,6 +57,10 @@ Cursor Collection::Execute(const operations::Aggregate& aggregate_op) {
   return impl_->Execute(aggregate_op);
 }
 
+ChangeStream Collection::Execute(const operations::Watch& watch_op) const {
+  return impl_->Execute(watch_op);
+}
+
 }  // namespace storages::mongo
 
 USERVER_NAMESPACE_END
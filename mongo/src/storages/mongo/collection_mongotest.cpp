@@ -1,5 +1,10 @@
 #include "collection_mongotest.hpp"
 
+#include <chrono>
+#include <optional>
+#include <utility>
+#include <vector>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -534,4 +539,46 @@ UTEST(Collection, ExecuteOps) {
   EXPECT_EQ(GetWinners(mongo_coll), "some_name_3 <anonymous> some_name_1 ");
 }
 
+UTEST(Collection, Watch) {
+  auto dns_resolver = MakeDnsResolver();
+  auto pool = MakeTestPool(&dns_resolver);
+  auto coll = pool.GetCollection("watch");
+
+  const options::MaxAwaitTime max_await_time{std::chrono::milliseconds{10}};
+  std::optional<Document> start_token;
+  try {
+    start_token = coll.Watch(max_await_time).GetResumeToken();
+  } catch (const ServerException& e) {
+    GTEST_SKIP() << "Change streams are not supported: " << e.what();
+  }
+  ASSERT_TRUE(start_token);
+
+  coll.InsertOne(MakeDoc("_id", 1, "x", 1));
+  coll.UpdateOne(MakeDoc("_id", 1), MakeDoc("$set", MakeDoc("x", 2)));
+  coll.DeleteOne(MakeDoc("_id", 1));
+
+  const auto read_events = [&](const Document& resume_token) {
+    auto stream = coll.Watch(options::ResumeAfter{resume_token},
+                             options::FullDocumentLookup{}, max_await_time);
+    std::vector<Document> events;
+    while (auto event = stream.Next()) events.push_back(std::move(*event));
+    return std::make_pair(std::move(events), stream.GetResumeToken());
+  };
+
+  auto [events, token] = read_events(*start_token);
+  ASSERT_EQ(3, events.size());
+  EXPECT_EQ("insert", events[0]["operationType"].As<std::string>());
+  EXPECT_EQ(1, events[0]["fullDocument"]["x"].As<int>());
+  EXPECT_EQ("update", events[1]["operationType"].As<std::string>());
+  EXPECT_EQ("delete", events[2]["operationType"].As<std::string>());
+  EXPECT_EQ(1, events[2]["documentKey"]["_id"].As<int>());
+
+  // Resumes after the last read event
+  ASSERT_TRUE(token);
+  EXPECT_TRUE(read_events(*token).first.empty());
+
+  const Document insert_token = events[0]["_id"];
+  EXPECT_EQ(2, read_events(insert_token).first.size());
+}
+
 USERVER_NAMESPACE_END
@@ -21,6 +21,11 @@ Cursor::Iterator Cursor::begin() { return Iterator(this); }
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 Cursor::Iterator Cursor::end() { return Iterator(nullptr); }
 
+std::optional<CursorPrefetchStatistics> Cursor::GetPrefetchStatistics()
+    const {
+  return impl_->GetPrefetchStatistics();
+}
+
 Cursor::Iterator::Iterator(Cursor* cursor) : cursor_(cursor) {
   if (cursor_ && !cursor_->impl_->IsValid()) cursor_ = nullptr;
 }
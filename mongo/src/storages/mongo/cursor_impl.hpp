@@ -1,6 +1,9 @@
 #pragma once
 
+#include <optional>
+
 #include <userver/formats/bson/document.hpp>
+#include <userver/storages/mongo/cursor.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,6 +18,12 @@ class CursorImpl {
 
   virtual const formats::bson::Document& Current() const = 0;
   virtual void Next() = 0;
+
+  /// Number of the batches received from the server, -1 if unknown
+  virtual int GetBatchNum() const = 0;
+
+  virtual std::optional<CursorPrefetchStatistics> GetPrefetchStatistics()
+      const = 0;
 };
 
 }  // namespace storages::mongo::impl
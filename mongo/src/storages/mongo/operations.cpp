@@ -3,6 +3,7 @@
 #include <mongoc/mongoc.h>
 
 #include <userver/formats/bson/bson_builder.hpp>
+#include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/utils/assert.hpp>
@@ -369,6 +370,10 @@ void Find::SetOption(const options::MaxServerTime& max_server_time) {
                       impl_->has_max_server_time_option, max_server_time);
 }
 
+void Find::SetOption(const options::Prefetch& prefetch) {
+  impl_->prefetch = prefetch;
+}
+
 InsertOne::InsertOne(formats::bson::Document document)
     : impl_(std::move(document)) {}
 
@@ -736,6 +741,60 @@ void Aggregate::SetOption(const options::MaxServerTime& max_server_time) {
                       impl_->has_max_server_time_option, max_server_time);
 }
 
+void Aggregate::SetOption(const options::Prefetch& prefetch) {
+  impl_->prefetch = prefetch;
+}
+
+Watch::Watch() : Watch(formats::bson::MakeArray()) {}
+
+Watch::Watch(formats::bson::Value pipeline) : impl_(std::move(pipeline)) {
+  if (!impl_->pipeline.IsArray()) {
+    throw InvalidQueryArgumentException(
+        "Change stream pipeline is not an array");
+  }
+}
+
+Watch::~Watch() = default;
+
+// NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+Watch::Watch(const Watch& other) = default;
+// NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+Watch::Watch(Watch&&) noexcept = default;
+Watch& Watch::operator=(const Watch& rhs) = default;
+Watch& Watch::operator=(Watch&&) noexcept = default;
+
+void Watch::SetOption(const options::ReadPreference& read_prefs) {
+  impl_->read_prefs = MakeCDriverReadPrefs(read_prefs);
+  impl_->read_prefs_desc = MakeReadPrefsDescription(read_prefs);
+}
+
+void Watch::SetOption(options::ReadPreference::Mode mode) {
+  impl_->read_prefs = MakeCDriverReadPrefs(mode);
+  impl_->read_prefs_desc = MakeReadPrefsDescription(mode);
+}
+
+void Watch::SetOption(options::ReadConcern level) {
+  AppendReadConcern(impl::EnsureBuilder(impl_->options), level);
+}
+
+void Watch::SetOption(const options::ResumeAfter& resume_after) {
+  static const std::string kOptionName = "resumeAfter";
+  impl::EnsureBuilder(impl_->options)
+      .Append(kOptionName, resume_after.Value());
+}
+
+void Watch::SetOption(options::FullDocumentLookup) {
+  static const std::string kOptionName = "fullDocument";
+  static const std::string kUpdateLookup = "updateLookup";
+  impl::EnsureBuilder(impl_->options).Append(kOptionName, kUpdateLookup);
+}
+
+void Watch::SetOption(const options::MaxAwaitTime& max_await_time) {
+  static const std::string kOptionName = "maxAwaitTimeMS";
+  AppendUint64Option(impl::EnsureBuilder(impl_->options), kOptionName,
+                     max_await_time.Value().count());
+}
+
 }  // namespace storages::mongo::operations
 
 USERVER_NAMESPACE_END
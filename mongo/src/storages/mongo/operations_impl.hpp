@@ -48,6 +48,7 @@ class Find::Impl {
   std::optional<formats::bson::impl::BsonBuilder> options;
   bool has_comment_option{false};
   bool has_max_server_time_option{false};
+  std::optional<options::Prefetch> prefetch;
 };
 
 class InsertOne::Impl {
@@ -159,6 +160,18 @@ class Aggregate::Impl {
   std::optional<formats::bson::impl::BsonBuilder> options;
   bool has_comment_option{false};
   bool has_max_server_time_option{false};
+  std::optional<options::Prefetch> prefetch;
+};
+
+class Watch::Impl {
+ public:
+  explicit Impl(formats::bson::Value pipeline_)
+      : pipeline(std::move(pipeline_)) {}
+
+  formats::bson::Value pipeline;
+  std::string read_prefs_desc{kDefaultReadPrefDesc};
+  impl::cdriver::ReadPrefsPtr read_prefs;
+  std::optional<formats::bson::impl::BsonBuilder> options;
 };
 
 void AppendComment(formats::bson::impl::BsonBuilder& builder,
@@ -534,6 +534,62 @@ UTEST(Options, Sort) {
   }
 }
 
+UTEST(Options, Prefetch) {
+  auto dns_resolver = MakeDnsResolver();
+  auto pool = MakeTestPool(dns_resolver);
+  auto coll = pool.GetCollection("prefetch");
+
+  // More than the default first batch of 101 documents
+  constexpr int kDocsCount = 300;
+  for (int i = 0; i < kDocsCount; ++i) coll.InsertOne(MakeDoc("_id", i));
+
+  const auto check_cursor = [&](Cursor& cursor) {
+    int expected_id = 0;
+    for (const auto& doc : cursor) {
+      EXPECT_EQ(expected_id++, doc["_id"].As<int>());
+    }
+    EXPECT_EQ(kDocsCount, expected_id);
+    EXPECT_FALSE(cursor.HasMore());
+
+    auto stats = cursor.GetPrefetchStatistics();
+    ASSERT_TRUE(stats);
+    EXPECT_GE(stats->batches, 1u);
+  };
+
+  {
+    auto cursor = coll.Find({});
+    EXPECT_FALSE(cursor.GetPrefetchStatistics());
+  }
+  {
+    auto cursor =
+        coll.Find({}, options::Sort{{"_id", options::Sort::kAscending}},
+                  options::Prefetch{});
+    check_cursor(cursor);
+    EXPECT_GE(cursor.GetPrefetchStatistics()->batches, 2u);
+  }
+  {
+    // Buffers a single document at a time
+    auto cursor =
+        coll.Find({}, options::Sort{{"_id", options::Sort::kAscending}},
+                  options::Prefetch{1, 1});
+    check_cursor(cursor);
+  }
+  {
+    auto cursor = coll.Aggregate(
+        MakeArray(MakeDoc("$sort", MakeDoc("_id", 1))), options::Prefetch{});
+    check_cursor(cursor);
+  }
+  {
+    // Stops the prefetch of an unread cursor
+    auto cursor = coll.Find({}, options::Prefetch{});
+    ASSERT_TRUE(cursor);
+  }
+  {
+    auto cursor = coll.Find(MakeDoc("_id", -1), options::Prefetch{});
+    EXPECT_FALSE(cursor);
+  }
+}
+
 UTEST(Options, Hint) {
   auto dns_resolver = MakeDnsResolver();
   auto pool = MakeTestPool(dns_resolver);
@@ -0,0 +1,175 @@
+#include <storages/mongo/prefetch_cursor_impl.hpp>
+
+#include <stdexcept>
+
+#include <bson/bson.h>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl {
+namespace {
+
+const std::string kPrefetchTaskName = "mongo-cursor-prefetch";
+
+}  // namespace
+
+PrefetchCursorImpl::PrefetchCursorImpl(std::unique_ptr<CursorImpl> cursor,
+                                       const options::Prefetch& prefetch)
+    : cursor_(std::move(cursor)), prefetch_(prefetch) {
+  UASSERT(cursor_);
+  last_read_ = std::chrono::steady_clock::now();
+  if (!cursor_->IsValid()) {
+    is_finished_ = true;
+    return;
+  }
+
+  // The first batch is received on the cursor creation
+  current_ = cursor_->Current();
+  current_batch_num_ = last_batch_num_ = cursor_->GetBatchNum();
+  batches_ = 1;
+  // The reader would wait forever if the task is not started
+  task_ = utils::CriticalAsync(kPrefetchTaskName, [this] { Prefetch(); });
+}
+
+PrefetchCursorImpl::~PrefetchCursorImpl() {
+  if (task_.IsValid()) task_.SyncCancel();
+}
+
+bool PrefetchCursorImpl::IsValid() const { return current_.has_value(); }
+
+bool PrefetchCursorImpl::HasMore() const {
+  if (read_pos_ < read_batch_.docs.size()) return true;
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  return !queue_.empty() || !is_finished_;
+}
+
+const formats::bson::Document& PrefetchCursorImpl::Current() const {
+  if (!IsValid()) throw std::logic_error("Reading from invalid cursor");
+  return *current_;
+}
+
+void PrefetchCursorImpl::Next() {
+  if (!IsValid()) throw std::logic_error("Advancing cursor past the end");
+
+  const auto wait_start = std::chrono::steady_clock::now();
+  process_time_ += wait_start - last_read_;
+  current_ = std::nullopt;
+  if (read_pos_ == read_batch_.docs.size()) {
+    {
+      std::unique_lock<engine::Mutex> lock(mutex_);
+      if (!items_cv_.Wait(
+              lock, [this] { return !queue_.empty() || is_finished_; })) {
+        throw engine::WaitInterruptedException(
+            engine::current_task::CancellationReason());
+      }
+
+      if (!queue_.empty()) {
+        read_batch_ = std::move(queue_.front());
+        read_pos_ = 0;
+        queue_size_ -= read_batch_.size;
+        queue_.pop_front();
+      } else if (error_) {
+        std::rethrow_exception(error_);
+      }
+    }
+    capacity_cv_.NotifyOne();
+  }
+
+  if (read_pos_ < read_batch_.docs.size()) {
+    current_ = std::move(read_batch_.docs[read_pos_++]);
+    current_batch_num_ = read_batch_.batch_num;
+  }
+
+  last_read_ = std::chrono::steady_clock::now();
+  wait_time_ += last_read_ - wait_start;
+}
+
+int PrefetchCursorImpl::GetBatchNum() const { return current_batch_num_; }
+
+std::optional<CursorPrefetchStatistics>
+PrefetchCursorImpl::GetPrefetchStatistics() const {
+  CursorPrefetchStatistics stats;
+  stats.wait_time =
+      std::chrono::duration_cast<std::chrono::microseconds>(wait_time_);
+  stats.process_time =
+      std::chrono::duration_cast<std::chrono::microseconds>(process_time_);
+
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  stats.batches = batches_;
+  return stats;
+}
+
+void PrefetchCursorImpl::Prefetch() {
+  // The rest of the first batch, its first document is already read
+  Batch batch;
+  batch.batch_num = cursor_->GetBatchNum();
+
+  std::exception_ptr error;
+  try {
+    while (WaitCapacity(batch)) {
+      // Requests the next batch from the server once the current one is read
+      cursor_->Next();
+      if (!cursor_->IsValid()) break;
+
+      // A batch is complete once the cursor moves past it. Without the batch
+      // numbers the documents are handed over one by one.
+      const auto batch_num = cursor_->GetBatchNum();
+      if (batch_num != batch.batch_num || batch_num == -1) {
+        if (!batch.docs.empty()) Push(std::move(batch));
+        batch = Batch{};
+        batch.batch_num = batch_num;
+      }
+
+      const auto& doc = cursor_->Current();
+      batch.size += doc.GetBson()->len;
+      batch.docs.push_back(doc);
+    }
+  } catch (const std::exception&) {
+    error = std::current_exception();
+  }
+
+  {
+    std::lock_guard<engine::Mutex> lock(mutex_);
+    if (!batch.docs.empty()) PushLocked(std::move(batch));
+    is_finished_ = true;
+    error_ = std::move(error);
+  }
+  items_cv_.NotifyOne();
+}
+
+void PrefetchCursorImpl::Push(Batch&& batch) {
+  {
+    std::lock_guard<engine::Mutex> lock(mutex_);
+    PushLocked(std::move(batch));
+  }
+  items_cv_.NotifyOne();
+}
+
+void PrefetchCursorImpl::PushLocked(Batch&& batch) {
+  if (batch.batch_num != last_batch_num_) {
+    last_batch_num_ = batch.batch_num;
+    ++batches_;
+  }
+  queue_size_ += batch.size;
+  queue_.push_back(std::move(batch));
+}
+
+bool PrefetchCursorImpl::WaitCapacity(const Batch& pending) {
+  std::unique_lock<engine::Mutex> lock(mutex_);
+  return capacity_cv_.Wait(lock, [this, &pending] {
+    if (queue_.empty()) return true;
+    if (queue_size_ + pending.size >= prefetch_.MaxBytes()) return false;
+    // The next document may start a new batch
+    const auto batches_ahead = queue_.size() + (pending.docs.empty() ? 0 : 1);
+    return batches_ahead < prefetch_.MaxBatches();
+  });
+}
+
+}  // namespace storages::mongo::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/bson/document.hpp>
+#include <userver/storages/mongo/options.hpp>
+
+#include <storages/mongo/cursor_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl {
+
+/// Reads the wrapped cursor in a background task ahead of the reader, so that
+/// the getMore requests overlap with the processing of the documents.
+/// The documents are handed over to the reader a whole batch at a time.
+class PrefetchCursorImpl : public CursorImpl {
+ public:
+  PrefetchCursorImpl(std::unique_ptr<CursorImpl> cursor,
+                     const options::Prefetch& prefetch);
+  ~PrefetchCursorImpl() override;
+
+  bool IsValid() const override;
+  bool HasMore() const override;
+
+  const formats::bson::Document& Current() const override;
+  void Next() override;
+
+  int GetBatchNum() const override;
+
+  std::optional<CursorPrefetchStatistics> GetPrefetchStatistics()
+      const override;
+
+ private:
+  /// Documents of a single server batch, handed over to the reader at once
+  struct Batch {
+    std::vector<formats::bson::Document> docs;
+    int batch_num{-1};
+    std::size_t size{0};
+  };
+
+  void Prefetch();
+  bool WaitCapacity(const Batch& pending);
+  void Push(Batch&& batch);
+  void PushLocked(Batch&& batch);
+
+  const std::unique_ptr<CursorImpl> cursor_;
+  const options::Prefetch prefetch_;
+
+  mutable engine::Mutex mutex_;
+  engine::ConditionVariable items_cv_;
+  engine::ConditionVariable capacity_cv_;
+  std::deque<Batch> queue_;
+  std::size_t queue_size_{0};
+  bool is_finished_{false};
+  std::exception_ptr error_;
+  std::size_t batches_{0};
+  // Only accessed by the prefetch task after the start
+  int last_batch_num_{-1};
+
+  // Only accessed by the reader
+  Batch read_batch_;
+  std::size_t read_pos_{0};
+  std::optional<formats::bson::Document> current_;
+  int current_batch_num_{-1};
+  std::chrono::steady_clock::duration wait_time_{};
+  std::chrono::steady_clock::duration process_time_{};
+  std::chrono::steady_clock::time_point last_read_;
+
+  engine::TaskWithResult<void> task_;
+};
+
+}  // namespace storages::mongo::impl
+
+USERVER_NAMESPACE_END
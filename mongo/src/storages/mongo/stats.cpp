@@ -101,6 +101,8 @@ std::string ToString(ReadOperationStatistics::OpType type) {
       return "find";
     case Type::kGetMore:
       return "getmore";
+    case Type::kWatch:
+      return "watch";
   }
 
   UINVARIANT(false, "Unexpected type");
@@ -66,6 +66,7 @@ struct ReadOperationStatistics {
     kCountApprox,
     kFind,
     kGetMore,
+    kWatch,
   };
 
   rcu::RcuMap<OpType, Aggregator<OperationStatisticsItem>> items;
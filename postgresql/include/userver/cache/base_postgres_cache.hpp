@@ -9,6 +9,7 @@
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -22,9 +23,14 @@
 #include <userver/storages/postgres/io/chrono.hpp>
 
 #include <userver/compiler/demangle.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/meta.hpp>
 #include <userver/utils/void_t.hpp>
@@ -51,6 +57,7 @@ namespace components {
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
 /// chunk-size | number of rows to request from PostgreSQL, 0 to fetch all rows in one request | 1000
+/// notify-debounce | time to gather notifications into a single update, see `kNotifyChannel` below | 100ms
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -82,6 +89,31 @@ namespace components {
 ///
 /// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Custom Container With Write Notification Example
 ///
+/// Big caches could be loaded faster on full updates with the binary COPY
+/// protocol, see @ref pg_run_queries. To do so set the `kUseCopyForFullUpdates`
+/// policy member to `true`. The rows are streamed and put into the cache as
+/// soon as they arrive, `chunk-size` is not used for full updates in this case.
+/// The types of the `RawValueType` (or `ValueType`) members must match the
+/// types of the selected columns exactly, and the query must not contain
+/// parameters.
+/// A row that fails to be parsed fails the whole update.
+///
+/// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Copy Example
+///
+/// Changes could be delivered to the cache sooner than the next periodic
+/// update with PostgreSQL `LISTEN`/`NOTIFY`. To do so set the `kNotifyChannel`
+/// policy member to the name of the notification channel and send a
+/// notification to the channel on every change of the data, e.g. from a
+/// trigger on the table. The cache holds a connection to the master host of
+/// each shard subscribed to the channel and runs an update (incremental if
+/// allowed) after each notification. Notifications that arrive within
+/// `notify-debounce` after the first one are coalesced into a single update.
+/// The periodic updates still run and serve as a fallback in case of lost
+/// notifications or connection failures, so their interval could be increased
+/// considerably.
+///
+/// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Notify Example
+///
 /// @section pg_cc_forward_declaration Forward Declaration
 ///
 /// To forward declare a cache you can forward declare a trait and
@@ -280,6 +312,26 @@ constexpr bool MayReturnNull() {
   }
 }
 
+// Use COPY for full updates policy
+template <typename T>
+using HasUseCopyForFullUpdates = decltype(T::kUseCopyForFullUpdates);
+
+template <typename T>
+constexpr bool UseCopyForFullUpdates() {
+  if constexpr (meta::kIsDetected<HasUseCopyForFullUpdates, T>) {
+    return T::kUseCopyForFullUpdates;
+  } else {
+    return false;
+  }
+}
+
+// Notification channel policy
+template <typename T>
+using HasNotifyChannel = decltype(T::kNotifyChannel);
+
+template <typename T>
+inline constexpr bool kHasNotifyChannel = meta::kIsDetected<HasNotifyChannel, T>;
+
 template <typename PostgreCachePolicy>
 struct PolicyChecker {
   // Static assertions for cache traits
@@ -337,6 +389,12 @@ inline constexpr std::string_view kFetchStage = "fetch";
 inline constexpr std::string_view kParseStage = "parse";
 
 inline constexpr std::size_t kDefaultChunkSize = 1000;
+// Rows are decoded column by column in batches of this size, the CPU is relaxed
+// between the batches
+inline constexpr std::size_t kParseBatchSize = 1000;
+
+inline constexpr std::chrono::milliseconds kDefaultNotifyDebounce{100};
+inline constexpr std::chrono::seconds kNotifyRetryInterval{1};
 }  // namespace pg_cache::detail
 
 /// @ingroup userver_components
@@ -364,6 +422,10 @@ class PostgreCache final
       pg_cache::detail::kWantIncrementalUpdates<PolicyType>;
   constexpr static auto kClusterHostTypeFlags =
       pg_cache::detail::ClusterHostType<PolicyType>();
+  constexpr static bool kUseCopyForFullUpdates =
+      pg_cache::detail::UseCopyForFullUpdates<PolicyType>();
+  constexpr static bool kListenNotifications =
+      pg_cache::detail::kHasNotifyChannel<PolicyType>;
   constexpr static auto kName = PolicyType::kName;
 
   PostgreCache(const ComponentConfig&, const ComponentContext&);
@@ -389,10 +451,15 @@ class PostgreCache final
   void CacheResults(storages::postgres::ResultSet res, CachedData& data_cache,
                     cache::UpdateStatisticsScope& stats_scope,
                     tracing::ScopeTime& scope);
+  void CacheResult(RawValueType&& raw, CachedData& data_cache,
+                   cache::UpdateStatisticsScope& stats_scope);
 
   static storages::postgres::Query GetAllQuery();
   static storages::postgres::Query GetDeltaQuery();
 
+  void ListenNotifications(const storages::postgres::ClusterPtr& cluster);
+  void UpdateOnNotification();
+
   static std::chrono::milliseconds ParseCorrection(
       const ComponentConfig& config);
 
@@ -402,8 +469,10 @@ class PostgreCache final
   const std::chrono::milliseconds full_update_timeout_;
   const std::chrono::milliseconds incremental_update_timeout_;
   const std::size_t chunk_size_;
+  const std::chrono::milliseconds notify_debounce_;
   std::size_t cpu_relax_iterations_parse_{0};
   std::size_t cpu_relax_iterations_copy_{0};
+  std::vector<engine::TaskWithResult<void>> listen_tasks_;
 };
 
 template <typename PostgreCachePolicy>
@@ -421,7 +490,9 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
           config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
               pg_cache::detail::kDefaultIncrementalUpdateTimeout)},
       chunk_size_{config["chunk-size"].As<size_t>(
-          pg_cache::detail::kDefaultChunkSize)} {
+          pg_cache::detail::kDefaultChunkSize)},
+      notify_debounce_{config["notify-debounce"].As<std::chrono::milliseconds>(
+          pg_cache::detail::kDefaultNotifyDebounce)} {
   if (this->GetAllowedUpdateTypes() ==
           cache::AllowedUpdateTypes::kFullAndIncremental &&
       !kIncrementalUpdates) {
@@ -454,10 +525,22 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
              << GetDeltaQuery().Statement() << "`";
 
   this->StartPeriodicUpdates();
+
+  if constexpr (kListenNotifications) {
+    listen_tasks_.reserve(clusters_.size());
+    for (const auto& cluster : clusters_) {
+      listen_tasks_.push_back(utils::CriticalAsync(
+          this->GetCacheTaskProcessor(), "pg-cache-listen/" + this->Name(),
+          [this, &cluster] { ListenNotifications(cluster); }));
+    }
+  }
 }
 
 template <typename PostgreCachePolicy>
 PostgreCache<PostgreCachePolicy>::~PostgreCache() {
+  for (auto& task : listen_tasks_) {
+    task.SyncCancel();
+  }
   this->StopPeriodicUpdates();
 }
 
@@ -493,6 +576,50 @@ storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetDeltaQuery() {
   }
 }
 
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::ListenNotifications(
+    const storages::postgres::ClusterPtr& cluster) {
+  namespace pg = storages::postgres;
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      auto scope = cluster->Listen(PolicyType::kNotifyChannel);
+      // Pick up the changes made while there was no subscription
+      UpdateOnNotification();
+      while (true) {
+        scope.WaitNotify(engine::Deadline{});
+        // Coalesce a burst of notifications into a single update
+        const auto debounce_deadline =
+            engine::Deadline::FromDuration(notify_debounce_);
+        try {
+          while (true) scope.WaitNotify(debounce_deadline);
+        } catch (const pg::ConnectionTimeoutError&) {
+        }
+        UpdateOnNotification();
+      }
+    } catch (const std::exception& e) {
+      if (engine::current_task::ShouldCancel()) break;
+      LOG_WARNING() << "Cache " << kName << " failed to listen to channel '"
+                    << PolicyType::kNotifyChannel << "': " << e;
+      engine::InterruptibleSleepFor(pg_cache::detail::kNotifyRetryInterval);
+    }
+  }
+}
+
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::UpdateOnNotification() {
+  const auto type = this->GetAllowedUpdateTypes() ==
+                            cache::AllowedUpdateTypes::kOnlyFull
+                        ? cache::UpdateType::kFull
+                        : cache::UpdateType::kIncremental;
+  try {
+    this->cache::CacheUpdateTrait::Update(type);
+  } catch (const std::exception& e) {
+    // The periodic update will retry
+    LOG_WARNING() << "Cache " << kName
+                  << " failed to update on notification: " << e;
+  }
+}
+
 template <typename PostgreCachePolicy>
 std::chrono::milliseconds PostgreCache<PostgreCachePolicy>::ParseCorrection(
     const ComponentConfig& config) {
@@ -543,6 +670,27 @@ void PostgreCache<PostgreCachePolicy>::Update(
   size_t changes = 0;
   // Iterate clusters
   for (auto cluster : clusters_) {
+    if constexpr (kUseCopyForFullUpdates) {
+      if (type == cache::UpdateType::kFull) {
+        auto trx = cluster->Begin(
+            kClusterHostTypeFlags, pg::Transaction::RO,
+            pg::CommandControl{timeout,
+                               pg_cache::detail::kStatementTimeoutOff});
+        // Rows are parsed as soon as they arrive, fetching is accounted as
+        // parsing
+        scope.Reset(std::string{pg_cache::detail::kParseStage});
+        utils::CpuRelax relax{cpu_relax_iterations_parse_, &scope};
+        const auto rows = trx.template CopyOut<RawValueType>(
+            query, [&](RawValueType&& raw) {
+              relax.Relax();
+              CacheResult(std::move(raw), data_cache, stats_scope);
+            });
+        trx.Commit();
+        stats_scope.IncreaseDocumentsReadCount(rows);
+        changes += rows;
+        continue;
+      }
+    }
     if (chunk_size_ > 0) {
       auto trx = cluster->Begin(
           kClusterHostTypeFlags, pg::Transaction::RO,
@@ -630,22 +778,46 @@ template <typename PostgreCachePolicy>
 void PostgreCache<PostgreCachePolicy>::CacheResults(
     storages::postgres::ResultSet res, CachedData& data_cache,
     cache::UpdateStatisticsScope& stats_scope, tracing::ScopeTime& scope) {
-  auto values = res.AsSetOf<RawValueType>(storages::postgres::kRowTag);
+  const auto on_parse_error = [&stats_scope](const std::exception& e) {
+    stats_scope.IncreaseDocumentsParseFailures(1);
+    LOG_ERROR() << "Error parsing data row in cache '" << kName << "' to '"
+                << compiler::GetTypeName<ValueType>() << "': " << e.what();
+  };
+
   utils::CpuRelax relax{cpu_relax_iterations_parse_, &scope};
-  for (auto p = values.begin(); p != values.end(); ++p) {
-    relax.Relax();
-    try {
-      auto value = pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p);
-      auto key = std::invoke(PolicyType::kKeyMember, value);
-      data_cache->insert_or_assign(std::move(key), std::move(value));
-    } catch (const std::exception& e) {
-      stats_scope.IncreaseDocumentsParseFailures(1);
-      LOG_ERROR() << "Error parsing data row in cache '" << kName << "' to '"
-                  << compiler::GetTypeName<ValueType>() << "': " << e.what();
+  for (std::size_t first_row = 0; first_row < res.Size();
+       first_row += pg_cache::detail::kParseBatchSize) {
+    auto values = res.AsVectorOf<RawValueType>(
+        storages::postgres::kRowTag, first_row,
+        pg_cache::detail::kParseBatchSize,
+        [&](std::size_t, const std::exception& e) { on_parse_error(e); });
+    for (auto& value : values) {
+      relax.Relax();
+      try {
+        CacheResult(std::move(value), data_cache, stats_scope);
+      } catch (const std::exception& e) {
+        on_parse_error(e);
+      }
     }
   }
 }
 
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::CacheResult(
+    RawValueType&& raw, CachedData& data_cache,
+    cache::UpdateStatisticsScope& stats_scope) {
+  try {
+    auto value =
+        pg_cache::detail::ExtractValue<PostgreCachePolicy>(std::move(raw));
+    auto key = std::invoke(PolicyType::kKeyMember, value);
+    data_cache->insert_or_assign(std::move(key), std::move(value));
+  } catch (const std::exception& e) {
+    stats_scope.IncreaseDocumentsParseFailures(1);
+    LOG_ERROR() << "Error parsing data row in cache '" << kName << "' to '"
+                << compiler::GetTypeName<ValueType>() << "': " << e.what();
+  }
+}
+
 template <typename PostgreCachePolicy>
 typename PostgreCache<PostgreCachePolicy>::CachedData
 PostgreCache<PostgreCachePolicy>::GetDataSnapshot(cache::UpdateType type,
@@ -13,8 +13,11 @@
 
 #include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
+#include <userver/storages/postgres/result_stream.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
@@ -171,6 +174,51 @@ class Cluster {
   ResultSet Execute(ClusterHostTypeFlags flags,
                     OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
+
+  /// @brief Execute the statements of the batch in a single network round
+  /// trip at host of specified type.
+  ///
+  /// The statements are executed in an implicit transaction.
+  /// @note You must specify at least one role from ClusterHostType here
+  QueryBatchResult Execute(ClusterHostTypeFlags flags,
+                           const QueryBatch& batch);
+
+  /// @brief Execute the statements of the batch in a single network round
+  /// trip with specified host selection rules and command control settings.
+  ///
+  /// The statements are executed in an implicit transaction.
+  /// @note You must specify at least one role from ClusterHostType here
+  QueryBatchResult Execute(ClusterHostTypeFlags flags,
+                           OptionalCommandControl batch_cmd_ctl,
+                           const QueryBatch& batch);
+
+  /// @brief Execute a statement at host of specified type and read its
+  /// results row by row as they arrive, see ResultStream.
+  ///
+  /// The connection is held by the stream until it is destroyed.
+  /// @note You must specify at least one role from ClusterHostType here
+  template <typename... Args>
+  ResultStream Stream(ClusterHostTypeFlags, const Query& query,
+                      const Args&... args);
+
+  /// @brief Execute a statement with specified host selection rules and command
+  /// control settings and read its results row by row as they arrive.
+  /// @note You must specify at least one role from ClusterHostType here
+  template <typename... Args>
+  ResultStream Stream(ClusterHostTypeFlags, OptionalCommandControl,
+                      const Query& query, const Args&... args);
+  /// @}
+
+  /// @name Notifications
+  /// @{
+
+  /// @brief Subscribe to the notification channel.
+  ///
+  /// A connection to the master host is held by the returned scope until it
+  /// is destroyed, as `LISTEN` cannot be executed on a hot standby.
+  /// The command control is used for `LISTEN` and `UNLISTEN` statements.
+  NotifyScope Listen(std::string_view channel,
+                     OptionalCommandControl cmd_ctl = {});
   /// @}
 
   /// Replaces globally updated command control with a static user-provided one
@@ -223,6 +271,24 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
   return ntrx.Execute(statement_cmd_ctl, query, args...);
 }
 
+template <typename... Args>
+ResultStream Cluster::Stream(ClusterHostTypeFlags flags, const Query& query,
+                             const Args&... args) {
+  return Stream(flags, OptionalCommandControl{}, query, args...);
+}
+
+template <typename... Args>
+ResultStream Cluster::Stream(ClusterHostTypeFlags flags,
+                             OptionalCommandControl statement_cmd_ctl,
+                             const Query& query, const Args&... args) {
+  if (!statement_cmd_ctl && query.GetName()) {
+    statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
+  }
+  statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+  auto ntrx = Start(flags, statement_cmd_ctl);
+  return std::move(ntrx).Stream(statement_cmd_ctl, query, args...);
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -57,6 +57,12 @@ namespace components {
 /// Note, however, that client-size lag detection is not precise in nature
 /// and can only provide the precision of couple seconds.
 ///
+/// `nearest_rtt_tolerance` groups hosts into bands of equally near hosts for
+/// the storages::postgres::ClusterHostType::kNearest strategy, e.g. the hosts
+/// of the local datacenter. Within the nearest band a host with fewer
+/// connections in use is preferred, the next band is used only when all the
+/// hosts of the nearer bands have no free connections.
+///
 /// ## Secdist format
 ///
 /// A PosgreSQL alias in secdist is described as a JSON array of objects
@@ -113,6 +119,7 @@ namespace components {
 /// dbconnection            | connection DSN string (used if no dbalias specified)      | --
 /// blocking_task_processor | name of task processor for background blocking operations | --
 /// max_replication_lag     | replication lag limit for usable slaves                   | 60s
+/// nearest_rtt_tolerance   | hosts with RTT within this tolerance of the nearest host are equally preferred by the kNearest strategy | 0ms
 /// min_pool_size           | number of connections created initially                   | 4
 /// max_pool_size           | limit of connections count                                | 15
 /// sync-start              | perform initial connections synchronously                 | false
@@ -122,11 +129,14 @@ namespace components {
 /// ignore_unused_query_params| disable check for not-NULL query params that are not used in query| false
 /// monitoring-dbalias      | name of the database for monitorings                      | calculated from dbalias or dbconnection options
 /// max_prepared_cache_size | prepared statements cache size limit                      | 5000
+/// prepared_warmup_size    | number of the most executed statements to prepare on a new connection before it is used, 0 to disable | 0
 /// max_statement_metrics   | limit of exported metrics for named statements            | 0
 /// min_pool_size           | number of connections created initially                   | 4
 /// max_pool_size           | maximum number of created connections                     | 15
 /// max_queue_size          | maximum number of clients waiting for a connection        | 200
+/// thread_stash_size       | number of recently released connections kept by each worker thread, 0 to disable | 0
 /// pipeline_enabled        | turn on pipeline mode                                     | false
+/// native_protocol_enabled | talk to the server with the native protocol implementation instead of libpq | false
 
 // clang-format on
 
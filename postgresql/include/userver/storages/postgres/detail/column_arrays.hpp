@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/io/array_types.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/traits.hpp>
+#include <userver/storages/postgres/io/type_traits.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Approximate size of the parameters of a single statement executed with
+/// Transaction::ExecuteDecompose, the server limits a message to 1GB
+inline constexpr std::size_t kDecomposeChunkSize = 16 * 1024 * 1024;
+
+/// @brief Writes the fields of rows to one-dimensional arrays in the binary
+/// format, an array per column of the row type.
+///
+/// The fields are written directly to the array buffers as the rows are
+/// appended, so the rows are not copied to intermediate containers.
+template <typename Row>
+class ColumnArraysWriter {
+ public:
+  static_assert(io::traits::kIsRowType<Row>,
+                "Decomposition supports row types only, see "
+                "@ref pg_user_row_types");
+  using RowType = io::RowType<Row>;
+  static constexpr std::size_t kColumnCount = RowType::size;
+
+  explicit ColumnArraysWriter(const UserTypes& types) : types_{types} {
+    Reset();
+  }
+
+  void Append(const Row& row) {
+    std::apply(
+        [this](const auto&... fields) {
+          auto column = columns_.begin();
+          (io::WriteRawBinary(types_, *column++, fields), ...);
+        },
+        RowType::GetTuple(row));
+    ++row_count_;
+  }
+
+  std::size_t RowCount() const { return row_count_; }
+
+  std::size_t ByteSize() const {
+    std::size_t size = 0;
+    for (const auto& column : columns_) size += column.size();
+    return size;
+  }
+
+  /// Moves the arrays of the appended rows to the query parameters and starts
+  /// a new chunk of rows
+  void MoveTo(QueryParameters& params) {
+    MoveColumns(params, std::make_index_sequence<kColumnCount>{});
+    Reset();
+  }
+
+ private:
+  using Buffer = std::vector<char>;
+
+  // Number of dimensions, flags, element type oid, dimension size and lower
+  // bound of a one-dimensional array
+  static constexpr std::size_t kHeaderSize = 5 * sizeof(Integer);
+
+  template <std::size_t... Indexes>
+  void MoveColumns(QueryParameters& params, std::index_sequence<Indexes...>) {
+    (MoveColumn<Indexes>(params), ...);
+  }
+
+  template <std::size_t Index>
+  void MoveColumn(QueryParameters& params) {
+    using Field = std::decay_t<
+        std::tuple_element_t<Index, typename RowType::TupleType>>;
+    using Array = std::vector<Field>;
+    static_assert(!io::traits::kIsCompatibleContainer<Field>,
+                  "Fields of decomposed rows cannot be arrays");
+    using ElementMapping = io::CppToPg<
+        typename io::traits::ContainerFinalElement<Array>::type>;
+
+    auto& column = columns_[Index];
+    auto header = column.begin();
+    io::BufferWriter(static_cast<Integer>(1))(header);  // dimensions
+    io::BufferWriter(static_cast<Integer>(0))(header + sizeof(Integer));
+    io::BufferWriter(static_cast<Integer>(ElementMapping::GetOid(types_)))(
+        header + 2 * sizeof(Integer));
+    io::BufferWriter(static_cast<Integer>(row_count_))(
+        header + 3 * sizeof(Integer));
+    io::BufferWriter(static_cast<Integer>(1))(header + 4 * sizeof(Integer));
+    params.WriteBinary(io::CppToPg<Array>::GetOid(types_), std::move(column));
+  }
+
+  void Reset() {
+    for (auto& column : columns_) {
+      column.clear();
+      column.resize(kHeaderSize);
+    }
+    row_count_ = 0;
+  }
+
+  const UserTypes& types_;
+  std::array<Buffer, kColumnCount> columns_;
+  std::size_t row_count_{0};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+#include <boost/endian/conversion.hpp>
+#include <boost/uuid/uuid.hpp>
+
+#include <userver/storages/postgres/io/buffer_io_base.hpp>
+#include <userver/storages/postgres/io/chrono.hpp>
+#include <userver/storages/postgres/io/integral_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Parsers for the fixed width types that are used when a result is decoded
+/// column by column. The values are byte swapped right from the field buffer
+/// without constructing the generic buffer parsers. A parser returns false if
+/// the buffer length does not match the type, the generic parser is used then.
+template <typename T, typename Enable = void>
+struct FixedWidthParser {
+  static constexpr bool kEnabled = false;
+};
+
+template <typename T>
+struct FixedWidthParser<
+    T, std::enable_if_t<std::is_same_v<T, Smallint> ||
+                        std::is_same_v<T, Integer> ||
+                        std::is_same_v<T, Bigint> ||
+                        std::is_same_v<T, io::detail::AltInteger>>> {
+  static constexpr bool kEnabled = true;
+
+  static bool Parse(const io::FieldBuffer& buffer, T& value) {
+    if (buffer.length != sizeof(T)) return false;
+    T tmp;
+    std::memcpy(&tmp, buffer.buffer, sizeof(T));
+    value = boost::endian::big_to_native(tmp);
+    return true;
+  }
+};
+
+template <typename T>
+struct FixedWidthParser<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+  static constexpr bool kEnabled = true;
+  using BitsType = std::conditional_t<sizeof(T) == 4, std::uint32_t,
+                                      std::uint64_t>;
+  static_assert(sizeof(T) == sizeof(BitsType));
+
+  static bool Parse(const io::FieldBuffer& buffer, T& value) {
+    if (buffer.length != sizeof(T)) return false;
+    BitsType bits;
+    std::memcpy(&bits, buffer.buffer, sizeof(T));
+    bits = boost::endian::big_to_native(bits);
+    std::memcpy(&value, &bits, sizeof(T));
+    return true;
+  }
+};
+
+template <typename Duration>
+struct FixedWidthParser<std::chrono::time_point<ClockType, Duration>> {
+  static constexpr bool kEnabled = true;
+  using ValueType = std::chrono::time_point<ClockType, Duration>;
+
+  static bool Parse(const io::FieldBuffer& buffer, ValueType& value) {
+    static const ValueType pg_epoch =
+        std::chrono::time_point_cast<Duration>(PostgresEpochTimePoint());
+    Bigint usec{0};
+    if (!FixedWidthParser<Bigint>::Parse(buffer, usec)) return false;
+    if (usec == std::numeric_limits<Bigint>::max()) {
+      value = kTimestampPositiveInfinity;
+    } else if (usec == std::numeric_limits<Bigint>::min()) {
+      value = kTimestampNegativeInfinity;
+    } else {
+      value = pg_epoch + std::chrono::microseconds{usec};
+    }
+    return true;
+  }
+};
+
+template <>
+struct FixedWidthParser<TimePointTz> {
+  static constexpr bool kEnabled = true;
+
+  static bool Parse(const io::FieldBuffer& buffer, TimePointTz& value) {
+    return FixedWidthParser<TimePoint>::Parse(buffer, value.GetUnderlying());
+  }
+};
+
+template <>
+struct FixedWidthParser<boost::uuids::uuid> {
+  static constexpr bool kEnabled = true;
+
+  static bool Parse(const io::FieldBuffer& buffer, boost::uuids::uuid& value) {
+    if (buffer.length != value.size()) return false;
+    std::memcpy(value.data, buffer.buffer, value.size());
+    return true;
+  }
+};
+
+template <typename T>
+struct FixedWidthParser<std::optional<T>,
+                        std::enable_if_t<FixedWidthParser<T>::kEnabled>> {
+  static constexpr bool kEnabled = true;
+
+  static bool Parse(const io::FieldBuffer& buffer, std::optional<T>& value) {
+    if (!value) value.emplace();
+    return FixedWidthParser<T>::Parse(buffer, *value);
+  }
+};
+
+/// Parses a non-null field of a column, the fixed width types go first
+template <typename T>
+void ParseColumnField(const io::FieldBuffer& buffer, T& value,
+                      const io::TypeBufferCategory& categories) {
+  if constexpr (FixedWidthParser<T>::kEnabled) {
+    if (FixedWidthParser<T>::Parse(buffer, value)) return;
+  }
+  io::ReadBuffer(buffer, value, categories);
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
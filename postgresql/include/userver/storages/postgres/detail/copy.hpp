@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/traits.hpp>
+#include <userver/storages/postgres/io/type_traits.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Approximate size of data sent to the server with a single CopyData message
+inline constexpr std::size_t kCopyChunkSize = 64 * 1024;
+
+/// Appends the next chunk of COPY FROM STDIN data to the buffer, returns false
+/// if the chunk is the last one
+using CopyInSource = std::function<bool(std::vector<char>& buffer)>;
+
+/// Receives the data of a single CopyData message of COPY TO STDOUT
+using CopyOutSink = std::function<void(std::string_view data)>;
+
+/// Writes the signature and the header of the binary COPY format
+void WriteCopyHeader(std::vector<char>& buffer);
+
+/// Writes the file trailer of the binary COPY format
+void WriteCopyTrailer(std::vector<char>& buffer);
+
+/// Checks and skips the signature and the header of the binary COPY format
+void ReadCopyHeader(io::FieldBuffer& buffer);
+
+/// Writes a tuple of the binary COPY format: the field count and
+/// length-prefixed binary representation of each field
+template <typename Row>
+void WriteCopyRow(const UserTypes& types, std::vector<char>& buffer,
+                  const Row& row) {
+  static_assert(io::traits::kIsRowType<Row>,
+                "COPY supports row types only, see @ref pg_user_row_types");
+  using RowType = io::RowType<Row>;
+  io::WriteBuffer(types, buffer, static_cast<Smallint>(RowType::size));
+  std::apply(
+      [&types, &buffer](const auto&... fields) {
+        (io::WriteRawBinary(types, buffer, fields), ...);
+      },
+      RowType::GetTuple(row));
+}
+
+/// Reads a tuple of the binary COPY format, returns false if the buffer
+/// contains the file trailer instead of a tuple
+template <typename Row>
+bool ReadCopyRow(io::FieldBuffer& buffer,
+                 const io::TypeBufferCategory& categories, Row& row) {
+  static_assert(io::traits::kIsRowType<Row>,
+                "COPY supports row types only, see @ref pg_user_row_types");
+  using RowType = io::RowType<Row>;
+  Smallint field_count{0};
+  buffer.Read(field_count, io::BufferCategory::kPlainBuffer);
+  if (field_count == -1) return false;
+  if (field_count < 0 ||
+      static_cast<std::size_t>(field_count) != RowType::size) {
+    throw InvalidBinaryBuffer(
+        "COPY tuple field count " + std::to_string(field_count) +
+        " does not match the row type size " + std::to_string(RowType::size));
+  }
+  std::apply(
+      [&buffer, &categories](auto&... fields) {
+        (buffer.ReadRaw(fields, categories,
+                        io::traits::kTypeBufferCategory<
+                            std::decay_t<decltype(fields)>>),
+         ...);
+      },
+      RowType::GetTuple(row));
+  return true;
+}
+
+/// Makes a source that writes `rows` in chunks of about kCopyChunkSize bytes
+template <typename Container>
+CopyInSource MakeCopyInSource(const UserTypes& types, const Container& rows) {
+  return [&types, &rows, it = std::begin(rows),
+          header_written = false](std::vector<char>& buffer) mutable {
+    if (!header_written) {
+      WriteCopyHeader(buffer);
+      header_written = true;
+    }
+    const auto end = std::end(rows);
+    while (it != end && buffer.size() < kCopyChunkSize) {
+      WriteCopyRow(types, buffer, *it);
+      ++it;
+    }
+    if (it != end) return true;
+    WriteCopyTrailer(buffer);
+    return false;
+  };
+}
+
+/// Makes a sink that parses tuples of `Row` type and passes them to `on_row`
+template <typename Row, typename Func>
+CopyOutSink MakeCopyOutSink(const UserTypes& types, Func& on_row,
+                            std::size_t& rows_count) {
+  return [&categories = types.GetTypeBufferCategories(), &on_row, &rows_count,
+          header_read = false](std::string_view data) mutable {
+    io::FieldBuffer buffer{false, io::BufferCategory::kPlainBuffer,
+                           data.size(),
+                           reinterpret_cast<const std::uint8_t*>(data.data())};
+    if (!header_read) {
+      ReadCopyHeader(buffer);
+      header_read = true;
+    }
+    while (buffer.length > 0) {
+      Row row{};
+      if (!ReadCopyRow(buffer, categories, row)) break;
+      ++rows_count;
+      on_row(std::move(row));
+    }
+  };
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
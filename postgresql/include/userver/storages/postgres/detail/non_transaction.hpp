@@ -6,7 +6,9 @@
 #include <userver/storages/postgres/parameter_store.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
 #include <userver/storages/postgres/result_set.hpp>
+#include <userver/storages/postgres/result_stream.hpp>
 
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
@@ -64,10 +66,29 @@ class NonTransaction {
   /// Suspends coroutine for execution.
   ResultSet Execute(OptionalCommandControl statement_cmd_ctl,
                     const std::string& statement, const ParameterStore& store);
+
+  /// Execute the statements of the batch in a single network round trip.
+  ///
+  /// Suspends coroutine for execution.
+  QueryBatchResult Execute(OptionalCommandControl batch_cmd_ctl,
+                           const QueryBatch& batch);
+
+  /// Execute statement with arbitrary parameters and read its results row by
+  /// row as they arrive. The connection is handed over to the stream.
+  template <typename... Args>
+  ResultStream Stream(OptionalCommandControl statement_cmd_ctl,
+                      const Query& query, const Args&... args) && {
+    detail::QueryParameters params;
+    params.Write(GetConnectionUserTypes(), args...);
+    return std::move(*this).DoStream(query, params, statement_cmd_ctl);
+  }
   /// @}
  private:
   ResultSet DoExecute(const Query& query, const detail::QueryParameters& params,
                       OptionalCommandControl statement_cmd_ctl);
+  ResultStream DoStream(const Query& query,
+                        const detail::QueryParameters& params,
+                        OptionalCommandControl statement_cmd_ctl) &&;
   const UserTypes& GetConnectionUserTypes() const;
 
  private:
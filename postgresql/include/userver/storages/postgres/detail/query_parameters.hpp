@@ -39,6 +39,16 @@ class QueryParameters {
     (Write(types, args), ...);
   }
 
+  /// Adds a parameter of the `type` already written in the binary format
+  void WriteBinary(Oid type, std::vector<char>&& buffer) {
+    param_types.push_back(type);
+    param_formats.push_back(io::kPgBinaryDataFormat);
+    param_lengths.push_back(buffer.size());
+    parameters.push_back(std::move(buffer));
+    const auto& param = parameters.back();
+    param_buffers.push_back(param.empty() ? empty_buffer : param.data());
+  }
+
   std::size_t TypeHash() const;
 
  private:
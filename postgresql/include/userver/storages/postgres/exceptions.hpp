@@ -145,6 +145,7 @@ namespace storages::postgres {
  *       - ConnectionTimeoutError
  *     - ConnectionBusy
  *     - ConnectionInterrupted
+ *     - BatchStatementSkipped
  *     - PoolError
  *     - ClusterError
  *     - InvalidConfig
@@ -260,6 +261,16 @@ class ConnectionInterrupted : public RuntimeError {
   using RuntimeError::RuntimeError;
 };
 
+/// @brief A statement of a QueryBatch was not executed because a previous
+/// statement of the batch has failed.
+class BatchStatementSkipped : public RuntimeError {
+ public:
+  BatchStatementSkipped()
+      : RuntimeError(
+            "Statement was skipped due to a failure of a previous statement "
+            "in the batch") {}
+};
+
 //@}
 
 //@{
@@ -0,0 +1,74 @@
+#pragma once
+
+/// @file userver/storages/postgres/notify.hpp
+/// @brief Asynchronous notifications
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Asynchronous notification sent by the server with a `NOTIFY`
+/// statement or a `pg_notify` call
+struct Notification {
+  /// Name of the notification channel
+  std::string channel;
+  /// Payload string, if any
+  std::optional<std::string> payload;
+};
+
+// clang-format off
+
+/// @brief RAII subscription to a notification channel.
+///
+/// Holds a connection to the master host that executed `LISTEN channel`, the
+/// channel is unsubscribed and the connection is returned to the pool when
+/// the scope is destroyed. The connection is not available for other queries
+/// meanwhile, so keep the number of simultaneous subscriptions low.
+///
+/// Notifications that arrive while no one waits for them are buffered, so
+/// nothing is lost between WaitNotify calls.
+///
+/// @snippet storages/postgres/tests/notify_pgtest.cpp  Sample notify usage
+///
+/// Non-copyable.
+
+// clang-format on
+class NotifyScope {
+ public:
+  NotifyScope(detail::ConnectionPtr&& conn, std::string_view channel,
+              OptionalCommandControl cmd_ctl);
+
+  NotifyScope(NotifyScope&&) noexcept;
+  NotifyScope& operator=(NotifyScope&&) noexcept;
+
+  NotifyScope(const NotifyScope&) = delete;
+  NotifyScope& operator=(const NotifyScope&) = delete;
+
+  ~NotifyScope();
+
+  /// @brief Suspends the coroutine until a notification arrives.
+  /// @throws ConnectionTimeoutError if the deadline is reached, the
+  /// subscription is still usable in this case
+  /// @throws ConnectionInterrupted if the task is cancelled
+  Notification WaitNotify(engine::Deadline deadline);
+
+  /// Name of the subscribed channel
+  const std::string& GetChannel() const { return channel_; }
+
+ private:
+  detail::ConnectionPtr conn_;
+  std::string channel_;
+  OptionalCommandControl cmd_ctl_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
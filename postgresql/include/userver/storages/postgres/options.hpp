@@ -151,6 +151,11 @@ OptionalCommandControl GetQueryOptionalCommandControl(
 
 struct TopologySettings {
   std::chrono::milliseconds max_replication_lag{0};
+
+  /// Hosts which roundtrip times differ from the nearest host RTT by no more
+  /// than this value are considered equally near by the
+  /// ClusterHostType::kNearest strategy
+  std::chrono::milliseconds nearest_rtt_tolerance{0};
 };
 
 /// Default initial pool connection count
@@ -175,9 +180,14 @@ struct PoolSettings {
   /// Maximum number of clients waiting for a connection
   size_t max_queue_size{kDefaultPoolMaxQueueSize};
 
+  /// Number of recently released connections kept by each worker thread to
+  /// be handed out first to the tasks of the same thread, 0 to disable
+  size_t thread_stash_size{0};
+
   bool operator==(const PoolSettings& rhs) const {
     return min_size == rhs.min_size && max_size == rhs.max_size &&
-           max_queue_size == rhs.max_queue_size;
+           max_queue_size == rhs.max_queue_size &&
+           thread_stash_size == rhs.thread_stash_size;
   }
 };
 
@@ -202,11 +212,22 @@ struct ConnectionSettings {
     kPipelineDisabled,
     kPipelineEnabled,
   };
+  enum ProtocolImplementation {
+    kLibpq,
+    kNativeProtocol,
+  };
   PreparedStatementOptions prepared_statements = kCachePreparedStatements;
   UserTypesOptions user_types = kUserTypesEnabled;
   CheckQueryParamsOptions ignore_unused_query_params = kCheckUnused;
   size_t max_prepared_cache_size = kDefaultMaxPreparedCacheSize;
   PipelineMode pipeline_mode = kPipelineDisabled;
+  /// Number of the most executed statements of the pool to prepare on a new
+  /// connection before it is handed out, 0 to disable
+  size_t prepared_warmup_size = 0;
+  /// Implementation of the frontend/backend protocol, kNativeProtocol talks
+  /// to the server over the engine sockets without libpq and rejects the
+  /// sslrootcert, sslcert and sslkey DSN options
+  ProtocolImplementation protocol = kLibpq;
 };
 
 /// @brief PostgreSQL statements metrics options
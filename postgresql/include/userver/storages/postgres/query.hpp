@@ -36,6 +36,8 @@ class Query {
 
   const std::string& Statement() const;
 
+  LogMode GetLogMode() const;
+
   /// @brief Fills provided span with connection info
   void FillSpanTags(tracing::Span&) const;
 
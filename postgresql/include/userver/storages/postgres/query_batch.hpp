@@ -0,0 +1,139 @@
+#pragma once
+
+/// @file userver/storages/postgres/query_batch.hpp
+/// @brief @copybrief storages::postgres::QueryBatch
+
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+// clang-format off
+
+/// @brief A list of independent statements with parameters that are sent to
+/// the server at once and executed in a single network round trip.
+///
+/// The batch is executed with Transaction::Execute or Cluster::Execute, the
+/// statements are sent to the server in libpq pipeline mode, see
+/// https://www.postgresql.org/docs/14/libpq-pipeline-mode.html
+///
+/// @snippet storages/postgres/tests/query_batch_pgtest.cpp  Sample batch usage
+///
+/// A statement of the batch cannot use the results of the previous ones. As
+/// with ParameterStore, only built-in/system types are supported as
+/// parameters.
+///
+/// Outside of a transaction the statements of the batch are executed in an
+/// implicit transaction: a failure of a statement rolls back the changes made
+/// by the previous statements of the batch.
+
+// clang-format on
+class QueryBatch {
+ public:
+  QueryBatch() = default;
+
+  QueryBatch(QueryBatch&&) noexcept = default;
+  QueryBatch& operator=(QueryBatch&&) noexcept = default;
+
+  QueryBatch(const QueryBatch&) = delete;
+  QueryBatch& operator=(const QueryBatch&) = delete;
+
+  /// @brief Adds a statement with arbitrary parameters to the end of the batch.
+  /// @note Currently only built-in/system types are supported.
+  template <typename... Args>
+  QueryBatch& Add(const Query& query, const Args&... args) {
+    ParameterStore params;
+    (params.PushBack(args), ...);
+    return Add(query, std::move(params));
+  }
+
+  /// @brief Adds a statement with stored parameters to the end of the batch.
+  QueryBatch& Add(const Query& query, ParameterStore&& params);
+
+  /// Stored parameters should be moved into the batch
+  QueryBatch& Add(const Query& query, const ParameterStore& params) = delete;
+
+  /// Returns whether the batch has no statements.
+  bool IsEmpty() const { return statements_.empty(); }
+
+  /// Returns the number of statements in the batch.
+  std::size_t Size() const { return statements_.size(); }
+
+  /// @cond
+  struct Statement {
+    Query query;
+    ParameterStore params;
+  };
+
+  const std::vector<Statement>& GetStatements() const { return statements_; }
+  /// @endcond
+
+ private:
+  // Parameter buffers are referenced by pointers, so the statements must not
+  // be copied on reallocation
+  static_assert(std::is_nothrow_move_constructible_v<Statement>);
+
+  std::vector<Statement> statements_;
+};
+
+/// @brief Results of a QueryBatch execution, a result set or an exception for
+/// each statement in the order the statements were added to the batch.
+///
+/// A statement that failed on the server side gets an exception derived from
+/// ServerLogicError or ServerRuntimeError, the statements following it are not
+/// executed and get a BatchStatementSkipped exception. Errors that are not
+/// related to a particular statement, e.g. network errors or timeouts, are
+/// thrown from the `Execute` call itself.
+class QueryBatchResult {
+ public:
+  /// Returns the number of statement results, same as the size of the batch.
+  std::size_t Size() const { return results_.size(); }
+
+  /// Returns whether there are no statement results.
+  bool IsEmpty() const { return results_.empty(); }
+
+  /// Returns whether the statement with the `index` has failed.
+  bool HasError(std::size_t index) const;
+
+  /// Returns the exception of the statement with the `index` or nullptr if the
+  /// statement has succeeded.
+  std::exception_ptr GetError(std::size_t index) const;
+
+  /// Returns the result set of the statement with the `index`.
+  /// @throws the exception of the statement if it has failed
+  const ResultSet& Get(std::size_t index) const;
+
+  /// @copydoc Get
+  const ResultSet& operator[](std::size_t index) const { return Get(index); }
+
+  /// Rethrows the exception of the first failed statement if any.
+  void ThrowIfError() const;
+
+  /// @cond
+  void Add(ResultSet&& result);
+  void Add(std::exception_ptr error);
+  /// @endcond
+
+ private:
+  struct StatementResult {
+    ResultSet result{nullptr};
+    std::exception_ptr error;
+  };
+
+  const StatementResult& At(std::size_t index) const;
+
+  std::vector<StatementResult> results_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -3,11 +3,14 @@
 /// @file userver/storages/postgres/result_set.hpp
 /// @brief Result accessors
 
+#include <algorithm>
+#include <exception>
 #include <initializer_list>
 #include <limits>
 #include <memory>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -15,6 +18,7 @@
 #include <userver/storages/postgres/io/supported_types.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
 
+#include <userver/storages/postgres/detail/column_decoder.hpp>
 #include <userver/storages/postgres/detail/const_data_iterator.hpp>
 
 #include <userver/compiler/demangle.hpp>
@@ -621,6 +625,27 @@ class ResultSet {
   template <typename Container>
   Container AsContainer(RowTag) const;
 
+  /// @brief Extract the rows into a vector of row types decoding the result
+  /// column by column.
+  ///
+  /// Column formats and parsers are resolved once per column rather than once
+  /// per field, and the fixed width types (integers, floating point,
+  /// timestamps, uuids) are decoded without the generic buffer parsers. For
+  /// large results this is considerably faster than AsContainer.
+  /// @throws The first error a field parser throws
+  template <typename T>
+  std::vector<T> AsVectorOf(RowTag) const;
+
+  /// @brief Extract `rows_count` rows starting with `first_row` into a vector
+  /// of row types decoding the result column by column.
+  ///
+  /// A row that fails to parse is not included into the result, the error is
+  /// reported with `on_error(size_type row_index, const std::exception&)`
+  /// instead. The callback may rethrow the exception to stop decoding.
+  template <typename T, typename OnError>
+  std::vector<T> AsVectorOf(RowTag, size_type first_row, size_type rows_count,
+                            OnError&& on_error) const;
+
   /// @brief Extract first row into user type.
   /// A single row result set is expected, will throw an exception when result
   /// set size != 1
@@ -636,6 +661,22 @@ class ResultSet {
   void FillBufferCategories(const UserTypes& types);
   void SetBufferCategoriesFrom(const ResultSet&);
 
+  void FillColumnBuffers(size_type field_index, size_type first_row,
+                         size_type rows_count,
+                         std::vector<io::FieldBuffer>& buffers) const;
+  const io::TypeBufferCategory& GetTypeBufferCategories() const;
+
+  template <typename T, typename OnRowError, std::size_t... Indexes>
+  void DecodeColumns(std::vector<T>& rows, size_type first_row,
+                     const std::vector<bool>& failed_rows,
+                     OnRowError& on_row_error,
+                     std::index_sequence<Indexes...>) const;
+  template <std::size_t Index, typename T, typename OnRowError>
+  void DecodeColumn(std::vector<T>& rows, size_type first_row,
+                    std::vector<io::FieldBuffer>& buffers,
+                    const std::vector<bool>& failed_rows,
+                    OnRowError& on_row_error) const;
+
  private:
   template <typename T, typename Tag>
   friend class TypedResultSet;
@@ -856,6 +897,102 @@ Container ResultSet::AsContainer(RowTag) const {
   return c;
 }
 
+template <typename T>
+std::vector<T> ResultSet::AsVectorOf(RowTag) const {
+  // The callback is invoked from within a catch block
+  return AsVectorOf<T>(kRowTag, 0, Size(),
+                       [](size_type, const std::exception&) { throw; });
+}
+
+template <typename T, typename OnError>
+std::vector<T> ResultSet::AsVectorOf(RowTag, size_type first_row,
+                                     size_type rows_count,
+                                     OnError&& on_error) const {
+  static_assert(io::traits::kIsRowType<T>,
+                "This type cannot be used as a row type");
+  using RowType = io::RowType<T>;
+  constexpr auto tuple_size = RowType::size;
+  if (tuple_size > FieldCount()) {
+    throw InvalidTupleSizeRequested(FieldCount(), tuple_size);
+  } else if (tuple_size < FieldCount()) {
+    LOG_LIMITED_WARNING()
+        << "Row size is greater that the number of data members in "
+           "C++ user datatype "
+        << compiler::GetTypeName<T>();
+  }
+  if (first_row > Size()) {
+    throw RowIndexOutOfBounds{first_row};
+  }
+  rows_count = std::min(rows_count, Size() - first_row);
+
+  std::vector<T> rows(rows_count);
+  std::vector<bool> failed_rows;
+  auto on_row_error = [&](size_type row, const std::exception& e) {
+    if (failed_rows.empty()) failed_rows.resize(rows_count, false);
+    failed_rows[row] = true;
+    on_error(first_row + row, e);
+  };
+
+  DecodeColumns(rows, first_row, failed_rows, on_row_error,
+                std::make_index_sequence<tuple_size>{});
+
+  if (!failed_rows.empty()) {
+    size_type row = 0;
+    rows.erase(std::remove_if(rows.begin(), rows.end(),
+                              [&](const T&) { return failed_rows[row++]; }),
+               rows.end());
+  }
+  return rows;
+}
+
+template <typename T, typename OnRowError, std::size_t... Indexes>
+void ResultSet::DecodeColumns(std::vector<T>& rows, size_type first_row,
+                              const std::vector<bool>& failed_rows,
+                              OnRowError& on_row_error,
+                              std::index_sequence<Indexes...>) const {
+  std::vector<io::FieldBuffer> buffers;
+  (DecodeColumn<Indexes>(rows, first_row, buffers, failed_rows, on_row_error),
+   ...);
+}
+
+template <std::size_t Index, typename T, typename OnRowError>
+void ResultSet::DecodeColumn(std::vector<T>& rows, size_type first_row,
+                             std::vector<io::FieldBuffer>& buffers,
+                             const std::vector<bool>& failed_rows,
+                             OnRowError& on_row_error) const {
+  using RowType = io::RowType<T>;
+  using FieldType =
+      std::decay_t<std::tuple_element_t<Index, typename RowType::TupleType>>;
+  io::traits::CheckParser<FieldType>();
+
+  FillColumnBuffers(Index, first_row, rows.size(), buffers);
+  const auto& categories = GetTypeBufferCategories();
+  for (size_type row = 0; row < rows.size(); ++row) {
+    if (!failed_rows.empty() && failed_rows[row]) continue;
+
+    const auto& buffer = buffers[row];
+    FieldType& value = std::get<Index>(RowType::GetTuple(rows[row]));
+    try {
+      if (!buffer.is_null) {
+        detail::ParseColumnField(buffer, value, categories);
+      } else if constexpr (io::traits::kIsNullable<FieldType>) {
+        io::traits::GetSetNull<FieldType>::SetNull(value);
+      } else {
+        throw FieldValueIsNull{Index, (*this)[first_row + row][Index].Name(),
+                               value};
+      }
+    } catch (ResultSetError& ex) {
+      ex.AddMsgSuffix(fmt::format(
+          " (field #{} name `{}` C++ type `{}`. Postgres ResultSet error)",
+          Index, (*this)[first_row + row][Index].Name(),
+          compiler::GetTypeName<FieldType>()));
+      on_row_error(row, ex);
+    } catch (const std::exception& ex) {
+      on_row_error(row, ex);
+    }
+  }
+}
+
 template <typename T>
 auto ResultSet::AsSingleRow() const {
   return AsSingleRow<T>(kFieldTag);
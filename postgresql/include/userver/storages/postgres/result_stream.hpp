@@ -0,0 +1,199 @@
+#pragma once
+
+/// @file userver/storages/postgres/result_stream.hpp
+/// @brief Row by row reading of query results
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/io/supported_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+template <typename T, typename ExtractionTag>
+class TypedResultStream;
+
+// clang-format off
+
+/// @brief Results of a statement that are received and parsed row by row as
+/// they are read.
+///
+/// The statement is executed in libpq single-row mode, so the memory usage
+/// does not depend on the number of rows in the result and the first rows are
+/// available before the server finishes the statement. Reading is driven by
+/// the user: the rows are not read from the socket until they are requested,
+/// so a slow consumer holds the server back with the TCP flow control instead
+/// of accumulating the rows in memory.
+///
+/// The connection is busy until all the rows are read or the stream is
+/// destroyed, no other statements can be executed in the transaction
+/// meanwhile. A stream that is destroyed before all the rows are read cancels
+/// the statement if it was started outside of a transaction, otherwise the
+/// rest of the rows are read and discarded to keep the transaction usable.
+///
+/// The command control `execute` timeout applies to waiting for each row,
+/// the `statement` timeout applies to the whole statement.
+///
+/// @snippet storages/postgres/tests/result_stream_pgtest.cpp  Sample result stream usage
+///
+/// Non-copyable.
+
+// clang-format on
+class ResultStream {
+ public:
+  /// Executes the statement in a connection of a transaction, the stream must
+  /// not outlive the transaction
+  ResultStream(detail::Connection* conn, const Query& query,
+               const detail::QueryParameters& params,
+               OptionalCommandControl cmd_ctl);
+  /// Executes the statement in a started connection that is owned by the
+  /// stream and returned to the pool when the stream is destroyed
+  ResultStream(detail::ConnectionPtr&& conn, const Query& query,
+               const detail::QueryParameters& params,
+               OptionalCommandControl cmd_ctl);
+
+  ResultStream(ResultStream&&) noexcept;
+  ResultStream& operator=(ResultStream&&) noexcept;
+
+  ResultStream(const ResultStream&) = delete;
+  ResultStream& operator=(const ResultStream&) = delete;
+
+  ~ResultStream();
+
+  /// @brief Suspends the coroutine until the next row arrives.
+  /// @returns std::nullopt if all the rows were read
+  std::optional<Row> Next();
+
+  /// @brief Stops reading, the rest of the rows are dropped.
+  /// Is called automatically on destruction.
+  void Finish();
+
+  /// Check if all the rows were read or the stream was finished
+  bool IsDone() const { return done_; }
+
+  /// Number of rows read so far
+  std::size_t RowsRead() const { return rows_read_; }
+
+  //@{
+  /** @name Typed results */
+  /// @brief Get a single pass range over the rows converted to `T`.
+  /// The rows are parsed one by one as the range is iterated.
+  /// For more information on the conversions see @ref psql_typed_results
+  template <typename T>
+  TypedResultStream<T, FieldTag> AsSetOf();
+  template <typename T>
+  TypedResultStream<T, RowTag> AsSetOf(RowTag);
+  template <typename T>
+  TypedResultStream<T, FieldTag> AsSetOf(FieldTag);
+  //@}
+
+ private:
+  void Reset() noexcept;
+
+  detail::ConnectionPtr owned_conn_;
+  detail::Connection* conn_{nullptr};
+  std::size_t rows_read_{0};
+  bool done_{false};
+};
+
+/// @brief Single pass range over the rows of a ResultStream converted to a
+/// user type.
+///
+/// Iterators are input iterators, incrementing an iterator reads the next row
+/// from the stream. The range must not outlive the stream.
+template <typename T, typename ExtractionTag>
+class TypedResultStream {
+ public:
+  using value_type = T;
+
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    /// Makes an end iterator
+    Iterator() = default;
+
+    reference operator*() const { return *value_; }
+    pointer operator->() const { return &*value_; }
+
+    Iterator& operator++() {
+      Advance();
+      return *this;
+    }
+
+    bool operator==(const Iterator& rhs) const {
+      return stream_ == rhs.stream_;
+    }
+    bool operator!=(const Iterator& rhs) const { return !(*this == rhs); }
+
+   private:
+    friend class TypedResultStream;
+
+    explicit Iterator(ResultStream* stream) : stream_{stream} { Advance(); }
+
+    void Advance() {
+      auto row = stream_->Next();
+      if (row) {
+        value_ = row->template As<T>(ExtractionTag{});
+      } else {
+        stream_ = nullptr;
+        value_.reset();
+      }
+    }
+
+    ResultStream* stream_{nullptr};
+    mutable std::optional<T> value_;
+  };
+
+  using iterator = Iterator;
+
+  explicit TypedResultStream(ResultStream& stream) : stream_{stream} {}
+
+  /// Reads the first row, may be called only once
+  Iterator begin() { return stream_.IsDone() ? end() : Iterator{&stream_}; }
+  Iterator end() { return Iterator{}; }
+
+ private:
+  ResultStream& stream_;
+};
+
+template <typename T>
+TypedResultStream<T, FieldTag> ResultStream::AsSetOf() {
+  return AsSetOf<T>(kFieldTag);
+}
+
+template <typename T>
+TypedResultStream<T, RowTag> ResultStream::AsSetOf(RowTag) {
+  using ValueType = std::decay_t<T>;
+  static_assert(io::traits::kIsRowType<ValueType>,
+                "This type cannot be used as a row type");
+  return TypedResultStream<T, RowTag>{*this};
+}
+
+template <typename T>
+TypedResultStream<T, FieldTag> ResultStream::AsSetOf(FieldTag) {
+  using ValueType = std::decay_t<T>;
+  // composite types can be parsed without an explicit mapping
+  static_assert(io::traits::kIsMappedToPg<ValueType> ||
+                    io::traits::kIsCompositeType<ValueType>,
+                "This type is not mapped to a PostgreSQL type");
+  return TypedResultStream<T, FieldTag>{*this};
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -45,6 +45,11 @@ struct TransactionStatistics {
   /// to pretty uniqueness of names. Nevertheless we would like to see them to
   /// diagnose certain kinds of problems
   Counter duplicate_prepared_statements = 0;
+  /// Number of prepared statement executions that had to prepare the
+  /// statement first
+  Counter cold_execute_total = 0;
+  /// Number of executions of already prepared statements
+  Counter warm_execute_total = 0;
 
   // TODO pick reasonable resolution for transaction
   // execution times
@@ -84,6 +89,10 @@ struct ConnectionStatistics {
   Counter error_timeout = 0;
   /// Number of maximum allowed waiting requests
   Counter max_queue_size = 0;
+  /// Number of statements prepared on new connections in advance
+  Counter prepared_warmup_total = 0;
+  /// Number of connections acquired from the stash of the current thread
+  Counter stash_hits = 0;
 
   /// Prepared statements count min-max-avg
   MmaAccumulator prepared_statements;
@@ -98,6 +107,19 @@ struct InstanceTopologyStatistics {
   MmaAccumulator replication_lag;
 };
 
+/// @brief Template host selection statistics storage
+template <typename Counter>
+struct HostSelectionStatistics {
+  /// Number of times the host was chosen as one of the nearest hosts
+  Counter nearest_total = 0;
+  /// Number of times the host was chosen because the nearer hosts had no
+  /// free connections
+  Counter spillover_total = 0;
+  /// Number of times the host was passed over because it had no free
+  /// connections
+  Counter saturated_total = 0;
+};
+
 /// @brief Template instance statistics storage
 template <typename Counter, typename PercentileAccumulator,
           typename MmaAccumulator>
@@ -108,6 +130,8 @@ struct InstanceStatisticsTemplate {
   TransactionStatistics<Counter, PercentileAccumulator> transaction;
   /// Topology statistics
   InstanceTopologyStatistics<MmaAccumulator> topology;
+  /// Host selection statistics
+  HostSelectionStatistics<Counter> host_selection;
   /// Error caused by pool exhaustion
   Counter pool_exhaust_errors = 0;
   /// Error caused by queue size overflow
@@ -116,6 +140,9 @@ struct InstanceStatisticsTemplate {
   PercentileAccumulator connection_percentile;
   /// Acquire connection percentile
   PercentileAccumulator acquire_percentile;
+  /// Acquire connection percentile in microseconds, shows the distribution
+  /// of the fast acquisitions that take less than a millisecond
+  PercentileAccumulator acquire_us_percentile;
 };
 
 using Percentile = USERVER_NAMESPACE::utils::statistics::Percentile<2048>;
@@ -155,6 +182,8 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     connection.prepared_statements =
         stats.connection.prepared_statements.GetStatsForPeriod();
     connection.max_queue_size = stats.connection.max_queue_size;
+    connection.prepared_warmup_total = stats.connection.prepared_warmup_total;
+    connection.stash_hits = stats.connection.stash_hits;
 
     transaction.total = stats.transaction.total;
     transaction.commit_total = stats.transaction.commit_total;
@@ -168,6 +197,8 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     transaction.execute_timeout = stats.transaction.execute_timeout;
     transaction.duplicate_prepared_statements =
         stats.transaction.duplicate_prepared_statements;
+    transaction.cold_execute_total = stats.transaction.cold_execute_total;
+    transaction.warm_execute_total = stats.transaction.warm_execute_total;
     transaction.total_percentile =
         stats.transaction.total_percentile.GetStatsForPeriod();
     transaction.busy_percentile =
@@ -187,6 +218,17 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     queue_size_errors = stats.queue_size_errors;
     connection_percentile = stats.connection_percentile.GetStatsForPeriod();
     acquire_percentile = stats.acquire_percentile.GetStatsForPeriod();
+    acquire_us_percentile = stats.acquire_us_percentile.GetStatsForPeriod();
+
+    return *this;
+  }
+
+  InstanceStatisticsNonatomic& Add(
+      const decltype(InstanceStatistics::host_selection)&
+          host_selection_stats) {
+    host_selection.nearest_total = host_selection_stats.nearest_total;
+    host_selection.spillover_total = host_selection_stats.spillover_total;
+    host_selection.saturated_total = host_selection_stats.saturated_total;
 
     return *this;
   }
@@ -5,8 +5,12 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include <userver/storages/postgres/detail/column_arrays.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/copy.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/options.hpp>
@@ -14,7 +18,10 @@
 #include <userver/storages/postgres/portal.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
 #include <userver/storages/postgres/result_set.hpp>
+#include <userver/storages/postgres/result_stream.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -95,6 +102,38 @@ namespace storages::postgres {
 /// trx.Commit();
 /// @endcode
 ///
+/// @par Batches of queries
+///
+/// Independent statements can be sent to the server at once and executed in a
+/// single network round trip with QueryBatch. Each statement gets its own
+/// result set or an exception, a statement that fails makes the following
+/// statements of the batch to be skipped.
+///
+/// @snippet storages/postgres/tests/query_batch_pgtest.cpp  Sample batch usage
+///
+/// @par Bulk data transfer
+///
+/// Big amounts of rows are loaded and unloaded faster with the binary COPY
+/// protocol than with INSERT and SELECT statements: the data is streamed in
+/// chunks without per-statement round trips and without building a result set
+/// in memory. Rows are @ref pg_user_row_types "row types" that are written and
+/// parsed with the same formatters and parsers as query parameters and
+/// results.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp  Sample COPY usage
+///
+/// @warning The binary COPY format does not contain type oids, so the C++ types
+/// of the row members must match the column types exactly, e.g. a `bigint`
+/// column must be copied to or from std::int64_t, otherwise the data is
+/// corrupted or an error is reported by the server.
+///
+/// Results of an arbitrary statement that are too big to be kept in memory
+/// may be read row by row with a ResultStream. The rows are parsed as they
+/// arrive and the next rows are not read from the network until the previous
+/// ones are processed.
+///
+/// @snippet storages/postgres/tests/result_stream_pgtest.cpp  Sample result stream usage
+///
 /// Next: @ref pg_process_results
 /// @see Transaction
 /// @see ResultSet
@@ -186,6 +225,22 @@ class Transaction {
   ResultSet Execute(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// Execute the statements of the batch in a single network round trip.
+  ///
+  /// Suspends coroutine for execution.
+  /// @returns a result set or an exception for each of the statements
+  QueryBatchResult Execute(const QueryBatch& batch) {
+    return Execute(OptionalCommandControl{}, batch);
+  }
+
+  /// Execute the statements of the batch in a single network round trip with
+  /// command control for the whole batch.
+  ///
+  /// Suspends coroutine for execution.
+  /// @returns a result set or an exception for each of the statements
+  QueryBatchResult Execute(OptionalCommandControl batch_cmd_ctl,
+                           const QueryBatch& batch);
+
   /// Execute statement that uses an array of arguments splitting that array in
   /// chunks and executing the statement with a chunk of arguments.
   ///
@@ -205,6 +260,49 @@ class Transaction {
                    const Container& args,
                    std::size_t chunk_rows = kDefaultRowsInChunk);
 
+  /// Execute statement that takes the columns of the rows as arrays, a
+  /// parameter per column of the row type, in chunks of rows.
+  ///
+  /// Useful for bulk inserts and upserts, e.g.
+  /// `INSERT INTO t (a, b) SELECT * FROM UNNEST($1, $2) ON CONFLICT DO
+  /// NOTHING`, as a chunk is a single execution of a prepared statement.
+  /// A chunk is limited to `chunk_rows` rows and to about
+  /// detail::kDecomposeChunkSize bytes of parameters.
+  ///
+  /// @returns the number of rows affected by all the executions
+  template <typename Container>
+  std::size_t ExecuteDecompose(const Query& query, const Container& rows,
+                               std::size_t chunk_rows = kDefaultRowsInChunk);
+
+  /// Execute statement that takes the columns of the rows as arrays in chunks
+  /// of rows with per-statement command control.
+  ///
+  /// @returns the number of rows affected by all the executions
+  template <typename Container>
+  std::size_t ExecuteDecompose(OptionalCommandControl statement_cmd_ctl,
+                               const Query& query, const Container& rows,
+                               std::size_t chunk_rows = kDefaultRowsInChunk);
+
+  /// Execute statement with arbitrary parameters and read its results row by
+  /// row as they arrive, see ResultStream.
+  ///
+  /// The connection is busy until the stream is done, the stream must not
+  /// outlive the transaction.
+  template <typename... Args>
+  ResultStream Stream(const Query& query, const Args&... args) {
+    return Stream(OptionalCommandControl{}, query, args...);
+  }
+
+  /// Execute statement with arbitrary parameters and per-statement command
+  /// control and read its results row by row as they arrive.
+  template <typename... Args>
+  ResultStream Stream(OptionalCommandControl statement_cmd_ctl,
+                      const Query& query, const Args&... args) {
+    detail::QueryParameters params;
+    params.Write(GetConnectionUserTypes(), args...);
+    return DoStream(query, params, std::move(statement_cmd_ctl));
+  }
+
   /// Create a portal for fetching results of a statement with arbitrary
   /// parameters.
   template <typename... Args>
@@ -233,6 +331,71 @@ class Transaction {
   Portal MakePortal(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// Copy rows of the container to the `target` table using the binary
+  /// `COPY FROM STDIN` protocol, `target` is a table name optionally followed
+  /// by a list of columns, e.g. `"foo (a, b)"`.
+  ///
+  /// The rows are sent in chunks of about 64KB, so the memory usage does not
+  /// depend on the number of rows.
+  ///
+  /// @returns the number of copied rows
+  template <typename Container>
+  std::size_t CopyIn(const std::string& target, const Container& rows) {
+    return CopyIn(OptionalCommandControl{}, target, rows);
+  }
+
+  /// Copy rows of the container to the `target` table using the binary
+  /// `COPY FROM STDIN` protocol with per-statement command control.
+  template <typename Container>
+  std::size_t CopyIn(OptionalCommandControl statement_cmd_ctl,
+                     const std::string& target, const Container& rows) {
+    return DoCopyIn(target,
+                    detail::MakeCopyInSource(GetConnectionUserTypes(), rows),
+                    std::move(statement_cmd_ctl));
+  }
+
+  /// Read the results of a query without parameters using the binary
+  /// `COPY (query) TO STDOUT` protocol and call `on_row` for each row of
+  /// `Row` type as soon as it arrives.
+  ///
+  /// @returns the number of rows read
+  template <typename Row, typename Func>
+  std::size_t CopyOut(const Query& query, Func&& on_row) {
+    return CopyOut<Row>(OptionalCommandControl{}, query,
+                        std::forward<Func>(on_row));
+  }
+
+  /// Read the results of a query without parameters using the binary
+  /// `COPY (query) TO STDOUT` protocol with per-statement command control.
+  template <typename Row, typename Func>
+  std::size_t CopyOut(OptionalCommandControl statement_cmd_ctl,
+                      const Query& query, Func&& on_row) {
+    std::size_t rows_count = 0;
+    DoCopyOut(query,
+              detail::MakeCopyOutSink<Row>(GetConnectionUserTypes(), on_row,
+                                           rows_count),
+              std::move(statement_cmd_ctl));
+    return rows_count;
+  }
+
+  /// Read all the results of a query without parameters using the binary
+  /// `COPY (query) TO STDOUT` protocol.
+  template <typename Row>
+  std::vector<Row> CopyOut(const Query& query) {
+    return CopyOut<Row>(OptionalCommandControl{}, query);
+  }
+
+  /// Read all the results of a query without parameters using the binary
+  /// `COPY (query) TO STDOUT` protocol with per-statement command control.
+  template <typename Row>
+  std::vector<Row> CopyOut(OptionalCommandControl statement_cmd_ctl,
+                           const Query& query) {
+    std::vector<Row> rows;
+    CopyOut<Row>(std::move(statement_cmd_ctl), query,
+                 [&rows](Row&& row) { rows.push_back(std::move(row)); });
+    return rows;
+  }
+
   /// Set a connection parameter
   /// https://www.postgresql.org/docs/current/sql-set.html
   /// The parameter is set for this transaction only
@@ -261,6 +424,16 @@ class Transaction {
                     const detail::QueryParameters& params,
                     OptionalCommandControl statement_cmd_ctl);
 
+  ResultStream DoStream(const Query& query,
+                        const detail::QueryParameters& params,
+                        OptionalCommandControl statement_cmd_ctl);
+
+  std::size_t DoCopyIn(const std::string& target,
+                       const detail::CopyInSource& source,
+                       OptionalCommandControl statement_cmd_ctl);
+  void DoCopyOut(const Query& query, const detail::CopyOutSink& sink,
+                 OptionalCommandControl statement_cmd_ctl);
+
   const UserTypes& GetConnectionUserTypes() const;
 
  private:
@@ -286,6 +459,38 @@ void Transaction::ExecuteBulk(OptionalCommandControl statement_cmd_ctl,
   }
 }
 
+template <typename Container>
+std::size_t Transaction::ExecuteDecompose(const Query& query,
+                                          const Container& rows,
+                                          std::size_t chunk_rows) {
+  return ExecuteDecompose(OptionalCommandControl{}, query, rows, chunk_rows);
+}
+
+template <typename Container>
+std::size_t Transaction::ExecuteDecompose(
+    OptionalCommandControl statement_cmd_ctl, const Query& query,
+    const Container& rows, std::size_t chunk_rows) {
+  UASSERT(chunk_rows > 0);
+  using Row = std::decay_t<decltype(*std::begin(rows))>;
+  detail::ColumnArraysWriter<Row> writer{GetConnectionUserTypes()};
+  std::size_t rows_affected = 0;
+  const auto execute_chunk = [&] {
+    detail::QueryParameters params;
+    writer.MoveTo(params);
+    rows_affected +=
+        DoExecute(query, params, statement_cmd_ctl).RowsAffected();
+  };
+  for (const auto& row : rows) {
+    writer.Append(row);
+    if (writer.RowCount() >= chunk_rows ||
+        writer.ByteSize() >= detail::kDecomposeChunkSize) {
+      execute_chunk();
+    }
+  }
+  if (writer.RowCount() > 0) execute_chunk();
+  return rows_affected;
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -28,6 +28,10 @@ properties:
         type: integer
         description: number of rows to request from PostgreSQL, 0 to fetch all rows in one request
         defaultDescription: 1000
+    notify-debounce:
+        type: string
+        description: time to gather notifications into a single update, used if the cache policy has `kNotifyChannel`
+        defaultDescription: 100ms
     pgcomponent:
         type: string
         description: PostgreSQL component name
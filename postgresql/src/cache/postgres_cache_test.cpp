@@ -264,6 +264,44 @@ struct PostgresExamplePolicy6 {
   using CacheContainer = UserSpecificCacheWithWriteNotification;
 };
 
+/*! [Pg Cache Policy Copy Example] */
+struct PostgresExamplePolicy7 {
+  static constexpr std::string_view kName = "my-pg-cache";
+  using ValueType = MyStructure;
+  static constexpr auto kKeyMember = &MyStructure::id;
+  // Column types must match the `MyStructure` member types exactly
+  static constexpr const char* kQuery =
+      "select id, bar, updated from test.my_data";
+  static constexpr const char* kUpdatedField = "updated";
+  using UpdatedFieldType = storages::postgres::TimePointTz;
+  // Full updates are loaded with the binary COPY protocol
+  static constexpr bool kUseCopyForFullUpdates = true;
+};
+/*! [Pg Cache Policy Copy Example] */
+
+static_assert(
+    pg_cache::detail::UseCopyForFullUpdates<PostgresExamplePolicy7>());
+static_assert(
+    !pg_cache::detail::UseCopyForFullUpdates<PostgresExamplePolicy6>());
+
+/*! [Pg Cache Policy Notify Example] */
+struct PostgresExamplePolicy8 {
+  static constexpr std::string_view kName = "my-pg-cache";
+  using ValueType = MyStructure;
+  static constexpr auto kKeyMember = &MyStructure::id;
+  static constexpr const char* kQuery =
+      "select id, bar, updated from test.my_data";
+  static constexpr const char* kUpdatedField = "updated";
+  using UpdatedFieldType = storages::postgres::TimePointTz;
+  // An update is run after `NOTIFY my_data_changes` on the master host, e.g.
+  // from a trigger on the `test.my_data` table
+  static constexpr std::string_view kNotifyChannel = "my_data_changes";
+};
+/*! [Pg Cache Policy Notify Example] */
+
+static_assert(pg_cache::detail::kHasNotifyChannel<PostgresExamplePolicy8>);
+static_assert(!pg_cache::detail::kHasNotifyChannel<PostgresExamplePolicy7>);
+
 // Instantiation test
 using MyCache1 = PostgreCache<PostgresExamplePolicy>;
 using MyCache2 = PostgreCache<PostgresExamplePolicy2>;
@@ -271,6 +309,8 @@ using MyCache3 = PostgreCache<PostgresExamplePolicy3>;
 using MyCache4 = PostgreCache<PostgresExamplePolicy4>;
 using MyCache5 = PostgreCache<PostgresExamplePolicy5>;
 using MyCache6 = PostgreCache<PostgresExamplePolicy6>;
+using MyCache7 = PostgreCache<PostgresExamplePolicy7>;
+using MyCache8 = PostgreCache<PostgresExamplePolicy8>;
 
 // NB: field access required for actual instantiation
 static_assert(MyCache1::kIncrementalUpdates);
@@ -279,6 +319,8 @@ static_assert(MyCache3::kIncrementalUpdates);
 static_assert(MyCache4::kIncrementalUpdates);
 static_assert(MyCache5::kIncrementalUpdates);
 static_assert(MyCache6::kIncrementalUpdates);
+static_assert(MyCache7::kUseCopyForFullUpdates);
+static_assert(MyCache8::kListenNotifications);
 
 namespace pg = storages::postgres;
 static_assert(MyCache1::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
@@ -298,6 +340,8 @@ static_assert(MyCache6::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
   MyCache4{config, context};
   MyCache5{config, context};
   MyCache6{config, context};
+  MyCache7{config, context};
+  MyCache8{config, context};
 }
 
 }  // namespace components::example
@@ -109,6 +109,24 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
   return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
 }
 
+QueryBatchResult Cluster::Execute(ClusterHostTypeFlags flags,
+                                  const QueryBatch& batch) {
+  return Execute(flags, OptionalCommandControl{}, batch);
+}
+
+QueryBatchResult Cluster::Execute(ClusterHostTypeFlags flags,
+                                  OptionalCommandControl batch_cmd_ctl,
+                                  const QueryBatch& batch) {
+  batch_cmd_ctl = GetHandlersCmdCtl(batch_cmd_ctl);
+  auto ntrx = Start(flags, batch_cmd_ctl);
+  return ntrx.Execute(batch_cmd_ctl, batch);
+}
+
+NotifyScope Cluster::Listen(std::string_view channel,
+                            OptionalCommandControl cmd_ctl) {
+  return pimpl_->Listen(channel, GetHandlersCmdCtl(cmd_ctl));
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <tuple>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/io/chrono.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+using Row = std::tuple<pg::Bigint, pg::Integer, double, pg::TimePointTz>;
+
+const pg::OptionalCommandControl kBulkCmdCtl{
+    pg::CommandControl{std::chrono::seconds{10}, std::chrono::seconds{10}}};
+
+constexpr const char* kSelect =
+    "select i::bigint, i, i::float8 / 3, now() + i * interval '1 second' "
+    "from generate_series(1, $1) as i";
+
+// Every field is parsed with the generic buffer parsers, row by row
+BENCHMARK_DEFINE_F(PgConnection, DecodeRowByRow)(benchmark::State& state) {
+  if (!IsConnectionValid()) {
+    state.SkipWithError("Database not connected");
+    return;
+  }
+  engine::RunStandalone([this, &state] {
+    const int rows_count = state.range(0);
+    auto res = conn_->Execute(kBulkCmdCtl.value(), kSelect, rows_count);
+    for (auto _ : state) {
+      auto rows = res.AsContainer<std::vector<Row>>(pg::kRowTag);
+      benchmark::DoNotOptimize(rows);
+    }
+    state.SetItemsProcessed(state.iterations() * rows_count);
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, DecodeRowByRow)->Range(1 << 4, 1 << 16);
+
+// Fields are parsed column by column with the fixed width parsers
+BENCHMARK_DEFINE_F(PgConnection, DecodeColumnar)(benchmark::State& state) {
+  if (!IsConnectionValid()) {
+    state.SkipWithError("Database not connected");
+    return;
+  }
+  engine::RunStandalone([this, &state] {
+    const int rows_count = state.range(0);
+    auto res = conn_->Execute(kBulkCmdCtl.value(), kSelect, rows_count);
+    for (auto _ : state) {
+      auto rows = res.AsVectorOf<Row>(pg::kRowTag);
+      benchmark::DoNotOptimize(rows);
+    }
+    state.SetItemsProcessed(state.iterations() * rows_count);
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, DecodeColumnar)->Range(1 << 4, 1 << 16);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
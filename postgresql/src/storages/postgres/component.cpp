@@ -46,6 +46,8 @@ formats::json::ValueBuilder InstanceStatisticsToJson(
   conn["max"] = stats.connection.maximum;
   conn["waiting"] = stats.connection.waiting;
   conn["max-queue-size"] = stats.connection.max_queue_size;
+  conn["prepared-warmup"] = stats.connection.prepared_warmup_total;
+  conn["stash-hits"] = stats.connection.stash_hits;
 
   auto trx = instance["transactions"];
   trx["total"] = stats.transaction.total;
@@ -75,12 +77,17 @@ formats::json::ValueBuilder InstanceStatisticsToJson(
   timing["acquire-connection"]["1min"] =
       utils::statistics::PercentileToJson(stats.acquire_percentile);
   utils::statistics::SolomonSkip(timing["acquire-connection"]["1min"]);
+  timing["acquire-connection-us"]["1min"] =
+      utils::statistics::PercentileToJson(stats.acquire_us_percentile);
+  utils::statistics::SolomonSkip(timing["acquire-connection-us"]["1min"]);
 
   auto query = instance["queries"];
   query["parsed"] = stats.transaction.parse_total;
   query["portals-bound"] = stats.transaction.portal_bind_total;
   query["executed"] = stats.transaction.execute_total;
   query["replies"] = stats.transaction.reply_total;
+  query["prepared-cold"] = stats.transaction.cold_execute_total;
+  query["prepared-warm"] = stats.transaction.warm_execute_total;
 
   auto errors = instance["errors"];
   utils::statistics::SolomonChildrenAreLabelValues(errors, "postgresql_error");
@@ -97,6 +104,11 @@ formats::json::ValueBuilder InstanceStatisticsToJson(
   instance["roundtrip-time"] = stats.topology.roundtrip_time;
   instance["replication-lag"] = stats.topology.replication_lag;
 
+  auto host_selection = instance["host-selection"];
+  host_selection["nearest"] = stats.host_selection.nearest_total;
+  host_selection["spillover"] = stats.host_selection.spillover_total;
+  host_selection["saturated"] = stats.host_selection.saturated_total;
+
   if (!stats.statement_timings.empty()) {
     auto timings = instance["statement_timings"];
     for (const auto& [name, percentile] : stats.statement_timings) {
@@ -214,6 +226,9 @@ Postgres::Postgres(const ComponentConfig& config,
   topology_settings.max_replication_lag =
       config["max_replication_lag"].As<std::chrono::milliseconds>(
           kDefaultMaxReplicationLag);
+  topology_settings.nearest_rtt_tolerance =
+      config["nearest_rtt_tolerance"].As<std::chrono::milliseconds>(
+          topology_settings.nearest_rtt_tolerance);
 
   storages::postgres::ConnectionSettings& conn_settings =
       cluster_settings.conn_settings;
@@ -237,6 +252,13 @@ Postgres::Postgres(const ComponentConfig& config,
                                     ? pg::ConnectionSettings::kPipelineEnabled
                                     : pg::ConnectionSettings::kPipelineDisabled;
 
+  conn_settings.prepared_warmup_size = config["prepared_warmup_size"].As<size_t>(
+      conn_settings.prepared_warmup_size);
+
+  conn_settings.protocol = config["native_protocol_enabled"].As<bool>(false)
+                               ? pg::ConnectionSettings::kNativeProtocol
+                               : pg::ConnectionSettings::kLibpq;
+
   const auto task_processor_name =
       config["blocking_task_processor"].As<std::string>();
   auto* bg_task_processor = &context.GetTaskProcessor(task_processor_name);
@@ -343,6 +365,10 @@ properties:
         type: string
         description: replication lag limit for usable slaves
         defaultDescription: 60s
+    nearest_rtt_tolerance:
+        type: string
+        description: hosts with RTT within this tolerance of the nearest host are equally preferred by the kNearest strategy
+        defaultDescription: 0ms
     min_pool_size:
         type: integer
         description: number of connections created initially
@@ -382,6 +408,14 @@ properties:
         type: integer
         description: prepared statements cache size limit
         defaultDescription: 5000
+    prepared_warmup_size:
+        type: integer
+        description: number of the most executed statements to prepare on a new connection before it is used, 0 to disable
+        defaultDescription: 0
+    native_protocol_enabled:
+        type: boolean
+        description: talk to the server with the native protocol implementation instead of libpq
+        defaultDescription: false
     max_statement_metrics:
         type: integer
         description: limit of exported metrics for named statements
@@ -423,6 +457,10 @@ properties:
         type: integer
         description: maximum number of clients waiting for a connection
         defaultDescription: 200
+    thread_stash_size:
+        type: integer
+        description: number of recently released connections kept by each worker thread, 0 to disable
+        defaultDescription: 0
 )");
 }
 
@@ -0,0 +1,146 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/detail/copy.hpp>
+#include <userver/storages/postgres/io/floating_point_types.hpp>
+#include <userver/storages/postgres/io/string_types.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+using Row = std::tuple<int, std::string, double>;
+
+const pg::OptionalCommandControl kBulkCmdCtl{
+    pg::CommandControl{std::chrono::seconds{10}, std::chrono::seconds{10}}};
+
+constexpr const char* kCreateTable =
+    "create temporary table copy_bench(id integer, name text, "
+    "value double precision)";
+
+std::vector<Row> MakeRows(std::size_t count) {
+  std::vector<Row> rows;
+  rows.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    rows.emplace_back(i, "name " + std::to_string(i), i / 2.0);
+  }
+  return rows;
+}
+
+BENCHMARK_DEFINE_F(PgConnection, CopyIn)(benchmark::State& state) {
+  if (!IsConnectionValid()) {
+    state.SkipWithError("Database not connected");
+    return;
+  }
+  engine::RunStandalone([this, &state] {
+    conn_->Execute(kCreateTable);
+    const auto rows = MakeRows(state.range(0));
+    for (auto _ : state) {
+      conn_->CopyIn("COPY copy_bench FROM STDIN (FORMAT binary)",
+                    pg::detail::MakeCopyInSource(conn_->GetUserTypes(), rows),
+                    kBulkCmdCtl);
+
+      state.PauseTiming();
+      conn_->Execute("truncate copy_bench");
+      state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * rows.size());
+    conn_->Execute("drop table copy_bench");
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, CopyIn)->Range(1 << 4, 1 << 16);
+
+BENCHMARK_DEFINE_F(PgConnection, InsertUnnest)(benchmark::State& state) {
+  if (!IsConnectionValid()) {
+    state.SkipWithError("Database not connected");
+    return;
+  }
+  engine::RunStandalone([this, &state] {
+    conn_->Execute(kCreateTable);
+    std::vector<int> ids;
+    std::vector<std::string> names;
+    std::vector<double> values;
+    for (auto& [id, name, value] : MakeRows(state.range(0))) {
+      ids.push_back(id);
+      names.push_back(std::move(name));
+      values.push_back(value);
+    }
+    for (auto _ : state) {
+      conn_->Execute(kBulkCmdCtl.value(),
+                     "insert into copy_bench select * from unnest("
+                     "$1::integer[], $2::text[], $3::double precision[])",
+                     ids, names, values);
+
+      state.PauseTiming();
+      conn_->Execute("truncate copy_bench");
+      state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * ids.size());
+    conn_->Execute("drop table copy_bench");
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, InsertUnnest)->Range(1 << 4, 1 << 16);
+
+BENCHMARK_DEFINE_F(PgConnection, CopyOut)(benchmark::State& state) {
+  if (!IsConnectionValid()) {
+    state.SkipWithError("Database not connected");
+    return;
+  }
+  engine::RunStandalone([this, &state] {
+    conn_->Execute(kCreateTable);
+    conn_->CopyIn("COPY copy_bench FROM STDIN (FORMAT binary)",
+                  pg::detail::MakeCopyInSource(conn_->GetUserTypes(),
+                                               MakeRows(state.range(0))),
+                  kBulkCmdCtl);
+    for (auto _ : state) {
+      std::vector<Row> rows;
+      std::size_t rows_count = 0;
+      auto on_row = [&rows](Row&& row) { rows.push_back(std::move(row)); };
+      conn_->CopyOut(
+          "COPY (select * from copy_bench) TO STDOUT (FORMAT binary)",
+          pg::detail::MakeCopyOutSink<Row>(conn_->GetUserTypes(), on_row,
+                                           rows_count),
+          kBulkCmdCtl);
+      benchmark::DoNotOptimize(rows);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    conn_->Execute("drop table copy_bench");
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, CopyOut)->Range(1 << 4, 1 << 16);
+
+BENCHMARK_DEFINE_F(PgConnection, Select)(benchmark::State& state) {
+  if (!IsConnectionValid()) {
+    state.SkipWithError("Database not connected");
+    return;
+  }
+  engine::RunStandalone([this, &state] {
+    conn_->Execute(kCreateTable);
+    conn_->CopyIn("COPY copy_bench FROM STDIN (FORMAT binary)",
+                  pg::detail::MakeCopyInSource(conn_->GetUserTypes(),
+                                               MakeRows(state.range(0))),
+                  kBulkCmdCtl);
+    for (auto _ : state) {
+      auto res = conn_->Execute(kBulkCmdCtl.value(),
+                                "select * from copy_bench");
+      auto rows = res.AsContainer<std::vector<Row>>(pg::kRowTag);
+      benchmark::DoNotOptimize(rows);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    conn_->Execute("drop table copy_bench");
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, Select)->Range(1 << 4, 1 << 16);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
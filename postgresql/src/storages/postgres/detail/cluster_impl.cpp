@@ -1,10 +1,13 @@
 #include <storages/postgres/detail/cluster_impl.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <userver/engine/async.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
 
 #include <storages/postgres/detail/topology/hot_standby.hpp>
 #include <storages/postgres/detail/topology/standalone.hpp>
@@ -33,31 +36,6 @@ ClusterHostType Fallback(ClusterHostType ht) {
   UINVARIANT(false, "Unexpected cluster host type");
 }
 
-size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
-                      ClusterHostTypeFlags flags,
-                      std::atomic<uint32_t>& rr_host_idx) {
-  UASSERT(!indices.empty());
-  if (indices.empty()) {
-    throw ClusterError("Cannot select host from an empty list");
-  }
-
-  const auto strategy_flags = flags & kClusterHostStrategyMask;
-  LOG_TRACE() << "Applying " << strategy_flags << " strategy";
-
-  size_t idx_pos = 0;
-  if (!strategy_flags || strategy_flags == ClusterHostType::kRoundRobin) {
-    if (indices.size() != 1) {
-      idx_pos =
-          rr_host_idx.fetch_add(1, std::memory_order_relaxed) % indices.size();
-    }
-  } else if (strategy_flags != ClusterHostType::kNearest) {
-    throw LogicError(
-        fmt::format("Invalid strategy requested: {}, ensure only one is used",
-                    ToString(strategy_flags)));
-  }
-  return indices[idx_pos];
-}
-
 }  // namespace
 
 ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
@@ -68,6 +46,7 @@ ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
                          const error_injection::Settings& ei_settings)
     : default_cmd_ctls_(default_cmd_ctls),
       bg_task_processor_(bg_task_processor),
+      host_selection_stats_(dsns.size()),
       rr_host_idx_(0) {
   if (dsns.empty()) {
     throw ClusterError("Cannot create a cluster from an empty DSN list");
@@ -128,6 +107,7 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     cluster_stats->master.stats.Add(host_pools_[dsn_index]
                                         ->GetStatementTimingsStorage()
                                         .GetTimingsPercentiles());
+    cluster_stats->master.stats.Add(host_selection_stats_[dsn_index]);
     is_host_pool_seen[dsn_index] = 1;
   }
 
@@ -145,6 +125,7 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     cluster_stats->sync_slave.stats.Add(host_pools_[dsn_index]
                                             ->GetStatementTimingsStorage()
                                             .GetTimingsPercentiles());
+    cluster_stats->sync_slave.stats.Add(host_selection_stats_[dsn_index]);
     is_host_pool_seen[dsn_index] = 1;
   }
 
@@ -166,6 +147,7 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
       slave_desc.stats.Add(host_pools_[dsn_index]
                                ->GetStatementTimingsStorage()
                                .GetTimingsPercentiles());
+      slave_desc.stats.Add(host_selection_stats_[dsn_index]);
       is_host_pool_seen[dsn_index] = 1;
     }
   }
@@ -180,6 +162,7 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     desc.stats.Add(host_pools_[i]->GetStatistics(), dsn_stats[i]);
     desc.stats.Add(
         host_pools_[i]->GetStatementTimingsStorage().GetTimingsPercentiles());
+    desc.stats.Add(host_selection_stats_[i]);
 
     cluster_stats->unknown.push_back(std::move(desc));
   }
@@ -206,7 +189,7 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
     if (alive_dsn_indices->empty()) {
       throw ClusterUnavailable("None of cluster hosts are available");
     }
-    dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+    dsn_index = SelectDsnIndex(*alive_dsn_indices, flags);
   } else {
     auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
     auto dsn_indices_by_type = topology_->GetDsnIndicesByType();
@@ -228,13 +211,108 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
                       ToString(host_role), ToString(role_flags)));
     }
     LOG_TRACE() << "Starting transaction on " << host_role;
-    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags);
   }
 
   UASSERT(dsn_index < host_pools_.size());
   return host_pools_.at(dsn_index);
 }
 
+size_t ClusterImpl::SelectDsnIndex(const DsnIndices& indices,
+                                   ClusterHostTypeFlags flags) {
+  UASSERT(!indices.empty());
+  if (indices.empty()) {
+    throw ClusterError("Cannot select host from an empty list");
+  }
+
+  const auto strategy_flags = flags & kClusterHostStrategyMask;
+  LOG_TRACE() << "Applying " << strategy_flags << " strategy";
+
+  size_t idx_pos = 0;
+  if (!strategy_flags || strategy_flags == ClusterHostType::kRoundRobin) {
+    if (indices.size() != 1) {
+      idx_pos =
+          rr_host_idx_.fetch_add(1, std::memory_order_relaxed) % indices.size();
+    }
+  } else if (strategy_flags == ClusterHostType::kNearest) {
+    return SelectNearestDsnIndex(indices);
+  } else {
+    throw LogicError(
+        fmt::format("Invalid strategy requested: {}, ensure only one is used",
+                    ToString(strategy_flags)));
+  }
+  return indices[idx_pos];
+}
+
+size_t ClusterImpl::SelectNearestDsnIndex(const DsnIndices& indices) {
+  const auto rtts = topology_->GetDsnRtts();
+  const topology::TopologyBase::Rtt tolerance =
+      topology_->GetTopologySettings().nearest_rtt_tolerance;
+
+  // Indices are ordered by RTT, so the bands of equally near hosts are
+  // contiguous. A farther band is used only if the nearer ones are saturated.
+  for (auto band_begin = indices.begin(); band_begin != indices.end();) {
+    UASSERT(*band_begin < rtts->size());
+    const auto band_rtt_limit = (*rtts)[*band_begin] + tolerance;
+    const auto band_end =
+        std::find_if(band_begin, indices.end(), [&](size_t dsn_index) {
+          return (*rtts)[dsn_index] > band_rtt_limit;
+        });
+
+    const auto dsn_index = SelectLessLoadedDsnIndex(band_begin, band_end);
+    if (dsn_index) {
+      if (band_begin == indices.begin()) {
+        ++host_selection_stats_[*dsn_index].nearest_total;
+      } else {
+        ++host_selection_stats_[*dsn_index].spillover_total;
+      }
+      return *dsn_index;
+    }
+    band_begin = band_end;
+  }
+
+  // All the hosts are saturated, wait for a connection of the nearest one
+  LOG_LIMITED_WARNING() << "All the hosts are saturated, using the nearest one";
+  ++host_selection_stats_[indices.front()].nearest_total;
+  return indices.front();
+}
+
+std::optional<size_t> ClusterImpl::SelectLessLoadedDsnIndex(
+    DsnIndexIterator begin, DsnIndexIterator end) {
+  // Power of two choices: the less loaded of two random hosts that are not
+  // saturated is chosen. The two hosts are picked with reservoir sampling.
+  std::optional<size_t> first;
+  std::optional<size_t> second;
+  size_t candidates_count = 0;
+  for (auto it = begin; it != end; ++it) {
+    UASSERT(*it < host_pools_.size());
+    if (host_pools_[*it]->IsSaturated()) {
+      ++host_selection_stats_[*it].saturated_total;
+      continue;
+    }
+
+    ++candidates_count;
+    if (candidates_count == 1) {
+      first = *it;
+    } else if (candidates_count == 2) {
+      second = *it;
+    } else {
+      const auto pos = USERVER_NAMESPACE::utils::RandRange(candidates_count);
+      if (pos == 0) {
+        first = *it;
+      } else if (pos == 1) {
+        second = *it;
+      }
+    }
+  }
+
+  if (!second) return first;
+  return host_pools_[*first]->GetUsedCount() <=
+                 host_pools_[*second]->GetUsedCount()
+             ? first
+             : second;
+}
+
 Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags,
                                const TransactionOptions& options,
                                OptionalCommandControl cmd_ctl) {
@@ -263,6 +341,12 @@ NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
   return FindPool(flags)->Start(cmd_ctl);
 }
 
+NotifyScope ClusterImpl::Listen(std::string_view channel,
+                                OptionalCommandControl cmd_ctl) {
+  LOG_TRACE() << "Requested listen on channel " << channel;
+  return FindPool(ClusterHostType::kMaster)->Listen(channel, cmd_ctl);
+}
+
 void ClusterImpl::SetDefaultCommandControl(CommandControl cmd_ctl,
                                            DefaultCommandControlSource source) {
   default_cmd_ctls_.UpdateDefaultCmdCtl(cmd_ctl, source);
@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -15,6 +16,7 @@
 #include <storages/postgres/detail/topology/base.hpp>
 #include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
@@ -40,6 +42,8 @@ class ClusterImpl {
 
   NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+  NotifyScope Listen(std::string_view channel, OptionalCommandControl);
+
   void SetDefaultCommandControl(CommandControl, DefaultCommandControlSource);
   CommandControl GetDefaultCommandControl() const;
 
@@ -59,14 +63,23 @@ class ClusterImpl {
 
  private:
   using ConnectionPoolPtr = std::shared_ptr<ConnectionPool>;
+  using DsnIndices = topology::TopologyBase::DsnIndices;
+  using DsnIndexIterator = DsnIndices::const_iterator;
 
   ConnectionPoolPtr FindPool(ClusterHostTypeFlags);
 
+  size_t SelectDsnIndex(const DsnIndices&, ClusterHostTypeFlags);
+  size_t SelectNearestDsnIndex(const DsnIndices&);
+  std::optional<size_t> SelectLessLoadedDsnIndex(DsnIndexIterator begin,
+                                                 DsnIndexIterator end);
+
  private:
   DefaultCommandControls default_cmd_ctls_;
   std::unique_ptr<topology::TopologyBase> topology_;
   engine::TaskProcessor& bg_task_processor_;
   std::vector<ConnectionPoolPtr> host_pools_;
+  std::vector<decltype(InstanceStatistics::host_selection)>
+      host_selection_stats_;
   std::atomic<uint32_t> rr_host_idx_;
 };
 
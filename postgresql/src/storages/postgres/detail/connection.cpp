@@ -124,6 +124,53 @@ ResultSet Connection::PortalExecute(StatementId statement_id,
                                std::move(statement_cmd_ctl));
 }
 
+void Connection::Listen(std::string_view channel,
+                        OptionalCommandControl cmd_ctl) {
+  pimpl_->Listen(channel, std::move(cmd_ctl));
+}
+
+void Connection::Unlisten(std::string_view channel,
+                          OptionalCommandControl cmd_ctl) {
+  pimpl_->Unlisten(channel, std::move(cmd_ctl));
+}
+
+Notification Connection::WaitNotify(engine::Deadline deadline) {
+  return pimpl_->WaitNotify(deadline);
+}
+
+QueryBatchResult Connection::ExecuteBatch(
+    const QueryBatch& batch, OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->ExecuteBatch(batch, std::move(statement_cmd_ctl));
+}
+
+ResultSet Connection::CopyIn(const Query& query,
+                             const detail::CopyInSource& source,
+                             OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->CopyIn(query, source, std::move(statement_cmd_ctl));
+}
+
+ResultSet Connection::CopyOut(const Query& query,
+                              const detail::CopyOutSink& sink,
+                              OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->CopyOut(query, sink, std::move(statement_cmd_ctl));
+}
+
+void Connection::StartResultStream(const Query& query,
+                                   const detail::QueryParameters& params,
+                                   OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->StartResultStream(query, params, std::move(statement_cmd_ctl));
+}
+
+ResultSet Connection::FetchResultStreamRow() {
+  return pimpl_->FetchResultStreamRow();
+}
+
+void Connection::FinishResultStream() { pimpl_->FinishResultStream(); }
+
+bool Connection::IsResultStreamActive() const {
+  return pimpl_->IsResultStreamActive();
+}
+
 void Connection::CancelAndCleanup(TimeoutDuration timeout) {
   pimpl_->CancelAndCleanup(timeout);
 }
@@ -151,6 +198,16 @@ void Connection::Ping() { pimpl_->Ping(); }
 
 void Connection::MarkAsBroken() { pimpl_->MarkAsBroken(); }
 
+void Connection::SetPreparedStatementsRegistry(
+    std::shared_ptr<PreparedStatementsRegistry> registry) {
+  pimpl_->SetPreparedStatementsRegistry(std::move(registry));
+}
+
+std::size_t Connection::WarmupPreparedStatements(std::size_t limit,
+                                                 engine::Deadline deadline) {
+  return pimpl_->WarmupPreparedStatements(limit, deadline);
+}
+
 OptionalCommandControl Connection::GetQueryCmdCtl(
     const std::optional<Query::Name>& query_name) const {
   return pimpl_->GetNamedQueryCommandControl(query_name);
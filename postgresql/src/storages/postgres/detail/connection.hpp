@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <string>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -12,11 +13,14 @@
 #include <userver/utils/strong_typedef.hpp>
 #include <utils/size_guard.hpp>
 
+#include <userver/storages/postgres/detail/copy.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/dsn.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
@@ -35,6 +39,7 @@ enum class ConnectionState {
 namespace detail {
 
 class ConnectionImpl;
+class PreparedStatementsRegistry;
 
 /// @brief PostreSQL connection class
 /// Handles connecting to Postgres, sending commands, processing command results
@@ -72,6 +77,8 @@ class Connection {
           error_execute_total{0},
           execute_timeout{0},
           duplicate_prepared_statements{0},
+          cold_execute_total{0},
+          warm_execute_total{0},
           prepared_statements_current{0},
           sum_query_duration{0} {}
 
@@ -98,6 +105,11 @@ class Connection {
     /// Number of duplicate prepared statements errors,
     /// probably caused by timeout while preparing
     Counter duplicate_prepared_statements;
+    /// Number of prepared statement executions that had to prepare the
+    /// statement first
+    Counter cold_execute_total;
+    /// Number of executions of already prepared statements
+    Counter warm_execute_total;
 
     /// Current number of prepared statements
     CurrentValue prepared_statements_current;
@@ -233,6 +245,40 @@ class Connection {
   ResultSet PortalExecute(StatementId, const std::string& portal_name,
                           std::uint32_t n_rows, OptionalCommandControl);
 
+  /// @brief Execute the statements of the batch in a single network round
+  /// trip using pipeline mode.
+  /// Server errors of the statements are returned in the result
+  QueryBatchResult ExecuteBatch(const QueryBatch& batch,
+                                OptionalCommandControl statement_cmd_ctl);
+
+  /// @brief Execute `COPY ... FROM STDIN` statement, the data is taken from
+  /// the `source` until it returns false.
+  /// Pipeline mode is turned off for the duration of the COPY
+  ResultSet CopyIn(const Query& query, const detail::CopyInSource& source,
+                   OptionalCommandControl statement_cmd_ctl);
+  /// @brief Execute `COPY ... TO STDOUT` statement, the data is passed to the
+  /// `sink` message by message.
+  /// Pipeline mode is turned off for the duration of the COPY
+  ResultSet CopyOut(const Query& query, const detail::CopyOutSink& sink,
+                    OptionalCommandControl statement_cmd_ctl);
+
+  /// @brief Send the statement and switch to single-row mode, the rows are
+  /// then read one by one with FetchResultStreamRow.
+  /// Pipeline mode is turned off until the stream is finished
+  void StartResultStream(const Query& query,
+                         const detail::QueryParameters& params,
+                         OptionalCommandControl statement_cmd_ctl);
+  /// @brief Wait for the next row of the started result stream.
+  /// Returns a result set with a single row or, when the rows are exhausted,
+  /// the final result set without rows and finishes the stream
+  ResultSet FetchResultStreamRow();
+  /// @brief Finish the stream before the rows are exhausted. Outside of a
+  /// transaction the statement is cancelled, inside of a transaction the rest
+  /// of the rows are read and discarded to keep the transaction usable
+  void FinishResultStream();
+  /// Check if a result stream was started and is not finished yet
+  bool IsResultStreamActive() const;
+
   /// Send cancel to the database backend
   /// Try to return connection to idle state discarding all results.
   /// If there is a transaction in progress - roll it back.
@@ -255,6 +301,16 @@ class Connection {
   void SetParameter(const std::string& param, const std::string& value,
                     ParameterScope scope);
 
+  /// @brief Subscribe to the notification channel with `LISTEN`
+  void Listen(std::string_view channel, OptionalCommandControl cmd_ctl);
+
+  /// @brief Unsubscribe from the notification channel with `UNLISTEN`.
+  /// Notifications of the channel that were not received yet are discarded
+  void Unlisten(std::string_view channel, OptionalCommandControl cmd_ctl);
+
+  /// @brief Wait for a notification on subscribed channels
+  Notification WaitNotify(engine::Deadline deadline);
+
   /// @brief Reload user types after creating a type
   void ReloadUserTypes();
   const UserTypes& GetUserTypes() const;
@@ -268,6 +324,15 @@ class Connection {
 
   void MarkAsBroken();
 
+  /// Set the pool-wide registry to account the executed prepared statements in
+  void SetPreparedStatementsRegistry(
+      std::shared_ptr<PreparedStatementsRegistry> registry);
+  /// Prepare up to `limit` most executed statements from the registry in a
+  /// single network round trip if possible.
+  /// @returns the number of statements prepared
+  std::size_t WarmupPreparedStatements(std::size_t limit,
+                                       engine::Deadline deadline);
+
   OptionalCommandControl GetQueryCmdCtl(
       const std::optional<Query::Name>& query_name) const;
 
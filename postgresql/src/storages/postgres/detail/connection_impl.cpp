@@ -1,5 +1,10 @@
 #include <storages/postgres/detail/connection_impl.hpp>
 
+#include <exception>
+#include <optional>
+#include <variant>
+#include <vector>
+
 #include <boost/functional/hash.hpp>
 
 #include <userver/error_injection/hook.hpp>
@@ -7,6 +12,7 @@
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/uuid4.hpp>
 
 #include <storages/postgres/detail/tracing_tags.hpp>
@@ -164,7 +170,8 @@ ConnectionImpl::ConnectionImpl(
     const error_injection::Settings& ei_settings,
     Connection::SizeGuard&& size_guard)
     : uuid_{USERVER_NAMESPACE::utils::generators::GenerateUuid()},
-      conn_wrapper_{bg_task_processor, id, std::move(size_guard)},
+      conn_wrapper_{bg_task_processor, id, std::move(size_guard),
+                    settings.protocol},
       prepared_{settings.max_prepared_cache_size},
       settings_{settings},
       default_cmd_ctls_(default_cmd_ctls),
@@ -467,6 +474,282 @@ ResultSet ConnectionImpl::PortalExecute(
                     count_execute, span, scope, &prepared_info->description);
 }
 
+QueryBatchResult ConnectionImpl::ExecuteBatch(
+    const QueryBatch& batch, OptionalCommandControl statement_cmd_ctl) {
+  CheckBusy();
+  TimeoutDuration execute_timeout = !!statement_cmd_ctl
+                                        ? statement_cmd_ctl->execute
+                                        : CurrentExecuteTimeout();
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(execute_timeout);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+  if (batch.IsEmpty()) return {};
+
+  if (settings_.ignore_unused_query_params ==
+      ConnectionSettings::kCheckUnused) {
+    for (const auto& [query, params] : batch.GetStatements()) {
+      CheckQueryParameters(query.Statement(), params.GetInternalData());
+    }
+  }
+  DiscardOldPreparedStatements(deadline);
+  CheckDeadlineReached(deadline);
+#if LIBPQ_HAS_PIPELINING
+  return ExecuteBatchPipelined(batch, deadline);
+#else
+  return ExecuteBatchSequential(batch, deadline);
+#endif
+}
+
+void ConnectionImpl::Listen(std::string_view channel,
+                            OptionalCommandControl cmd_ctl) {
+  CheckBusy();
+  const auto quoted_channel = conn_wrapper_.EscapeIdentifier(channel);
+  TimeoutDuration execute_timeout =
+      !!cmd_ctl ? cmd_ctl->execute : CurrentExecuteTimeout();
+  ExecuteCommandNoPrepare("LISTEN " + quoted_channel,
+                          testsuite_pg_ctl_.MakeExecuteDeadline(execute_timeout));
+}
+
+void ConnectionImpl::Unlisten(std::string_view channel,
+                              OptionalCommandControl cmd_ctl) {
+  CheckBusy();
+  const auto quoted_channel = conn_wrapper_.EscapeIdentifier(channel);
+  TimeoutDuration execute_timeout =
+      !!cmd_ctl ? cmd_ctl->execute : CurrentExecuteTimeout();
+  ExecuteCommandNoPrepare(
+      "UNLISTEN " + quoted_channel,
+      testsuite_pg_ctl_.MakeExecuteDeadline(execute_timeout));
+  // Do not let the next user of the connection see stale notifications
+  conn_wrapper_.DiscardNotifies();
+}
+
+Notification ConnectionImpl::WaitNotify(engine::Deadline deadline) {
+  CheckBusy();
+  return conn_wrapper_.WaitNotify(deadline);
+}
+
+ResultSet ConnectionImpl::CopyIn(const Query& query,
+                                 const CopyInSource& source,
+                                 OptionalCommandControl statement_cmd_ctl) {
+  auto deadline = PrepareNonPipelinedCommand(std::move(statement_cmd_ctl));
+  USERVER_NAMESPACE::utils::FastScopeGuard pipeline_guard(
+      [this]() noexcept { RestorePipelineMode(); });
+  const auto& statement = query.Statement();
+  auto span = MakeQuerySpan(query);
+  auto scope = span.CreateScopeTime();
+  TimeoutDuration network_timeout =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          deadline.TimeLeft());
+  CountExecute count_execute(stats_);
+  conn_wrapper_.SendQuery(statement, scope);
+
+  // Server errors abort the COPY, in that case libpq refuses to send data and
+  // the actual error is reported by WaitResult
+  std::exception_ptr send_error;
+  try {
+    conn_wrapper_.WaitCopyStart(deadline, scope);
+    scope.Reset(scopes::kLibpqPutCopyData);
+    std::vector<char> buffer;
+    buffer.reserve(kCopyChunkSize);
+    for (bool has_more = true; has_more;) {
+      buffer.clear();
+      try {
+        has_more = source(buffer);
+      } catch (const std::exception& e) {
+        // Abort the COPY leaving the connection usable
+        conn_wrapper_.PutCopyEnd(e.what(), deadline);
+        conn_wrapper_.DiscardInput(deadline);
+        throw;
+      }
+      if (!buffer.empty()) conn_wrapper_.PutCopyData(buffer, deadline);
+    }
+    conn_wrapper_.PutCopyEnd(nullptr, deadline);
+  } catch (const CommandError&) {
+    send_error = std::current_exception();
+  } catch (const ConnectionTimeoutError& e) {
+    ++stats_.execute_timeout;
+    LOG_LIMITED_WARNING() << "Statement `" << statement
+                          << "` network timeout error: " << e << ". "
+                          << "Network timout was " << network_timeout.count()
+                          << "ms";
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  } catch (const std::exception&) {
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+
+  auto res = WaitResult(statement, deadline, network_timeout, count_execute,
+                        span, scope, nullptr);
+  if (send_error) {
+    span.AddTag(tracing::kErrorFlag, true);
+    std::rethrow_exception(send_error);
+  }
+  return res;
+}
+
+ResultSet ConnectionImpl::CopyOut(const Query& query, const CopyOutSink& sink,
+                                  OptionalCommandControl statement_cmd_ctl) {
+  auto deadline = PrepareNonPipelinedCommand(std::move(statement_cmd_ctl));
+  USERVER_NAMESPACE::utils::FastScopeGuard pipeline_guard(
+      [this]() noexcept { RestorePipelineMode(); });
+  const auto& statement = query.Statement();
+  auto span = MakeQuerySpan(query);
+  auto scope = span.CreateScopeTime();
+  TimeoutDuration network_timeout =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          deadline.TimeLeft());
+  CountExecute count_execute(stats_);
+  conn_wrapper_.SendQuery(statement, scope);
+
+  try {
+    conn_wrapper_.WaitCopyStart(deadline, scope);
+    scope.Reset(scopes::kLibpqGetCopyData);
+    for (auto data = conn_wrapper_.GetCopyData(deadline); !data.empty();
+         data = conn_wrapper_.GetCopyData(deadline)) {
+      try {
+        sink(data);
+      } catch (const std::exception&) {
+        // Make the server stop sending the data and skip what is already
+        // received, leaving the connection usable
+        std::optional<engine::Task> cancel;
+        // Cancelling the statement would abort the transaction
+        if (!IsInTransaction()) cancel.emplace(conn_wrapper_.Cancel());
+        while (!conn_wrapper_.GetCopyData(deadline).empty()) {
+        }
+        conn_wrapper_.DiscardInput(deadline);
+        if (cancel) cancel->WaitUntil(deadline);
+        throw;
+      }
+    }
+  } catch (const ConnectionTimeoutError& e) {
+    ++stats_.execute_timeout;
+    LOG_LIMITED_WARNING() << "Statement `" << statement
+                          << "` network timeout error: " << e << ". "
+                          << "Network timout was " << network_timeout.count()
+                          << "ms";
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  } catch (const std::exception&) {
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+
+  return WaitResult(statement, deadline, network_timeout, count_execute, span,
+                    scope, nullptr);
+}
+
+void ConnectionImpl::StartResultStream(
+    const Query& query, const QueryParameters& params,
+    OptionalCommandControl statement_cmd_ctl) {
+  const bool in_transaction = IsInTransaction();
+  auto deadline = PrepareNonPipelinedCommand(std::move(statement_cmd_ctl));
+  USERVER_NAMESPACE::utils::FastScopeGuard pipeline_guard(
+      [this]() noexcept { RestorePipelineMode(); });
+  const auto& statement = query.Statement();
+  auto span = MakeQuerySpan(query);
+  auto scope = span.CreateScopeTime();
+  ResultStreamState state{
+      statement, std::nullopt,
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          deadline.TimeLeft()),
+      SteadyClock::now(), in_transaction};
+  ++stats_.execute_total;
+
+  try {
+    if (settings_.prepared_statements ==
+        ConnectionSettings::kNoPreparedStatements) {
+      conn_wrapper_.SendQuery(statement, params, scope);
+    } else {
+      if (settings_.ignore_unused_query_params ==
+          ConnectionSettings::kCheckUnused) {
+        CheckQueryParameters(statement, params);
+      }
+      DiscardOldPreparedStatements(deadline);
+      const auto& prepared_info =
+          PrepareStatement(statement, params, deadline, span, scope);
+      state.description = prepared_info.description;
+      scope.Reset(scopes::kExec);
+      conn_wrapper_.SendPreparedQuery(prepared_info.statement_name, params,
+                                      scope);
+    }
+    conn_wrapper_.SetSingleRowMode();
+  } catch (const std::exception&) {
+    ++stats_.error_execute_total;
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+
+  result_stream_ = std::move(state);
+  pipeline_guard.Release();
+}
+
+ResultSet ConnectionImpl::FetchResultStreamRow() {
+  UINVARIANT(result_stream_, "Result stream is not started");
+  auto& state = *result_stream_;
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(state.network_timeout);
+
+  auto res = ResultSet{nullptr};
+  try {
+    res = conn_wrapper_.WaitSingleRowResult(deadline);
+  } catch (const ConnectionTimeoutError& e) {
+    ++stats_.execute_timeout;
+    LOG_LIMITED_WARNING() << "Statement `" << state.statement
+                          << "` network timeout error: " << e << ". "
+                          << "Network timout was "
+                          << state.network_timeout.count() << "ms";
+    // The rest of the rows are left in the connection, FinishResultStream
+    // takes care of them
+    throw;
+  } catch (const std::exception&) {
+    // The connection is idle after a server error
+    ++stats_.error_execute_total;
+    stats_.last_execute_finish = SteadyClock::now();
+    result_stream_.reset();
+    RestorePipelineMode();
+    throw;
+  }
+
+  if (state.description) {
+    res.SetBufferCategoriesFrom(*state.description);
+  } else {
+    FillBufferCategories(res);
+    state.description = res;
+  }
+
+  if (res.IsEmpty()) {
+    const auto now = SteadyClock::now();
+    if (res.FieldCount()) ++stats_.reply_total;
+    stats_.sum_query_duration += now - state.start_time;
+    stats_.last_execute_finish = now;
+    result_stream_.reset();
+    RestorePipelineMode();
+  }
+  return res;
+}
+
+void ConnectionImpl::FinishResultStream() {
+  if (!result_stream_) return;
+  const auto state = std::move(*result_stream_);
+  result_stream_.reset();
+  USERVER_NAMESPACE::utils::FastScopeGuard pipeline_guard(
+      [this]() noexcept { RestorePipelineMode(); });
+  stats_.last_execute_finish = SteadyClock::now();
+
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(state.network_timeout);
+  if (state.in_transaction) {
+    // Cancelling the statement would abort the transaction
+    conn_wrapper_.DiscardInput(deadline);
+  } else {
+    auto cancel = conn_wrapper_.Cancel();
+    conn_wrapper_.DiscardInput(deadline);
+    cancel.WaitUntil(deadline);
+  }
+}
+
+bool ConnectionImpl::IsResultStreamActive() const {
+  return result_stream_.has_value();
+}
+
 void ConnectionImpl::CancelAndCleanup(TimeoutDuration timeout) {
   auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
 
@@ -474,6 +757,13 @@ void ConnectionImpl::CancelAndCleanup(TimeoutDuration timeout) {
   if (state == ConnectionState::kOffline) {
     return;
   }
+  const bool had_result_stream = result_stream_.has_value();
+  // An abandoned stream is cancelled below
+  result_stream_.reset();
+  USERVER_NAMESPACE::utils::FastScopeGuard pipeline_guard(
+      [this, had_result_stream]() noexcept {
+        if (had_result_stream) RestorePipelineMode();
+      });
   if (GetConnectionState() == ConnectionState::kTranActive) {
     auto cancel = conn_wrapper_.Cancel();
     // May throw on timeout
@@ -540,9 +830,118 @@ void ConnectionImpl::Ping() {
   Finish();
 }
 
+template <typename Func>
+auto ConnectionImpl::RunInPipelineMode(Func&& func) {
+  // Pipeline mode is turned on for the duration of the call if the connection
+  // does not use it
+  const bool enter_pipeline = !IsPipelineEnabled();
+  if (enter_pipeline) conn_wrapper_.EnterPipelineMode();
+  USERVER_NAMESPACE::utils::FastScopeGuard pipeline_guard(
+      [this, enter_pipeline]() noexcept {
+        if (!enter_pipeline) return;
+        try {
+          conn_wrapper_.ExitPipelineMode();
+        } catch (const std::exception& e) {
+          LOG_LIMITED_WARNING() << "Failed to exit pipeline mode, connection is "
+                                   "marked as broken: "
+                                << e;
+          conn_wrapper_.MarkAsBroken();
+        }
+      });
+  return func();
+}
+
 void ConnectionImpl::MarkAsBroken() { conn_wrapper_.MarkAsBroken(); }
 
+void ConnectionImpl::SetPreparedStatementsRegistry(
+    std::shared_ptr<PreparedStatementsRegistry> registry) {
+  statements_registry_ = std::move(registry);
+}
+
+std::size_t ConnectionImpl::WarmupPreparedStatements(
+    std::size_t limit, engine::Deadline deadline) {
+  CheckBusy();
+  if (!statements_registry_ || settings_.prepared_statements ==
+                                   ConnectionSettings::kNoPreparedStatements) {
+    return 0;
+  }
+  const auto statements = statements_registry_->GetMostExecuted(
+      std::min(limit, settings_.max_prepared_cache_size - prepared_.GetSize()));
+  if (statements.empty()) return 0;
+
+  tracing::Span span{scopes::kPrepareWarmup};
+  conn_wrapper_.FillSpanTags(span);
+  auto scope = span.CreateScopeTime();
+
+  std::size_t prepared_count = 0;
+  const auto add_prepared = [this, &prepared_count](
+                                const PreparedStatementsRegistry::StatementInfo&
+                                    info,
+                                ResultSet&& description) {
+    FillBufferCategories(description);
+    try {
+      description.GetRowDescription().CheckBinaryFormat(db_types_);
+    } catch (const std::exception& e) {
+      LOG_DEBUG() << "Statement `" << info.statement
+                  << "` is not warmed up: " << e;
+      return;
+    }
+    prepared_.Put(info.id, {info.id, info.statement, MakeStatementName(info.id),
+                            std::move(description)});
+    ++prepared_count;
+  };
+
+  try {
+#if LIBPQ_HAS_PIPELINING
+    // All the statements are prepared and described in a single round trip.
+    // A failed statement makes the server skip the rest of them, that is fine
+    // as they will be prepared on the first use as usual.
+    auto results = RunInPipelineMode([&] {
+      for (const auto& info : statements) {
+        const auto statement_name = MakeStatementName(info->id);
+        conn_wrapper_.SendPrepare(statement_name, info->statement,
+                                  info->param_types, scope);
+        conn_wrapper_.SendDescribePrepared(statement_name, scope);
+      }
+      return conn_wrapper_.WaitPipelineResults(statements.size() * 2, deadline,
+                                               scope);
+    });
+    for (std::size_t i = 0; i < statements.size(); ++i) {
+      if (auto* description = std::get_if<ResultSet>(&results[i * 2 + 1])) {
+        add_prepared(*statements[i], std::move(*description));
+      }
+    }
+#else
+    for (const auto& info : statements) {
+      const auto statement_name = MakeStatementName(info->id);
+      try {
+        conn_wrapper_.SendPrepare(statement_name, info->statement,
+                                  info->param_types, scope);
+        conn_wrapper_.WaitResult(deadline, scope);
+        conn_wrapper_.SendDescribePrepared(statement_name, scope);
+        add_prepared(*info, conn_wrapper_.WaitResult(deadline, scope));
+      } catch (const ServerLogicError& e) {
+        LOG_DEBUG() << "Statement `" << info->statement
+                    << "` is not warmed up: " << e;
+      } catch (const ServerRuntimeError& e) {
+        LOG_DEBUG() << "Statement `" << info->statement
+                    << "` is not warmed up: " << e;
+      }
+    }
+#endif
+  } catch (const std::exception&) {
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+  LOG_DEBUG() << "Prepared " << prepared_count << " of " << statements.size()
+              << " most executed statements";
+  return prepared_count;
+}
+
 void ConnectionImpl::CheckBusy() const {
+  if (result_stream_) {
+    throw ConnectionBusy("There is a result stream in progress");
+  }
   if ((GetConnectionState() == ConnectionState::kTranActive) &&
       (!IsPipelineEnabled() || conn_wrapper_.IsSyncingPipeline())) {
     throw ConnectionBusy("There is another query in flight");
@@ -623,21 +1022,32 @@ void ConnectionImpl::SetStatementTimeout(OptionalCommandControl cmd_ctl) {
   }
 }
 
+std::string ConnectionImpl::MakeStatementName(
+    Connection::StatementId id) const {
+  return "q" + std::to_string(id.GetUnderlying()) + "_" + uuid_;
+}
+
 const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::PrepareStatement(
     const std::string& statement, const QueryParameters& params,
     engine::Deadline deadline, tracing::Span& span, tracing::ScopeTime& scope) {
-  auto query_hash = QueryHash(statement, params);
-  Connection::StatementId query_id{query_hash};
-  std::string statement_name = "q" + std::to_string(query_hash) + "_" + uuid_;
+  Connection::StatementId query_id{QueryHash(statement, params)};
 
   error_injection::Hook ei_hook(ei_settings_, deadline);
   ei_hook.PreHook<ConnectionTimeoutError, CommandError>();
 
+  if (statements_registry_) {
+    statements_executions_.Account(*statements_registry_, query_id, statement,
+                                   params);
+  }
+
   auto* statement_info = prepared_.Get(query_id);
   if (statement_info) {
     LOG_TRACE() << "Query " << statement << " is already prepared.";
+    ++stats_.warm_execute_total;
     return *statement_info;
   } else {
+    ++stats_.cold_execute_total;
+    const auto statement_name = MakeStatementName(query_id);
     if (prepared_.GetSize() >= settings_.max_prepared_cache_size) {
       statement_info = prepared_.GetLeastUsed();
       UASSERT(statement_info);
@@ -755,6 +1165,129 @@ ResultSet ConnectionImpl::ExecuteCommandNoPrepare(const Query& query,
                     scope, nullptr);
 }
 
+QueryBatchResult ConnectionImpl::ExecuteBatchPipelined(
+    const QueryBatch& batch, engine::Deadline deadline) {
+  tracing::Span span{scopes::kQueryBatch};
+  conn_wrapper_.FillSpanTags(span);
+  auto scope = span.CreateScopeTime();
+  TimeoutDuration network_timeout =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          deadline.TimeLeft());
+  CountExecute count_execute(stats_);
+
+  // Already prepared statements are executed by name, the rest are sent
+  // unnamed to avoid additional round trips
+  std::vector<const ResultSet*> descriptions;
+  descriptions.reserve(batch.Size());
+  std::vector<std::variant<ResultSet, std::exception_ptr>> results;
+  try {
+    results = RunInPipelineMode([&] {
+      for (const auto& [query, store] : batch.GetStatements()) {
+        const auto& params = store.GetInternalData();
+        const PreparedStatementInfo* prepared_info = nullptr;
+        if (settings_.prepared_statements !=
+            ConnectionSettings::kNoPreparedStatements) {
+          prepared_info = prepared_.Get(
+              Connection::StatementId{QueryHash(query.Statement(), params)});
+        }
+        if (prepared_info) {
+          ++stats_.warm_execute_total;
+          conn_wrapper_.SendPreparedQuery(prepared_info->statement_name, params,
+                                          scope);
+          descriptions.push_back(&prepared_info->description);
+        } else {
+          ++stats_.cold_execute_total;
+          conn_wrapper_.SendQuery(query.Statement(), params, scope);
+          descriptions.push_back(nullptr);
+        }
+      }
+      return conn_wrapper_.WaitPipelineResults(batch.Size(), deadline, scope);
+    });
+  } catch (const ConnectionTimeoutError& e) {
+    ++stats_.execute_timeout;
+    LOG_LIMITED_WARNING() << "Batch of " << batch.Size()
+                          << " statements network timeout error: " << e
+                          << ". Network timout was " << network_timeout.count()
+                          << "ms";
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  } catch (const std::exception&) {
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+
+  QueryBatchResult batch_result;
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    if (auto* res = std::get_if<ResultSet>(&results[i])) {
+      const auto* description = descriptions[i];
+      if (description && !description->IsEmpty()) {
+        res->SetBufferCategoriesFrom(*description);
+      } else if (!res->IsEmpty()) {
+        FillBufferCategories(*res);
+      }
+      count_execute.AccountResult(*res);
+      batch_result.Add(std::move(*res));
+    } else {
+      span.AddTag(tracing::kErrorFlag, true);
+      batch_result.Add(std::get<std::exception_ptr>(std::move(results[i])));
+    }
+  }
+  return batch_result;
+}
+
+QueryBatchResult ConnectionImpl::ExecuteBatchSequential(
+    const QueryBatch& batch, engine::Deadline deadline) {
+  QueryBatchResult batch_result;
+  bool failed = false;
+  for (const auto& [query, params] : batch.GetStatements()) {
+    if (failed) {
+      batch_result.Add(std::make_exception_ptr(BatchStatementSkipped{}));
+      continue;
+    }
+    try {
+      batch_result.Add(
+          ExecuteCommand(query, params.GetInternalData(), deadline));
+    } catch (const ServerLogicError&) {
+      batch_result.Add(std::current_exception());
+      failed = true;
+    } catch (const ServerRuntimeError&) {
+      batch_result.Add(std::current_exception());
+      failed = true;
+    }
+  }
+  return batch_result;
+}
+
+engine::Deadline ConnectionImpl::PrepareNonPipelinedCommand(
+    OptionalCommandControl statement_cmd_ctl) {
+  CheckBusy();
+  TimeoutDuration execute_timeout = !!statement_cmd_ctl
+                                        ? statement_cmd_ctl->execute
+                                        : CurrentExecuteTimeout();
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(execute_timeout);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+  CheckDeadlineReached(deadline);
+  if (IsPipelineEnabled()) {
+    // COPY and single-row mode are not allowed in pipeline mode, the mode is
+    // turned off until the command is finished
+    conn_wrapper_.DiscardInput(deadline);
+    conn_wrapper_.ExitPipelineMode();
+  }
+  return deadline;
+}
+
+void ConnectionImpl::RestorePipelineMode() noexcept {
+  if (!IsPipelineEnabled()) return;
+  try {
+    conn_wrapper_.EnterPipelineMode();
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to restore pipeline mode, "
+                             "connection is marked as broken: "
+                          << e;
+    conn_wrapper_.MarkAsBroken();
+  }
+}
+
 void ConnectionImpl::SendCommandNoPrepare(const Query& query,
                                           engine::Deadline deadline) {
   static const QueryParameters kNoParams;
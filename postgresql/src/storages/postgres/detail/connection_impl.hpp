@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -16,10 +17,14 @@
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_connection_wrapper.hpp>
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
+#include <userver/storages/postgres/detail/copy.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -80,6 +85,25 @@ class ConnectionImpl {
                           const std::string& portal_name, std::uint32_t n_rows,
                           OptionalCommandControl statement_cmd_ctl);
 
+  QueryBatchResult ExecuteBatch(const QueryBatch& batch,
+                                OptionalCommandControl statement_cmd_ctl);
+
+  void Listen(std::string_view channel, OptionalCommandControl cmd_ctl);
+  void Unlisten(std::string_view channel, OptionalCommandControl cmd_ctl);
+  Notification WaitNotify(engine::Deadline deadline);
+
+  ResultSet CopyIn(const Query& query, const CopyInSource& source,
+                   OptionalCommandControl statement_cmd_ctl);
+
+  ResultSet CopyOut(const Query& query, const CopyOutSink& sink,
+                    OptionalCommandControl statement_cmd_ctl);
+
+  void StartResultStream(const Query& query, const QueryParameters& params,
+                         OptionalCommandControl statement_cmd_ctl);
+  ResultSet FetchResultStreamRow();
+  void FinishResultStream();
+  bool IsResultStreamActive() const;
+
   void CancelAndCleanup(TimeoutDuration timeout);
   bool Cleanup(TimeoutDuration timeout);
 
@@ -95,6 +119,11 @@ class ConnectionImpl {
   void Ping();
   void MarkAsBroken();
 
+  void SetPreparedStatementsRegistry(
+      std::shared_ptr<PreparedStatementsRegistry> registry);
+  std::size_t WarmupPreparedStatements(std::size_t limit,
+                                       engine::Deadline deadline);
+
  private:
   struct PreparedStatementInfo {
     Connection::StatementId id{};
@@ -103,6 +132,16 @@ class ConnectionImpl {
     ResultSet description{nullptr};
   };
 
+  struct ResultStreamState {
+    std::string statement;
+    // Source of the result fields buffer categories, the first row is used if
+    // the statement is not prepared
+    std::optional<ResultSet> description;
+    TimeoutDuration network_timeout{};
+    SteadyClock::time_point start_time;
+    bool in_transaction{false};
+  };
+
   using PreparedStatements =
       cache::LruMap<Connection::StatementId, PreparedStatementInfo>;
 
@@ -124,6 +163,7 @@ class ConnectionImpl {
 
   void SetStatementTimeout(OptionalCommandControl cmd_ctl);
 
+  std::string MakeStatementName(Connection::StatementId id) const;
   const PreparedStatementInfo& PrepareStatement(
       const std::string& statement, const detail::QueryParameters& params,
       engine::Deadline deadline, tracing::Span& span,
@@ -147,6 +187,17 @@ class ConnectionImpl {
 
   void SendCommandNoPrepare(const Query& query, engine::Deadline deadline);
 
+  QueryBatchResult ExecuteBatchPipelined(const QueryBatch& batch,
+                                         engine::Deadline deadline);
+  QueryBatchResult ExecuteBatchSequential(const QueryBatch& batch,
+                                          engine::Deadline deadline);
+
+  engine::Deadline PrepareNonPipelinedCommand(
+      OptionalCommandControl statement_cmd_ctl);
+  void RestorePipelineMode() noexcept;
+  template <typename Func>
+  auto RunInPipelineMode(Func&& func);
+
   void SendCommandNoPrepare(const Query& query, const QueryParameters& params,
                             engine::Deadline deadline);
 
@@ -181,6 +232,9 @@ class ConnectionImpl {
   OptionalCommandControl transaction_cmd_ctl_;
   TimeoutDuration current_statement_timeout_{};
   const error_injection::Settings ei_settings_;
+  std::shared_ptr<PreparedStatementsRegistry> statements_registry_;
+  PreparedStatementsRegistry::ExecutionCounters statements_executions_;
+  std::optional<ResultStreamState> result_stream_;
 };
 
 }  // namespace storages::postgres::detail
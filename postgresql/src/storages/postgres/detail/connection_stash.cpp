@@ -0,0 +1,92 @@
+#include <storages/postgres/detail/connection_stash.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+std::size_t GetThreadIndex() noexcept {
+  static std::atomic<std::size_t> next_index{0};
+  thread_local const std::size_t index =
+      next_index.fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+
+}  // namespace
+
+bool ConnectionStash::TryPush(Connection* connection,
+                              std::size_t size_limit) noexcept {
+  UASSERT(connection);
+  auto& slots = GetThreadStash().slots;
+  const auto size = std::min(size_limit, kMaxSize);
+  for (std::size_t i = 0; i < size; ++i) {
+    Connection* expected = nullptr;
+    if (slots[i].compare_exchange_strong(expected, connection)) return true;
+  }
+  return false;
+}
+
+Connection* ConnectionStash::TryPop() noexcept {
+  auto& slots = GetThreadStash().slots;
+  // Slots are filled from the beginning, so the last occupied slot holds the
+  // most recently released connection
+  for (auto it = slots.rbegin(); it != slots.rend(); ++it) {
+    if (it->load(std::memory_order_relaxed) == nullptr) continue;
+    if (auto* connection = it->exchange(nullptr)) return connection;
+  }
+  return nullptr;
+}
+
+Connection* ConnectionStash::TrySteal() noexcept {
+  for (auto& stash : stashes_) {
+    for (auto& slot : stash.slots) {
+      if (slot.load(std::memory_order_relaxed) == nullptr) continue;
+      if (auto* connection = slot.exchange(nullptr)) return connection;
+    }
+  }
+  return nullptr;
+}
+
+std::vector<Connection*> ConnectionStash::ExtractIdle(
+    TimeoutDuration max_idle) {
+  std::vector<Connection*> result;
+  for (auto& stash : stashes_) {
+    for (auto& slot : stash.slots) {
+      auto* connection = slot.exchange(nullptr);
+      if (!connection) continue;
+      // The connection is owned by us until it is put back, so it is safe to
+      // look into it
+      Connection* expected = nullptr;
+      if (connection->GetIdleDuration() >= max_idle ||
+          !slot.compare_exchange_strong(expected, connection)) {
+        result.push_back(connection);
+      }
+    }
+  }
+  return result;
+}
+
+std::vector<Connection*> ConnectionStash::ExtractAll() {
+  std::vector<Connection*> result;
+  for (auto& stash : stashes_) {
+    for (auto& slot : stash.slots) {
+      if (auto* connection = slot.exchange(nullptr)) {
+        result.push_back(connection);
+      }
+    }
+  }
+  return result;
+}
+
+ConnectionStash::Stash& ConnectionStash::GetThreadStash() noexcept {
+  return stashes_[GetThreadIndex() % kStashesCount];
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include <userver/storages/postgres/detail/time_types.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Lock-free stashes of recently released connections, one per worker thread.
+/// A connection released by a thread is handed out first to the next task
+/// running on the same thread, so the hot connections are reused and the
+/// shared pool queue is not touched on the fast path.
+///
+/// Threads are mapped to stashes in a round-robin manner on their first use
+/// of a stash, so that threads of a task processor get different stashes.
+class ConnectionStash final {
+ public:
+  /// Maximum number of connections in a stash of a thread
+  static constexpr std::size_t kMaxSize = 4;
+
+  ConnectionStash() = default;
+  ConnectionStash(const ConnectionStash&) = delete;
+  ConnectionStash& operator=(const ConnectionStash&) = delete;
+
+  /// Puts the connection to the stash of the current thread, returns false if
+  /// the stash already has `size_limit` connections
+  bool TryPush(Connection* connection, std::size_t size_limit) noexcept;
+
+  /// Takes a connection from the stash of the current thread. Slots are
+  /// scanned from the end, so a recently pushed connection is likely to be
+  /// taken, but the order is not strictly LIFO: a push fills the first free
+  /// slot, which may precede the occupied ones after a steal.
+  Connection* TryPop() noexcept;
+
+  /// Takes a connection from the stash of any thread
+  Connection* TrySteal() noexcept;
+
+  /// Takes the connections that were not used for at least `max_idle` out of
+  /// all the stashes
+  std::vector<Connection*> ExtractIdle(TimeoutDuration max_idle);
+
+  /// Takes all the connections out of all the stashes
+  std::vector<Connection*> ExtractAll();
+
+ private:
+  static constexpr std::size_t kStashesCount = 16;
+  static constexpr std::size_t kCacheLineSize = 64;
+
+  struct alignas(kCacheLineSize) Stash final {
+    std::array<std::atomic<Connection*>, kMaxSize> slots{};
+  };
+
+  Stash& GetThreadStash() noexcept;
+
+  std::array<Stash, kStashesCount> stashes_{};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
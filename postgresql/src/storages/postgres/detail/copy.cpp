@@ -0,0 +1,55 @@
+#include <userver/storages/postgres/detail/copy.hpp>
+
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Binary format file header, see
+// https://www.postgresql.org/docs/current/sql-copy.html
+constexpr std::string_view kCopySignature{"PGCOPY\n\377\r\n\0", 11};
+
+}  // namespace
+
+void WriteCopyHeader(std::vector<char>& buffer) {
+  buffer.insert(buffer.end(), kCopySignature.begin(), kCopySignature.end());
+  // Zero flags field and zero header extension area length
+  buffer.insert(buffer.end(), 2 * sizeof(Integer), '\0');
+}
+
+void WriteCopyTrailer(std::vector<char>& buffer) {
+  // Field count of -1
+  buffer.insert(buffer.end(), sizeof(Smallint), '\xff');
+}
+
+void ReadCopyHeader(io::FieldBuffer& buffer) {
+  if (buffer.length < kCopySignature.size() ||
+      std::string_view{reinterpret_cast<const char*>(buffer.buffer),
+                       kCopySignature.size()} != kCopySignature) {
+    throw InvalidBinaryBuffer("COPY signature is missing");
+  }
+  buffer.buffer += kCopySignature.size();
+  buffer.length -= kCopySignature.size();
+
+  Integer flags{0};
+  buffer.Read(flags, io::BufferCategory::kPlainBuffer);
+  // Bit 16 is the only critical flag defined, it means OIDs are included
+  if (flags & (1 << 16)) {
+    throw InvalidBinaryBuffer("COPY with OIDs is not supported");
+  }
+  Integer extension_length{0};
+  buffer.Read(extension_length, io::BufferCategory::kPlainBuffer);
+  if (extension_length < 0 ||
+      static_cast<std::size_t>(extension_length) > buffer.length) {
+    throw InvalidBinaryBuffer("COPY header extension area is truncated");
+  }
+  buffer.buffer += extension_length;
+  buffer.length -= extension_length;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
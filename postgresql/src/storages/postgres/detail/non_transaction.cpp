@@ -14,7 +14,10 @@ NonTransaction::NonTransaction(ConnectionPtr&& conn,
 }
 
 NonTransaction::NonTransaction(NonTransaction&&) noexcept = default;
-NonTransaction::~NonTransaction() { conn_->Finish(); }
+NonTransaction::~NonTransaction() {
+  // The connection might have been handed over to a result stream
+  if (conn_) conn_->Finish();
+}
 
 NonTransaction& NonTransaction::operator=(NonTransaction&&) noexcept = default;
 
@@ -24,6 +27,11 @@ ResultSet NonTransaction::Execute(OptionalCommandControl statement_cmd_ctl,
   return DoExecute(statement, store.GetInternalData(), statement_cmd_ctl);
 }
 
+QueryBatchResult NonTransaction::Execute(OptionalCommandControl batch_cmd_ctl,
+                                         const QueryBatch& batch) {
+  return conn_->ExecuteBatch(batch, batch_cmd_ctl);
+}
+
 ResultSet NonTransaction::DoExecute(const Query& query,
                                     const detail::QueryParameters& params,
                                     OptionalCommandControl statement_cmd_ctl) {
@@ -33,6 +41,13 @@ ResultSet NonTransaction::DoExecute(const Query& query,
   return res;
 }
 
+ResultStream NonTransaction::DoStream(
+    const Query& query, const detail::QueryParameters& params,
+    OptionalCommandControl statement_cmd_ctl) && {
+  return ResultStream{std::move(conn_), query, params,
+                      std::move(statement_cmd_ctl)};
+}
+
 const UserTypes& NonTransaction::GetConnectionUserTypes() const {
   return conn_->GetUserTypes();
 }
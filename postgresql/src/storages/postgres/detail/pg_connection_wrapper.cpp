@@ -18,6 +18,7 @@ auto PQXgetResult(PGconn* conn) { return ::PQgetResult(conn); }
 
 #include <storages/postgres/detail/pg_message_severity.hpp>
 #include <storages/postgres/detail/tracing_tags.hpp>
+#include <storages/postgres/detail/wire/native_connection.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
 #include <userver/storages/postgres/io/traits.hpp>
@@ -105,15 +106,18 @@ void NoticeReceiver(void* conn_wrapper_ptr, PGresult const* pg_res) {
 
 }  // namespace
 
-PGConnectionWrapper::PGConnectionWrapper(engine::TaskProcessor& tp, uint32_t id,
-                                         SizeGuard&& size_guard)
+PGConnectionWrapper::PGConnectionWrapper(
+    engine::TaskProcessor& tp, uint32_t id, SizeGuard&& size_guard,
+    ConnectionSettings::ProtocolImplementation protocol)
     : bg_task_processor_{tp},
       log_extra_{{tracing::kDatabaseType, tracing::kDatabasePostgresType},
                  {"pg_conn_id", id}},
       size_guard_{std::move(size_guard)},
       last_use_{std::chrono::steady_clock::now()},
       is_broken_{false} {
-  // TODO add SSL initialization
+  if (protocol == ConnectionSettings::kNativeProtocol) {
+    native_ = std::make_unique<wire::NativeConnection>(*this, tp);
+  }
 }
 
 PGConnectionWrapper::~PGConnectionWrapper() { Close().Detach(); }
@@ -140,6 +144,7 @@ PGTransactionStatusType PGConnectionWrapper::GetTransactionStatus() const {
 }
 
 ConnectionState PGConnectionWrapper::GetConnectionState() const {
+  if (native_) return native_->GetConnectionState();
   if (!conn_) {
     return ConnectionState::kOffline;
   }
@@ -160,17 +165,21 @@ ConnectionState PGConnectionWrapper::GetConnectionState() const {
 }
 
 int PGConnectionWrapper::GetServerVersion() const {
+  if (native_) return native_->GetServerVersion();
   return PQserverVersion(conn_);
 }
 
 std::string_view PGConnectionWrapper::GetParameterStatus(
     const char* name) const {
+  if (native_) return native_->GetParameterStatus(name);
   const char* value = PQparameterStatus(conn_, name);
   if (!value) return {};
   return value;
 }
 
 engine::Task PGConnectionWrapper::Close() {
+  if (native_) return native_->Close(std::move(size_guard_), is_broken_);
+
   engine::io::Socket tmp_sock = std::exchange(socket_, {});
   PGconn* tmp_conn = std::exchange(conn_, nullptr);
 
@@ -220,6 +229,7 @@ void PGConnectionWrapper::CloseWithError(ExceptionType&& ex) {
 }
 
 engine::Task PGConnectionWrapper::Cancel() {
+  if (native_) return native_->Cancel();
   if (!conn_) {
     // NOLINTNEXTLINE(cppcoreguidelines-slicing)
     return engine::AsyncNoSpan(bg_task_processor_, [] {});
@@ -247,6 +257,12 @@ void PGConnectionWrapper::AsyncConnect(const Dsn& dsn, Deadline deadline,
   log_extra_.Extend(tracing::kPeerAddress,
                     std::move(options.host) + ':' + options.port);
 
+  if (native_) {
+    native_->Connect(dsn, deadline, scope);
+    PGCW_LOG_DEBUG() << "Connected to " << DsnCutPassword(dsn);
+    return;
+  }
+
   scope.Reset(scopes::kLibpqConnect);
   StartAsyncConnect(dsn);
   scope.Reset(scopes::kLibpqWaitConnectFinish);
@@ -364,6 +380,7 @@ void PGConnectionWrapper::WaitConnectionFinish(Deadline deadline,
 
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 void PGConnectionWrapper::EnterPipelineMode() {
+  if (native_) return native_->EnterPipelineMode();
 #if LIBPQ_HAS_PIPELINING
   if (!PQenterPipelineMode(conn_)) {
     PGCW_LOG_LIMITED_ERROR()
@@ -375,7 +392,20 @@ void PGConnectionWrapper::EnterPipelineMode() {
 #endif
 }
 
+void PGConnectionWrapper::ExitPipelineMode() {
+  if (native_) return native_->ExitPipelineMode();
+#if LIBPQ_HAS_PIPELINING
+  if (!PQexitPipelineMode(conn_)) {
+    PGCW_LOG_LIMITED_ERROR() << "libpq failed to exit pipeline connection mode";
+    throw ConnectionError{"Failed to exit pipeline connection mode"};
+  }
+#else
+  UINVARIANT(false, "Pipeline mode is not supported");
+#endif
+}
+
 bool PGConnectionWrapper::IsSyncingPipeline() const {
+  if (native_) return native_->IsSyncingPipeline();
   return is_syncing_pipeline_;
 }
 
@@ -426,6 +456,7 @@ void PGConnectionWrapper::Flush(Deadline deadline) {
 }
 
 bool PGConnectionWrapper::TryConsumeInput(Deadline deadline) {
+  if (native_) return native_->TryConsumeInput(deadline);
   while (PQXisBusy(conn_)) {
     if (!WaitSocketReadable(deadline)) {
       return false;
@@ -437,6 +468,7 @@ bool PGConnectionWrapper::TryConsumeInput(Deadline deadline) {
 }
 
 void PGConnectionWrapper::ConsumeInput(Deadline deadline) {
+  if (native_) return native_->ConsumeInput(deadline);
   if (!TryConsumeInput(deadline)) {
     if (engine::current_task::ShouldCancel()) {
       throw ConnectionInterrupted("Task cancelled while consuming input");
@@ -449,6 +481,7 @@ void PGConnectionWrapper::ConsumeInput(Deadline deadline) {
 
 ResultSet PGConnectionWrapper::WaitResult(Deadline deadline,
                                           tracing::ScopeTime& scope) {
+  if (native_) return native_->WaitResult(deadline, scope);
   scope.Reset(scopes::kLibpqWaitResult);
   Flush(deadline);
   auto handle = MakeResultHandle(nullptr);
@@ -481,7 +514,223 @@ ResultSet PGConnectionWrapper::WaitResult(Deadline deadline,
   return MakeResult(std::move(handle));
 }
 
+void PGConnectionWrapper::SetSingleRowMode() {
+  if (native_) return native_->SetSingleRowMode();
+  if (!PQsetSingleRowMode(conn_)) {
+    PGCW_LOG_LIMITED_ERROR() << "Failed to switch to single-row mode";
+    throw CommandError{"Failed to switch to single-row mode"};
+  }
+}
+
+ResultSet PGConnectionWrapper::WaitSingleRowResult(Deadline deadline) {
+  if (native_) return native_->WaitSingleRowResult(deadline);
+  Flush(deadline);
+  ConsumeInput(deadline);
+  auto handle = MakeResultHandle(PQXgetResult(conn_));
+  if (PQresultStatus(handle.get()) == PGRES_SINGLE_TUPLE) {
+    // MakeResult rejects single-row results of queries not in single-row mode
+    return ResultSet{
+        std::make_shared<detail::ResultWrapper>(std::move(handle))};
+  }
+  // This is the final result of the query, consume the rest of the results
+  // to return the connection to the idle state
+  ConsumeInput(deadline);
+  while (auto pg_res = PQXgetResult(conn_)) {
+    MakeResultHandle(pg_res);
+    ConsumeInput(deadline);
+  }
+  return MakeResult(std::move(handle));
+}
+
+std::vector<std::variant<ResultSet, std::exception_ptr>>
+PGConnectionWrapper::WaitPipelineResults(std::size_t count, Deadline deadline,
+                                         tracing::ScopeTime& scope) {
+  if (native_) return native_->WaitPipelineResults(count, deadline, scope);
+#if LIBPQ_HAS_PIPELINING
+  UASSERT(PQpipelineStatus(conn_) != PQ_PIPELINE_OFF);
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  // In pipeline mode results of each query are followed by a null result, the
+  // pipeline ends with a PIPELINE_SYNC result
+  std::vector<ResultHandle> handles;
+  auto handle = MakeResultHandle(nullptr);
+  while (is_syncing_pipeline_) {
+    ConsumeInput(deadline);
+    auto* pg_res = PQXgetResult(conn_);
+    if (!pg_res) {
+      if (!handle) {
+        CloseWithError(
+            ConnectionError{"Unexpected end of results in a pipeline"});
+      }
+      handles.push_back(std::move(handle));
+      handle = MakeResultHandle(nullptr);
+      continue;
+    }
+    auto next_handle = MakeResultHandle(pg_res);
+    if (PQresultStatus(next_handle.get()) == PGRES_PIPELINE_SYNC) {
+      is_syncing_pipeline_ = false;
+      break;
+    }
+    if (handle) {
+      PGCW_LOG_LIMITED_INFO()
+          << "Query returned several result sets, a result set is discarded";
+    }
+    handle = std::move(next_handle);
+  }
+  if (handles.size() < count) {
+    CloseWithError(ConnectionError{"Missing results of pipelined queries"});
+  }
+
+  const auto first = handles.size() - count;
+  for (std::size_t i = 0; i < first; ++i) {
+    // Queries sent before the batch, e.g. BEGIN, report their errors as usual
+    if (PQresultStatus(handles[i].get()) != PGRES_PIPELINE_ABORTED) {
+      MakeResult(std::move(handles[i]));
+    }
+  }
+  std::vector<std::variant<ResultSet, std::exception_ptr>> results;
+  results.reserve(count);
+  for (std::size_t i = first; i < handles.size(); ++i) {
+    if (PQresultStatus(handles[i].get()) == PGRES_PIPELINE_ABORTED) {
+      results.emplace_back(std::make_exception_ptr(BatchStatementSkipped{}));
+      continue;
+    }
+    try {
+      results.emplace_back(MakeResult(std::move(handles[i])));
+    } catch (const ServerLogicError&) {
+      results.emplace_back(std::current_exception());
+    } catch (const ServerRuntimeError&) {
+      results.emplace_back(std::current_exception());
+    }
+  }
+  return results;
+#else
+  UINVARIANT(false, "Pipeline mode is not supported");
+  return {};
+#endif
+}
+
+void PGConnectionWrapper::WaitCopyStart(Deadline deadline,
+                                        tracing::ScopeTime& scope) {
+  if (native_) return native_->WaitCopyStart(deadline, scope);
+  scope.Reset(scopes::kLibpqWaitCopyStart);
+  Flush(deadline);
+  ConsumeInput(deadline);
+  auto handle = MakeResultHandle(PQXgetResult(conn_));
+  const auto status = PQresultStatus(handle.get());
+  if (status == PGRES_COPY_IN || status == PGRES_COPY_OUT) return;
+
+  if (status != PGRES_COPY_BOTH) {
+    // The command failed, consume the rest of the results to return the
+    // connection to the idle state before reporting the error
+    ConsumeInput(deadline);
+    while (auto pg_res = PQXgetResult(conn_)) {
+      MakeResultHandle(pg_res);
+      ConsumeInput(deadline);
+    }
+  }
+  MakeResult(std::move(handle));
+  PGCW_LOG_LIMITED_ERROR() << "COPY command did not start copying";
+  CloseWithError(LogicError{"COPY command did not start copying"});
+}
+
+void PGConnectionWrapper::PutCopyData(const std::vector<char>& data,
+                                      Deadline deadline) {
+  if (native_) return native_->PutCopyData(data, deadline);
+  int put_res = 0;
+  while (!(put_res = PQputCopyData(conn_, data.data(), data.size()))) {
+    // libpq send buffer is full, wait until it's flushed
+    Flush(deadline);
+  }
+  CheckError<CommandError>("PQputCopyData", put_res > 0);
+  // Flush every chunk so that the send buffer does not grow beyond a chunk
+  Flush(deadline);
+  UpdateLastUse();
+}
+
+void PGConnectionWrapper::PutCopyEnd(const char* error, Deadline deadline) {
+  if (native_) return native_->PutCopyEnd(error, deadline);
+  int put_res = 0;
+  while (!(put_res = PQputCopyEnd(conn_, error))) {
+    Flush(deadline);
+  }
+  CheckError<CommandError>("PQputCopyEnd", put_res > 0);
+  Flush(deadline);
+  UpdateLastUse();
+}
+
+std::string_view PGConnectionWrapper::GetCopyData(Deadline deadline) {
+  if (native_) return native_->GetCopyData(deadline);
+  copy_data_.reset();
+  while (true) {
+    char* data = nullptr;
+    const int size = PQgetCopyData(conn_, &data, /* async */ 1);
+    if (size > 0) {
+      copy_data_.reset(data);
+      UpdateLastUse();
+      return {data, static_cast<std::size_t>(size)};
+    }
+    if (size == -1) return {};
+    if (size == -2) {
+      throw CommandError(PQerrorMessage(conn_));
+    }
+    if (!WaitSocketReadable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted("Task cancelled while receiving copy data");
+      }
+      PGCW_LOG_LIMITED_WARNING()
+          << "Timeout while receiving copy data from PostgreSQL connection "
+             "socket";
+      throw ConnectionTimeoutError("Timed out while receiving copy data");
+    }
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+  }
+}
+
+Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
+  if (native_) return native_->WaitNotify(deadline);
+  while (true) {
+    if (auto* notify = PQnotifies(conn_)) {
+      Notification notification{notify->relname, std::nullopt};
+      if (notify->extra && *notify->extra) {
+        notification.payload.emplace(notify->extra);
+      }
+      PQfreemem(notify);
+      UpdateLastUse();
+      return notification;
+    }
+    if (!WaitSocketReadable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted(
+            "Task cancelled while waiting for a notification");
+      }
+      throw ConnectionTimeoutError("Timed out while waiting for a notification");
+    }
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+  }
+}
+
+void PGConnectionWrapper::DiscardNotifies() {
+  if (native_) return native_->DiscardNotifies();
+  while (auto* notify = PQnotifies(conn_)) {
+    PQfreemem(notify);
+  }
+}
+
+std::string PGConnectionWrapper::EscapeIdentifier(std::string_view identifier) {
+  if (native_) return native_->EscapeIdentifier(identifier);
+  auto* escaped =
+      PQescapeIdentifier(conn_, identifier.data(), identifier.size());
+  if (!escaped) {
+    throw CommandError(PQerrorMessage(conn_));
+  }
+  std::string result{escaped};
+  PQfreemem(escaped);
+  return result;
+}
+
 void PGConnectionWrapper::DiscardInput(Deadline deadline) {
+  if (native_) return native_->DiscardInput(deadline);
   Flush(deadline);
   auto handle = MakeResultHandle(nullptr);
   ConsumeInput(deadline);
@@ -508,8 +757,22 @@ ResultSet PGConnectionWrapper::MakeResult(ResultHandle&& handle) {
     LOG_DEBUG() << "Empty result";
     return ResultSet{nullptr};
   }
+  return CheckResult(
+      std::make_shared<detail::ResultWrapper>(std::move(handle)));
+}
 
-  auto wrapper = std::make_shared<detail::ResultWrapper>(std::move(handle));
+ResultSet PGConnectionWrapper::MakeResult(
+    std::unique_ptr<wire::NativeResult>&& result) {
+  if (!result) {
+    LOG_DEBUG() << "Empty result";
+    return ResultSet{nullptr};
+  }
+  return CheckResult(
+      std::make_shared<detail::ResultWrapper>(std::move(result)));
+}
+
+ResultSet PGConnectionWrapper::CheckResult(
+    std::shared_ptr<ResultWrapper> wrapper) {
   auto status = wrapper->GetStatus();
   switch (status) {
     case PGRES_EMPTY_QUERY:
@@ -529,9 +792,11 @@ ResultSet PGConnectionWrapper::MakeResult(ResultHandle&& handle) {
     case PGRES_COPY_OUT:
     case PGRES_COPY_BOTH:
       PGCW_LOG_LIMITED_ERROR()
-          << "PostgreSQL COPY command invoked which is not implemented"
+          << "PostgreSQL COPY command invoked outside of "
+             "Transaction::CopyIn/CopyOut which is not supported"
           << logging::LogExtra::Stacktrace();
-      CloseWithError(NotImplemented{"Copy is not implemented"});
+      CloseWithError(NotImplemented{
+          "Copy is supported only via Transaction::CopyIn/CopyOut"});
     case PGRES_BAD_RESPONSE:
       CloseWithError(ConnectionError{"Failed to parse server response"});
     case PGRES_NONFATAL_ERROR: {
@@ -594,6 +859,7 @@ ResultSet PGConnectionWrapper::MakeResult(ResultHandle&& handle) {
 
 void PGConnectionWrapper::SendQuery(const std::string& statement,
                                     tracing::ScopeTime& scope) {
+  if (native_) return native_->SendQuery(statement, nullptr, scope);
   scope.Reset(scopes::kLibpqSendQueryParams);
   CheckError<CommandError>(
       "PQsendQueryParams `" + statement + "`",
@@ -609,6 +875,7 @@ void PGConnectionWrapper::SendQuery(const std::string& statement,
     SendQuery(statement, scope);
     return;
   }
+  if (native_) return native_->SendQuery(statement, &params, scope);
   scope.Reset(scopes::kLibpqSendQueryParams);
   CheckError<CommandError>(
       "PQsendQueryParams",
@@ -623,6 +890,11 @@ void PGConnectionWrapper::SendPrepare(const std::string& name,
                                       const std::string& statement,
                                       const QueryParameters& params,
                                       tracing::ScopeTime& scope) {
+  if (native_) {
+    return native_->SendPrepare(
+        name, statement, params.Empty() ? nullptr : params.ParamTypesBuffer(),
+        params.Size(), scope);
+  }
   scope.Reset(scopes::kLibpqSendPrepare);
   if (params.Empty()) {
     CheckError<CommandError>(
@@ -637,8 +909,25 @@ void PGConnectionWrapper::SendPrepare(const std::string& name,
   UpdateLastUse();
 }
 
+void PGConnectionWrapper::SendPrepare(const std::string& name,
+                                      const std::string& statement,
+                                      const std::vector<Oid>& param_types,
+                                      tracing::ScopeTime& scope) {
+  if (native_) {
+    return native_->SendPrepare(name, statement, param_types.data(),
+                                param_types.size(), scope);
+  }
+  scope.Reset(scopes::kLibpqSendPrepare);
+  CheckError<CommandError>(
+      "PQsendPrepare",
+      PQsendPrepare(conn_, name.c_str(), statement.c_str(), param_types.size(),
+                    param_types.empty() ? nullptr : param_types.data()));
+  UpdateLastUse();
+}
+
 void PGConnectionWrapper::SendDescribePrepared(const std::string& name,
                                                tracing::ScopeTime& scope) {
+  if (native_) return native_->SendDescribePrepared(name, scope);
   scope.Reset(scopes::kLibpqSendDescribePrepared);
   CheckError<CommandError>("PQsendDescribePrepared",
                            PQsendDescribePrepared(conn_, name.c_str()));
@@ -648,6 +937,7 @@ void PGConnectionWrapper::SendDescribePrepared(const std::string& name,
 void PGConnectionWrapper::SendPreparedQuery(const std::string& name,
                                             const QueryParameters& params,
                                             tracing::ScopeTime& scope) {
+  if (native_) return native_->SendPreparedQuery(name, params, scope);
   scope.Reset(scopes::kLibpqSendQueryPrepared);
   if (params.Empty()) {
     CheckError<CommandError>(
@@ -670,6 +960,9 @@ void PGConnectionWrapper::SendPortalBind(const std::string& statement_name,
                                          const std::string& portal_name,
                                          const QueryParameters& params,
                                          tracing::ScopeTime& scope) {
+  if (native_) {
+    return native_->SendPortalBind(statement_name, portal_name, params, scope);
+  }
   scope.Reset(scopes::kPqSendPortalBind);
   if (params.Empty()) {
     CheckError<CommandError>(
@@ -690,6 +983,7 @@ void PGConnectionWrapper::SendPortalBind(const std::string& statement_name,
 void PGConnectionWrapper::SendPortalExecute(const std::string& portal_name,
                                             std::uint32_t n_rows,
                                             tracing::ScopeTime& scope) {
+  if (native_) return native_->SendPortalExecute(portal_name, n_rows, scope);
   scope.Reset(scopes::kPqSendPortalExecute);
   CheckError<CommandError>(
       "PQXSendPortalExecute",
@@ -697,15 +991,21 @@ void PGConnectionWrapper::SendPortalExecute(const std::string& portal_name,
   UpdateLastUse();
 }
 #else
-void PGConnectionWrapper::SendPortalBind(const std::string&, const std::string&,
-                                         const QueryParameters&,
-                                         tracing::ScopeTime&) {
+void PGConnectionWrapper::SendPortalBind(const std::string& statement_name,
+                                         const std::string& portal_name,
+                                         const QueryParameters& params,
+                                         tracing::ScopeTime& scope) {
+  if (native_) {
+    return native_->SendPortalBind(statement_name, portal_name, params, scope);
+  }
   UINVARIANT(false,
              "Portals are disabled by CMake option USERVER_FEATURE_PATCH_PSQL");
 }
 
-void PGConnectionWrapper::SendPortalExecute(const std::string&, std::uint32_t,
-                                            tracing::ScopeTime&) {
+void PGConnectionWrapper::SendPortalExecute(const std::string& portal_name,
+                                            std::uint32_t n_rows,
+                                            tracing::ScopeTime& scope) {
+  if (native_) return native_->SendPortalExecute(portal_name, n_rows, scope);
   UINVARIANT(false,
              "Portals are disabled by CMake option USERVER_FEATURE_PATCH_PSQL");
 }
@@ -1,7 +1,11 @@
 #pragma once
 
 #include <chrono>
+#include <exception>
+#include <memory>
 #include <string_view>
+#include <variant>
+#include <vector>
 
 #include <libpq-fe.h>
 
@@ -15,11 +19,17 @@
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/result_wrapper.hpp>
 #include <userver/storages/postgres/dsn.hpp>
+#include <userver/storages/postgres/notify.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres::detail {
 
+namespace wire {
+class NativeConnection;
+class NativeResult;
+}  // namespace wire
+
 class PGConnectionWrapper {
  public:
   using Deadline = engine::Deadline;
@@ -30,7 +40,9 @@ class PGConnectionWrapper {
 
  public:
   PGConnectionWrapper(engine::TaskProcessor& tp, uint32_t id,
-                      SizeGuard&& size_guard);
+                      SizeGuard&& size_guard,
+                      ConnectionSettings::ProtocolImplementation protocol =
+                          ConnectionSettings::kLibpq);
   ~PGConnectionWrapper();
 
   PGConnectionWrapper(const PGConnectionWrapper&) = delete;
@@ -58,6 +70,11 @@ class PGConnectionWrapper {
   /// Requires libpq >= 14.
   void EnterPipelineMode();
 
+  /// @brief Causes a connection to exit pipeline mode.
+  ///
+  /// All the results of the sent queries must be consumed beforehand.
+  void ExitPipelineMode();
+
   /// @brief Returns true if command send queue is empty.
   ///
   /// Normally command queue is flushed after any Send* call, but in pipeline
@@ -81,6 +98,11 @@ class PGConnectionWrapper {
   void SendPrepare(const std::string& name, const std::string& statement,
                    const QueryParameters& params, tracing::ScopeTime&);
 
+  /// @brief Wrapper for PQsendPrepare with explicitly specified parameter
+  /// types
+  void SendPrepare(const std::string& name, const std::string& statement,
+                   const std::vector<Oid>& param_types, tracing::ScopeTime&);
+
   /// @brief Wrapper for PQsendDescribePrepared
   void SendDescribePrepared(const std::string& name, tracing::ScopeTime&);
 
@@ -101,6 +123,51 @@ class PGConnectionWrapper {
   /// Will return result or throw an exception
   ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&);
 
+  /// @brief Wait for the results of the last `count` queries sent in pipeline
+  /// mode, a result set or an exception for each of them.
+  /// Results of the queries sent before them are checked and discarded, server
+  /// errors of the `count` queries are returned instead of being thrown.
+  std::vector<std::variant<ResultSet, std::exception_ptr>> WaitPipelineResults(
+      std::size_t count, Deadline deadline, tracing::ScopeTime&);
+
+  /// @brief Wrapper for PQsetSingleRowMode, must be called right after the
+  /// query is sent
+  void SetSingleRowMode();
+
+  /// @brief Wait for the next row of a query result in single-row mode.
+  /// Returns a result set with a single row or, when the rows are exhausted,
+  /// the final result set without rows.
+  /// Will throw an exception if the query fails
+  ResultSet WaitSingleRowResult(Deadline deadline);
+
+  /// @brief Wait for the server to enter COPY IN or COPY OUT state after a COPY
+  /// command was sent.
+  /// Will throw an exception if the command fails
+  void WaitCopyStart(Deadline deadline, tracing::ScopeTime&);
+
+  /// @brief Wrapper for PQputCopyData, sends the data to the server in COPY IN
+  /// state, waits for the socket to become writeable if needed
+  void PutCopyData(const std::vector<char>& data, Deadline deadline);
+
+  /// @brief Wrapper for PQputCopyEnd, `error` is sent to the server to abort
+  /// the COPY if not null
+  void PutCopyEnd(const char* error, Deadline deadline);
+
+  /// @brief Wrapper for PQgetCopyData, returns the data of the next CopyData
+  /// message in COPY OUT state or an empty view if the COPY is finished.
+  /// The data is valid until the next call.
+  std::string_view GetCopyData(Deadline deadline);
+
+  /// @brief Wrapper for PQnotifies, waits for the socket to become readable
+  /// and consumes input until a notification arrives
+  Notification WaitNotify(Deadline deadline);
+
+  /// @brief Discard all the notifications received so far
+  void DiscardNotifies();
+
+  /// @brief Wrapper for PQescapeIdentifier
+  std::string EscapeIdentifier(std::string_view identifier);
+
   /// Consume input from connection
   void ConsumeInput(Deadline deadline);
   /// Consume all input discarding all result sets
@@ -140,6 +207,8 @@ class PGConnectionWrapper {
   void Flush(Deadline deadline);
 
   ResultSet MakeResult(ResultHandle&& handle);
+  ResultSet MakeResult(std::unique_ptr<wire::NativeResult>&& result);
+  ResultSet CheckResult(std::shared_ptr<ResultWrapper> wrapper);
 
   template <typename ExceptionType>
   void CheckError(const std::string& cmd, int pg_dispatch_result);
@@ -150,6 +219,8 @@ class PGConnectionWrapper {
   void UpdateLastUse();
 
  private:
+  friend class wire::NativeConnection;
+
   engine::TaskProcessor& bg_task_processor_;
 
   PGconn* conn_ = nullptr;
@@ -159,6 +230,8 @@ class PGConnectionWrapper {
   std::chrono::steady_clock::time_point last_use_;
   bool is_broken_;
   bool is_syncing_pipeline_{false};
+  std::unique_ptr<char, void (*)(void*)> copy_data_{nullptr, &PQfreemem};
+  std::unique_ptr<wire::NativeConnection> native_;
 };
 
 }  // namespace storages::postgres::detail
@@ -26,11 +26,16 @@ constexpr std::chrono::seconds kCleanupTimeout{1};
 
 constexpr std::chrono::seconds kMaintainInterval{30};
 constexpr std::chrono::seconds kMaxIdleDuration{15};
+// Stashed connections that were not reused by their thread for this long are
+// returned to the shared queue
+constexpr std::chrono::seconds kMaxStashIdleDuration{1};
 constexpr const char* kMaintainTaskName = "pg_maintain";
+constexpr const char* kStashSweepTaskName = "pg_stash_sweep";
 
 // Max idle connections that can be dropped in one run of maintenance task
 constexpr auto kIdleDropLimit = 1;
 
+template <typename Duration = std::chrono::milliseconds>
 class Stopwatch {
  public:
   using Accumulator =
@@ -40,8 +45,7 @@ class Stopwatch {
       : accum_{acc}, start_{SteadyClock::now()} {}
   ~Stopwatch() {
     accum_.GetCurrentCounter().Account(
-        std::chrono::duration_cast<std::chrono::milliseconds>(
-            SteadyClock::now() - start_)
+        std::chrono::duration_cast<Duration>(SteadyClock::now() - start_)
             .count());
   }
 
@@ -69,6 +73,7 @@ ConnectionPool::ConnectionPool(
       conn_settings_{conn_settings},
       bg_task_processor_{bg_task_processor},
       queue_{settings.max_size},
+      thread_stash_size_{settings.thread_stash_size},
       size_{std::make_shared<std::atomic<size_t>>(0)},
       wait_count_{0},
       default_cmd_ctls_(default_cmd_ctls),
@@ -76,7 +81,12 @@ ConnectionPool::ConnectionPool(
       ei_settings_(std::move(ei_settings)),
       cancel_limit_{std::max(std::size_t{1}, settings.max_size / kCancelRatio),
                     {1, kCancelPeriod}},
-      sts_{statement_metrics_settings} {}
+      sts_{statement_metrics_settings} {
+  if (conn_settings_.prepared_warmup_size > 0) {
+    statements_registry_ = std::make_shared<PreparedStatementsRegistry>(
+        conn_settings_.max_prepared_cache_size);
+  }
+}
 
 ConnectionPool::~ConnectionPool() {
   StopMaintainTask();
@@ -166,6 +176,8 @@ void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
   stats_.transaction.execute_timeout += conn_stats.execute_timeout;
   stats_.transaction.duplicate_prepared_statements +=
       conn_stats.duplicate_prepared_statements;
+  stats_.transaction.cold_execute_total += conn_stats.cold_execute_total;
+  stats_.transaction.warm_execute_total += conn_stats.warm_execute_total;
 
   stats_.transaction.total_percentile.GetCurrentCounter().Account(
       std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -272,6 +284,16 @@ const InstanceStatistics& ConnectionPool::GetStatistics() const {
   return stats_;
 }
 
+size_t ConnectionPool::GetUsedCount() const {
+  return stats_.connection.used.Load();
+}
+
+bool ConnectionPool::IsSaturated() const {
+  if (wait_count_.load(std::memory_order_relaxed) > 0) return true;
+  const auto settings = settings_.Read();
+  return GetUsedCount() >= settings->max_size;
+}
+
 Transaction ConnectionPool::Begin(const TransactionOptions& options,
                                   OptionalCommandControl trx_cmd_ctl) {
   const auto trx_start_time = detail::SteadyClock::now();
@@ -291,6 +313,15 @@ NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
   return NonTransaction{std::move(conn), start_time};
 }
 
+NotifyScope ConnectionPool::Listen(std::string_view channel,
+                                   OptionalCommandControl cmd_ctl) {
+  const auto deadline =
+      testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
+  auto conn = Acquire(deadline);
+  UASSERT(conn);
+  return NotifyScope{std::move(conn), channel, cmd_ctl};
+}
+
 TimeoutDuration ConnectionPool::GetExecuteTimeout(
     OptionalCommandControl cmd_ctl) {
   if (cmd_ctl) return cmd_ctl->execute;
@@ -306,6 +337,7 @@ void ConnectionPool::SetSettings(const PoolSettings& settings) {
   auto reader = settings_.Read();
   if (*reader == settings) return;
   settings_.Assign(settings);
+  thread_stash_size_ = settings.thread_stash_size;
 }
 
 void ConnectionPool::SetStatementMetricsSettings(
@@ -349,6 +381,15 @@ engine::TaskWithResult<bool> ConnectionPool::Connect(
     }
     LOG_TRACE() << "PostgreSQL connection created";
 
+    if (shared_this->statements_registry_) {
+      connection->SetPreparedStatementsRegistry(
+          shared_this->statements_registry_);
+      if (!shared_this->WarmupPreparedStatements(*connection)) {
+        shared_this->DeleteBrokenConnection(connection.release());
+        return false;
+      }
+    }
+
     // Clean up the statistics and not account it
     [[maybe_unused]] const auto& stats = connection->GetStatsAndReset();
 
@@ -357,6 +398,22 @@ engine::TaskWithResult<bool> ConnectionPool::Connect(
   });
 }
 
+bool ConnectionPool::WarmupPreparedStatements(Connection& connection) {
+  const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(
+      GetDefaultCommandControl().execute);
+  try {
+    stats_.connection.prepared_warmup_total +=
+        connection.WarmupPreparedStatements(conn_settings_.prepared_warmup_size,
+                                            deadline);
+  } catch (const Error& e) {
+    LOG_LIMITED_WARNING()
+        << "Failed to prepare statements on a new connection: " << e;
+  }
+  // Statement errors are not fatal, the statements will be prepared on the
+  // first use
+  return connection.IsConnected();
+}
+
 void ConnectionPool::TryCreateConnectionAsync() {
   SharedSizeGuard sg(size_);
   auto settings = settings_.Read();
@@ -384,6 +441,19 @@ void ConnectionPool::CheckMinPoolSizeUnderflow() {
 }
 
 void ConnectionPool::Push(Connection* connection) {
+  const auto stash_size = thread_stash_size_.load(std::memory_order_relaxed);
+  if (stash_size > 0 && stash_.TryPush(connection, stash_size)) {
+    // A task that started waiting for a connection before the connection was
+    // stashed might have missed it, hand a connection over to the waiters
+    if (wait_count_ > 0) {
+      if (auto* stashed = stash_.TryPop()) PushToQueue(stashed);
+    }
+    return;
+  }
+  PushToQueue(connection);
+}
+
+void ConnectionPool::PushToQueue(Connection* connection) {
   if (queue_.push(connection)) {
     conn_available_.NotifyOne();
     return;
@@ -405,8 +475,15 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
     throw PoolError("Deadline reached before trying to get a connection");
   }
   Stopwatch st{stats_.acquire_percentile};
-  Connection* connection = nullptr;
-  if (queue_.pop(connection)) {
+  Stopwatch<std::chrono::microseconds> st_us{stats_.acquire_us_percentile};
+  // The most recently used connection of the thread goes first
+  Connection* connection = stash_.TryPop();
+  if (connection) {
+    ++stats_.connection.stash_hits;
+    return connection;
+  }
+  connection = PopFromQueue();
+  if (connection) {
     return connection;
   }
 
@@ -427,9 +504,8 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
     std::unique_lock<engine::Mutex> lock{wait_mutex_};
     // Wait for a connection
     if (conn_available_.WaitUntil(lock, deadline, [&] {
-          // boost.lockfree pointer magic (FP?)
-          // NOLINTNEXTLINE(clang-analyzer-core.UndefinedBinaryOperatorResult)
-          return queue_.pop(connection);
+          connection = PopFromQueue();
+          return connection != nullptr;
         })) {
       return connection;
     }
@@ -443,7 +519,19 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
   throw PoolError("No available connections found", db_name_);
 }
 
+Connection* ConnectionPool::PopFromQueue() {
+  Connection* connection = nullptr;
+  // boost.lockfree pointer magic (FP?)
+  // NOLINTNEXTLINE(clang-analyzer-core.UndefinedBinaryOperatorResult)
+  if (queue_.pop(connection)) return connection;
+  // Connections stashed by other threads are better than waiting
+  return stash_.TrySteal();
+}
+
 void ConnectionPool::Clear() {
+  for (auto* connection : stash_.ExtractAll()) {
+    delete connection;
+  }
   Connection* connection = nullptr;
   while (queue_.pop(connection)) {
     delete connection;
@@ -462,8 +550,9 @@ void ConnectionPool::DeleteBrokenConnection(Connection* connection) {
 }
 
 Connection* ConnectionPool::AcquireImmediate() {
-  Connection* conn = nullptr;
-  if (queue_.pop(conn)) {
+  Connection* conn = stash_.TryPop();
+  if (!conn) conn = PopFromQueue();
+  if (conn) {
     ++stats_.connection.used;
     return conn;
   }
@@ -471,7 +560,20 @@ Connection* ConnectionPool::AcquireImmediate() {
   return nullptr;
 }
 
+void ConnectionPool::SweepStash() {
+  // Connections that are not reused by their threads are handed over to the
+  // other tasks and pinged and dropped when idle as the other ones
+  const auto max_stash_idle =
+      thread_stash_size_ > 0 ? TimeoutDuration{kMaxStashIdleDuration}
+                             : TimeoutDuration{0};
+  for (auto* connection : stash_.ExtractIdle(max_stash_idle)) {
+    PushToQueue(connection);
+  }
+}
+
 void ConnectionPool::MaintainConnections() {
+  if (statements_registry_) statements_registry_->Decay();
+
   // No point in doing database roundtrips if there are queries waiting for
   // connections
   if (wait_count_ > 0) {
@@ -528,9 +630,15 @@ void ConnectionPool::StartMaintainTask() {
 
   ping_task_.Start(kMaintainTaskName, {kMaintainInterval, Flags::kStrong},
                    [this] { MaintainConnections(); });
+  stash_sweep_task_.Start(kStashSweepTaskName,
+                          {kMaxStashIdleDuration, Flags::kStrong},
+                          [this] { SweepStash(); });
 }
 
-void ConnectionPool::StopMaintainTask() { ping_task_.Stop(); }
+void ConnectionPool::StopMaintainTask() {
+  stash_sweep_task_.Stop();
+  ping_task_.Stop();
+}
 
 }  // namespace storages::postgres::detail
 
@@ -20,12 +20,15 @@
 #include <storages/postgres/default_command_controls.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/connection_stash.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
 #include <storages/postgres/detail/statement_timings_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -61,11 +64,21 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   void Release(Connection* connection);
 
   const InstanceStatistics& GetStatistics() const;
+
+  /// Number of connections acquired by the clients
+  size_t GetUsedCount() const;
+  /// Checks if there are clients waiting for a connection or all the allowed
+  /// connections are in use
+  bool IsSaturated() const;
+
   [[nodiscard]] Transaction Begin(const TransactionOptions& options,
                                   OptionalCommandControl trx_cmd_ctl = {});
 
   [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {});
 
+  [[nodiscard]] NotifyScope Listen(std::string_view channel,
+                                   OptionalCommandControl cmd_ctl = {});
+
   CommandControl GetDefaultCommandControl() const;
 
   void SetSettings(const PoolSettings& settings);
@@ -87,11 +100,15 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 
   [[nodiscard]] engine::TaskWithResult<bool> Connect(SharedSizeGuard&&);
 
+  bool WarmupPreparedStatements(Connection& connection);
+
   void TryCreateConnectionAsync();
   void CheckMinPoolSizeUnderflow();
 
   void Push(Connection* connection);
+  void PushToQueue(Connection* connection);
   Connection* Pop(engine::Deadline);
+  Connection* PopFromQueue();
 
   void Clear();
 
@@ -102,6 +119,7 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 
   Connection* AcquireImmediate();
   void MaintainConnections();
+  void SweepStash();
   void StartMaintainTask();
   void StopMaintainTask();
 
@@ -117,9 +135,12 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   ConnectionSettings conn_settings_;
   engine::TaskProcessor& bg_task_processor_;
   USERVER_NAMESPACE::utils::PeriodicTask ping_task_;
+  USERVER_NAMESPACE::utils::PeriodicTask stash_sweep_task_;
   engine::Mutex wait_mutex_;
   engine::ConditionVariable conn_available_;
   boost::lockfree::queue<Connection*> queue_;
+  ConnectionStash stash_;
+  std::atomic<size_t> thread_stash_size_;
   SharedCounter size_;
   std::atomic<size_t> wait_count_;
   DefaultCommandControls default_cmd_ctls_;
@@ -128,6 +149,7 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   RecentCounter recent_conn_errors_;
   USERVER_NAMESPACE::utils::TokenBucket cancel_limit_;
   detail::StatementTimingsStorage sts_;
+  std::shared_ptr<PreparedStatementsRegistry> statements_registry_;
 };
 
 }  // namespace storages::postgres::detail
@@ -0,0 +1,107 @@
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
+
+#include <algorithm>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+void PreparedStatementsRegistry::ExecutionCounters::Account(
+    PreparedStatementsRegistry& registry, Connection::StatementId id,
+    const std::string& statement, const QueryParameters& params) {
+  auto& counter = counters_[id.GetUnderlying()];
+  if (!counter.info) {
+    const auto* types = params.ParamTypesBuffer();
+    counter.info = std::make_shared<const StatementInfo>(StatementInfo{
+        id, statement, std::vector<Oid>(types, types + params.Size())});
+  }
+  ++counter.executions;
+
+  if (++executions_ >= kMergePeriod) registry.Merge(*this);
+}
+
+PreparedStatementsRegistry::PreparedStatementsRegistry(std::size_t max_size)
+    : max_size_{max_size} {}
+
+void PreparedStatementsRegistry::Merge(ExecutionCounters& counters) {
+  std::vector<ExecutionCounters::Counter*> unknown;
+  {
+    const auto statements = statements_.Read();
+    for (auto& [id, counter] : counters.counters_) {
+      const auto it = statements->find(id);
+      if (it == statements->end()) {
+        unknown.push_back(&counter);
+      } else {
+        it->second->executions.fetch_add(counter.executions,
+                                         std::memory_order_relaxed);
+      }
+    }
+  }
+
+  if (!unknown.empty() && SizeApprox() < max_size_) {
+    auto statements = statements_.StartWrite();
+    for (auto* counter : unknown) {
+      if (statements->size() >= max_size_) break;
+      auto& entry = (*statements)[counter->info->id.GetUnderlying()];
+      if (!entry) entry = std::make_shared<Entry>(std::move(counter->info));
+      entry->executions.fetch_add(counter->executions,
+                                  std::memory_order_relaxed);
+    }
+    statements.Commit();
+  }
+
+  counters.counters_.clear();
+  counters.executions_ = 0;
+}
+
+std::vector<PreparedStatementsRegistry::StatementInfoPtr>
+PreparedStatementsRegistry::GetMostExecuted(std::size_t limit) const {
+  std::vector<std::pair<std::size_t, StatementInfoPtr>> statements;
+  {
+    const auto map = statements_.Read();
+    for (const auto& [id, entry] : *map) {
+      const auto executions = entry->executions.load(std::memory_order_relaxed);
+      if (executions) statements.emplace_back(executions, entry->info);
+    }
+  }
+
+  const auto count = std::min(limit, statements.size());
+  std::partial_sort(
+      statements.begin(), statements.begin() + count, statements.end(),
+      [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+  std::vector<StatementInfoPtr> result;
+  result.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    result.push_back(std::move(statements[i].second));
+  }
+  return result;
+}
+
+void PreparedStatementsRegistry::Decay() {
+  // A single copy of the map per pass, entries are shared with the readers
+  auto statements = statements_.StartWrite();
+  for (auto it = statements->begin(); it != statements->end();) {
+    // Concurrent increments between the load and the store may be lost, that
+    // is acceptable for a heuristic
+    auto& executions = it->second->executions;
+    const auto value = executions.load(std::memory_order_relaxed);
+    if (value == 0) {
+      it = statements->erase(it);
+    } else {
+      executions.store(value / 2, std::memory_order_relaxed);
+      ++it;
+    }
+  }
+  statements.Commit();
+}
+
+std::size_t PreparedStatementsRegistry::SizeApprox() const {
+  const auto statements = statements_.Read();
+  return statements->size();
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
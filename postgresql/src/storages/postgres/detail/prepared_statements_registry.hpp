@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/rcu/rcu.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Pool-wide registry of prepared statements with their execution counters.
+/// Used to prepare the most executed statements on a new connection before it
+/// is handed out, so that the first queries don't pay for preparing.
+class PreparedStatementsRegistry final {
+ public:
+  struct StatementInfo {
+    Connection::StatementId id;
+    std::string statement;
+    std::vector<Oid> param_types;
+  };
+  using StatementInfoPtr = std::shared_ptr<const StatementInfo>;
+
+  /// Execution counters of a single connection. A connection is used by one
+  /// task at a time, so accounting an execution touches no shared state, the
+  /// counters are merged into the registry every kMergePeriod executions.
+  class ExecutionCounters final {
+   public:
+    static constexpr std::size_t kMergePeriod = 256;
+
+    /// Accounts an execution of a prepared statement, merges the counters
+    /// into the registry when the period is over
+    void Account(PreparedStatementsRegistry& registry,
+                 Connection::StatementId id, const std::string& statement,
+                 const QueryParameters& params);
+
+   private:
+    friend class PreparedStatementsRegistry;
+
+    struct Counter {
+      StatementInfoPtr info;
+      std::size_t executions{0};
+    };
+
+    std::unordered_map<std::size_t, Counter> counters_;
+    std::size_t executions_{0};
+  };
+
+  /// @param max_size limit of the registered statements count
+  explicit PreparedStatementsRegistry(std::size_t max_size);
+
+  /// Adds the executions from the connection counters and resets them,
+  /// registers unknown statements while there is a room for them
+  void Merge(ExecutionCounters& counters);
+
+  /// Returns up to `limit` most executed statements, the most executed first
+  std::vector<StatementInfoPtr> GetMostExecuted(std::size_t limit) const;
+
+  /// Halves the execution counters and forgets the statements that were not
+  /// executed since the previous call, so that the registry follows the
+  /// changes in the workload and makes room for new statements
+  void Decay();
+
+  std::size_t SizeApprox() const;
+
+ private:
+  struct Entry {
+    explicit Entry(StatementInfoPtr&& info) : info{std::move(info)} {}
+
+    const StatementInfoPtr info;
+    std::atomic<std::size_t> executions{0};
+  };
+  using Map = std::unordered_map<std::size_t, std::shared_ptr<Entry>>;
+
+  const std::size_t max_size_;
+  rcu::Variable<Map> statements_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
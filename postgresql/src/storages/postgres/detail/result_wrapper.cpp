@@ -8,6 +8,7 @@
 #include <userver/logging/stacktrace_cache.hpp>
 
 #include <storages/postgres/detail/pg_message_severity.hpp>
+#include <storages/postgres/detail/wire/native_result.hpp>
 #include <userver/storages/postgres/io/traits.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -93,6 +94,13 @@ ResultWrapper::ResultWrapper(ResultHandle&& res) : handle_{std::move(res)} {
   UASSERT(handle_);
 }
 
+ResultWrapper::ResultWrapper(std::unique_ptr<wire::NativeResult>&& res)
+    : handle_{nullptr, &PQclear}, native_{std::move(res)} {
+  UASSERT(native_);
+}
+
+ResultWrapper::~ResultWrapper() = default;
+
 void ResultWrapper::FillBufferCategories(const UserTypes& types) {
   buffer_categories_.clear();
   auto n_fields = FieldCount();
@@ -107,20 +115,27 @@ void ResultWrapper::FillBufferCategories(const UserTypes& types) {
 }
 
 ExecStatusType ResultWrapper::GetStatus() const {
+  if (native_) return native_->GetStatus();
   return PQresultStatus(handle_.get());
 }
 
-std::size_t ResultWrapper::RowCount() const { return PQntuples(handle_.get()); }
+std::size_t ResultWrapper::RowCount() const {
+  if (native_) return native_->RowCount();
+  return PQntuples(handle_.get());
+}
 
 std::size_t ResultWrapper::FieldCount() const {
+  if (native_) return native_->FieldCount();
   return PQnfields(handle_.get());
 }
 
 std::string ResultWrapper::CommandStatus() const {
+  if (native_) return native_->GetCommandStatus();
   return PQcmdStatus(handle_.get());
 }
 
 std::size_t ResultWrapper::RowsAffected() const {
+  if (native_) return native_->GetAffectedRows();
   auto str = PQcmdTuples(handle_.get());
   if (str) {
     char* endptr = nullptr;
@@ -138,12 +153,14 @@ std::size_t ResultWrapper::RowsAffected() const {
 }
 
 std::size_t ResultWrapper::IndexOfName(const std::string& name) const {
-  auto n = PQfnumber(handle_.get(), name.c_str());
+  auto n = native_ ? native_->IndexOfName(name)
+                  : PQfnumber(handle_.get(), name.c_str());
   if (n < 0) return ResultSet::npos;
   return n;
 }
 
 std::string_view ResultWrapper::GetFieldName(std::size_t col) const {
+  if (native_) return native_->GetField(col).name;
   auto name = PQfname(handle_.get(), col);
   if (name) {
     return {name};
@@ -154,6 +171,12 @@ std::string_view ResultWrapper::GetFieldName(std::size_t col) const {
 }
 
 FieldDescription ResultWrapper::GetFieldDescription(std::size_t col) const {
+  if (native_) {
+    const auto& field = native_->GetField(col);
+    return {col,           field.type_oid,     field.name,
+            field.table_oid, field.table_column, field.type_size,
+            field.type_modifier};
+  }
   return {col,
           GetFieldTypeOid(col),
           std::string{GetFieldName(col)},
@@ -164,10 +187,12 @@ FieldDescription ResultWrapper::GetFieldDescription(std::size_t col) const {
 }
 
 bool ResultWrapper::IsFieldNull(std::size_t row, std::size_t col) const {
+  if (native_) return native_->IsNull(row, col);
   return PQgetisnull(handle_.get(), row, col);
 }
 
 Oid ResultWrapper::GetFieldTypeOid(std::size_t col) const {
+  if (native_) return native_->GetField(col).type_oid;
   return PQftype(handle_.get(), col);
 }
 
@@ -183,23 +208,58 @@ io::BufferCategory ResultWrapper::GetFieldBufferCategory(
 
 std::size_t ResultWrapper::GetFieldLength(std::size_t row,
                                           std::size_t col) const {
+  if (native_) return native_->GetLength(row, col);
   return PQgetlength(handle_.get(), row, col);
 }
 
 io::FieldBuffer ResultWrapper::GetFieldBuffer(std::size_t row,
                                               std::size_t col) const {
-  if (PQfformat(handle_.get(), col) != io::kPgBinaryDataFormat) {
+  const auto format = native_ ? native_->GetField(col).format
+                              : PQfformat(handle_.get(), col);
+  if (format != io::kPgBinaryDataFormat) {
     throw ResultSetError{
         fmt::format("Column with index {} has text format\n", col) +
         logging::stacktrace_cache::to_string(boost::stacktrace::stacktrace{})};
   }
+  const auto* value = native_ ? native_->GetValue(row, col)
+                              : PQgetvalue(handle_.get(), row, col);
   return io::FieldBuffer{IsFieldNull(row, col), GetFieldBufferCategory(col),
                          GetFieldLength(row, col),
-                         reinterpret_cast<const std::uint8_t*>(
-                             PQgetvalue(handle_.get(), row, col))};
+                         reinterpret_cast<const std::uint8_t*>(value)};
+}
+
+void ResultWrapper::FillColumnBuffers(
+    std::size_t col, std::size_t first_row, std::size_t count,
+    std::vector<io::FieldBuffer>& buffers) const {
+  const auto format = native_ ? native_->GetField(col).format
+                              : PQfformat(handle_.get(), col);
+  if (format != io::kPgBinaryDataFormat) {
+    throw ResultSetError{
+        fmt::format("Column with index {} has text format\n", col) +
+        logging::stacktrace_cache::to_string(boost::stacktrace::stacktrace{})};
+  }
+  const auto category = GetFieldBufferCategory(col);
+  buffers.clear();
+  buffers.reserve(count);
+  if (native_) {
+    for (auto row = first_row; row < first_row + count; ++row) {
+      buffers.push_back(io::FieldBuffer{
+          native_->IsNull(row, col), category, native_->GetLength(row, col),
+          reinterpret_cast<const std::uint8_t*>(native_->GetValue(row, col))});
+    }
+    return;
+  }
+  auto* pg_res = handle_.get();
+  for (auto row = first_row; row < first_row + count; ++row) {
+    buffers.push_back(io::FieldBuffer{
+        static_cast<bool>(PQgetisnull(pg_res, row, col)), category,
+        static_cast<std::size_t>(PQgetlength(pg_res, row, col)),
+        reinterpret_cast<const std::uint8_t*>(PQgetvalue(pg_res, row, col))});
+  }
 }
 
 std::string ResultWrapper::GetErrorMessage() const {
+  if (native_) return native_->GetErrorMessage();
   auto msg = PQresultErrorMessage(handle_.get());
   return {msg ? msg : "no error message"};
 }
@@ -217,7 +277,7 @@ std::string ResultWrapper::GetMessageSeverityString() const {
 }
 
 Message::Severity ResultWrapper::GetMessageSeverity() const {
-  return Message::SeverityFromString(GetMachineReadableSeverity(handle_.get()));
+  return Message::SeverityFromString(GetSeverityField());
 }
 
 std::string ResultWrapper::GetSqlCode() const {
@@ -225,7 +285,7 @@ std::string ResultWrapper::GetSqlCode() const {
 }
 
 SqlState ResultWrapper::GetSqlState() const {
-  auto msg = PQresultErrorField(handle_.get(), PG_DIAG_SQLSTATE);
+  auto msg = GetErrorField(PG_DIAG_SQLSTATE);
   return msg ? SqlStateFromString(msg) : SqlState::kUnknownState;
 }
 
@@ -246,19 +306,20 @@ std::string ResultWrapper::GetMessageConstraint() const {
 }
 
 std::string ResultWrapper::GetMessageField(int fieldcode) const {
-  return {PQresultErrorField(handle_.get(), fieldcode)};
+  auto msg = GetErrorField(fieldcode);
+  return msg ? msg : std::string{};
 }
 
 logging::LogExtra ResultWrapper::GetMessageLogExtra() const {
   logging::LogExtra log_extra;
 
-  auto severity = GetMachineReadableSeverity(handle_.get());
+  auto severity = GetSeverityField();
   if (!severity.empty()) {
     log_extra.Extend(kSeverityLogExtraKey, std::string{severity});
   }
 
   for (auto [key, field] : kExtraErrorFields) {
-    auto msg = PQresultErrorField(handle_.get(), field);
+    auto msg = GetErrorField(field);
     if (msg) {
       log_extra.Extend(key, std::string{msg});
     }
@@ -266,6 +327,16 @@ logging::LogExtra ResultWrapper::GetMessageLogExtra() const {
   return log_extra;
 }
 
+const char* ResultWrapper::GetErrorField(int fieldcode) const {
+  if (native_) return native_->GetMessageField(fieldcode);
+  return PQresultErrorField(handle_.get(), fieldcode);
+}
+
+std::string_view ResultWrapper::GetSeverityField() const {
+  if (native_) return native_->GetMachineReadableSeverity();
+  return GetMachineReadableSeverity(handle_.get());
+}
+
 }  // namespace storages::postgres::detail
 
 USERVER_NAMESPACE_END
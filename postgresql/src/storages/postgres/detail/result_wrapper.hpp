@@ -3,6 +3,7 @@
 #include <libpq-fe.h>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 #include <userver/storages/postgres/postgres_fwd.hpp>
 
@@ -17,13 +18,20 @@ namespace storages {
 namespace postgres {
 namespace detail {
 
-/// @brief Wrapper for PGresult
+namespace wire {
+class NativeResult;
+}  // namespace wire
+
+/// @brief Wrapper for PGresult or a result received with the native protocol
+/// implementation
 class ResultWrapper {
  public:
   using ResultHandle = std::unique_ptr<PGresult, decltype(&PQclear)>;
 
  public:
   ResultWrapper(ResultHandle&& res);
+  explicit ResultWrapper(std::unique_ptr<wire::NativeResult>&& res);
+  ~ResultWrapper();
 
   void FillBufferCategories(const UserTypes& types);
 
@@ -51,6 +59,11 @@ class ResultWrapper {
   bool IsFieldNull(std::size_t row, std::size_t col) const;
   std::size_t GetFieldLength(std::size_t row, std::size_t col) const;
   io::FieldBuffer GetFieldBuffer(std::size_t row, std::size_t col) const;
+  /// Replaces the contents of `buffers` with the field buffers of `count` rows
+  /// of the column, the format and the buffer category are looked up once
+  void FillColumnBuffers(std::size_t col, std::size_t first_row,
+                         std::size_t count,
+                         std::vector<io::FieldBuffer>& buffers) const;
   //@}
 
   //@{
@@ -76,7 +89,11 @@ class ResultWrapper {
   //@}
 
  private:
+  const char* GetErrorField(int fieldcode) const;
+  std::string_view GetSeverityField() const;
+
   ResultHandle handle_;
+  std::unique_ptr<wire::NativeResult> native_;
   io::TypeBufferCategory buffer_categories_;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -25,6 +26,8 @@ class TopologyBase {
   using DsnIndices = std::vector<DsnIndex>;
   using DsnIndicesByType =
       std::unordered_map<ClusterHostType, DsnIndices, ClusterHostTypeHash>;
+  using Rtt = std::chrono::microseconds;
+  using DsnRtts = std::vector<Rtt>;
 
   TopologyBase(engine::TaskProcessor& bg_task_processor, DsnList dsns,
                clients::dns::Resolver* resolver,
@@ -46,6 +49,10 @@ class TopologyBase {
   /// Currently accessible hosts
   virtual rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const = 0;
 
+  /// Smoothed roundtrip times for each DSN in DsnList, negative for the hosts
+  /// that were not reached
+  virtual rcu::ReadablePtr<DsnRtts> GetDsnRtts() const = 0;
+
   // Returns statistics for each DSN in DsnList
   virtual const std::vector<decltype(InstanceStatistics::topology)>&
   GetDsnStatistics() const = 0;
@@ -32,8 +32,11 @@ namespace {
 constexpr auto kCheckTimeout = std::chrono::seconds{1};
 constexpr auto kDiscoveryInterval = std::chrono::seconds{1};
 
-using Rtt = std::chrono::microseconds;
+using Rtt = TopologyBase::Rtt;
 constexpr Rtt kUnknownRtt{-1};
+// Weight of the previous smoothed RTT value is (kRttSmoothingFactor - 1) /
+// kRttSmoothingFactor, so a single slow check does not reorder the hosts
+constexpr Rtt::rep kRttSmoothingFactor = 4;
 
 using ReplicationLag = std::chrono::milliseconds;
 
@@ -125,6 +128,9 @@ struct HotStandby::HostState {
   ClusterHostType role = ClusterHostType::kNone;
   bool is_readonly = true;
   Rtt roundtrip_time{kUnknownRtt};
+  // Exponentially weighted moving average of roundtrip_time, is kept
+  // between the discovery runs
+  Rtt smoothed_roundtrip_time{kUnknownRtt};
   Lsn wal_lsn{kUnknownLsn};
   std::chrono::system_clock::time_point current_xact_timestamp;
   std::vector<std::string> detected_sync_slaves;
@@ -164,6 +170,10 @@ rcu::ReadablePtr<TopologyBase::DsnIndices> HotStandby::GetAliveDsnIndices()
   return alive_dsn_indices_.Read();
 }
 
+rcu::ReadablePtr<TopologyBase::DsnRtts> HotStandby::GetDsnRtts() const {
+  return dsn_rtts_.Read();
+}
+
 const std::vector<decltype(InstanceStatistics::topology)>&
 HotStandby::GetDsnStatistics() const {
   return dsn_stats_;
@@ -190,6 +200,15 @@ void HotStandby::RunDiscovery() {
           std::chrono::duration_cast<std::chrono::milliseconds>(
               state.roundtrip_time)
               .count());
+      if (state.smoothed_roundtrip_time == kUnknownRtt) {
+        state.smoothed_roundtrip_time = state.roundtrip_time;
+      } else {
+        state.smoothed_roundtrip_time +=
+            (state.roundtrip_time - state.smoothed_roundtrip_time) /
+            kRttSmoothingFactor;
+      }
+    } else {
+      state.smoothed_roundtrip_time = kUnknownRtt;
     }
     if (state.role == ClusterHostType::kMaster) {
       master = &state;
@@ -266,8 +285,8 @@ void HotStandby::RunDiscovery() {
 
   std::sort(alive_dsn_indices.begin(), alive_dsn_indices.end(),
             [this](DsnIndex lhs, DsnIndex rhs) {
-              return host_states_[lhs].roundtrip_time <
-                     host_states_[rhs].roundtrip_time;
+              return host_states_[lhs].smoothed_roundtrip_time <
+                     host_states_[rhs].smoothed_roundtrip_time;
             });
   DsnIndicesByType dsn_indices_by_type;
   for (DsnIndex idx : alive_dsn_indices) {
@@ -280,6 +299,12 @@ void HotStandby::RunDiscovery() {
       dsn_indices_by_type[ClusterHostType::kSlave].push_back(idx);
     }
   }
+  DsnRtts dsn_rtts;
+  dsn_rtts.reserve(host_states_.size());
+  for (const auto& state : host_states_) {
+    dsn_rtts.push_back(state.smoothed_roundtrip_time);
+  }
+  dsn_rtts_.Assign(std::move(dsn_rtts));
   dsn_indices_by_type_.Assign(std::move(dsn_indices_by_type));
   alive_dsn_indices_.Assign(std::move(alive_dsn_indices));
 }
@@ -14,8 +14,12 @@ const std::string kConnect = "pg_connect";
 const std::string kGetConnectData = "pg_get_conn_data";
 /// Execute query, top driver level
 const std::string kQuery = "pg_query";
+/// Execute a batch of queries, top driver level
+const std::string kQueryBatch = "pg_query_batch";
 /// Prepare query, driver level
 const std::string kPrepare = "pg_prepare";
+/// Prepare the most executed statements on a new connection, driver level
+const std::string kPrepareWarmup = "pg_prepare_warmup";
 /// Bind portal, driver level
 const std::string kBind = "pg_bind";
 /// Execute query, driver level
@@ -36,6 +40,12 @@ const std::string kLibpqSendPrepare = "libpq_send_prepare";
 const std::string kLibpqSendDescribePrepared = "libpq_send_describe_prepared";
 /// libpq send query prepared stage
 const std::string kLibpqSendQueryPrepared = "libpq_send_query_prepared";
+/// libpq wait for COPY start stage
+const std::string kLibpqWaitCopyStart = "libpq_wait_copy_start";
+/// libpq put copy data stage
+const std::string kLibpqPutCopyData = "libpq_put_copy_data";
+/// libpq get copy data stage
+const std::string kLibpqGetCopyData = "libpq_get_copy_data";
 /// libpq-missing send bind portal
 const std::string kPqSendPortalBind = "pq_send_portal_bind";
 /// libpq-missing send execute portal
@@ -0,0 +1,162 @@
+#include <storages/postgres/detail/wire/messages.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <fmt/format.h>
+#include <boost/endian/conversion.hpp>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail::wire {
+
+namespace {
+
+constexpr std::size_t kInitialBufferSize = 64 * 1024;
+constexpr std::size_t kMinReadSize = 4 * 1024;
+// A buffer grown for a large message is shrunk back when it becomes empty
+constexpr std::size_t kMaxIdleBufferSize = 16 * kInitialBufferSize;
+
+template <typename T>
+T ReadBigEndian(const char* data) {
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return boost::endian::big_to_native(value);
+}
+
+[[noreturn]] void ThrowMalformed(std::string_view what) {
+  throw ConnectionError{
+      fmt::format("Malformed message from the server: {}", what)};
+}
+
+// Size of the message including the type byte
+std::size_t GetMessageSize(const char* header) {
+  const auto length = ReadBigEndian<std::int32_t>(header + 1);
+  if (length < static_cast<std::int32_t>(sizeof(std::int32_t))) {
+    ThrowMalformed(fmt::format("invalid length {} of message '{}'", length,
+                               header[0]));
+  }
+  return static_cast<std::size_t>(length) + 1;
+}
+
+}  // namespace
+
+char MessageReader::ReadByte() {
+  if (data_.empty()) ThrowMalformed("unexpected end of message");
+  const char value = data_.front();
+  data_.remove_prefix(1);
+  return value;
+}
+
+std::int16_t MessageReader::ReadInt16() {
+  const auto bytes = ReadBytes(sizeof(std::int16_t));
+  return ReadBigEndian<std::int16_t>(bytes.data());
+}
+
+std::int32_t MessageReader::ReadInt32() {
+  const auto bytes = ReadBytes(sizeof(std::int32_t));
+  return ReadBigEndian<std::int32_t>(bytes.data());
+}
+
+std::string_view MessageReader::ReadString() {
+  const auto end = data_.find('\0');
+  if (end == std::string_view::npos) ThrowMalformed("unterminated string");
+  const auto value = data_.substr(0, end);
+  data_.remove_prefix(end + 1);
+  return value;
+}
+
+std::string_view MessageReader::ReadBytes(std::size_t size) {
+  if (data_.size() < size) ThrowMalformed("unexpected end of message");
+  const auto value = data_.substr(0, size);
+  data_.remove_prefix(size);
+  return value;
+}
+
+void MessageWriter::Start(char type) {
+  if (type != frontend::kUntyped) buffer_.push_back(type);
+  length_pos_ = buffer_.size();
+  PutInt32(0);
+}
+
+void MessageWriter::PutByte(char value) { buffer_.push_back(value); }
+
+void MessageWriter::PutInt16(std::int16_t value) {
+  value = boost::endian::native_to_big(value);
+  buffer_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void MessageWriter::PutInt32(std::int32_t value) {
+  value = boost::endian::native_to_big(value);
+  buffer_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void MessageWriter::PutString(std::string_view value) {
+  UASSERT(value.find('\0') == std::string_view::npos);
+  buffer_.append(value);
+  buffer_.push_back('\0');
+}
+
+void MessageWriter::PutBytes(std::string_view value) { buffer_.append(value); }
+
+void MessageWriter::End() {
+  const auto length = boost::endian::native_to_big(
+      static_cast<std::int32_t>(buffer_.size() - length_pos_));
+  std::memcpy(buffer_.data() + length_pos_, &length, sizeof(length));
+}
+
+ReceiveBuffer::ReceiveBuffer() : data_(kInitialBufferSize) {}
+
+std::optional<BackendMessage> ReceiveBuffer::Peek() const {
+  const auto available = end_ - begin_;
+  if (available < kHeaderSize) return std::nullopt;
+
+  const char* head = data_.data() + begin_;
+  const auto size = GetMessageSize(head);
+  if (available < size) return std::nullopt;
+  return BackendMessage{head[0], {head + kHeaderSize, size - kHeaderSize},
+                        size};
+}
+
+void ReceiveBuffer::Consume(std::size_t size) {
+  UASSERT(size <= end_ - begin_);
+  begin_ += size;
+  if (begin_ == end_) {
+    begin_ = end_ = 0;
+    if (data_.size() > kMaxIdleBufferSize) {
+      data_.resize(kInitialBufferSize);
+      data_.shrink_to_fit();
+    }
+  }
+}
+
+std::pair<char*, std::size_t> ReceiveBuffer::PrepareRead() {
+  // The whole message at the head must fit into the buffer
+  std::size_t required = kHeaderSize;
+  if (end_ - begin_ >= kHeaderSize) {
+    required = std::max(required, GetMessageSize(data_.data() + begin_));
+  }
+  if (data_.size() - begin_ < required || data_.size() - end_ < kMinReadSize) {
+    std::memmove(data_.data(), data_.data() + begin_, end_ - begin_);
+    end_ -= begin_;
+    begin_ = 0;
+  }
+  if (data_.size() < required) {
+    data_.resize(std::max(required, data_.size() * 2));
+  } else if (data_.size() - end_ < kMinReadSize) {
+    data_.resize(data_.size() * 2);
+  }
+  return {data_.data() + end_, data_.size() - end_};
+}
+
+void ReceiveBuffer::CommitRead(std::size_t size) {
+  UASSERT(end_ + size <= data_.size());
+  end_ += size;
+}
+
+}  // namespace storages::postgres::detail::wire
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail::wire {
+
+/// Protocol version 3.0
+inline constexpr std::int32_t kProtocolVersion = 196608;
+inline constexpr std::int32_t kSslRequestCode = 80877103;
+inline constexpr std::int32_t kCancelRequestCode = 80877102;
+
+/// Size of the message type and length header
+inline constexpr std::size_t kHeaderSize = 5;
+
+namespace frontend {
+
+inline constexpr char kBind = 'B';
+inline constexpr char kCopyData = 'd';
+inline constexpr char kCopyDone = 'c';
+inline constexpr char kCopyFail = 'f';
+inline constexpr char kDescribe = 'D';
+inline constexpr char kExecute = 'E';
+inline constexpr char kParse = 'P';
+inline constexpr char kPassword = 'p';
+inline constexpr char kSync = 'S';
+inline constexpr char kTerminate = 'X';
+/// Startup, SSL and cancel request packets do not have a type byte
+inline constexpr char kUntyped = '\0';
+
+}  // namespace frontend
+
+namespace backend {
+
+inline constexpr char kAuthentication = 'R';
+inline constexpr char kBackendKeyData = 'K';
+inline constexpr char kBindComplete = '2';
+inline constexpr char kCloseComplete = '3';
+inline constexpr char kCommandComplete = 'C';
+inline constexpr char kCopyData = 'd';
+inline constexpr char kCopyDone = 'c';
+inline constexpr char kCopyInResponse = 'G';
+inline constexpr char kCopyOutResponse = 'H';
+inline constexpr char kCopyBothResponse = 'W';
+inline constexpr char kDataRow = 'D';
+inline constexpr char kEmptyQueryResponse = 'I';
+inline constexpr char kErrorResponse = 'E';
+inline constexpr char kNegotiateProtocolVersion = 'v';
+inline constexpr char kNoData = 'n';
+inline constexpr char kNoticeResponse = 'N';
+inline constexpr char kNotificationResponse = 'A';
+inline constexpr char kParameterDescription = 't';
+inline constexpr char kParameterStatus = 'S';
+inline constexpr char kParseComplete = '1';
+inline constexpr char kPortalSuspended = 's';
+inline constexpr char kReadyForQuery = 'Z';
+inline constexpr char kRowDescription = 'T';
+
+}  // namespace backend
+
+namespace auth {
+
+inline constexpr std::int32_t kOk = 0;
+inline constexpr std::int32_t kCleartextPassword = 3;
+inline constexpr std::int32_t kMd5Password = 5;
+inline constexpr std::int32_t kSasl = 10;
+inline constexpr std::int32_t kSaslContinue = 11;
+inline constexpr std::int32_t kSaslFinal = 12;
+
+}  // namespace auth
+
+/// A backend message received completely, the payload points into the
+/// receive buffer and is valid until the message is consumed
+struct BackendMessage {
+  char type;
+  std::string_view payload;
+  /// Size of the message including the header
+  std::size_t size;
+};
+
+/// @brief Sequential reader of backend message fields.
+/// @throws ConnectionError if the message is malformed
+class MessageReader {
+ public:
+  explicit MessageReader(std::string_view payload) : data_{payload} {}
+
+  char ReadByte();
+  std::int16_t ReadInt16();
+  std::int32_t ReadInt32();
+  /// Reads a null-terminated string
+  std::string_view ReadString();
+  std::string_view ReadBytes(std::size_t size);
+
+  std::size_t Remaining() const { return data_.size(); }
+
+ private:
+  std::string_view data_;
+};
+
+/// Appends frontend messages to an output buffer
+class MessageWriter {
+ public:
+  explicit MessageWriter(std::string& buffer) : buffer_{buffer} {}
+
+  /// Starts a message, the length is filled in by End
+  void Start(char type);
+  void PutByte(char value);
+  void PutInt16(std::int16_t value);
+  void PutInt32(std::int32_t value);
+  /// Puts a null-terminated string
+  void PutString(std::string_view value);
+  void PutBytes(std::string_view value);
+  void End();
+
+ private:
+  std::string& buffer_;
+  std::size_t length_pos_{0};
+};
+
+/// @brief Buffer for the data received from the server.
+///
+/// Messages are parsed in place, so a message is always kept contiguous: the
+/// unparsed tail is moved to the front of the buffer before a read that would
+/// not fit, and the buffer grows to fit a message larger than its capacity.
+class ReceiveBuffer {
+ public:
+  ReceiveBuffer();
+
+  /// @returns the message at the head of the buffer if it was received
+  /// completely
+  /// @throws ConnectionError if the message header is invalid
+  std::optional<BackendMessage> Peek() const;
+  void Consume(std::size_t size);
+
+  /// @returns a free span to read the data to
+  std::pair<char*, std::size_t> PrepareRead();
+  void CommitRead(std::size_t size);
+
+  bool Empty() const { return begin_ == end_; }
+
+ private:
+  std::vector<char> data_;
+  std::size_t begin_{0};
+  std::size_t end_{0};
+};
+
+}  // namespace storages::postgres::detail::wire
+
+USERVER_NAMESPACE_END
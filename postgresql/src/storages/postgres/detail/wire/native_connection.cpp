@@ -0,0 +1,1324 @@
+#include <storages/postgres/detail/wire/native_connection.hpp>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include <fmt/format.h>
+#include <boost/algorithm/string/split.hpp>
+
+#include <userver/crypto/hash.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/traits.hpp>
+#include <userver/storages/postgres/message.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <storages/postgres/detail/tracing_tags.hpp>
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage): uses file/line info
+#define PGNC_LOG_TRACE() LOG_TRACE() << owner_.log_extra_
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage): uses file/line info
+#define PGNC_LOG_DEBUG() LOG_DEBUG() << owner_.log_extra_
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage): uses file/line info
+#define PGNC_LOG_LIMITED_INFO() LOG_LIMITED_INFO() << owner_.log_extra_
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage): uses file/line info
+#define PGNC_LOG_LIMITED_WARNING() LOG_LIMITED_WARNING() << owner_.log_extra_
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage): uses file/line info
+#define PGNC_LOG_LIMITED_ERROR() LOG_LIMITED_ERROR() << owner_.log_extra_
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage): uses file/line info
+#define PGNC_LOG(level) LOG(level) << owner_.log_extra_
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail::wire {
+
+namespace {
+
+using Options = NativeConnection::Options;
+
+const std::string kDefaultHost = "localhost";
+constexpr std::size_t kUnixSocketPathSize = sizeof(sockaddr_un::sun_path);
+constexpr std::chrono::seconds kCancelTimeout{5};
+constexpr std::chrono::seconds kTerminateTimeout{1};
+
+using OptionsHandle =
+    std::unique_ptr<PQconninfoOption, decltype(&PQconninfoFree)>;
+
+void AddOptions(const OptionsHandle& handle, Options& options) {
+  for (auto* opt = handle.get(); opt && opt->keyword; ++opt) {
+    if (opt->val) options[opt->keyword] = opt->val;
+  }
+}
+
+// DSN options over the libpq defaults, which include the environment
+// variables like PGUSER and PGPASSWORD
+Options ParseOptions(const Dsn& dsn) {
+  Options options;
+  AddOptions(OptionsHandle{PQconndefaults(), &PQconninfoFree}, options);
+
+  char* errmsg = nullptr;
+  OptionsHandle parsed{PQconninfoParse(dsn.GetUnderlying().c_str(), &errmsg),
+                       &PQconninfoFree};
+  if (errmsg) {
+    InvalidDSN err{DsnMaskPassword(dsn), errmsg};
+    PQfreemem(errmsg);
+    throw std::move(err);
+  }
+  AddOptions(parsed, options);
+  return options;
+}
+
+std::string GetOption(const Options& options, const std::string& name) {
+  const auto it = options.find(name);
+  return it == options.end() ? std::string{} : it->second;
+}
+
+std::vector<std::string> SplitOption(const Options& options,
+                                     const std::string& name) {
+  std::vector<std::string> values;
+  const auto value = GetOption(options, name);
+  if (!value.empty()) {
+    boost::split(values, value, [](char c) { return c == ','; });
+  }
+  return values;
+}
+
+// Value at the index of a per-host option list, a single value is used for
+// all the hosts
+std::string GetListValue(const std::vector<std::string>& values,
+                         std::size_t index) {
+  if (values.empty()) return {};
+  if (values.size() == 1) return values.front();
+  return index < values.size() ? values[index] : std::string{};
+}
+
+std::vector<engine::io::Sockaddr> Resolve(const std::string& host,
+                                          const std::string& port,
+                                          bool numeric) {
+  addrinfo hints{};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  if (numeric) hints.ai_flags = AI_NUMERICHOST;
+
+  addrinfo* result = nullptr;
+  const auto error = ::getaddrinfo(host.c_str(), port.c_str(), &hints, &result);
+  if (error) {
+    throw ConnectionError{fmt::format("could not translate host name \"{}\" "
+                                      "to address: {}",
+                                      host, ::gai_strerror(error))};
+  }
+  std::unique_ptr<addrinfo, decltype(&::freeaddrinfo)> guard{result,
+                                                             &::freeaddrinfo};
+  std::vector<engine::io::Sockaddr> addresses;
+  for (const auto* info = result; info; info = info->ai_next) {
+    if (info->ai_family == AF_INET || info->ai_family == AF_INET6) {
+      addresses.emplace_back(info->ai_addr);
+    }
+  }
+  return addresses;
+}
+
+engine::io::Sockaddr MakeUnixSocketAddress(const std::string& directory,
+                                           const std::string& port) {
+  const auto path = fmt::format("{}/.s.PGSQL.{}", directory, port);
+  if (path.size() >= kUnixSocketPathSize) {
+    throw ConnectionError{
+        fmt::format("Unix-domain socket path \"{}\" is too long", path)};
+  }
+  engine::io::Sockaddr address;
+  auto* native = address.As<sockaddr_un>();
+  native->sun_family = AF_UNIX;
+  std::memcpy(native->sun_path, path.c_str(), path.size() + 1);
+  return address;
+}
+
+// Same as PQserverVersion: 90605 for 9.6.5, 140005 for 14.5
+int ParseServerVersion(std::string_view version) {
+  std::array<int, 3> parts{};
+  std::size_t count = 0;
+  for (auto it = version.begin(); it != version.end() && count < parts.size();
+       ++count) {
+    if (!std::isdigit(static_cast<unsigned char>(*it))) break;
+    for (; it != version.end() && std::isdigit(static_cast<unsigned char>(*it));
+         ++it) {
+      parts[count] = parts[count] * 10 + (*it - '0');
+    }
+    if (it == version.end() || *it != '.') {
+      ++count;
+      break;
+    }
+    ++it;
+  }
+  if (count == 0) return 0;
+  if (parts[0] >= 10) return parts[0] * 10000 + parts[1];
+  return parts[0] * 10000 + parts[1] * 100 + parts[2];
+}
+
+}  // namespace
+
+template <typename ExceptionType>
+void NativeConnection::CloseWithError(ExceptionType&& ex) {
+  PGNC_LOG_DEBUG() << "Closing connection because of failure: " << ex;
+  Reset();
+  // NOLINTNEXTLINE(hicpp-exception-baseclass)
+  throw std::forward<ExceptionType>(ex);
+}
+
+NativeConnection::NativeConnection(PGConnectionWrapper& owner,
+                                   engine::TaskProcessor& bg_task_processor)
+    : owner_{owner}, bg_task_processor_{bg_task_processor} {}
+
+NativeConnection::~NativeConnection() = default;
+
+bool NativeConnection::IsConnected() const {
+  return socket_.IsValid() || tls_.has_value();
+}
+
+bool NativeConnection::IsBusy() const {
+  // Like in libpq, the connection is not busy in COPY state as the data is
+  // transferred by the dedicated functions
+  return results_.empty() && !commands_.empty() &&
+         copy_state_ == CopyState::kNone;
+}
+
+ConnectionState NativeConnection::GetConnectionState() const {
+  if (!IsConnected()) return ConnectionState::kOffline;
+  if (!commands_.empty() || !results_.empty() ||
+      copy_state_ != CopyState::kNone) {
+    return ConnectionState::kTranActive;
+  }
+  switch (transaction_status_) {
+    case 'I':
+      return ConnectionState::kIdle;
+    case 'T':
+      return ConnectionState::kTranIdle;
+    case 'E':
+      return ConnectionState::kTranError;
+    default:
+      return ConnectionState::kOffline;
+  }
+}
+
+int NativeConnection::GetServerVersion() const {
+  return ParseServerVersion(GetParameterStatus("server_version"));
+}
+
+std::string_view NativeConnection::GetParameterStatus(const char* name) const {
+  const auto it = parameters_.find(name);
+  if (it == parameters_.end()) return {};
+  return it->second;
+}
+
+void NativeConnection::Connect(const Dsn& dsn, Deadline deadline,
+                               tracing::ScopeTime& scope) {
+  if (IsConnected()) {
+    PGNC_LOG_LIMITED_ERROR()
+        << "Attempt to connect a connection that is already connected"
+        << logging::LogExtra::Stacktrace();
+    throw ConnectionFailed{dsn, "Already connected"};
+  }
+
+  scope.Reset(scopes::kLibpqConnect);
+  // PQconndefaults() may access the service file, /etc/passwd, etc.
+  const auto options =
+      engine::CriticalAsyncNoSpan(bg_task_processor_, [&dsn] {
+        return ParseOptions(dsn);
+      }).Get();
+  // The TLS client takes neither a custom root certificate nor a client
+  // certificate, silently ignoring them would weaken the connection security
+  for (const auto* name : {"sslrootcert", "sslcert", "sslkey"}) {
+    if (!GetOption(options, name).empty()) {
+      throw ConnectionFailed{
+          dsn, fmt::format("\"{}\" option is not supported by the native "
+                           "protocol implementation, disable "
+                           "native_protocol_enabled to use it",
+                           name)};
+    }
+  }
+
+  auto hosts = SplitOption(options, "host");
+  const auto hostaddrs = SplitOption(options, "hostaddr");
+  const auto ports = SplitOption(options, "port");
+  if (hosts.empty() && hostaddrs.empty()) hosts.push_back(kDefaultHost);
+
+  scope.Reset(scopes::kLibpqWaitConnectFinish);
+  std::exception_ptr last_error;
+  const auto count = std::max(hosts.size(), hostaddrs.size());
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto host = GetListValue(hosts, i);
+    const auto hostaddr = GetListValue(hostaddrs, i);
+    auto port = GetListValue(ports, i);
+    if (port.empty()) port = "5432";
+    try {
+      ConnectHost(host, hostaddr, port, options, deadline);
+      Startup(options, dsn, deadline);
+      return;
+    } catch (const engine::io::IoInterrupted&) {
+      Reset();
+      ThrowInterrupted("connecting");
+    } catch (const engine::io::IoException& ex) {
+      Reset();
+      last_error = std::make_exception_ptr(ConnectionFailed{dsn, ex.what()});
+    } catch (const ConnectionTimeoutError&) {
+      Reset();
+      throw;
+    } catch (const ConnectionError& ex) {
+      Reset();
+      PGNC_LOG_LIMITED_WARNING()
+          << "Failed to connect to " << (host.empty() ? hostaddr : host) << ':'
+          << port << ": " << ex;
+      last_error = std::current_exception();
+    }
+  }
+  std::rethrow_exception(last_error);
+}
+
+void NativeConnection::ConnectHost(const std::string& host,
+                                   const std::string& hostaddr,
+                                   const std::string& port,
+                                   const Options& options, Deadline deadline) {
+  std::vector<engine::io::Sockaddr> addresses;
+  if (hostaddr.empty() && !host.empty() && host.front() == '/') {
+    addresses.push_back(MakeUnixSocketAddress(host, port));
+  } else {
+    // getaddrinfo() is blocking
+    addresses = engine::CriticalAsyncNoSpan(bg_task_processor_, [&] {
+                  return hostaddr.empty() ? Resolve(host, port, false)
+                                          : Resolve(hostaddr, port, true);
+                }).Get();
+  }
+
+  std::string error = "no addresses";
+  for (const auto& address : addresses) {
+    engine::io::Socket socket{address.Domain(),
+                              engine::io::SocketType::kStream};
+    try {
+      socket.Connect(address, deadline);
+    } catch (const engine::io::IoInterrupted&) {
+      throw;
+    } catch (const engine::io::IoException& ex) {
+      error = ex.what();
+      continue;
+    }
+    if (address.Domain() != engine::io::AddrDomain::kUnix) {
+      socket.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
+    }
+    socket_ = std::move(socket);
+    server_address_ = address;
+    break;
+  }
+  if (!socket_) {
+    throw ConnectionError{fmt::format("could not connect to {}:{}: {}",
+                                      host.empty() ? hostaddr : host, port,
+                                      error)};
+  }
+
+  auto sslmode = GetOption(options, "sslmode");
+  if (sslmode.empty()) sslmode = "prefer";
+  StartTls(host.empty() ? hostaddr : host, sslmode, deadline);
+}
+
+void NativeConnection::StartTls(const std::string& host,
+                                std::string_view sslmode, Deadline deadline) {
+  // "allow" prefers a connection without TLS, it is never retried with TLS
+  if (sslmode == "disable" || sslmode == "allow") return;
+  const bool verify = (sslmode == "verify-ca" || sslmode == "verify-full");
+  if (!verify && sslmode != "prefer" && sslmode != "require") {
+    throw ConnectionError{
+        fmt::format("invalid sslmode value: \"{}\"", sslmode)};
+  }
+  // libpq does not use TLS over Unix-domain sockets
+  if (server_address_.Domain() == engine::io::AddrDomain::kUnix) return;
+
+  MessageWriter writer{out_buffer_};
+  writer.Start(frontend::kUntyped);
+  writer.PutInt32(kSslRequestCode);
+  writer.End();
+  SendOutput(deadline);
+
+  char response = 0;
+  if (!socket_.RecvSome(&response, 1, deadline)) {
+    throw ConnectionError{"server closed the connection during TLS startup"};
+  }
+  if (response == 'N') {
+    if (sslmode != "prefer") {
+      throw ConnectionError{
+          "server does not support SSL, but SSL was required"};
+    }
+    return;
+  }
+  if (response != 'S') {
+    throw ConnectionError{
+        fmt::format("received invalid response to SSL negotiation: {}",
+                    response)};
+  }
+  // An empty server name disables the certificate verification
+  tls_.emplace(engine::io::TlsWrapper::StartTlsClient(
+      std::move(socket_), verify ? host : std::string{}, deadline));
+}
+
+void NativeConnection::Startup(const Options& options, const Dsn& dsn,
+                               Deadline deadline) {
+  const auto user = GetOption(options, "user");
+  const auto password = GetOption(options, "password");
+  auto dbname = GetOption(options, "dbname");
+  if (dbname.empty()) dbname = user;
+
+  MessageWriter writer{out_buffer_};
+  writer.Start(frontend::kUntyped);
+  writer.PutInt32(kProtocolVersion);
+  writer.PutString("user");
+  writer.PutString(user);
+  writer.PutString("database");
+  writer.PutString(dbname);
+  for (const auto* name : {"application_name", "options", "client_encoding"}) {
+    const auto value = GetOption(options, name);
+    if (!value.empty()) {
+      writer.PutString(name);
+      writer.PutString(value);
+    }
+  }
+  writer.PutByte('\0');
+  writer.End();
+  SendOutput(deadline);
+
+  std::optional<ScramSha256Client> scram;
+  while (true) {
+    const auto message = WaitMessage(deadline);
+    switch (message.type) {
+      case backend::kAuthentication:
+        Authenticate(message.payload, user, password, scram, dsn);
+        break;
+      case backend::kBackendKeyData: {
+        MessageReader reader{message.payload};
+        backend_pid_ = reader.ReadInt32();
+        backend_secret_ = reader.ReadInt32();
+        break;
+      }
+      case backend::kParameterStatus:
+        HandleParameterStatus(message.payload);
+        break;
+      case backend::kNoticeResponse:
+        LogNotice(message.payload);
+        break;
+      case backend::kNegotiateProtocolVersion:
+        // No protocol extensions are requested, the server may still report
+        // a lower minor version
+        PGNC_LOG_DEBUG() << "Server negotiated the protocol version";
+        break;
+      case backend::kErrorResponse: {
+        NativeResult error{PGRES_FATAL_ERROR};
+        error.SetMessageFields(message.payload);
+        throw ConnectionFailed{dsn, error.GetErrorMessage()};
+      }
+      case backend::kReadyForQuery: {
+        MessageReader reader{message.payload};
+        transaction_status_ = reader.ReadByte();
+        in_buffer_.Consume(message.size);
+        return;
+      }
+      default:
+        throw ConnectionError{fmt::format(
+            "unexpected message type '{}' during startup", message.type)};
+    }
+    in_buffer_.Consume(message.size);
+    SendOutput(deadline);
+  }
+}
+
+void NativeConnection::Authenticate(std::string_view payload,
+                                    const std::string& user,
+                                    const std::string& password,
+                                    std::optional<ScramSha256Client>& scram,
+                                    const Dsn& dsn) {
+  MessageReader reader{payload};
+  const auto code = reader.ReadInt32();
+  if (code == auth::kOk) return;
+
+  MessageWriter writer{out_buffer_};
+  switch (code) {
+    case auth::kCleartextPassword:
+    case auth::kMd5Password:
+    case auth::kSasl:
+      if (password.empty()) {
+        throw ConnectionFailed{dsn, "password is required by the server"};
+      }
+      break;
+    default:
+      break;
+  }
+  switch (code) {
+    case auth::kCleartextPassword:
+      writer.Start(frontend::kPassword);
+      writer.PutString(password);
+      writer.End();
+      break;
+    case auth::kMd5Password: {
+      const auto salt = reader.ReadBytes(sizeof(std::int32_t));
+      const auto hash = crypto::hash::weak::Md5(password + user);
+      writer.Start(frontend::kPassword);
+      writer.PutString("md5" +
+                       crypto::hash::weak::Md5(hash + std::string{salt}));
+      writer.End();
+      break;
+    }
+    case auth::kSasl: {
+      bool has_scram = false;
+      for (auto mechanism = reader.ReadString(); !mechanism.empty();
+           mechanism = reader.ReadString()) {
+        if (mechanism == ScramSha256Client::kMechanism) has_scram = true;
+      }
+      if (!has_scram) {
+        throw ConnectionFailed{dsn,
+                               "none of the server's SASL authentication "
+                               "mechanisms are supported"};
+      }
+      scram.emplace(password);
+      const auto client_first = scram->MakeClientFirstMessage();
+      writer.Start(frontend::kPassword);
+      writer.PutString(ScramSha256Client::kMechanism);
+      writer.PutInt32(static_cast<std::int32_t>(client_first.size()));
+      writer.PutBytes(client_first);
+      writer.End();
+      break;
+    }
+    case auth::kSaslContinue: {
+      if (!scram) throw ConnectionError{"unexpected SASL continuation"};
+      const auto client_final =
+          scram->MakeClientFinalMessage(reader.ReadBytes(reader.Remaining()));
+      writer.Start(frontend::kPassword);
+      writer.PutBytes(client_final);
+      writer.End();
+      break;
+    }
+    case auth::kSaslFinal:
+      if (!scram) throw ConnectionError{"unexpected SASL completion"};
+      scram->VerifyServerFinalMessage(reader.ReadBytes(reader.Remaining()));
+      break;
+    default:
+      throw ConnectionFailed{
+          dsn, fmt::format("authentication method {} is not supported", code)};
+  }
+}
+
+BackendMessage NativeConnection::WaitMessage(Deadline deadline) {
+  while (true) {
+    if (auto message = in_buffer_.Peek()) return *message;
+    if (!ReadInput(deadline)) ThrowInterrupted("connecting");
+  }
+}
+
+void NativeConnection::Reset() {
+  socket_ = {};
+  tls_.reset();
+  out_buffer_.clear();
+  in_buffer_ = ReceiveBuffer{};
+  copy_data_size_ = 0;
+  commands_.clear();
+  results_.clear();
+  current_.reset();
+  copy_state_ = CopyState::kNone;
+  is_syncing_pipeline_ = false;
+}
+
+void NativeConnection::EnterPipelineMode() {
+#if LIBPQ_HAS_PIPELINING
+  if (!commands_.empty() || !results_.empty()) {
+    PGNC_LOG_LIMITED_ERROR() << "Failed to enter pipeline connection mode";
+    throw ConnectionError{"Failed to enter pipeline connection mode"};
+  }
+  pipeline_mode_ = true;
+#else
+  UINVARIANT(false, "Pipeline mode is not supported");
+#endif
+}
+
+void NativeConnection::ExitPipelineMode() {
+#if LIBPQ_HAS_PIPELINING
+  if (!commands_.empty() || !results_.empty()) {
+    PGNC_LOG_LIMITED_ERROR() << "Failed to exit pipeline connection mode";
+    throw ConnectionError{"Failed to exit pipeline connection mode"};
+  }
+  pipeline_mode_ = false;
+#else
+  UINVARIANT(false, "Pipeline mode is not supported");
+#endif
+}
+
+engine::Task NativeConnection::Close(SizeGuard&& size_guard, bool is_broken) {
+  auto socket = std::exchange(socket_, {});
+  auto tls = std::exchange(tls_, std::nullopt);
+  Reset();
+
+  // NOLINTNEXTLINE(cppcoreguidelines-slicing)
+  return engine::CriticalAsyncNoSpan(
+      bg_task_processor_,
+      [socket = std::move(socket), tls = std::move(tls), is_broken,
+       sg = std::move(size_guard)]() mutable {
+        if (is_broken || (!socket && !tls)) return;
+        std::string terminate;
+        MessageWriter writer{terminate};
+        writer.Start(frontend::kTerminate);
+        writer.End();
+        const auto deadline = Deadline::FromDuration(kTerminateTimeout);
+        try {
+          if (tls) {
+            [[maybe_unused]] auto sent =
+                tls->SendAll(terminate.data(), terminate.size(), deadline);
+          } else {
+            [[maybe_unused]] auto sent =
+                socket.SendAll(terminate.data(), terminate.size(), deadline);
+          }
+        } catch (const engine::io::IoException& ex) {
+          LOG_DEBUG() << "Failed to send connection termination: " << ex;
+        }
+      });
+}
+
+engine::Task NativeConnection::Cancel() {
+  if (!IsConnected()) {
+    // NOLINTNEXTLINE(cppcoreguidelines-slicing)
+    return engine::AsyncNoSpan(bg_task_processor_, [] {});
+  }
+  PGNC_LOG_DEBUG() << "Cancel current request";
+  std::string request;
+  MessageWriter writer{request};
+  writer.Start(frontend::kUntyped);
+  writer.PutInt32(kCancelRequestCode);
+  writer.PutInt32(backend_pid_);
+  writer.PutInt32(backend_secret_);
+  writer.End();
+
+  // NOLINTNEXTLINE(cppcoreguidelines-slicing)
+  return engine::AsyncNoSpan(
+      bg_task_processor_, [log_extra = owner_.log_extra_,
+                           address = server_address_,
+                           request = std::move(request)] {
+        // The request is sent over a new connection without TLS, like
+        // PQcancel does
+        const auto deadline = Deadline::FromDuration(kCancelTimeout);
+        try {
+          engine::io::Socket socket{address.Domain(),
+                                    engine::io::SocketType::kStream};
+          socket.Connect(address, deadline);
+          [[maybe_unused]] auto sent =
+              socket.SendAll(request.data(), request.size(), deadline);
+          // The server closes the connection after processing the request
+          char eof = 0;
+          [[maybe_unused]] auto received = socket.RecvSome(&eof, 1, deadline);
+        } catch (const std::exception& ex) {
+          LOG_LIMITED_WARNING()
+              << log_extra << "Failed to cancel current request: " << ex;
+        }
+      });
+}
+
+void NativeConnection::AddCommand(CommandType type) {
+  commands_.push_back({type});
+  if (!pipeline_mode_) WriteSync();
+}
+
+void NativeConnection::WriteParse(const std::string& name,
+                                  const std::string& statement,
+                                  const Oid* param_types,
+                                  std::size_t param_count) {
+  MessageWriter writer{out_buffer_};
+  writer.Start(frontend::kParse);
+  writer.PutString(name);
+  writer.PutString(statement);
+  writer.PutInt16(static_cast<std::int16_t>(param_count));
+  for (std::size_t i = 0; i < param_count; ++i) {
+    writer.PutInt32(static_cast<std::int32_t>(param_types[i]));
+  }
+  writer.End();
+}
+
+void NativeConnection::WriteBind(const std::string& portal_name,
+                                 const std::string& statement_name,
+                                 const QueryParameters* params) {
+  const std::size_t count = params ? params->Size() : 0;
+  MessageWriter writer{out_buffer_};
+  writer.Start(frontend::kBind);
+  writer.PutString(portal_name);
+  writer.PutString(statement_name);
+  writer.PutInt16(static_cast<std::int16_t>(count));
+  for (std::size_t i = 0; i < count; ++i) {
+    writer.PutInt16(static_cast<std::int16_t>(params->ParamFormatsBuffer()[i]));
+  }
+  writer.PutInt16(static_cast<std::int16_t>(count));
+  for (std::size_t i = 0; i < count; ++i) {
+    const char* value = params->ParamBuffers()[i];
+    if (!value) {
+      writer.PutInt32(-1);
+      continue;
+    }
+    const std::size_t length =
+        params->ParamFormatsBuffer()[i] == io::kPgBinaryDataFormat
+            ? params->ParamLengthsBuffer()[i]
+            : std::strlen(value);
+    writer.PutInt32(static_cast<std::int32_t>(length));
+    writer.PutBytes({value, length});
+  }
+  // All the result columns are in binary format
+  writer.PutInt16(1);
+  writer.PutInt16(io::kPgBinaryDataFormat);
+  writer.End();
+}
+
+void NativeConnection::WriteDescribe(char kind, const std::string& name) {
+  MessageWriter writer{out_buffer_};
+  writer.Start(frontend::kDescribe);
+  writer.PutByte(kind);
+  writer.PutString(name);
+  writer.End();
+}
+
+void NativeConnection::WriteExecute(const std::string& portal_name,
+                                    std::uint32_t n_rows) {
+  MessageWriter writer{out_buffer_};
+  writer.Start(frontend::kExecute);
+  writer.PutString(portal_name);
+  writer.PutInt32(static_cast<std::int32_t>(n_rows));
+  writer.End();
+}
+
+void NativeConnection::WriteSync() {
+  MessageWriter writer{out_buffer_};
+  writer.Start(frontend::kSync);
+  writer.End();
+  commands_.push_back({CommandType::kSync});
+}
+
+void NativeConnection::SendQuery(const std::string& statement,
+                                 const QueryParameters* params,
+                                 tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqSendQueryParams);
+  static const std::string kUnnamed;
+  if (params && !params->Empty()) {
+    WriteParse(kUnnamed, statement, params->ParamTypesBuffer(), params->Size());
+  } else {
+    WriteParse(kUnnamed, statement, nullptr, 0);
+  }
+  WriteBind(kUnnamed, kUnnamed, params);
+  WriteDescribe('P', kUnnamed);
+  WriteExecute(kUnnamed, 0);
+  AddCommand(CommandType::kExecute);
+  owner_.UpdateLastUse();
+}
+
+void NativeConnection::SendPrepare(const std::string& name,
+                                   const std::string& statement,
+                                   const Oid* param_types,
+                                   std::size_t param_count,
+                                   tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqSendPrepare);
+  WriteParse(name, statement, param_types, param_count);
+  AddCommand(CommandType::kPrepare);
+  owner_.UpdateLastUse();
+}
+
+void NativeConnection::SendDescribePrepared(const std::string& name,
+                                            tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqSendDescribePrepared);
+  WriteDescribe('S', name);
+  AddCommand(CommandType::kDescribe);
+  owner_.UpdateLastUse();
+}
+
+void NativeConnection::SendPreparedQuery(const std::string& name,
+                                         const QueryParameters& params,
+                                         tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqSendQueryPrepared);
+  static const std::string kUnnamed;
+  WriteBind(kUnnamed, name, &params);
+  WriteDescribe('P', kUnnamed);
+  WriteExecute(kUnnamed, 0);
+  AddCommand(CommandType::kExecute);
+  owner_.UpdateLastUse();
+}
+
+void NativeConnection::SendPortalBind(const std::string& statement_name,
+                                      const std::string& portal_name,
+                                      const QueryParameters& params,
+                                      tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kPqSendPortalBind);
+  if (transaction_status_ != 'T') {
+    throw CommandError{"a transaction is needed for a portal to work"};
+  }
+  WriteBind(portal_name, statement_name, &params);
+  AddCommand(CommandType::kBind);
+  owner_.UpdateLastUse();
+}
+
+void NativeConnection::SendPortalExecute(const std::string& portal_name,
+                                         std::uint32_t n_rows,
+                                         tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kPqSendPortalExecute);
+  WriteDescribe('P', portal_name);
+  WriteExecute(portal_name, n_rows);
+  AddCommand(CommandType::kExecute);
+  owner_.UpdateLastUse();
+}
+
+void NativeConnection::SetSingleRowMode() {
+  // The Sync of the query is queued after it outside of pipeline mode
+  const auto query = std::find_if(
+      commands_.rbegin(), commands_.rend(),
+      [](const auto& command) { return command.type != CommandType::kSync; });
+  if (query == commands_.rend() || query->type != CommandType::kExecute) {
+    PGNC_LOG_LIMITED_ERROR() << "Failed to switch to single-row mode";
+    throw CommandError{"Failed to switch to single-row mode"};
+  }
+  query->single_row = true;
+}
+
+void NativeConnection::Flush(Deadline deadline) {
+#if LIBPQ_HAS_PIPELINING
+  if (pipeline_mode_) {
+    WriteSync();
+    is_syncing_pipeline_ = true;
+  }
+#endif
+  SendOutput(deadline);
+}
+
+void NativeConnection::SendOutput(Deadline deadline) {
+  if (out_buffer_.empty()) return;
+  if (!IsConnected()) throw CommandError{"Connection is closed"};
+
+  std::size_t sent = 0;
+  try {
+    sent = tls_ ? tls_->SendAll(out_buffer_.data(), out_buffer_.size(),
+                                deadline)
+                : socket_.SendAll(out_buffer_.data(), out_buffer_.size(),
+                                  deadline);
+  } catch (const engine::io::IoInterrupted& ex) {
+    // The rest of the data is sent on the next flush
+    out_buffer_.erase(0, ex.BytesTransferred());
+    if (engine::current_task::ShouldCancel()) {
+      throw ConnectionInterrupted("Task cancelled while flushing connection");
+    }
+    PGNC_LOG_LIMITED_WARNING()
+        << "Timeout while flushing PostgreSQL connection socket";
+    throw ConnectionTimeoutError("Timed out while flushing connection");
+  } catch (const engine::io::IoException& ex) {
+    CloseWithError(ConnectionError{
+        fmt::format("Failed to send data to the server: {}", ex.what())});
+  }
+  if (sent != out_buffer_.size()) {
+    CloseWithError(ConnectionError{"Server closed the connection"});
+  }
+  out_buffer_.clear();
+  owner_.UpdateLastUse();
+}
+
+bool NativeConnection::ReadInput(Deadline deadline) {
+  if (!IsConnected()) throw CommandError{"Connection is closed"};
+
+  const auto [data, size] = in_buffer_.PrepareRead();
+  std::size_t received = 0;
+  try {
+    received = tls_ ? tls_->RecvSome(data, size, deadline)
+                    : socket_.RecvSome(data, size, deadline);
+  } catch (const engine::io::IoInterrupted&) {
+    return false;
+  } catch (const engine::io::IoException& ex) {
+    CloseWithError(ConnectionError{
+        fmt::format("Failed to receive data from the server: {}", ex.what())});
+  }
+  if (received == 0) {
+    CloseWithError(
+        ConnectionError{"Server closed the connection unexpectedly"});
+  }
+  in_buffer_.CommitRead(received);
+  owner_.UpdateLastUse();
+  return true;
+}
+
+void NativeConnection::ThrowInterrupted(std::string_view action) {
+  if (engine::current_task::ShouldCancel()) {
+    throw ConnectionInterrupted(fmt::format("Task cancelled while {}", action));
+  }
+  PGNC_LOG_LIMITED_WARNING() << "Timeout while " << action
+                             << " on PostgreSQL connection socket";
+  throw ConnectionTimeoutError(fmt::format("Timed out while {}", action));
+}
+
+void NativeConnection::ProcessInput() {
+  if (copy_data_size_) {
+    in_buffer_.Consume(std::exchange(copy_data_size_, 0));
+  }
+  // Like libpq, parsing stops when a result is ready, so that the rows of the
+  // next results stay unparsed in the buffer in single-row mode
+  while (results_.empty()) {
+    const auto message = in_buffer_.Peek();
+    if (!message) break;
+    HandleMessage(*message);
+    in_buffer_.Consume(message->size);
+  }
+}
+
+void NativeConnection::HandleMessage(const BackendMessage& message) {
+  switch (message.type) {
+    case backend::kNotificationResponse:
+      HandleNotification(message.payload);
+      return;
+    case backend::kNoticeResponse:
+      LogNotice(message.payload);
+      return;
+    case backend::kParameterStatus:
+      HandleParameterStatus(message.payload);
+      return;
+    default:
+      break;
+  }
+
+  if (commands_.empty()) {
+    if (message.type == backend::kErrorResponse) {
+      // The server reports the reason before closing the connection
+      LogNotice(message.payload);
+    } else {
+      PGNC_LOG_LIMITED_WARNING()
+          << "Message type '" << message.type
+          << "' arrived from the server while idle";
+    }
+    return;
+  }
+
+  const auto& command = commands_.front();
+  switch (message.type) {
+    case backend::kParseComplete:
+      if (command.type == CommandType::kPrepare) {
+        CompleteCommand(std::make_unique<NativeResult>(PGRES_COMMAND_OK));
+      }
+      break;
+    case backend::kBindComplete:
+      if (command.type == CommandType::kBind) CompleteCommand(nullptr);
+      break;
+    case backend::kCloseComplete:
+    case backend::kParameterDescription:
+      break;
+    case backend::kRowDescription: {
+      auto fields = NativeResult::ParseRowDescription(message.payload);
+      if (command.type == CommandType::kDescribe) {
+        CompleteCommand(std::make_unique<NativeResult>(PGRES_COMMAND_OK,
+                                                       std::move(fields)));
+      } else {
+        current_ =
+            std::make_unique<NativeResult>(PGRES_TUPLES_OK, std::move(fields));
+      }
+      break;
+    }
+    case backend::kNoData:
+      if (command.type == CommandType::kDescribe) {
+        CompleteCommand(std::make_unique<NativeResult>(PGRES_COMMAND_OK));
+      }
+      break;
+    case backend::kDataRow:
+      if (!current_ || current_->GetStatus() != PGRES_TUPLES_OK) {
+        CloseWithError(ConnectionError{
+            "Server sent data without prior row description"});
+      }
+      if (command.single_row) {
+        auto row = std::make_unique<NativeResult>(PGRES_SINGLE_TUPLE,
+                                                  current_->GetFields());
+        row->AddRow(message.payload);
+        results_.push_back(std::move(row));
+      } else {
+        current_->AddRow(message.payload);
+      }
+      break;
+    case backend::kCommandComplete: {
+      auto result = current_ ? std::move(current_)
+                             : std::make_unique<NativeResult>(PGRES_COMMAND_OK);
+      MessageReader reader{message.payload};
+      result->SetCommandStatus(reader.ReadString());
+      CompleteCommand(std::move(result));
+      break;
+    }
+    case backend::kPortalSuspended:
+      CompleteCommand(current_
+                          ? std::move(current_)
+                          : std::make_unique<NativeResult>(PGRES_COMMAND_OK));
+      break;
+    case backend::kEmptyQueryResponse:
+      current_.reset();
+      CompleteCommand(std::make_unique<NativeResult>(PGRES_EMPTY_QUERY));
+      break;
+    case backend::kErrorResponse:
+      HandleError(message.payload);
+      break;
+    case backend::kReadyForQuery:
+      HandleReadyForQuery(message.payload);
+      break;
+    case backend::kCopyInResponse:
+      copy_state_ = CopyState::kCopyIn;
+      results_.push_back(std::make_unique<NativeResult>(PGRES_COPY_IN));
+      break;
+    case backend::kCopyOutResponse:
+      copy_state_ = CopyState::kCopyOut;
+      results_.push_back(std::make_unique<NativeResult>(PGRES_COPY_OUT));
+      break;
+    case backend::kCopyBothResponse:
+      results_.push_back(std::make_unique<NativeResult>(PGRES_COPY_BOTH));
+      break;
+    case backend::kCopyData:
+      // The application left the COPY OUT state early
+      break;
+    case backend::kCopyDone:
+      copy_state_ = CopyState::kNone;
+      break;
+    default:
+      CloseWithError(ConnectionError{fmt::format(
+          "Unexpected response from the server, message type '{}'",
+          message.type)});
+  }
+}
+
+void NativeConnection::CompleteCommand(ResultPtr result) {
+  if (result) results_.push_back(std::move(result));
+  if (pipeline_mode_) results_.push_back(nullptr);
+  commands_.pop_front();
+}
+
+void NativeConnection::HandleError(std::string_view payload) {
+  auto error = std::make_unique<NativeResult>(PGRES_FATAL_ERROR);
+  error->SetMessageFields(payload);
+  current_.reset();
+  if (copy_state_ == CopyState::kCopyIn) {
+    // The Sync sent with the query was ignored in COPY IN state, the server
+    // now skips the messages until the next Sync
+    MessageWriter writer{out_buffer_};
+    writer.Start(frontend::kSync);
+    writer.End();
+  }
+  copy_state_ = CopyState::kNone;
+
+  if (commands_.front().type == CommandType::kSync) {
+    results_.push_back(std::move(error));
+    if (pipeline_mode_) results_.push_back(nullptr);
+    return;
+  }
+  CompleteCommand(std::move(error));
+  // The server skips the rest of the commands until the Sync
+  while (!commands_.empty() && commands_.front().type != CommandType::kSync) {
+#if LIBPQ_HAS_PIPELINING
+    if (pipeline_mode_) {
+      results_.push_back(
+          std::make_unique<NativeResult>(PGRES_PIPELINE_ABORTED));
+      results_.push_back(nullptr);
+    }
+#endif
+    commands_.pop_front();
+  }
+}
+
+void NativeConnection::HandleReadyForQuery(std::string_view payload) {
+  MessageReader reader{payload};
+  transaction_status_ = reader.ReadByte();
+  if (commands_.front().type != CommandType::kSync) {
+    CloseWithError(ConnectionError{
+        "Unexpected end of the command results from the server"});
+  }
+  commands_.pop_front();
+#if LIBPQ_HAS_PIPELINING
+  if (pipeline_mode_) {
+    results_.push_back(std::make_unique<NativeResult>(PGRES_PIPELINE_SYNC));
+    return;
+  }
+#endif
+  results_.push_back(nullptr);
+}
+
+void NativeConnection::HandleNotification(std::string_view payload) {
+  MessageReader reader{payload};
+  reader.ReadInt32();  // the pid of the notifying backend
+  Notification notification{std::string{reader.ReadString()}, std::nullopt};
+  const auto extra = reader.ReadString();
+  if (!extra.empty()) notification.payload.emplace(extra);
+  notifications_.push_back(std::move(notification));
+}
+
+void NativeConnection::HandleParameterStatus(std::string_view payload) {
+  MessageReader reader{payload};
+  const auto name = reader.ReadString();
+  parameters_[std::string{name}] = std::string{reader.ReadString()};
+}
+
+void NativeConnection::LogNotice(std::string_view payload) const {
+  NativeResult notice{PGRES_NONFATAL_ERROR};
+  notice.SetMessageFields(payload);
+  const auto severity =
+      Message::SeverityFromString(notice.GetMachineReadableSeverity());
+
+  logging::Level lvl = logging::Level::kInfo;
+  if (severity >= Message::Severity::kError) {
+    lvl = logging::Level::kError;
+  } else if (severity == Message::Severity::kWarning) {
+    lvl = logging::Level::kWarning;
+  } else if (severity < Message::Severity::kInfo) {
+    lvl = logging::Level::kDebug;
+  }
+  PGNC_LOG(lvl) << notice.GetErrorMessage();
+}
+
+bool NativeConnection::TryConsumeInput(Deadline deadline) {
+  SendOutput(deadline);
+  ProcessInput();
+  while (IsBusy()) {
+    if (!ReadInput(deadline)) return false;
+    ProcessInput();
+  }
+  return true;
+}
+
+void NativeConnection::ConsumeInput(Deadline deadline) {
+  if (!TryConsumeInput(deadline)) ThrowInterrupted("consuming input");
+}
+
+NativeConnection::ResultPtr NativeConnection::GetResult(Deadline deadline) {
+  ConsumeInput(deadline);
+  if (results_.empty()) return nullptr;
+  auto result = std::move(results_.front());
+  results_.pop_front();
+  return result;
+}
+
+ResultSet NativeConnection::WaitResult(Deadline deadline,
+                                       tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  ResultPtr result;
+  do {
+    while (auto next = GetResult(deadline)) {
+      if (result && !is_syncing_pipeline_) {
+        PGNC_LOG_LIMITED_INFO()
+            << "Query returned several result sets, a result set is discarded";
+      }
+#if LIBPQ_HAS_PIPELINING
+      if (is_syncing_pipeline_) {
+        switch (next->GetStatus()) {
+          case PGRES_PIPELINE_SYNC:
+            is_syncing_pipeline_ = false;
+            [[fallthrough]];
+          case PGRES_PIPELINE_ABORTED:
+            continue;
+          default:
+            break;
+        }
+      }
+#endif
+      result = std::move(next);
+    }
+  } while (is_syncing_pipeline_);
+  return owner_.MakeResult(std::move(result));
+}
+
+std::vector<std::variant<ResultSet, std::exception_ptr>>
+NativeConnection::WaitPipelineResults(std::size_t count, Deadline deadline,
+                                      tracing::ScopeTime& scope) {
+#if LIBPQ_HAS_PIPELINING
+  UASSERT(pipeline_mode_);
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  // Results of each query are followed by a null result, the pipeline ends
+  // with a PIPELINE_SYNC result
+  std::vector<ResultPtr> query_results;
+  ResultPtr result;
+  while (is_syncing_pipeline_) {
+    auto next = GetResult(deadline);
+    if (!next) {
+      if (!result) {
+        CloseWithError(
+            ConnectionError{"Unexpected end of results in a pipeline"});
+      }
+      query_results.push_back(std::move(result));
+      continue;
+    }
+    if (next->GetStatus() == PGRES_PIPELINE_SYNC) {
+      is_syncing_pipeline_ = false;
+      break;
+    }
+    if (result) {
+      PGNC_LOG_LIMITED_INFO()
+          << "Query returned several result sets, a result set is discarded";
+    }
+    result = std::move(next);
+  }
+  if (query_results.size() < count) {
+    CloseWithError(ConnectionError{"Missing results of pipelined queries"});
+  }
+
+  const auto first = query_results.size() - count;
+  for (std::size_t i = 0; i < first; ++i) {
+    // Queries sent before the batch, e.g. BEGIN, report their errors as usual
+    if (query_results[i]->GetStatus() != PGRES_PIPELINE_ABORTED) {
+      owner_.MakeResult(std::move(query_results[i]));
+    }
+  }
+  std::vector<std::variant<ResultSet, std::exception_ptr>> results;
+  results.reserve(count);
+  for (std::size_t i = first; i < query_results.size(); ++i) {
+    if (query_results[i]->GetStatus() == PGRES_PIPELINE_ABORTED) {
+      results.emplace_back(std::make_exception_ptr(BatchStatementSkipped{}));
+      continue;
+    }
+    try {
+      results.emplace_back(owner_.MakeResult(std::move(query_results[i])));
+    } catch (const ServerLogicError&) {
+      results.emplace_back(std::current_exception());
+    } catch (const ServerRuntimeError&) {
+      results.emplace_back(std::current_exception());
+    }
+  }
+  return results;
+#else
+  UINVARIANT(false, "Pipeline mode is not supported");
+  return {};
+#endif
+}
+
+ResultSet NativeConnection::WaitSingleRowResult(Deadline deadline) {
+  Flush(deadline);
+  auto result = GetResult(deadline);
+  if (result && result->GetStatus() == PGRES_SINGLE_TUPLE) {
+    // MakeResult rejects single-row results of queries not in single-row mode
+    return ResultSet{std::make_shared<ResultWrapper>(std::move(result))};
+  }
+  // This is the final result of the query, consume the rest of the results
+  // to return the connection to the idle state
+  while (GetResult(deadline)) {
+  }
+  return owner_.MakeResult(std::move(result));
+}
+
+void NativeConnection::WaitCopyStart(Deadline deadline,
+                                     tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqWaitCopyStart);
+  Flush(deadline);
+  auto result = GetResult(deadline);
+  const auto status = result ? result->GetStatus() : PGRES_FATAL_ERROR;
+  if (status == PGRES_COPY_IN || status == PGRES_COPY_OUT) return;
+
+  if (status != PGRES_COPY_BOTH) {
+    // The command failed, consume the rest of the results to return the
+    // connection to the idle state before reporting the error
+    while (GetResult(deadline)) {
+    }
+  }
+  owner_.MakeResult(std::move(result));
+  PGNC_LOG_LIMITED_ERROR() << "COPY command did not start copying";
+  CloseWithError(LogicError{"COPY command did not start copying"});
+}
+
+void NativeConnection::PutCopyData(const std::vector<char>& data,
+                                   Deadline deadline) {
+  // An error from the server ends the COPY IN state
+  ProcessInput();
+  if (copy_state_ != CopyState::kCopyIn) {
+    throw CommandError{"PQputCopyData execution error: no COPY in progress"};
+  }
+  MessageWriter writer{out_buffer_};
+  writer.Start(frontend::kCopyData);
+  writer.PutBytes({data.data(), data.size()});
+  writer.End();
+  // Flush every chunk so that the send buffer does not grow beyond a chunk
+  SendOutput(deadline);
+}
+
+void NativeConnection::PutCopyEnd(const char* error, Deadline deadline) {
+  ProcessInput();
+  if (copy_state_ != CopyState::kCopyIn) {
+    throw CommandError{"PQputCopyEnd execution error: no COPY in progress"};
+  }
+  MessageWriter writer{out_buffer_};
+  if (error) {
+    writer.Start(frontend::kCopyFail);
+    writer.PutString(error);
+  } else {
+    writer.Start(frontend::kCopyDone);
+  }
+  writer.End();
+  // The Sync sent with the query was ignored in COPY IN state
+  writer.Start(frontend::kSync);
+  writer.End();
+  copy_state_ = CopyState::kNone;
+  SendOutput(deadline);
+}
+
+std::string_view NativeConnection::GetCopyData(Deadline deadline) {
+  if (copy_data_size_) {
+    in_buffer_.Consume(std::exchange(copy_data_size_, 0));
+  }
+  while (copy_state_ == CopyState::kCopyOut) {
+    const auto message = in_buffer_.Peek();
+    if (!message) {
+      if (!ReadInput(deadline)) ThrowInterrupted("receiving copy data");
+      continue;
+    }
+    if (message->type == backend::kCopyData) {
+      // The data stays in the buffer until the next call
+      copy_data_size_ = message->size;
+      return message->payload;
+    }
+    // CopyDone or an error ends the COPY OUT state
+    HandleMessage(*message);
+    in_buffer_.Consume(message->size);
+    copy_state_ = CopyState::kNone;
+  }
+  return {};
+}
+
+Notification NativeConnection::WaitNotify(Deadline deadline) {
+  while (true) {
+    ProcessInput();
+    if (!notifications_.empty()) {
+      auto notification = std::move(notifications_.front());
+      notifications_.pop_front();
+      owner_.UpdateLastUse();
+      return notification;
+    }
+    if (!ReadInput(deadline)) ThrowInterrupted("waiting for a notification");
+  }
+}
+
+void NativeConnection::DiscardNotifies() { notifications_.clear(); }
+
+std::string NativeConnection::EscapeIdentifier(
+    std::string_view identifier) const {
+  std::string escaped;
+  escaped.reserve(identifier.size() + 2);
+  escaped.push_back('"');
+  for (const char c : identifier) {
+    if (c == '"') escaped.push_back('"');
+    escaped.push_back(c);
+  }
+  escaped.push_back('"');
+  return escaped;
+}
+
+void NativeConnection::DiscardInput(Deadline deadline) {
+  Flush(deadline);
+  do {
+    while (auto result = GetResult(deadline)) {
+#if LIBPQ_HAS_PIPELINING
+      if (is_syncing_pipeline_ &&
+          result->GetStatus() == PGRES_PIPELINE_SYNC) {
+        is_syncing_pipeline_ = false;
+      }
+#endif
+    }
+  } while (is_syncing_pipeline_);
+}
+
+}  // namespace storages::postgres::detail::wire
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <userver/engine/io/sockaddr.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/engine/task/task.hpp>
+
+#include <storages/postgres/detail/pg_connection_wrapper.hpp>
+#include <storages/postgres/detail/wire/messages.hpp>
+#include <storages/postgres/detail/wire/native_result.hpp>
+#include <storages/postgres/detail/wire/scram.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail::wire {
+
+/// @brief PostgreSQL frontend/backend protocol implementation on top of the
+/// engine sockets, used by PGConnectionWrapper instead of libpq when the
+/// native protocol is enabled.
+///
+/// Frontend messages are accumulated in the output buffer and sent in a single
+/// write on Flush. Backend messages are parsed in place in the receive buffer,
+/// the results of the sent commands are queued the same way libpq returns
+/// them, so the methods have the semantics of the PGConnectionWrapper ones.
+class NativeConnection {
+ public:
+  using Deadline = engine::Deadline;
+  using SizeGuard = PGConnectionWrapper::SizeGuard;
+  using Options = std::unordered_map<std::string, std::string>;
+
+  NativeConnection(PGConnectionWrapper& owner,
+                   engine::TaskProcessor& bg_task_processor);
+  ~NativeConnection();
+
+  NativeConnection(const NativeConnection&) = delete;
+  NativeConnection& operator=(const NativeConnection&) = delete;
+
+  ConnectionState GetConnectionState() const;
+  int GetServerVersion() const;
+  std::string_view GetParameterStatus(const char* name) const;
+
+  void Connect(const Dsn& dsn, Deadline deadline, tracing::ScopeTime&);
+
+  void EnterPipelineMode();
+  void ExitPipelineMode();
+  bool IsSyncingPipeline() const { return is_syncing_pipeline_; }
+
+  [[nodiscard]] engine::Task Close(SizeGuard&& size_guard, bool is_broken);
+  [[nodiscard]] engine::Task Cancel();
+
+  void SendQuery(const std::string& statement, const QueryParameters* params,
+                 tracing::ScopeTime&);
+  void SendPrepare(const std::string& name, const std::string& statement,
+                   const Oid* param_types, std::size_t param_count,
+                   tracing::ScopeTime&);
+  void SendDescribePrepared(const std::string& name, tracing::ScopeTime&);
+  void SendPreparedQuery(const std::string& name, const QueryParameters& params,
+                         tracing::ScopeTime&);
+  void SendPortalBind(const std::string& statement_name,
+                      const std::string& portal_name,
+                      const QueryParameters& params, tracing::ScopeTime&);
+  void SendPortalExecute(const std::string& portal_name, std::uint32_t n_rows,
+                         tracing::ScopeTime&);
+
+  ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&);
+  std::vector<std::variant<ResultSet, std::exception_ptr>> WaitPipelineResults(
+      std::size_t count, Deadline deadline, tracing::ScopeTime&);
+
+  void SetSingleRowMode();
+  ResultSet WaitSingleRowResult(Deadline deadline);
+
+  void WaitCopyStart(Deadline deadline, tracing::ScopeTime&);
+  void PutCopyData(const std::vector<char>& data, Deadline deadline);
+  void PutCopyEnd(const char* error, Deadline deadline);
+  std::string_view GetCopyData(Deadline deadline);
+
+  Notification WaitNotify(Deadline deadline);
+  void DiscardNotifies();
+
+  std::string EscapeIdentifier(std::string_view identifier) const;
+
+  void ConsumeInput(Deadline deadline);
+  void DiscardInput(Deadline deadline);
+  bool TryConsumeInput(Deadline deadline);
+
+ private:
+  enum class CommandType {
+    /// Execution of a statement or a portal, the results are the rows
+    kExecute,
+    kPrepare,
+    kDescribe,
+    /// Portal bind, completes without a result
+    kBind,
+    kSync,
+  };
+
+  struct PendingCommand {
+    CommandType type;
+    bool single_row{false};
+  };
+
+  enum class CopyState { kNone, kCopyIn, kCopyOut };
+
+  using ResultPtr = std::unique_ptr<NativeResult>;
+
+  bool IsConnected() const;
+  bool IsBusy() const;
+  /// Drops the socket and the state of the commands in progress
+  void Reset();
+
+  void ConnectHost(const std::string& host, const std::string& hostaddr,
+                   const std::string& port, const Options& options,
+                   Deadline deadline);
+  void StartTls(const std::string& host, std::string_view sslmode,
+                Deadline deadline);
+  void Startup(const Options& options, const Dsn& dsn, Deadline deadline);
+  void Authenticate(std::string_view payload, const std::string& user,
+                    const std::string& password,
+                    std::optional<ScramSha256Client>& scram, const Dsn& dsn);
+  BackendMessage WaitMessage(Deadline deadline);
+
+  void WriteParse(const std::string& name, const std::string& statement,
+                  const Oid* param_types, std::size_t param_count);
+  void WriteBind(const std::string& portal_name,
+                 const std::string& statement_name,
+                 const QueryParameters* params);
+  void WriteDescribe(char kind, const std::string& name);
+  void WriteExecute(const std::string& portal_name, std::uint32_t n_rows);
+  void WriteSync();
+  void AddCommand(CommandType type);
+
+  void Flush(Deadline deadline);
+  void SendOutput(Deadline deadline);
+  /// @return false if was interrupted by the deadline or cancellation
+  [[nodiscard]] bool ReadInput(Deadline deadline);
+  void ProcessInput();
+  void HandleMessage(const BackendMessage& message);
+  void HandleError(std::string_view payload);
+  void HandleReadyForQuery(std::string_view payload);
+  void HandleNotification(std::string_view payload);
+  void HandleParameterStatus(std::string_view payload);
+  void CompleteCommand(ResultPtr result);
+  ResultPtr GetResult(Deadline deadline);
+  void LogNotice(std::string_view payload) const;
+
+  [[noreturn]] void ThrowInterrupted(std::string_view action);
+  template <typename ExceptionType>
+  [[noreturn]] void CloseWithError(ExceptionType&& ex);
+
+  PGConnectionWrapper& owner_;
+  engine::TaskProcessor& bg_task_processor_;
+
+  engine::io::Socket socket_;
+  std::optional<engine::io::TlsWrapper> tls_;
+  engine::io::Sockaddr server_address_;
+  std::int32_t backend_pid_{0};
+  std::int32_t backend_secret_{0};
+  std::unordered_map<std::string, std::string> parameters_;
+  char transaction_status_{'I'};
+
+  std::string out_buffer_;
+  ReceiveBuffer in_buffer_;
+  /// CopyData message returned by GetCopyData is consumed on the next call
+  std::size_t copy_data_size_{0};
+
+  std::deque<PendingCommand> commands_;
+  /// nullptr marks the end of the results of a command, like in libpq
+  std::deque<ResultPtr> results_;
+  /// Result receiving the rows of the command in progress
+  ResultPtr current_;
+  std::deque<Notification> notifications_;
+  CopyState copy_state_{CopyState::kNone};
+  bool pipeline_mode_{false};
+  bool is_syncing_pipeline_{false};
+};
+
+}  // namespace storages::postgres::detail::wire
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,221 @@
+#include <storages/postgres/detail/wire/native_result.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdlib>
+
+#include <fmt/format.h>
+
+#include <storages/postgres/detail/wire/messages.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/assert.hpp>
+
+// Added in 9.6
+#ifndef PG_DIAG_SEVERITY_NONLOCALIZED
+#define PG_DIAG_SEVERITY_NONLOCALIZED 'V'
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail::wire {
+
+namespace {
+
+const std::string kEmptyValue;
+
+// Commands reporting the number of rows in the command tag
+constexpr std::array<std::string_view, 7> kRowCountCommands{
+    "DELETE ", "UPDATE ", "SELECT ", "MOVE ", "FETCH ", "COPY ", "MERGE "};
+constexpr std::string_view kInsertCommand = "INSERT ";
+
+std::string FoldFieldName(std::string_view name) {
+  std::string folded;
+  folded.reserve(name.size());
+  bool in_quotes = false;
+  for (std::size_t i = 0; i < name.size(); ++i) {
+    const char c = name[i];
+    if (c == '"') {
+      if (in_quotes && i + 1 < name.size() && name[i + 1] == '"') {
+        // doubled quote inside quotes is a literal quote
+        folded.push_back(c);
+        ++i;
+      } else {
+        in_quotes = !in_quotes;
+      }
+    } else if (in_quotes) {
+      folded.push_back(c);
+    } else {
+      folded.push_back(
+          static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+    }
+  }
+  return folded;
+}
+
+}  // namespace
+
+NativeResult::NativeResult(ExecStatusType status) : status_{status} {}
+
+NativeResult::NativeResult(ExecStatusType status, FieldDescriptionsPtr fields)
+    : status_{status}, fields_{std::move(fields)} {}
+
+NativeResult::FieldDescriptionsPtr NativeResult::ParseRowDescription(
+    std::string_view payload) {
+  MessageReader reader{payload};
+  const auto count = reader.ReadInt16();
+  if (count < 0) {
+    throw ConnectionError{"Malformed message from the server: negative "
+                          "number of fields in a row description"};
+  }
+  auto fields = std::make_shared<FieldDescriptions>(count);
+  for (auto& field : *fields) {
+    field.name = std::string{reader.ReadString()};
+    field.table_oid = static_cast<Oid>(reader.ReadInt32());
+    field.table_column = reader.ReadInt16();
+    field.type_oid = static_cast<Oid>(reader.ReadInt32());
+    field.type_size = reader.ReadInt16();
+    field.type_modifier = reader.ReadInt32();
+    field.format = reader.ReadInt16();
+  }
+  return fields;
+}
+
+const NativeResult::FieldDescription& NativeResult::GetField(
+    std::size_t col) const {
+  UASSERT(col < FieldCount());
+  return (*fields_)[col];
+}
+
+int NativeResult::IndexOfName(std::string_view name) const {
+  if (!fields_) return -1;
+  const auto folded = FoldFieldName(name);
+  const auto it = std::find_if(
+      fields_->begin(), fields_->end(),
+      [&folded](const auto& field) { return field.name == folded; });
+  if (it == fields_->end()) return -1;
+  return static_cast<int>(it - fields_->begin());
+}
+
+const NativeResult::FieldView& NativeResult::GetFieldView(
+    std::size_t row, std::size_t col) const {
+  UASSERT(row < row_count_ && col < FieldCount());
+  return values_[row * FieldCount() + col];
+}
+
+bool NativeResult::IsNull(std::size_t row, std::size_t col) const {
+  return GetFieldView(row, col).length < 0;
+}
+
+std::size_t NativeResult::GetLength(std::size_t row, std::size_t col) const {
+  const auto length = GetFieldView(row, col).length;
+  return length < 0 ? 0 : length;
+}
+
+const char* NativeResult::GetValue(std::size_t row, std::size_t col) const {
+  const auto& view = GetFieldView(row, col);
+  if (view.length < 0) return kEmptyValue.c_str();
+  return rows_data_.data() + view.offset;
+}
+
+void NativeResult::AddRow(std::string_view payload) {
+  MessageReader reader{payload};
+  const auto count = reader.ReadInt16();
+  if (count < 0 || static_cast<std::size_t>(count) != FieldCount()) {
+    throw ConnectionError{fmt::format(
+        "Malformed message from the server: data row has {} fields while the "
+        "row description has {}",
+        count, FieldCount())};
+  }
+
+  // The row is copied at once, the values are referenced by offsets because
+  // the storage may be reallocated by the next rows
+  const auto row = payload.substr(sizeof(std::int16_t));
+  const auto row_offset = rows_data_.size();
+  rows_data_.insert(rows_data_.end(), row.begin(), row.end());
+  values_.reserve(values_.size() + count);
+  for (std::int16_t i = 0; i < count; ++i) {
+    const auto length = reader.ReadInt32();
+    const auto offset = row_offset + (row.size() - reader.Remaining());
+    if (length > 0) reader.ReadBytes(length);
+    values_.push_back({offset, length});
+  }
+  ++row_count_;
+}
+
+void NativeResult::SetCommandStatus(std::string_view status) {
+  command_status_ = std::string{status};
+}
+
+std::size_t NativeResult::GetAffectedRows() const {
+  std::string_view rows{command_status_};
+  if (rows.substr(0, kInsertCommand.size()) == kInsertCommand) {
+    // INSERT oid rows
+    rows.remove_prefix(kInsertCommand.size());
+    const auto space = rows.find(' ');
+    if (space == std::string_view::npos) return 0;
+    rows.remove_prefix(space + 1);
+  } else {
+    const auto command = std::find_if(
+        kRowCountCommands.begin(), kRowCountCommands.end(),
+        [rows](auto prefix) {
+          return rows.substr(0, prefix.size()) == prefix;
+        });
+    if (command == kRowCountCommands.end()) return 0;
+    rows.remove_prefix(command->size());
+  }
+  const auto value = std::strtoll(std::string{rows}.c_str(), nullptr, 10);
+  return value < 0 ? 0 : value;
+}
+
+void NativeResult::SetMessageFields(std::string_view payload) {
+  MessageReader reader{payload};
+  message_fields_.clear();
+  while (const char code = reader.ReadByte()) {
+    message_fields_.emplace_back(code, std::string{reader.ReadString()});
+  }
+}
+
+const char* NativeResult::GetMessageField(int code) const {
+  for (const auto& [field_code, value] : message_fields_) {
+    if (field_code == code) return value.c_str();
+  }
+  return nullptr;
+}
+
+std::string_view NativeResult::GetMachineReadableSeverity() const {
+  const auto* severity = GetMessageField(PG_DIAG_SEVERITY_NONLOCALIZED);
+  if (!severity) severity = GetMessageField(PG_DIAG_SEVERITY);
+  return severity ? severity : std::string_view{};
+}
+
+std::string NativeResult::GetErrorMessage() const {
+  if (message_fields_.empty()) return {};
+
+  std::string message;
+  const auto* severity = GetMessageField(PG_DIAG_SEVERITY);
+  if (!severity) severity = GetMessageField(PG_DIAG_SEVERITY_NONLOCALIZED);
+  if (severity) {
+    message += severity;
+    message += ":  ";
+  }
+  if (const auto* primary = GetMessageField(PG_DIAG_MESSAGE_PRIMARY)) {
+    message += primary;
+  }
+  message += '\n';
+  if (const auto* detail = GetMessageField(PG_DIAG_MESSAGE_DETAIL)) {
+    message += "DETAIL:  ";
+    message += detail;
+    message += '\n';
+  }
+  if (const auto* hint = GetMessageField(PG_DIAG_MESSAGE_HINT)) {
+    message += "HINT:  ";
+    message += hint;
+    message += '\n';
+  }
+  return message;
+}
+
+}  // namespace storages::postgres::detail::wire
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <libpq-fe.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail::wire {
+
+/// @brief Result of a statement received with the native protocol
+/// implementation, a replacement for PGresult.
+///
+/// A DataRow message is copied into the row storage as a whole and the field
+/// values are referenced by their offsets in it, so there is a single copy and
+/// no allocations per value.
+class NativeResult {
+ public:
+  struct FieldDescription {
+    std::string name;
+    Oid table_oid{InvalidOid};
+    int table_column{0};
+    Oid type_oid{InvalidOid};
+    int type_size{0};
+    int type_modifier{0};
+    int format{0};
+  };
+  using FieldDescriptions = std::vector<FieldDescription>;
+  using FieldDescriptionsPtr = std::shared_ptr<const FieldDescriptions>;
+
+  explicit NativeResult(ExecStatusType status);
+  NativeResult(ExecStatusType status, FieldDescriptionsPtr fields);
+
+  /// @throws ConnectionError if the message is malformed
+  static FieldDescriptionsPtr ParseRowDescription(std::string_view payload);
+
+  ExecStatusType GetStatus() const { return status_; }
+  void SetStatus(ExecStatusType status) { status_ = status; }
+
+  const FieldDescriptionsPtr& GetFields() const { return fields_; }
+
+  std::size_t RowCount() const { return row_count_; }
+  std::size_t FieldCount() const { return fields_ ? fields_->size() : 0; }
+  const FieldDescription& GetField(std::size_t col) const;
+  /// @returns the index of the field with the name or -1, the name is case
+  /// folded unless it is double quoted, like in PQfnumber
+  int IndexOfName(std::string_view name) const;
+
+  bool IsNull(std::size_t row, std::size_t col) const;
+  std::size_t GetLength(std::size_t row, std::size_t col) const;
+  /// @returns the field value or an empty string for a null value
+  const char* GetValue(std::size_t row, std::size_t col) const;
+
+  /// Appends a row from a DataRow message payload
+  /// @throws ConnectionError if the message is malformed
+  void AddRow(std::string_view payload);
+
+  const std::string& GetCommandStatus() const { return command_status_; }
+  void SetCommandStatus(std::string_view status);
+  /// @returns the number of rows affected by the command, like PQcmdTuples
+  std::size_t GetAffectedRows() const;
+
+  /// Sets the fields of an ErrorResponse or NoticeResponse message payload
+  /// @throws ConnectionError if the message is malformed
+  void SetMessageFields(std::string_view payload);
+  /// @returns the message field with the PG_DIAG_* code or nullptr
+  const char* GetMessageField(int code) const;
+  /// @returns nonlocalized severity, plain severity or an empty string, like
+  /// GetMachineReadableSeverity for a PGresult
+  std::string_view GetMachineReadableSeverity() const;
+  /// @returns the message formatted like PQresultErrorMessage does
+  std::string GetErrorMessage() const;
+
+ private:
+  struct FieldView {
+    std::size_t offset;
+    std::int32_t length;
+  };
+
+  const FieldView& GetFieldView(std::size_t row, std::size_t col) const;
+
+  ExecStatusType status_;
+  FieldDescriptionsPtr fields_;
+  std::size_t row_count_{0};
+  std::vector<char> rows_data_;
+  std::vector<FieldView> values_;
+  std::string command_status_;
+  std::vector<std::pair<char, std::string>> message_fields_;
+};
+
+}  // namespace storages::postgres::detail::wire
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,139 @@
+#include <storages/postgres/detail/wire/scram.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+
+#include <fmt/format.h>
+
+#include <userver/crypto/base64.hpp>
+#include <userver/crypto/exception.hpp>
+#include <userver/crypto/hash.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/uuid4.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail::wire {
+
+namespace {
+
+using crypto::hash::OutputEncoding;
+
+// base64 of the "n,," GS2 header: no channel binding
+constexpr std::string_view kChannelBinding = "biws";
+constexpr int kMinIterations = 4096;
+
+[[noreturn]] void ThrowScramError(std::string_view what) {
+  throw ConnectionError{fmt::format("SCRAM authentication failed: {}", what)};
+}
+
+std::string HmacSha256(std::string_view key, std::string_view message) {
+  return crypto::hash::HmacSha256(key, message, OutputEncoding::kBinary);
+}
+
+std::string XorBytes(std::string lhs, std::string_view rhs) {
+  for (std::size_t i = 0; i < lhs.size(); ++i) lhs[i] ^= rhs[i];
+  return lhs;
+}
+
+// PBKDF2 with HMAC-SHA-256, the Hi() function of RFC 5802
+std::string SaltPassword(std::string_view password, std::string_view salt,
+                         int iterations) {
+  std::string block{salt};
+  block.append({'\0', '\0', '\0', '\1'});
+  auto u = HmacSha256(password, block);
+  auto result = u;
+  for (int i = 1; i < iterations; ++i) {
+    u = HmacSha256(password, u);
+    result = XorBytes(std::move(result), u);
+  }
+  return result;
+}
+
+// Returns the value of the `name=` attribute of a SCRAM message
+std::string_view GetAttribute(std::string_view message, char name) {
+  while (!message.empty()) {
+    const auto end = message.find(',');
+    const auto attribute = message.substr(0, end);
+    if (attribute.size() >= 2 && attribute[0] == name && attribute[1] == '=') {
+      return attribute.substr(2);
+    }
+    if (end == std::string_view::npos) break;
+    message.remove_prefix(end + 1);
+  }
+  ThrowScramError(fmt::format("no '{}' attribute in the server message", name));
+}
+
+std::string Base64Decode(std::string_view data) {
+  try {
+    return crypto::base64::Base64Decode(data);
+  } catch (const crypto::CryptoException&) {
+    ThrowScramError("invalid base64 in the server message");
+  }
+}
+
+}  // namespace
+
+ScramSha256Client::ScramSha256Client(std::string password, std::string user,
+                                     std::string client_nonce)
+    : password_{std::move(password)},
+      user_{std::move(user)},
+      client_nonce_{std::move(client_nonce)} {
+  if (client_nonce_.empty()) {
+    client_nonce_ = USERVER_NAMESPACE::utils::generators::GenerateUuid();
+  }
+}
+
+std::string ScramSha256Client::MakeClientFirstMessageBare() const {
+  return fmt::format("n={},r={}", user_, client_nonce_);
+}
+
+std::string ScramSha256Client::MakeClientFirstMessage() const {
+  return "n,," + MakeClientFirstMessageBare();
+}
+
+std::string ScramSha256Client::MakeClientFinalMessage(
+    std::string_view server_first_message) {
+  const auto nonce = GetAttribute(server_first_message, 'r');
+  if (nonce.substr(0, client_nonce_.size()) != client_nonce_ ||
+      nonce.size() == client_nonce_.size()) {
+    ThrowScramError("invalid server nonce");
+  }
+  const auto salt = Base64Decode(GetAttribute(server_first_message, 's'));
+  const auto iterations =
+      std::atoi(std::string{GetAttribute(server_first_message, 'i')}.c_str());
+  if (iterations < kMinIterations) {
+    ThrowScramError(fmt::format("invalid iteration count {}", iterations));
+  }
+
+  salted_password_ = SaltPassword(password_, salt, iterations);
+  const auto client_final_without_proof =
+      fmt::format("c={},r={}", kChannelBinding, nonce);
+  auth_message_ = fmt::format("{},{},{}", MakeClientFirstMessageBare(),
+                              server_first_message, client_final_without_proof);
+
+  const auto client_key = HmacSha256(salted_password_, "Client Key");
+  const auto stored_key =
+      crypto::hash::Sha256(client_key, OutputEncoding::kBinary);
+  const auto client_signature = HmacSha256(stored_key, auth_message_);
+  const auto proof = XorBytes(client_key, client_signature);
+  return fmt::format("{},p={}", client_final_without_proof,
+                     crypto::base64::Base64Encode(proof));
+}
+
+void ScramSha256Client::VerifyServerFinalMessage(
+    std::string_view server_final_message) const {
+  if (server_final_message.substr(0, 2) == "e=") {
+    ThrowScramError(server_final_message.substr(2));
+  }
+  const auto server_key = HmacSha256(salted_password_, "Server Key");
+  const auto expected_signature = HmacSha256(server_key, auth_message_);
+  if (Base64Decode(GetAttribute(server_final_message, 'v')) !=
+      expected_signature) {
+    ThrowScramError("invalid server signature");
+  }
+}
+
+}  // namespace storages::postgres::detail::wire
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail::wire {
+
+/// @brief Client side of the SCRAM-SHA-256 authentication exchange (RFC 5802,
+/// RFC 7677) without channel binding.
+///
+/// PostgreSQL takes the user name from the startup message, so the user name
+/// in the exchange is left empty by default.
+class ScramSha256Client {
+ public:
+  static constexpr std::string_view kMechanism = "SCRAM-SHA-256";
+
+  /// A random nonce is generated if `client_nonce` is empty
+  explicit ScramSha256Client(std::string password, std::string user = {},
+                             std::string client_nonce = {});
+
+  std::string MakeClientFirstMessage() const;
+
+  /// @returns the client-final-message for the server-first-message
+  /// @throws ConnectionError if the server message is malformed
+  std::string MakeClientFinalMessage(std::string_view server_first_message);
+
+  /// @throws ConnectionError if the server signature does not match
+  void VerifyServerFinalMessage(std::string_view server_final_message) const;
+
+ private:
+  std::string MakeClientFirstMessageBare() const;
+
+  std::string password_;
+  std::string user_;
+  std::string client_nonce_;
+  std::string salted_password_;
+  std::string auth_message_;
+};
+
+}  // namespace storages::postgres::detail::wire
+
+USERVER_NAMESPACE_END
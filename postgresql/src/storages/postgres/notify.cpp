@@ -0,0 +1,46 @@
+#include <userver/storages/postgres/notify.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+NotifyScope::NotifyScope(detail::ConnectionPtr&& conn,
+                         std::string_view channel,
+                         OptionalCommandControl cmd_ctl)
+    : conn_{std::move(conn)}, channel_{channel}, cmd_ctl_{cmd_ctl} {
+  conn_->Start(detail::SteadyClock::now());
+  try {
+    conn_->Listen(channel_, cmd_ctl_);
+  } catch (const std::exception&) {
+    conn_->Finish();
+    throw;
+  }
+}
+
+NotifyScope::NotifyScope(NotifyScope&&) noexcept = default;
+
+NotifyScope& NotifyScope::operator=(NotifyScope&&) noexcept = default;
+
+NotifyScope::~NotifyScope() {
+  if (!conn_) return;
+  try {
+    conn_->Unlisten(channel_, cmd_ctl_);
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to unsubscribe from notification channel '"
+                          << channel_ << "', the connection is dropped: " << e;
+    conn_->MarkAsBroken();
+  }
+  conn_->Finish();
+}
+
+Notification NotifyScope::WaitNotify(engine::Deadline deadline) {
+  return conn_->WaitNotify(deadline);
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
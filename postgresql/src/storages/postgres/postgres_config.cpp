@@ -48,6 +48,8 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
       config["max_pool_size"].template As<size_t>(result.max_size);
   result.max_queue_size =
       config["max_queue_size"].template As<size_t>(result.max_queue_size);
+  result.thread_stash_size = config["thread_stash_size"].template As<size_t>(
+      result.thread_stash_size);
 
   if (result.max_size == 0)
     throw InvalidConfig{"max_pool_size must be greater than 0"};
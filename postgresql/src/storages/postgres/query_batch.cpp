@@ -0,0 +1,60 @@
+#include <userver/storages/postgres/query_batch.hpp>
+
+#include <string>
+
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+QueryBatch& QueryBatch::Add(const Query& query, ParameterStore&& params) {
+  statements_.push_back({query, std::move(params)});
+  return *this;
+}
+
+bool QueryBatchResult::HasError(std::size_t index) const {
+  return !!At(index).error;
+}
+
+std::exception_ptr QueryBatchResult::GetError(std::size_t index) const {
+  return At(index).error;
+}
+
+const ResultSet& QueryBatchResult::Get(std::size_t index) const {
+  const auto& statement_result = At(index);
+  if (statement_result.error) {
+    std::rethrow_exception(statement_result.error);
+  }
+  return statement_result.result;
+}
+
+void QueryBatchResult::ThrowIfError() const {
+  for (const auto& statement_result : results_) {
+    if (statement_result.error) {
+      std::rethrow_exception(statement_result.error);
+    }
+  }
+}
+
+void QueryBatchResult::Add(ResultSet&& result) {
+  results_.push_back({std::move(result), nullptr});
+}
+
+void QueryBatchResult::Add(std::exception_ptr error) {
+  results_.push_back({ResultSet{nullptr}, std::move(error)});
+}
+
+const QueryBatchResult::StatementResult& QueryBatchResult::At(
+    std::size_t index) const {
+  if (index >= results_.size()) {
+    throw LogicError("Statement index " + std::to_string(index) +
+                     " is out of bounds of the batch of size " +
+                     std::to_string(results_.size()));
+  }
+  return results_[index];
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -249,6 +249,20 @@ void ResultSet::SetBufferCategoriesFrom(const ResultSet& dsc) {
   pimpl_->SetTypeBufferCategories(dsc.pimpl_->GetTypeBufferCategories());
 }
 
+void ResultSet::FillColumnBuffers(size_type field_index, size_type first_row,
+                                  size_type rows_count,
+                                  std::vector<io::FieldBuffer>& buffers) const {
+  if (field_index >= FieldCount()) throw FieldIndexOutOfBounds{field_index};
+  if (first_row + rows_count > Size()) {
+    throw RowIndexOutOfBounds{first_row + rows_count};
+  }
+  pimpl_->FillColumnBuffers(field_index, first_row, rows_count, buffers);
+}
+
+const io::TypeBufferCategory& ResultSet::GetTypeBufferCategories() const {
+  return pimpl_->GetTypeBufferCategories();
+}
+
 Row::size_type Row::IndexOfName(const std::string& name) const {
   return res_->IndexOfName(name);
 }
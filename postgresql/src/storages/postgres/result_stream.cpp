@@ -0,0 +1,101 @@
+#include <userver/storages/postgres/result_stream.hpp>
+
+#include <utility>
+
+#include <storages/postgres/detail/connection.hpp>
+
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+ResultStream::ResultStream(detail::Connection* conn, const Query& query,
+                           const detail::QueryParameters& params,
+                           OptionalCommandControl cmd_ctl)
+    : owned_conn_{nullptr}, conn_{conn} {
+  UASSERT(conn_);
+  if (!cmd_ctl) {
+    cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+  }
+  conn_->StartResultStream(query, params, std::move(cmd_ctl));
+}
+
+ResultStream::ResultStream(detail::ConnectionPtr&& conn, const Query& query,
+                           const detail::QueryParameters& params,
+                           OptionalCommandControl cmd_ctl)
+    : owned_conn_{std::move(conn)}, conn_{owned_conn_.get()} {
+  UASSERT(conn_);
+  try {
+    conn_->StartResultStream(query, params, std::move(cmd_ctl));
+  } catch (const std::exception&) {
+    conn_->Finish();
+    throw;
+  }
+}
+
+ResultStream::ResultStream(ResultStream&& other) noexcept
+    : owned_conn_{std::move(other.owned_conn_)},
+      conn_{std::exchange(other.conn_, nullptr)},
+      rows_read_{other.rows_read_},
+      done_{other.done_} {}
+
+ResultStream& ResultStream::operator=(ResultStream&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    owned_conn_ = std::move(other.owned_conn_);
+    conn_ = std::exchange(other.conn_, nullptr);
+    rows_read_ = other.rows_read_;
+    done_ = other.done_;
+  }
+  return *this;
+}
+
+ResultStream::~ResultStream() { Reset(); }
+
+std::optional<Row> ResultStream::Next() {
+  if (done_) return std::nullopt;
+  UASSERT(conn_);
+
+  ResultSet res{nullptr};
+  try {
+    res = conn_->FetchResultStreamRow();
+  } catch (const std::exception&) {
+    // A stream is finished by the connection on a server error, timeouts
+    // leave the rest of the rows to Finish
+    done_ = !conn_->IsResultStreamActive();
+    throw;
+  }
+  if (res.IsEmpty()) {
+    done_ = true;
+    return std::nullopt;
+  }
+  ++rows_read_;
+  return res.Front();
+}
+
+void ResultStream::Finish() {
+  if (done_) return;
+  done_ = true;
+  UASSERT(conn_);
+  conn_->FinishResultStream();
+}
+
+void ResultStream::Reset() noexcept {
+  if (!conn_) return;
+  try {
+    Finish();
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to finish result stream after "
+                          << rows_read_ << " rows: " << e;
+  }
+  if (owned_conn_) {
+    conn_->Finish();
+    owned_conn_ = detail::ConnectionPtr{nullptr};
+  }
+  conn_ = nullptr;
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
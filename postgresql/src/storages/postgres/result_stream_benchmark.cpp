@@ -0,0 +1,146 @@
+#include <benchmark/benchmark.h>
+
+#include <malloc.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/io/string_types.hpp>
+#include <userver/storages/postgres/result_stream.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+// Defined only if jemalloc is linked in
+extern "C" int mallctl(const char*, void*, std::size_t*, void*, std::size_t)
+    __attribute__((weak));
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+using Row = std::tuple<int, std::string>;
+
+const pg::OptionalCommandControl kBulkCmdCtl{
+    pg::CommandControl{std::chrono::seconds{10}, std::chrono::seconds{10}}};
+
+constexpr const char* kSelect =
+    "select i, repeat('a', 100) from generate_series(1, $1) as i";
+
+// Bytes allocated by malloc and not freed yet, including the memory of libpq
+// results. Uses jemalloc statistics if it is linked in, glibc otherwise.
+std::int64_t GetAllocatedBytes() {
+  if (mallctl) {
+    std::uint64_t epoch = 1;
+    std::size_t size = sizeof(epoch);
+    mallctl("epoch", &epoch, &size, &epoch, size);
+
+    std::size_t allocated = 0;
+    size = sizeof(allocated);
+    if (mallctl("stats.allocated", &allocated, &size, nullptr, 0) == 0) {
+      return allocated;
+    }
+    return 0;
+  }
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+  const auto info = ::mallinfo2();
+  return info.uordblks + info.hblkhd;
+#else
+  return 0;
+#endif
+}
+
+// Tracks the growth of allocated memory relative to the construction moment.
+// Sampling is too slow for the timed loop, so the memory is measured in
+// a separate pass.
+class MemoryUsage {
+ public:
+  MemoryUsage() : baseline_{GetAllocatedBytes()} {}
+
+  void Sample() { peak_ = std::max(peak_, GetAllocatedBytes() - baseline_); }
+
+  // `retained_bytes` is the memory held when all the rows are processed and
+  // the result is still alive, `peak_bytes` is the maximum observed
+  void Report(benchmark::State& state) {
+    Sample();
+    state.counters["retained_bytes"] = GetAllocatedBytes() - baseline_;
+    state.counters["peak_bytes"] = peak_;
+  }
+
+ private:
+  const std::int64_t baseline_;
+  std::int64_t peak_{0};
+};
+
+// The whole result set is received and kept in memory before the rows are
+// processed
+BENCHMARK_DEFINE_F(PgConnection, SelectResultSet)(benchmark::State& state) {
+  if (!IsConnectionValid()) {
+    state.SkipWithError("Database not connected");
+    return;
+  }
+  engine::RunStandalone([this, &state] {
+    const int rows_count = state.range(0);
+    for (auto _ : state) {
+      auto res = conn_->Execute(kBulkCmdCtl.value(), kSelect, rows_count);
+      std::size_t total_size = 0;
+      for (const auto& [id, name] : res.AsSetOf<Row>(pg::kRowTag)) {
+        total_size += name.size();
+      }
+      benchmark::DoNotOptimize(total_size);
+    }
+    state.SetItemsProcessed(state.iterations() * rows_count);
+
+    MemoryUsage memory;
+    auto res = conn_->Execute(kBulkCmdCtl.value(), kSelect, rows_count);
+    for (const auto& [id, name] : res.AsSetOf<Row>(pg::kRowTag)) {
+      benchmark::DoNotOptimize(name);
+      memory.Sample();
+    }
+    memory.Report(state);
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, SelectResultSet)->Range(1 << 4, 1 << 18);
+
+// Only a single row is kept in memory at a time
+BENCHMARK_DEFINE_F(PgConnection, SelectResultStream)(benchmark::State& state) {
+  if (!IsConnectionValid()) {
+    state.SkipWithError("Database not connected");
+    return;
+  }
+  engine::RunStandalone([this, &state] {
+    const int rows_count = state.range(0);
+    for (auto _ : state) {
+      pg::detail::QueryParameters params;
+      params.Write(conn_->GetUserTypes(), rows_count);
+      pg::ResultStream stream{conn_.get(), kSelect, params, kBulkCmdCtl};
+      std::size_t total_size = 0;
+      for (const auto& [id, name] : stream.AsSetOf<Row>(pg::kRowTag)) {
+        total_size += name.size();
+      }
+      benchmark::DoNotOptimize(total_size);
+    }
+    state.SetItemsProcessed(state.iterations() * rows_count);
+
+    MemoryUsage memory;
+    pg::detail::QueryParameters params;
+    params.Write(conn_->GetUserTypes(), rows_count);
+    pg::ResultStream stream{conn_.get(), kSelect, params, kBulkCmdCtl};
+    for (const auto& [id, name] : stream.AsSetOf<Row>(pg::kRowTag)) {
+      benchmark::DoNotOptimize(name);
+      memory.Sample();
+    }
+    memory.Report(state);
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, SelectResultStream)
+    ->Range(1 << 4, 1 << 18);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
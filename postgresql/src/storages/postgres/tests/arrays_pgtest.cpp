@@ -906,6 +906,50 @@ UTEST_P(PostgreConnection, TransactionChunkedContainer) {
   trx.Commit();
 }
 
+struct DecomposedRow {
+  int id;
+  std::string name;
+  std::optional<double> value;
+};
+
+UTEST_P(PostgreConnection, TransactionDecomposeContainer) {
+  CheckConnection(conn);
+
+  conn->Execute(
+      "create temporary table decompose_test(id integer primary key, "
+      "name text, value double precision)");
+  std::vector<DecomposedRow> rows;
+  for (int i = 0; i < 1001; ++i) {
+    rows.push_back({i, "row " + std::to_string(i),
+                    i % 2 ? std::optional<double>{} : i * 0.5});
+  }
+
+  pg::Transaction trx(std::move(conn), pg::TransactionOptions{});
+  const pg::Query insert{
+      "insert into decompose_test select * from unnest($1, $2, $3) "
+      "on conflict (id) do update set name = excluded.name, "
+      "value = excluded.value"};
+  EXPECT_EQ(rows.size(), trx.ExecuteDecompose(insert, rows, 100));
+
+  for (auto& row : rows) row.name = "updated";
+  EXPECT_EQ(rows.size(), trx.ExecuteDecompose(insert, rows));
+
+  auto res = trx.Execute(
+      "select id, name, value from decompose_test order by id");
+  const auto stored = res.AsContainer<std::vector<DecomposedRow>>(
+      pg::kRowTag);
+  ASSERT_EQ(rows.size(), stored.size());
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    EXPECT_EQ(rows[i].id, stored[i].id);
+    EXPECT_EQ(rows[i].name, stored[i].name);
+    EXPECT_EQ(rows[i].value, stored[i].value);
+  }
+
+  EXPECT_EQ(0, trx.ExecuteDecompose(insert, std::vector<DecomposedRow>{}));
+
+  trx.Commit();
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -332,4 +332,20 @@ UTEST_F(PostgreCluster, NonTransactionExecuteWithParameterStore) {
   }
 }
 
+UTEST_F(PostgreCluster, NearestHostSelectionStatistics) {
+  auto cluster = CreateCluster(GetDsnFromEnv(), GetTaskProcessor(), 1);
+
+  UEXPECT_NO_THROW(cluster.Execute(
+      {pg::ClusterHostType::kMaster, pg::ClusterHostType::kNearest},
+      "select 1"));
+  auto stats = cluster.GetStatistics();
+  EXPECT_EQ(1, stats->master.stats.host_selection.nearest_total);
+  EXPECT_EQ(0, stats->master.stats.host_selection.spillover_total);
+
+  // Round robin selection is not accounted
+  UEXPECT_NO_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select 1"));
+  stats = cluster.GetStatistics();
+  EXPECT_EQ(1, stats->master.stats.host_selection.nearest_total);
+}
+
 USERVER_NAMESPACE_END
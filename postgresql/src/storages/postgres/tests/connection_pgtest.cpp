@@ -1,5 +1,7 @@
 #include <storages/postgres/tests/util_pgtest.hpp>
 
+#include <fmt/format.h>
+
 #include <userver/engine/single_consumer_event.hpp>
 
 #include <storages/postgres/detail/connection.hpp>
@@ -414,4 +416,15 @@ UTEST_F(PostgreCustomConnection, NoUserTypes) {
   UEXPECT_NO_THROW(conn->Execute("drop type user_type"));
 }
 
+UTEST_F(PostgreCustomConnection, NativeProtocolSslFiles) {
+  for (const auto* option : {"sslrootcert", "sslcert", "sslkey"}) {
+    const pg::Dsn dsn{fmt::format("host=localhost {}=/nonexistent", option)};
+    UEXPECT_THROW(pg::detail::Connection::Connect(
+                      dsn, nullptr, GetTaskProcessor(), kConnectionId,
+                      kNativeProtocol, GetTestCmdCtls(), {}, {}),
+                  pg::ConnectionFailed)
+        << option << " is not supported by the native protocol";
+  }
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,147 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/optional.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+struct CopyRow {
+  int id;
+  std::optional<std::string> name;
+  double value;
+
+  bool operator==(const CopyRow& other) const {
+    return id == other.id && name == other.name && value == other.value;
+  }
+};
+
+UTEST_P(PostgreConnection, CopyRoundtrip) {
+  CheckConnection(conn);
+
+  conn->Execute(
+      "create temporary table copy_test(id integer, name text, value double "
+      "precision)");
+
+  /// [Sample COPY usage]
+  pg::Transaction trx(std::move(conn), pg::TransactionOptions{});
+
+  const std::vector<CopyRow> rows{{1, "one", 1.5}, {2, std::nullopt, -2}};
+  EXPECT_EQ(trx.CopyIn("copy_test (id, name, value)", rows), rows.size());
+
+  const auto copied =
+      trx.CopyOut<CopyRow>("select id, name, value from copy_test order by id");
+  /// [Sample COPY usage]
+  EXPECT_EQ(copied, rows);
+
+  auto res = trx.Execute("select count(*) from copy_test where name is null");
+  EXPECT_EQ(1, res.Front().As<pg::Bigint>());
+
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyManyChunks) {
+  CheckConnection(conn);
+
+  conn->Execute(
+      "create temporary table copy_test(id integer, name text, value double "
+      "precision)");
+
+  // Rows take several CopyData chunks
+  std::vector<CopyRow> rows;
+  for (int i = 0; i < 20000; ++i) {
+    rows.push_back({i, std::string(i % 100, 'a'), i / 2.0});
+  }
+
+  pg::Transaction trx(std::move(conn), pg::TransactionOptions{});
+  EXPECT_EQ(trx.CopyIn("copy_test", rows), rows.size());
+
+  int expected_id = 0;
+  const auto count = trx.CopyOut<CopyRow>(
+      "select id, name, value from copy_test order by id",
+      [&](CopyRow&& row) {
+        EXPECT_EQ(row, rows[expected_id]);
+        ++expected_id;
+      });
+  EXPECT_EQ(count, rows.size());
+  EXPECT_EQ(expected_id, static_cast<int>(rows.size()));
+
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyEmpty) {
+  CheckConnection(conn);
+
+  conn->Execute(
+      "create temporary table copy_test(id integer, name text, value double "
+      "precision)");
+
+  pg::Transaction trx(std::move(conn), pg::TransactionOptions{});
+  EXPECT_EQ(trx.CopyIn("copy_test", std::vector<CopyRow>{}), 0);
+  EXPECT_TRUE(trx.CopyOut<CopyRow>("select * from copy_test").empty());
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyInServerError) {
+  CheckConnection(conn);
+
+  conn->Execute("create temporary table copy_test(id integer not null)");
+
+  const std::vector<std::tuple<std::optional<int>>> rows{{1}, {std::nullopt}};
+  pg::Transaction trx(std::move(conn), pg::TransactionOptions{});
+  UEXPECT_THROW(trx.CopyIn("copy_test", rows), pg::NotNullViolation);
+  // The connection is left in a usable state
+  UEXPECT_NO_THROW(trx.Rollback());
+}
+
+UTEST_P(PostgreConnection, CopyOutParseError) {
+  CheckConnection(conn);
+
+  conn->Execute("create temporary table copy_test(id integer)");
+  conn->Execute("insert into copy_test select generate_series(1, 100)");
+
+  pg::Transaction trx(std::move(conn), pg::TransactionOptions{});
+  // Field count mismatch is detected while parsing
+  using TwoColumns = std::tuple<int, int>;
+  UEXPECT_THROW(trx.CopyOut<TwoColumns>("select id from copy_test"),
+                pg::InvalidBinaryBuffer);
+  // The rest of the data is skipped, the transaction is still usable
+  EXPECT_EQ(100, trx.Execute("select count(*) from copy_test")
+                     .Front()
+                     .As<pg::Bigint>());
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyOutSinkErrorCancels) {
+  CheckConnection(conn);
+
+  // Draining the whole output would take much longer than the test timeout
+  const pg::Query query{
+      "COPY (select generate_series(1, 1000000000)) TO STDOUT (FORMAT binary)"};
+  UEXPECT_THROW(conn->CopyOut(
+                    query,
+                    [](std::string_view) {
+                      throw std::runtime_error("sink failure");
+                    },
+                    {}),
+                std::runtime_error);
+  // The query is cancelled and the connection is left in a usable state
+  EXPECT_EQ(pg::ConnectionState::kIdle, conn->GetState());
+  UEXPECT_NO_THROW(conn->Execute("select 1"));
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,96 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <chrono>
+#include <string>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/notify.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+constexpr std::chrono::milliseconds kShortTimeout{50};
+
+UTEST_P(PostgreConnection, Notify) {
+  CheckConnection(conn);
+  auto notifier = MakeConnection(GetDsnFromEnv(), GetTaskProcessor());
+  CheckConnection(notifier);
+
+  /// [Sample notify usage]
+  pg::NotifyScope scope{std::move(conn), "test_channel", {}};
+
+  notifier->Execute("select pg_notify('test_channel', 'payload')");
+  const auto notification = scope.WaitNotify(MakeDeadline());
+  /// [Sample notify usage]
+  EXPECT_EQ("test_channel", notification.channel);
+  EXPECT_EQ("payload", notification.payload.value_or(""));
+}
+
+UTEST_P(PostgreConnection, NotifyNoPayload) {
+  CheckConnection(conn);
+  auto notifier = MakeConnection(GetDsnFromEnv(), GetTaskProcessor());
+  CheckConnection(notifier);
+
+  pg::NotifyScope scope{std::move(conn), "Mixed Case Channel", {}};
+  EXPECT_EQ("Mixed Case Channel", scope.GetChannel());
+
+  notifier->Execute(R"~(notify "Mixed Case Channel")~");
+  const auto notification = scope.WaitNotify(MakeDeadline());
+  EXPECT_EQ("Mixed Case Channel", notification.channel);
+  EXPECT_FALSE(notification.payload);
+}
+
+UTEST_P(PostgreConnection, NotifyTimeout) {
+  CheckConnection(conn);
+  auto notifier = MakeConnection(GetDsnFromEnv(), GetTaskProcessor());
+  CheckConnection(notifier);
+
+  pg::NotifyScope scope{std::move(conn), "test_channel", {}};
+  UEXPECT_THROW(
+      scope.WaitNotify(engine::Deadline::FromDuration(kShortTimeout)),
+      pg::ConnectionTimeoutError);
+
+  // The subscription is still usable after the timeout
+  notifier->Execute("select pg_notify('test_channel', '1')");
+  notifier->Execute("select pg_notify('test_channel', '2')");
+  EXPECT_EQ("1", scope.WaitNotify(MakeDeadline()).payload.value_or(""));
+  EXPECT_EQ("2", scope.WaitNotify(MakeDeadline()).payload.value_or(""));
+}
+
+UTEST_P(PostgreConnection, NotifyOtherChannel) {
+  CheckConnection(conn);
+  auto notifier = MakeConnection(GetDsnFromEnv(), GetTaskProcessor());
+  CheckConnection(notifier);
+
+  pg::NotifyScope scope{std::move(conn), "test_channel", {}};
+  notifier->Execute("select pg_notify('other_channel', '')");
+  UEXPECT_THROW(
+      scope.WaitNotify(engine::Deadline::FromDuration(kShortTimeout)),
+      pg::ConnectionTimeoutError);
+}
+
+UTEST_P(PostgreConnection, NotifyUnlisten) {
+  CheckConnection(conn);
+  auto notifier = MakeConnection(GetDsnFromEnv(), GetTaskProcessor());
+  CheckConnection(notifier);
+
+  conn->Listen("test_channel", {});
+  notifier->Execute("select pg_notify('test_channel', '')");
+  // Make sure the notification has reached the connection
+  conn->Execute("select 1");
+
+  // Pending notifications are discarded on unsubscribe
+  conn->Unlisten("test_channel", {});
+  UEXPECT_THROW(
+      conn->WaitNotify(engine::Deadline::FromDuration(kShortTimeout)),
+      pg::ConnectionTimeoutError);
+  UEXPECT_NO_THROW(conn->Execute("select 1"));
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -275,6 +275,73 @@ UTEST_F(PostgrePoolStats, MaxPreparedCacheSize) {
             conn_settings.max_prepared_cache_size);
 }
 
+UTEST_F(PostgrePoolStats, PreparedWarmup) {
+  pg::ConnectionSettings conn_settings;
+  conn_settings.prepared_warmup_size = 1;
+
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "",
+      storages::postgres::InitMode::kSync, {1, 10, 10}, conn_settings, {},
+      GetTestCmdCtls(), {}, {});
+
+  auto conn = pg::detail::ConnectionPtr{nullptr};
+  UEXPECT_NO_THROW(conn = pool->Acquire(MakeDeadline()))
+      << "Obtained connection from pool";
+  CheckConnection(conn);
+  EXPECT_EQ(pool->GetStatistics().connection.prepared_warmup_total, 0);
+
+  // Executions are merged into the pool registry once in a merge period
+  constexpr auto kExecutions =
+      pg::detail::PreparedStatementsRegistry::ExecutionCounters::kMergePeriod;
+  for (std::size_t i = 0; i < kExecutions; ++i) {
+    UEXPECT_NO_THROW(conn->Execute("select 1"));
+  }
+  UEXPECT_NO_THROW(conn->Execute("select 2"));
+  auto stats = conn->GetStatsAndReset();
+  EXPECT_EQ(stats.cold_execute_total, 2);
+  EXPECT_EQ(stats.warm_execute_total, kExecutions - 1);
+
+  // The connection is held, so a new one is created and warmed up with the
+  // most executed statement
+  auto new_conn = pg::detail::ConnectionPtr{nullptr};
+  UEXPECT_NO_THROW(new_conn = pool->Acquire(MakeDeadline()))
+      << "Obtained connection from pool";
+  CheckConnection(new_conn);
+  EXPECT_EQ(pool->GetStatistics().connection.prepared_warmup_total, 1);
+
+  UEXPECT_NO_THROW(new_conn->Execute("select 1"));
+  UEXPECT_NO_THROW(new_conn->Execute("select 2"));
+  stats = new_conn->GetStatsAndReset();
+  EXPECT_EQ(stats.warm_execute_total, 1);
+  EXPECT_EQ(stats.cold_execute_total, 1);
+  EXPECT_EQ(stats.parse_total, 1);
+}
+
+UTEST_F(PostgrePoolStats, ThreadStash) {
+  pg::PoolSettings pool_settings{1, 10, 10};
+  pool_settings.thread_stash_size = 1;
+
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "",
+      storages::postgres::InitMode::kSync, pool_settings, {}, {},
+      GetTestCmdCtls(), {}, {});
+
+  const pg::detail::Connection* raw_conn = nullptr;
+  {
+    auto conn = pool->Acquire(MakeDeadline());
+    CheckConnection(conn);
+    raw_conn = conn.get();
+  }
+  EXPECT_EQ(pool->GetStatistics().connection.stash_hits, 0);
+
+  // The released connection is handed out again to the same thread
+  auto conn = pool->Acquire(MakeDeadline());
+  CheckConnection(conn);
+  EXPECT_EQ(conn.get(), raw_conn);
+  EXPECT_EQ(pool->GetStatistics().connection.stash_hits, 1);
+  EXPECT_EQ(pool->GetStatistics().connection.open_total, 1);
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
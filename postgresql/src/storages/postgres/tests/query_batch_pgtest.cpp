@@ -0,0 +1,151 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <string>
+#include <tuple>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+UTEST_P(PostgreConnection, QueryBatch) {
+  CheckConnection(conn);
+
+  /// [Sample batch usage]
+  pg::Transaction trx(std::move(conn), pg::TransactionOptions{});
+
+  pg::QueryBatch batch;
+  batch.Add("select $1::integer", 1)
+      .Add("select $1::text, $2::bigint", std::string{"two"}, pg::Bigint{2})
+      .Add("select generate_series(1, 3)");
+  const auto results = trx.Execute(batch);
+  ASSERT_EQ(results.Size(), batch.Size());
+
+  EXPECT_EQ(1, results[0].AsSingleRow<int>());
+  const auto [text, number] =
+      results[1].AsSingleRow<std::tuple<std::string, pg::Bigint>>(pg::kRowTag);
+  /// [Sample batch usage]
+  EXPECT_EQ("two", text);
+  EXPECT_EQ(2, number);
+  EXPECT_EQ(3, results[2].Size());
+  UEXPECT_NO_THROW(results.ThrowIfError());
+
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, QueryBatchPrepared) {
+  CheckConnection(conn);
+
+  pg::Transaction trx(std::move(conn), pg::TransactionOptions{});
+  // The statement is prepared and then executed by name within the batch
+  EXPECT_EQ(1, trx.Execute("select $1::integer", 1).AsSingleRow<int>());
+
+  pg::QueryBatch batch;
+  batch.Add("select $1::integer", 2).Add("select $1::integer", 3);
+  const auto results = trx.Execute(batch);
+  ASSERT_EQ(results.Size(), 2);
+  EXPECT_EQ(2, results[0].AsSingleRow<int>());
+  EXPECT_EQ(3, results[1].AsSingleRow<int>());
+
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, QueryBatchParameterStore) {
+  CheckConnection(conn);
+  pg::detail::NonTransaction ntrx(std::move(conn));
+
+  pg::ParameterStore params;
+  params.PushBack(1).PushBack(std::string{"one"});
+
+  pg::QueryBatch batch;
+  batch.Add("select $1::integer, $2::text", std::move(params))
+      .Add("select 2");
+  const auto results = ntrx.Execute(pg::OptionalCommandControl{}, batch);
+  ASSERT_EQ(results.Size(), 2);
+  EXPECT_EQ(1, results[0].Front()[0].As<int>());
+  EXPECT_EQ("one", results[0].Front()[1].As<std::string>());
+  EXPECT_EQ(2, results[1].AsSingleRow<int>());
+}
+
+UTEST_P(PostgreConnection, QueryBatchErrors) {
+  CheckConnection(conn);
+
+  conn->Execute("create temporary table batch_test(id integer primary key)");
+
+  pg::Transaction trx(std::move(conn), pg::TransactionOptions{});
+  pg::QueryBatch batch;
+  batch.Add("insert into batch_test values (1)")
+      .Add("insert into batch_test values (1)")
+      .Add("select count(*) from batch_test");
+  const auto results = trx.Execute(batch);
+  ASSERT_EQ(results.Size(), 3);
+
+  EXPECT_FALSE(results.HasError(0));
+  EXPECT_EQ(1, results[0].RowsAffected());
+  EXPECT_TRUE(results.HasError(1));
+  UEXPECT_THROW(results[1], pg::UniqueViolation);
+  EXPECT_TRUE(results.HasError(2));
+  UEXPECT_THROW(results[2], pg::BatchStatementSkipped);
+  UEXPECT_THROW(results.ThrowIfError(), pg::UniqueViolation);
+  UEXPECT_THROW(results[3], pg::LogicError);
+
+  // The connection is left in a usable state
+  UEXPECT_NO_THROW(trx.Rollback());
+}
+
+UTEST_P(PostgreConnection, QueryBatchImplicitTransaction) {
+  CheckConnection(conn);
+
+  conn->Execute("create temporary table batch_test(id integer primary key)");
+
+  pg::detail::NonTransaction ntrx(std::move(conn));
+  pg::QueryBatch batch;
+  batch.Add("insert into batch_test values (1)")
+      .Add("insert into batch_test values (1)");
+  const auto results = ntrx.Execute(pg::OptionalCommandControl{}, batch);
+  ASSERT_EQ(results.Size(), 2);
+  EXPECT_FALSE(results.HasError(0));
+  UEXPECT_THROW(results[1], pg::UniqueViolation);
+
+  // The failed statement rolls back the whole batch
+  EXPECT_EQ(0, ntrx.Execute("select count(*) from batch_test")
+                   .AsSingleRow<pg::Bigint>());
+}
+
+UTEST_P(PostgreConnection, QueryBatchStatementTimeout) {
+  CheckConnection(conn);
+  pg::detail::NonTransaction ntrx(std::move(conn));
+
+  pg::QueryBatch batch;
+  batch.Add("select 1").Add("select pg_sleep(1)").Add("select 3");
+  pg::CommandControl cc{std::chrono::milliseconds{300},
+                        std::chrono::milliseconds{50}};
+  const auto results = ntrx.Execute(cc, batch);
+  ASSERT_EQ(results.Size(), 3);
+  EXPECT_EQ(1, results[0].AsSingleRow<int>());
+  UEXPECT_THROW(results[1], pg::QueryCancelled);
+  UEXPECT_THROW(results[2], pg::BatchStatementSkipped);
+
+  // NOTE: connection may now be reused
+  UEXPECT_NO_THROW(ntrx.Execute("select 1"));
+}
+
+UTEST_P(PostgreConnection, QueryBatchEmpty) {
+  CheckConnection(conn);
+
+  pg::Transaction trx(std::move(conn), pg::TransactionOptions{});
+  const auto results = trx.Execute(pg::QueryBatch{});
+  EXPECT_TRUE(results.IsEmpty());
+  trx.Commit();
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,129 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/result_stream.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+struct StreamRow {
+  int id;
+  std::string name;
+};
+
+UTEST_P(PostgreConnection, ResultStream) {
+  CheckConnection(conn);
+
+  /// [Sample result stream usage]
+  pg::Transaction trx(std::move(conn), pg::TransactionOptions{});
+
+  auto stream = trx.Stream(
+      "select i, 'name' || i from generate_series(1, $1) as i", 1000);
+  int expected_id = 0;
+  for (const auto& row : stream.AsSetOf<StreamRow>(pg::kRowTag)) {
+    EXPECT_EQ(++expected_id, row.id);
+    EXPECT_EQ("name" + std::to_string(row.id), row.name);
+  }
+  /// [Sample result stream usage]
+  EXPECT_EQ(1000, expected_id);
+  EXPECT_TRUE(stream.IsDone());
+  EXPECT_EQ(1000u, stream.RowsRead());
+
+  // The connection is usable after the stream is exhausted
+  EXPECT_EQ(1, trx.Execute("select 1").Front().As<int>());
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, ResultStreamRows) {
+  CheckConnection(conn);
+
+  pg::ResultStream stream{conn.get(),
+                          "select i, i * 2 from generate_series(1, 3) as i",
+                          {},
+                          {}};
+  std::vector<int> doubled;
+  while (auto row = stream.Next()) {
+    EXPECT_EQ(2u, row->Size());
+    doubled.push_back((*row)[1].As<int>());
+  }
+  EXPECT_EQ((std::vector<int>{2, 4, 6}), doubled);
+  EXPECT_FALSE(stream.Next());
+}
+
+UTEST_P(PostgreConnection, ResultStreamEmpty) {
+  CheckConnection(conn);
+
+  pg::ResultStream stream{
+      conn.get(), "select i from generate_series(1, 0) as i", {}, {}};
+  EXPECT_FALSE(stream.Next());
+  EXPECT_TRUE(stream.IsDone());
+  EXPECT_EQ(0u, stream.RowsRead());
+}
+
+UTEST_P(PostgreConnection, ResultStreamBusy) {
+  CheckConnection(conn);
+
+  pg::ResultStream stream{
+      conn.get(), "select i from generate_series(1, 10) as i", {}, {}};
+  ASSERT_TRUE(stream.Next());
+  UEXPECT_THROW(conn->Execute("select 1"), pg::ConnectionBusy);
+}
+
+UTEST_P(PostgreConnection, ResultStreamCancel) {
+  CheckConnection(conn);
+
+  {
+    pg::ResultStream stream{
+        conn.get(), "select i from generate_series(1, 10000000) as i", {}, {}};
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_TRUE(stream.Next());
+    }
+  }
+  // The statement is cancelled outside of a transaction
+  EXPECT_FALSE(conn->IsInTransaction());
+  EXPECT_EQ(1, conn->Execute("select 1").Front().As<int>());
+}
+
+UTEST_P(PostgreConnection, ResultStreamFinishInTransaction) {
+  CheckConnection(conn);
+
+  pg::Transaction trx(std::move(conn), pg::TransactionOptions{});
+  {
+    auto stream = trx.Stream("select i from generate_series(1, 10000) as i");
+    auto range = stream.AsSetOf<int>();
+    auto it = range.begin();
+    ASSERT_NE(it, range.end());
+    EXPECT_EQ(1, *it);
+  }
+  // The rest of the rows are discarded and the transaction is not aborted
+  UEXPECT_NO_THROW(trx.Execute("select 1"));
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, ResultStreamError) {
+  CheckConnection(conn);
+
+  pg::ResultStream stream{
+      conn.get(), "select 1 / (5 - i) from generate_series(1, 10) as i", {},
+      {}};
+  std::vector<int> values;
+  UEXPECT_THROW(
+      [&] {
+        for (auto value : stream.AsSetOf<int>()) values.push_back(value);
+      }(),
+      pg::DataException);
+  EXPECT_TRUE(stream.IsDone());
+  EXPECT_EQ(1, conn->Execute("select 1").Front().As<int>());
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
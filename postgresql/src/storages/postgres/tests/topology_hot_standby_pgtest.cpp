@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/topology/hot_standby.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
@@ -49,4 +51,27 @@ UTEST_F(HotStandby, ReplicationLag) {
   EXPECT_EQ(0, hosts->count(pg::ClusterHostType::kSlave));
 }
 
+UTEST_F(HotStandby, RoundtripTime) {
+  const auto& dsns = GetDsnListFromEnv();
+  if (dsns.empty()) return;
+
+  pg::detail::topology::HotStandby qcc(
+      GetTaskProcessor(), dsns, nullptr,
+      pg::TopologySettings{utest::kMaxTestWaitTime}, pg::ConnectionSettings{},
+      GetTestCmdCtls(), testsuite::PostgresControl{},
+      error_injection::Settings{});
+  auto alive = qcc.GetAliveDsnIndices();
+  auto rtts = qcc.GetDsnRtts();
+
+  ASSERT_EQ(dsns.size(), rtts->size());
+  ASSERT_FALSE(alive->empty());
+  for (const auto idx : *alive) {
+    EXPECT_LE(0, (*rtts)[idx].count());
+  }
+  // Alive hosts are ordered by RTT
+  EXPECT_TRUE(std::is_sorted(
+      alive->begin(), alive->end(),
+      [&rtts](auto lhs, auto rhs) { return (*rtts)[lhs] < (*rtts)[rhs]; }));
+}
+
 USERVER_NAMESPACE_END
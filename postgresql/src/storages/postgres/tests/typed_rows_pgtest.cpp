@@ -1,6 +1,8 @@
 #include <deque>
 #include <list>
 #include <set>
+#include <tuple>
+#include <vector>
 
 #include <storages/postgres/tests/util_pgtest.hpp>
 #include <userver/storages/postgres/typed_result_set.hpp>
@@ -171,6 +173,73 @@ UTEST_P(PostgreConnection, OptionalFields) {
   UEXPECT_NO_THROW(res.AsSingleRow<MyStruct>(pg::kRowTag));
 }
 
+struct ColumnarRow {
+  int id;
+  std::int64_t doubled;
+  double half;
+  std::string name;
+  std::optional<int> even;
+  pg::TimePoint ts;
+  boost::uuids::uuid uuid;
+
+  bool operator==(const ColumnarRow& rhs) const {
+    return std::tie(id, doubled, half, name, even, ts, uuid) ==
+           std::tie(rhs.id, rhs.doubled, rhs.half, rhs.name, rhs.even, rhs.ts,
+                    rhs.uuid);
+  }
+};
+
+UTEST_P(PostgreConnection, ColumnarResult) {
+  CheckConnection(conn);
+  pg::ResultSet res{nullptr};
+
+  UEXPECT_NO_THROW(
+      res = conn->Execute(
+          "select i, i::bigint * 2, i::float8 / 2, 'name' || i, "
+          "case when i % 2 = 0 then i end, "
+          "'2000-01-01'::timestamp + i * interval '1 second', "
+          "md5(i::text)::uuid from generate_series(1, 100) as i"));
+  ASSERT_EQ(100, res.Size());
+
+  const auto rows = res.AsVectorOf<ColumnarRow>(pg::kRowTag);
+  EXPECT_EQ(res.AsContainer<std::vector<ColumnarRow>>(pg::kRowTag), rows);
+  ASSERT_EQ(100, rows.size());
+  EXPECT_EQ(100, rows.back().id);
+  EXPECT_EQ(200, rows.back().doubled);
+  EXPECT_EQ(50.0, rows.back().half);
+  EXPECT_EQ("name100", rows.back().name);
+  EXPECT_EQ(100, rows.back().even);
+  EXPECT_FALSE(rows.front().even);
+
+  const auto tail = res.AsVectorOf<ColumnarRow>(
+      pg::kRowTag, 90, 20, [](std::size_t, const std::exception&) {});
+  ASSERT_EQ(10, tail.size());
+  EXPECT_EQ(91, tail.front().id);
+}
+
+UTEST_P(PostgreConnection, ColumnarResultErrors) {
+  using MyTuple = std::tuple<int, int>;
+
+  CheckConnection(conn);
+  pg::ResultSet res{nullptr};
+
+  UEXPECT_NO_THROW(
+      res = conn->Execute("select i, case when i % 3 = 0 then null else i end "
+                          "from generate_series(1, 9) as i"));
+  UEXPECT_THROW(res.AsVectorOf<MyTuple>(pg::kRowTag), pg::FieldValueIsNull);
+
+  std::vector<std::size_t> failed_rows;
+  const auto rows = res.AsVectorOf<MyTuple>(
+      pg::kRowTag, 0, res.Size(),
+      [&](std::size_t row, const std::exception&) {
+        failed_rows.push_back(row);
+      });
+  EXPECT_EQ((std::vector<std::size_t>{2, 5, 8}), failed_rows);
+  ASSERT_EQ(6, rows.size());
+  EXPECT_EQ(4, std::get<0>(rows[2]));
+  EXPECT_EQ(4, std::get<1>(rows[2]));
+}
+
 UTEST_P(PostgreConnection, EmptyTypedResult) {
   using MyTuple = static_test::MyTupleType;
   using MyStruct = static_test::MyAggregateStruct;
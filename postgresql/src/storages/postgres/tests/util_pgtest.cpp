@@ -149,6 +149,6 @@ PostgreConnection::~PostgreConnection() {
 
 INSTANTIATE_UTEST_SUITE_P(ConnectionSettings, PostgreConnection,
                           ::testing::Values(kCachePreparedStatements,
-                                            kPipelineEnabled));
+                                            kPipelineEnabled, kNativeProtocol));
 
 USERVER_NAMESPACE_END
@@ -52,6 +52,15 @@ inline const storages::postgres::ConnectionSettings kPipelineEnabled{
     storages::postgres::kDefaultMaxPreparedCacheSize,
     storages::postgres::ConnectionSettings::kPipelineEnabled,
 };
+inline const storages::postgres::ConnectionSettings kNativeProtocol{
+    storages::postgres::ConnectionSettings::kCachePreparedStatements,
+    storages::postgres::ConnectionSettings::kUserTypesEnabled,
+    storages::postgres::ConnectionSettings::kCheckUnused,
+    storages::postgres::kDefaultMaxPreparedCacheSize,
+    storages::postgres::ConnectionSettings::kPipelineEnabled,
+    0,
+    storages::postgres::ConnectionSettings::kNativeProtocol,
+};
 
 engine::Deadline MakeDeadline();
 
@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+#include <storages/postgres/detail/wire/messages.hpp>
+#include <storages/postgres/detail/wire/native_result.hpp>
+#include <storages/postgres/detail/wire/scram.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+namespace wire = pg::detail::wire;
+
+namespace {
+
+std::string MakeMessage(char type, void (*fill)(wire::MessageWriter&)) {
+  std::string buffer;
+  wire::MessageWriter writer{buffer};
+  writer.Start(type);
+  fill(writer);
+  writer.End();
+  return buffer;
+}
+
+void Receive(wire::ReceiveBuffer& buffer, std::string_view data) {
+  while (!data.empty()) {
+    auto [ptr, size] = buffer.PrepareRead();
+    ASSERT_GT(size, 0);
+    size = std::min(size, data.size());
+    std::memcpy(ptr, data.data(), size);
+    buffer.CommitRead(size);
+    data.remove_prefix(size);
+  }
+}
+
+std::string Payload(const std::string& message) {
+  return message.substr(wire::kHeaderSize);
+}
+
+}  // namespace
+
+TEST(PostgreWire, WriteRead) {
+  const auto message = MakeMessage('Q', [](wire::MessageWriter& writer) {
+    writer.PutByte('x');
+    writer.PutInt16(-2);
+    writer.PutInt32(100500);
+    writer.PutString("select 1");
+    writer.PutBytes("raw");
+  });
+  ASSERT_EQ(message.size(), wire::kHeaderSize + 1 + 2 + 4 + 9 + 3);
+  EXPECT_EQ(message[0], 'Q');
+
+  wire::ReceiveBuffer buffer;
+  Receive(buffer, message);
+  const auto received = buffer.Peek();
+  ASSERT_TRUE(received);
+  EXPECT_EQ(received->type, 'Q');
+  EXPECT_EQ(received->size, message.size());
+
+  wire::MessageReader reader{received->payload};
+  EXPECT_EQ(reader.ReadByte(), 'x');
+  EXPECT_EQ(reader.ReadInt16(), -2);
+  EXPECT_EQ(reader.ReadInt32(), 100500);
+  EXPECT_EQ(reader.ReadString(), "select 1");
+  EXPECT_EQ(reader.ReadBytes(3), "raw");
+  EXPECT_EQ(reader.Remaining(), 0);
+  UEXPECT_THROW(reader.ReadByte(), pg::ConnectionError);
+
+  buffer.Consume(received->size);
+  EXPECT_TRUE(buffer.Empty());
+}
+
+TEST(PostgreWire, UntypedMessage) {
+  std::string buffer;
+  wire::MessageWriter writer{buffer};
+  writer.Start(wire::frontend::kUntyped);
+  writer.PutInt32(wire::kSslRequestCode);
+  writer.End();
+  EXPECT_EQ(buffer.size(), 8);
+  EXPECT_EQ(buffer.substr(0, 4), std::string_view("\0\0\0\x08", 4));
+}
+
+TEST(PostgreWire, PartialMessages) {
+  std::string data;
+  for (int i = 0; i < 1000; ++i) {
+    data += MakeMessage(wire::backend::kDataRow, [](wire::MessageWriter& w) {
+      w.PutBytes(std::string(100, 'a'));
+    });
+  }
+  // A message larger than the initial buffer capacity
+  data += MakeMessage(wire::backend::kDataRow, [](wire::MessageWriter& w) {
+    w.PutBytes(std::string(1 << 20, 'b'));
+  });
+
+  wire::ReceiveBuffer buffer;
+  std::size_t messages = 0;
+  std::string_view rest = data;
+  while (!rest.empty()) {
+    // Feed the data in odd-sized chunks splitting the headers
+    const auto chunk = rest.substr(0, 7777);
+    Receive(buffer, chunk);
+    rest.remove_prefix(chunk.size());
+    while (const auto message = buffer.Peek()) {
+      EXPECT_EQ(message->type, wire::backend::kDataRow);
+      EXPECT_EQ(message->payload.size(), messages < 1000 ? 100 : 1 << 20);
+      buffer.Consume(message->size);
+      ++messages;
+    }
+  }
+  EXPECT_EQ(messages, 1001);
+  EXPECT_TRUE(buffer.Empty());
+}
+
+TEST(PostgreWire, InvalidLength) {
+  wire::ReceiveBuffer buffer;
+  Receive(buffer, std::string_view{"D\0\0\0\x02", 5});
+  UEXPECT_THROW(buffer.Peek(), pg::ConnectionError);
+}
+
+TEST(PostgreWire, ResultRows) {
+  const auto description =
+      MakeMessage(wire::backend::kRowDescription, [](wire::MessageWriter& w) {
+        w.PutInt16(2);
+        for (const auto* name : {"id", "Name"}) {
+          w.PutString(name);
+          w.PutInt32(0);
+          w.PutInt16(0);
+          w.PutInt32(25);
+          w.PutInt16(-1);
+          w.PutInt32(-1);
+          w.PutInt16(1);
+        }
+      });
+  wire::NativeResult result{
+      PGRES_TUPLES_OK,
+      wire::NativeResult::ParseRowDescription(Payload(description))};
+  ASSERT_EQ(result.FieldCount(), 2);
+  EXPECT_EQ(result.GetField(1).name, "Name");
+  EXPECT_EQ(result.GetField(1).type_oid, 25);
+  EXPECT_EQ(result.IndexOfName("id"), 0);
+  EXPECT_EQ(result.IndexOfName("ID"), 0);
+  EXPECT_EQ(result.IndexOfName("name"), -1);
+  EXPECT_EQ(result.IndexOfName("\"Name\""), 1);
+
+  const auto row =
+      MakeMessage(wire::backend::kDataRow, [](wire::MessageWriter& w) {
+        w.PutInt16(2);
+        w.PutInt32(5);
+        w.PutBytes("hello");
+        w.PutInt32(-1);
+      });
+  result.AddRow(Payload(row));
+  result.AddRow(Payload(row));
+  ASSERT_EQ(result.RowCount(), 2);
+  EXPECT_FALSE(result.IsNull(1, 0));
+  EXPECT_EQ(std::string_view(result.GetValue(1, 0), result.GetLength(1, 0)),
+            "hello");
+  EXPECT_TRUE(result.IsNull(1, 1));
+  EXPECT_EQ(result.GetLength(1, 1), 0);
+
+  UEXPECT_THROW(result.AddRow(Payload(row).substr(0, 6)), pg::ConnectionError);
+}
+
+TEST(PostgreWire, AffectedRows) {
+  wire::NativeResult result{PGRES_COMMAND_OK};
+  for (const auto& [status, rows] :
+       std::initializer_list<std::pair<std::string_view, std::size_t>>{
+           {"INSERT 0 5", 5},
+           {"UPDATE 10", 10},
+           {"DELETE 0", 0},
+           {"SELECT 42", 42},
+           {"MOVE 3", 3},
+           {"FETCH 7", 7},
+           {"COPY 100500", 100500},
+           {"MERGE 2", 2},
+           {"CREATE TABLE", 0},
+           {"BEGIN", 0}}) {
+    result.SetCommandStatus(status);
+    EXPECT_EQ(result.GetCommandStatus(), status);
+    EXPECT_EQ(result.GetAffectedRows(), rows) << status;
+  }
+}
+
+TEST(PostgreWire, ErrorMessage) {
+  const auto error =
+      MakeMessage(wire::backend::kErrorResponse, [](wire::MessageWriter& w) {
+        w.PutByte('S');
+        w.PutString("ОШИБКА");
+        w.PutByte('V');
+        w.PutString("ERROR");
+        w.PutByte('C');
+        w.PutString("23505");
+        w.PutByte('M');
+        w.PutString("duplicate key");
+        w.PutByte('\0');
+      });
+  wire::NativeResult result{PGRES_FATAL_ERROR};
+  result.SetMessageFields(Payload(error));
+  EXPECT_STREQ(result.GetMessageField(PG_DIAG_SQLSTATE), "23505");
+  EXPECT_EQ(result.GetMessageField(PG_DIAG_MESSAGE_DETAIL), nullptr);
+  EXPECT_EQ(result.GetMachineReadableSeverity(), "ERROR");
+  EXPECT_EQ(result.GetErrorMessage(), "ОШИБКА:  duplicate key\n");
+}
+
+// Test vector from RFC 7677
+TEST(PostgreWire, ScramSha256) {
+  wire::ScramSha256Client client{"pencil", "user", "rOprNGfwEbeRWgbNEkqO"};
+  EXPECT_EQ(client.MakeClientFirstMessage(),
+            "n,,n=user,r=rOprNGfwEbeRWgbNEkqO");
+  EXPECT_EQ(
+      client.MakeClientFinalMessage(
+          "r=rOprNGfwEbeRWgbNEkqO%hvYDpWUa2RaTCAfuxFIlj)hNlF$k0,"
+          "s=W22ZaJ0SNY7soEsUEjb6gQ==,i=4096"),
+      "c=biws,r=rOprNGfwEbeRWgbNEkqO%hvYDpWUa2RaTCAfuxFIlj)hNlF$k0,"
+      "p=dHzbZapWIk4jUhN+Ute9ytag9zjfMHgsqmmiz7AndVQ=");
+  UEXPECT_NO_THROW(client.VerifyServerFinalMessage(
+      "v=6rriTRBi23WpRR/wtup+mMhUZUn/dB5nLTJRsjl95G4="));
+  UEXPECT_THROW(client.VerifyServerFinalMessage(
+                    "v=AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA="),
+                pg::ConnectionError);
+  UEXPECT_THROW(client.VerifyServerFinalMessage("e=invalid-proof"),
+                pg::ConnectionError);
+}
+
+TEST(PostgreWire, ScramInvalidNonce) {
+  wire::ScramSha256Client client{"pencil", "user", "rOprNGfwEbeRWgbNEkqO"};
+  UEXPECT_THROW(
+      client.MakeClientFinalMessage("r=foreign,s=W22ZaJ0SNY7soEsUEjb6gQ==,"
+                                    "i=4096"),
+      pg::ConnectionError);
+}
+
+USERVER_NAMESPACE_END
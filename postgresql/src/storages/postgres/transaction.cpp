@@ -44,6 +44,16 @@ ResultSet Transaction::Execute(OptionalCommandControl statement_cmd_ctl,
   return DoExecute(query, store.GetInternalData(), statement_cmd_ctl);
 }
 
+QueryBatchResult Transaction::Execute(OptionalCommandControl batch_cmd_ctl,
+                                      const QueryBatch& batch) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Execute called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  return conn_->ExecuteBatch(batch, std::move(batch_cmd_ctl));
+}
+
 Portal Transaction::MakePortal(OptionalCommandControl statement_cmd_ctl,
                                const Query& query,
                                const ParameterStore& store) {
@@ -90,6 +100,57 @@ Portal Transaction::MakePortal(const PortalName& portal_name,
                 std::move(statement_cmd_ctl)};
 }
 
+ResultStream Transaction::DoStream(const Query& query,
+                                   const detail::QueryParameters& params,
+                                   OptionalCommandControl statement_cmd_ctl) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Stream called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  return ResultStream{conn_.get(), query, params,
+                      std::move(statement_cmd_ctl)};
+}
+
+std::size_t Transaction::DoCopyIn(const std::string& target,
+                                  const detail::CopyInSource& source,
+                                  OptionalCommandControl statement_cmd_ctl) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Copy in called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  const Query query{"COPY " + target + " FROM STDIN (FORMAT binary)"};
+  if (!statement_cmd_ctl) {
+    statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+  }
+
+  detail::StatementTimer timer{query, conn_};
+  auto res = conn_->CopyIn(query, source, std::move(statement_cmd_ctl));
+  timer.Account();
+  return res.RowsAffected();
+}
+
+void Transaction::DoCopyOut(const Query& query,
+                            const detail::CopyOutSink& sink,
+                            OptionalCommandControl statement_cmd_ctl) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Copy out called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  const Query copy_query{
+      "COPY (" + query.Statement() + ") TO STDOUT (FORMAT binary)",
+      query.GetName(), query.GetLogMode()};
+  if (!statement_cmd_ctl) {
+    statement_cmd_ctl = conn_->GetQueryCmdCtl(copy_query.GetName());
+  }
+
+  detail::StatementTimer timer{copy_query, conn_};
+  conn_->CopyOut(copy_query, sink, std::move(statement_cmd_ctl));
+  timer.Account();
+}
+
 void Transaction::SetParameter(const std::string& param_name,
                                const std::string& value) {
   if (!conn_) {
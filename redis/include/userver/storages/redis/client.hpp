@@ -171,6 +171,9 @@ class Client {
   virtual RequestIncr Incr(std::string key,
                            const CommandControl& command_control) = 0;
 
+  virtual RequestIncrby Incrby(std::string key, int64_t increment,
+                               const CommandControl& command_control) = 0;
+
   [[deprecated("use Scan")]] virtual RequestKeys Keys(
       std::string keys_pattern, size_t shard,
       const CommandControl& command_control) = 0;
@@ -318,6 +321,36 @@ class Client {
   virtual RequestType Type(std::string key,
                            const CommandControl& command_control) = 0;
 
+  virtual RequestXack Xack(std::string key, std::string group,
+                           std::vector<std::string> ids,
+                           const CommandControl& command_control) = 0;
+
+  virtual RequestXadd Xadd(
+      std::string key, std::vector<std::pair<std::string, std::string>> fields,
+      const XaddOptions& options, const CommandControl& command_control) = 0;
+
+  virtual RequestXautoclaim Xautoclaim(
+      std::string key, std::string group, std::string consumer,
+      std::chrono::milliseconds min_idle_time, std::string start,
+      const XautoclaimOptions& options,
+      const CommandControl& command_control) = 0;
+
+  virtual RequestXdel Xdel(std::string key, std::vector<std::string> ids,
+                           const CommandControl& command_control) = 0;
+
+  /// Creates the consumer group (and the stream if it does not exist). Fails
+  /// with a BUSYGROUP error if the group already exists.
+  virtual RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) = 0;
+
+  /// Reads the entries of a single stream starting after `id`, use ">" to
+  /// read the entries never delivered to the other consumers of the group
+  virtual RequestXreadgroup Xreadgroup(
+      std::string key, std::string group, std::string consumer,
+      std::string id, const XreadgroupOptions& options,
+      const CommandControl& command_control) = 0;
+
   virtual RequestZadd Zadd(std::string key, double score, std::string member,
                            const CommandControl& command_control) = 0;
 
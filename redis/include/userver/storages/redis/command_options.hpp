@@ -19,6 +19,9 @@ using RangeOptions = USERVER_NAMESPACE::redis::RangeOptions;
 using GeoaddArg = USERVER_NAMESPACE::redis::GeoaddArg;
 using GeoradiusOptions = USERVER_NAMESPACE::redis::GeoradiusOptions;
 using ZaddOptions = USERVER_NAMESPACE::redis::ZaddOptions;
+using XaddOptions = USERVER_NAMESPACE::redis::XaddOptions;
+using XreadgroupOptions = USERVER_NAMESPACE::redis::XreadgroupOptions;
+using XautoclaimOptions = USERVER_NAMESPACE::redis::XautoclaimOptions;
 
 class ScanOptionsBase {
  public:
@@ -26,6 +26,7 @@ namespace storages {
 /// Redis client
 namespace redis {
 class Client;
+class ClientSideCache;
 class SubscribeClient;
 class SubscribeClientImpl;
 }  // namespace redis
@@ -50,6 +51,10 @@ namespace components {
 /// groups.[].config_name | key name in secdist with options for this cluster | -
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
+/// groups.[].client_side_cache | enables caching of GET, HGET and MGET replies invalidated by the server key tracking, requires redis 6.0+ | -
+/// groups.[].client_side_cache.max_keys | maximum number of cached keys per shard | 10000
+/// groups.[].client_side_cache.prefixes | only the keys with one of the prefixes are cached, all the keys are cached if empty | []
+/// groups.[].client_side_cache.check_interval | period of the tracking connections check | 1s
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
@@ -63,6 +68,9 @@ namespace components {
 ///          - config_name: taxi-tmp
 ///            db: taxi-tmp
 ///            sharding_strategy: "RedisCluster"
+///            client_side_cache:
+///                max_keys: 100000
+///                prefixes: ["settings:"]
 ///          - config_name: taxi-tmp-pubsub
 ///            db: taxi-tmp-pubsub
 ///        subscribe_groups:
@@ -111,6 +119,9 @@ class Redis : public LoggableComponentBase {
   std::unordered_map<std::string, std::shared_ptr<redis::Sentinel>> sentinels_;
   std::unordered_map<std::string, std::shared_ptr<storages::redis::Client>>
       clients_;
+  std::unordered_map<std::string,
+                     std::shared_ptr<storages::redis::ClientSideCache>>
+      client_side_caches_;
   std::unordered_map<std::string,
                      std::shared_ptr<storages::redis::SubscribeClientImpl>>
       subscribe_clients_;
@@ -0,0 +1,127 @@
+#pragma once
+
+/// @file userver/storages/redis/counter_aggregator.hpp
+/// @brief @copybrief storages::redis::CounterAggregator
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+#include <userver/storages/redis/client.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+struct CounterAggregatorSettings {
+  /// Maximum delay of an increment before it is sent to redis
+  std::chrono::milliseconds flush_interval{100};
+  /// The increments are flushed early once that many distinct counters are
+  /// accumulated
+  size_t max_counters{10000};
+  /// Number of the local maps of the counters, more maps reduce the
+  /// contention of the concurrent increments
+  size_t local_shards{16};
+  /// Send the increments of a redis shard in a MULTI/EXEC transaction instead
+  /// of separate pipelined commands
+  bool use_transaction{false};
+  CommandControl command_control;
+};
+
+struct CounterAggregatorStatistics {
+  /// Number of the Incrby() and Hincrby() calls
+  std::uint64_t increments{0};
+  /// Number of the INCRBY and HINCRBY commands sent to redis
+  std::uint64_t commands{0};
+  std::uint64_t flushes{0};
+  /// Number of the commands that failed, their increments are lost
+  std::uint64_t failed_commands{0};
+
+  /// Number of the increments per command sent to redis
+  double GetReductionFactor() const {
+    return commands ? static_cast<double>(increments) / commands : 0;
+  }
+};
+
+/// @brief Accumulates the increments of redis counters locally and sends
+/// them in batches.
+///
+/// The increments of the same key (or hash field) made within
+/// `flush_interval` are summed up and sent as a single INCRBY (HINCRBY)
+/// command. A flush sends the commands for all the accumulated counters at
+/// once, without waiting for the replies in between. The counters in redis
+/// are thus updated with a delay of up to `flush_interval`.
+///
+/// A failed command is not retried as its increment may have been applied,
+/// the increment is lost and accounted in the statistics.
+///
+/// Stop() (or the destructor) flushes the remaining increments, call it
+/// before the client is shut down.
+class CounterAggregator final {
+ public:
+  CounterAggregator(ClientPtr client, CounterAggregatorSettings settings,
+                    engine::TaskProcessor& task_processor);
+  ~CounterAggregator();
+
+  CounterAggregator(const CounterAggregator&) = delete;
+  CounterAggregator& operator=(const CounterAggregator&) = delete;
+
+  /// Adds `increment` to the counter `key`
+  void Incrby(const std::string& key, int64_t increment);
+
+  /// Adds `increment` to the field `field` of the hash `key`
+  void Hincrby(const std::string& key, const std::string& field,
+               int64_t increment);
+
+  /// Sends the accumulated increments and waits for the replies
+  void Flush();
+
+  /// Stops the periodic flushes and flushes the remaining increments. The
+  /// increments made after the call are not sent.
+  void Stop();
+
+  CounterAggregatorStatistics GetStatistics() const;
+
+ private:
+  struct Counters {
+    std::unordered_map<std::string, int64_t> keys;
+    std::unordered_map<std::string, std::unordered_map<std::string, int64_t>>
+        hashes;
+  };
+
+  struct LocalShard {
+    engine::Mutex mutex;
+    Counters counters;
+    size_t size{0};
+  };
+
+  LocalShard& GetLocalShard(const std::string& key);
+  void OnCounterAdded();
+  void Run();
+  void SendPipelined(Counters& counters);
+  void SendTransactions(Counters& counters);
+
+  const ClientPtr client_;
+  const CounterAggregatorSettings settings_;
+  std::vector<LocalShard> local_shards_;
+  std::atomic<size_t> size_{0};
+  engine::Mutex flush_mutex_;
+  engine::SingleConsumerEvent flush_event_;
+  std::atomic<std::uint64_t> increments_{0};
+  std::atomic<std::uint64_t> commands_{0};
+  std::atomic<std::uint64_t> flushes_{0};
+  std::atomic<std::uint64_t> failed_commands_{0};
+  engine::TaskWithResult<void> task_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
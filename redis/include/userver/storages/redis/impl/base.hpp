@@ -93,9 +93,14 @@ void PutArg(CmdArgs::CmdArgsArray& args_, std::string&& arg);
 
 void PutArg(CmdArgs::CmdArgsArray& args_, const std::vector<std::string>& arg);
 
+void PutArg(CmdArgs::CmdArgsArray& args_, std::vector<std::string>&& arg);
+
 void PutArg(CmdArgs::CmdArgsArray& args_,
             const std::vector<std::pair<std::string, std::string>>& arg);
 
+void PutArg(CmdArgs::CmdArgsArray& args_,
+            std::vector<std::pair<std::string, std::string>>&& arg);
+
 void PutArg(CmdArgs::CmdArgsArray& args_,
             const std::vector<std::pair<double, std::string>>& arg);
 
@@ -197,6 +202,13 @@ struct CommandControl {
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   bool force_retries_to_master_on_nil_reply = false;
 
+  /* If not 0, the reads from slaves are repeated on another slave if there is
+   * no reply for the recent p95 reply time of the shard. The repeated requests
+   * are limited to the percentage of the reads.
+   */
+  // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+  size_t hedging_budget_percent = 0;
+
   CommandControl() = default;
   CommandControl(std::chrono::milliseconds timeout_single,
                  std::chrono::milliseconds timeout_all, size_t max_retries,
@@ -227,11 +239,14 @@ struct CommandsBufferingSettings {
   bool buffering_enabled{false};
   size_t commands_buffering_threshold{0};
   std::chrono::microseconds watch_command_timer_interval{0};
+  // Send the commands without buffering if there are no commands in flight
+  bool adaptive{false};
 
   constexpr bool operator==(const CommandsBufferingSettings& o) const {
     return buffering_enabled == o.buffering_enabled &&
            commands_buffering_threshold == o.commands_buffering_threshold &&
-           watch_command_timer_interval == o.watch_command_timer_interval;
+           watch_command_timer_interval == o.watch_command_timer_interval &&
+           adaptive == o.adaptive;
   }
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <vector>
@@ -75,6 +76,27 @@ struct RangeScoreOptions {
   RangeOptions range_options;
 };
 
+struct XaddOptions {
+  /* Trim the stream to about this number of entries, no trimming if 0 */
+  size_t maxlen = 0;
+  /* Trim exactly to maxlen instead of the efficient approximate trimming */
+  bool exact_trim = false;
+};
+
+struct XreadgroupOptions {
+  /* Maximum number of entries to read, no limit if 0 */
+  size_t count = 0;
+  /* Wait for the new entries if set. Blocks the connection to the shard for
+   * the duration, so use it only on a client dedicated to the streams. */
+  std::optional<std::chrono::milliseconds> block;
+  bool noack = false;
+};
+
+struct XautoclaimOptions {
+  /* Maximum number of entries to claim, server default (100) if 0 */
+  size_t count = 0;
+};
+
 void PutArg(CmdArgs::CmdArgsArray& args_, GeoaddArg arg);
 
 void PutArg(CmdArgs::CmdArgsArray& args_, std::vector<GeoaddArg> arg);
@@ -93,6 +115,12 @@ void PutArg(CmdArgs::CmdArgsArray& args_, const RangeOptions& arg);
 
 void PutArg(CmdArgs::CmdArgsArray& args_, const RangeScoreOptions& arg);
 
+void PutArg(CmdArgs::CmdArgsArray& args_, const XaddOptions& arg);
+
+void PutArg(CmdArgs::CmdArgsArray& args_, const XreadgroupOptions& arg);
+
+void PutArg(CmdArgs::CmdArgsArray& args_, const XautoclaimOptions& arg);
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
@@ -47,6 +47,12 @@ class ParseReplyException : public Exception {
   using Exception::Exception;
 };
 
+/// The stream or the consumer group of a stream command does not exist
+class NoGroupException : public Exception {
+ public:
+  using Exception::Exception;
+};
+
 /// Invalid config format
 class ParseConfigException : public Exception {
  public:
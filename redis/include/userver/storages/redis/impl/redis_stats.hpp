@@ -32,6 +32,8 @@ class Statistics {
   void AccountReplyReceived(const ReplyPtr& reply, const CommandPtr& cmd);
   void AccountPing(std::chrono::milliseconds ping);
   void AccountError(int code);
+  void AccountCommandsFlush(size_t size);
+  void AccountSocketWrite();
 
   using Percentile = utils::statistics::Percentile<2048>;
 
@@ -40,8 +42,15 @@ class Statistics {
   std::atomic<std::chrono::milliseconds> session_start_time{};
   utils::statistics::RecentPeriod<Percentile, Percentile,
                                   utils::datetime::SteadyClock>
-      request_size_percentile, reply_size_percentile, timings_percentile;
+      request_size_percentile, reply_size_percentile, timings_percentile,
+      commands_flush_size_percentile;
   std::atomic_llong last_ping_ms{};
+  // Passes of the command loop that handed the queued commands to hiredis.
+  // Not the number of writes: hiredis may write a flush with several send()
+  // calls or several flushes with one.
+  std::atomic_llong commands_flushes{0};
+  // write() calls on the connection socket
+  std::atomic_llong socket_writes{0};
 
   std::array<std::atomic_llong, REDIS_ERR_MAX + 1> error_count{{}};
 };
@@ -56,7 +65,12 @@ struct InstanceStatistics {
             other.request_size_percentile.GetStatsForPeriod()),
         reply_size_percentile(other.reply_size_percentile.GetStatsForPeriod()),
         timings_percentile(other.timings_percentile.GetStatsForPeriod()),
-        last_ping_ms(other.last_ping_ms.load(std::memory_order_relaxed)) {
+        commands_flush_size_percentile(
+            other.commands_flush_size_percentile.GetStatsForPeriod()),
+        last_ping_ms(other.last_ping_ms.load(std::memory_order_relaxed)),
+        commands_flushes(
+            other.commands_flushes.load(std::memory_order_relaxed)),
+        socket_writes(other.socket_writes.load(std::memory_order_relaxed)) {
     for (size_t i = 0; i < error_count.size(); i++)
       error_count[i] = other.error_count[i].load(std::memory_order_relaxed);
   }
@@ -68,6 +82,9 @@ struct InstanceStatistics {
     request_size_percentile.Add(other.request_size_percentile);
     reply_size_percentile.Add(other.reply_size_percentile);
     timings_percentile.Add(other.timings_percentile);
+    commands_flush_size_percentile.Add(other.commands_flush_size_percentile);
+    commands_flushes += other.commands_flushes;
+    socket_writes += other.socket_writes;
 
     for (size_t i = 0; i < error_count.size(); i++)
       error_count[i] += other.error_count[i];
@@ -77,8 +94,10 @@ struct InstanceStatistics {
   long long reconnects;
   std::chrono::milliseconds session_start_time;
   Statistics::Percentile request_size_percentile, reply_size_percentile,
-      timings_percentile;
+      timings_percentile, commands_flush_size_percentile;
   long long last_ping_ms;
+  long long commands_flushes;
+  long long socket_writes;
 
   std::array<long long, REDIS_ERR_MAX + 1> error_count{{}};
 };
@@ -89,6 +108,8 @@ struct ShardStatistics {
   std::map<std::string, InstanceStatistics> instances;
   bool is_ready = false;
   std::chrono::steady_clock::time_point last_ready_time;
+  long long hedges_sent = 0;
+  long long hedges_won = 0;
 };
 
 struct SentinelStatisticsInternal {
@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <userver/logging/log_extra.hpp>
@@ -36,8 +37,10 @@ class ReplyData final {
       KeyValue(const Array& array, size_t index)
           : array_(array), index_(index) {}
 
-      std::string Key() const { return array_[index_ * 2].GetString(); }
-      std::string Value() const { return array_[index_ * 2 + 1].GetString(); }
+      const std::string& Key() const { return array_[index_ * 2].GetString(); }
+      const std::string& Value() const {
+        return array_[index_ * 2 + 1].GetString();
+      }
 
      private:
       const Array& array_;
@@ -119,6 +122,8 @@ class ReplyData final {
 
   MovableKeyValues GetMovableKeyValues();
 
+  /// Copies the payload of the hiredis reply tree, the tree is owned and
+  /// freed by hiredis after the reply callback returns
   ReplyData(const redisReply* reply);
   ReplyData(Array&& array);
   ReplyData(std::string s);
@@ -160,6 +165,12 @@ class ReplyData final {
     return string_;
   }
 
+  /// @returns the payload of a string, status or error reply without copying
+  std::string_view GetStringView() const {
+    UASSERT(IsString() || IsStatus() || IsError());
+    return string_;
+  }
+
   const Array& GetArray() const {
     UASSERT(IsArray());
     return array_;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -110,6 +111,10 @@ class Sentinel {
 
   SentinelStatistics GetStatistics() const;
 
+  // Returns the connection info of the master of a shard or std::nullopt if
+  // the master is not known yet.
+  std::optional<ConnectionInfo> GetMasterConnectionInfo(size_t shard) const;
+
   void SetCommandsBufferingSettings(
       CommandsBufferingSettings commands_buffering_settings);
 
@@ -150,18 +155,19 @@ class Sentinel {
   virtual void SetConfigDefaultCommandControl(
       const std::shared_ptr<CommandControl>& cc);
 
-  using UserMessageCallback = std::function<void(const std::string& channel,
-                                                 const std::string& message)>;
+  // The message is moved out of the pub/sub reply, so the last subscriber of
+  // a channel gets it without a copy
+  using UserMessageCallback =
+      std::function<void(const std::string& channel, std::string message)>;
   using UserPmessageCallback =
       std::function<void(const std::string& pattern, const std::string& channel,
-                         const std::string& message)>;
-
-  using MessageCallback =
-      std::function<void(ServerId server_id, const std::string& channel,
-                         const std::string& message)>;
-  using PmessageCallback = std::function<void(
-      ServerId server_id, const std::string& pattern,
-      const std::string& channel, const std::string& message)>;
+                         std::string message)>;
+
+  using MessageCallback = std::function<void(
+      ServerId server_id, const std::string& channel, std::string message)>;
+  using PmessageCallback =
+      std::function<void(ServerId server_id, const std::string& pattern,
+                         const std::string& channel, std::string message)>;
   using SubscribeCallback =
       std::function<void(ServerId, const std::string& channel, size_t count)>;
   using UnsubscribeCallback =
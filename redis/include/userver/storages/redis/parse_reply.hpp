@@ -120,6 +120,14 @@ std::unordered_map<std::string, std::string> Parse(
     ReplyData&& reply_data, const std::string& request_description,
     To<std::unordered_map<std::string, std::string>>);
 
+XreadgroupReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XreadgroupReply>);
+
+XautoclaimReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XautoclaimReply>);
+
 ReplyData Parse(ReplyData&& reply_data, const std::string& request_description,
                 To<ReplyData>);
 
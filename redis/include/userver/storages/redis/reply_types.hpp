@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -132,6 +133,46 @@ enum class StatusPong { kPong };
 
 using TtlReply = USERVER_NAMESPACE::redis::TtlReply;
 
+struct StreamEntry final {
+  std::string id;
+  std::vector<std::pair<std::string, std::string>> fields;
+
+  StreamEntry() = default;
+  StreamEntry(std::string id,
+              std::vector<std::pair<std::string, std::string>> fields)
+      : id(std::move(id)), fields(std::move(fields)) {}
+
+  bool operator==(const StreamEntry& rhs) const {
+    return id == rhs.id && fields == rhs.fields;
+  }
+
+  bool operator!=(const StreamEntry& rhs) const { return !(*this == rhs); }
+};
+
+/// Reply to XREADGROUP of a single stream
+struct XreadgroupReply final {
+  /// Read entries, without the ones deleted from the stream
+  std::vector<StreamEntry> entries;
+  /// Ids of the pending entries of the consumer that are no longer in the
+  /// stream, only reported when the pending entries are read
+  std::vector<std::string> deleted_ids;
+};
+
+struct XautoclaimReply final {
+  /// Start id for the next XAUTOCLAIM call, "0-0" if the whole pending
+  /// entries list was scanned
+  std::string next_start_id;
+  /// Claimed entries, without the ones deleted from the stream
+  std::vector<StreamEntry> entries;
+  /// Ids of the claimed entries that are no longer in the stream. Redis 7.0+
+  /// removes them from the pending entries list itself.
+  std::vector<std::string> deleted_ids;
+  /// Number of the claimed entries deleted from the stream whose ids are not
+  /// reported (redis 6.2). They stay pending for the claiming consumer and
+  /// are reported as deleted when it reads its pending entries.
+  size_t unreported_deleted{0};
+};
+
 }  // namespace redis
 }  // namespace storages
 
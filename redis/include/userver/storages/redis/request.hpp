@@ -167,6 +167,7 @@ using RequestHset = Request<HsetReply>;
 using RequestHsetnx = Request<size_t, bool>;
 using RequestHvals = Request<std::vector<std::string>>;
 using RequestIncr = Request<int64_t>;
+using RequestIncrby = Request<int64_t>;
 using RequestKeys = Request<std::vector<std::string>>;
 using RequestLindex = Request<std::optional<std::string>>;
 using RequestLlen = Request<size_t>;
@@ -205,6 +206,12 @@ using RequestStrlen = Request<size_t>;
 using RequestTime = Request<std::chrono::system_clock::time_point>;
 using RequestTtl = Request<TtlReply>;
 using RequestType = Request<KeyType>;
+using RequestXack = Request<size_t>;
+using RequestXadd = Request<std::string>;
+using RequestXautoclaim = Request<XautoclaimReply>;
+using RequestXdel = Request<size_t>;
+using RequestXgroupCreate = Request<StatusOk, void>;
+using RequestXreadgroup = Request<XreadgroupReply>;
 using RequestZadd = Request<size_t>;
 using RequestZaddIncr = Request<double>;
 using RequestZaddIncrExisting = Request<std::optional<double>>;
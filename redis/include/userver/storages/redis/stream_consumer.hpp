@@ -0,0 +1,106 @@
+#pragma once
+
+/// @file userver/storages/redis/stream_consumer.hpp
+/// @brief @copybrief storages::redis::StreamConsumer
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+#include <userver/storages/redis/client.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+struct StreamConsumerSettings {
+  /// Consumer group, it is created to read the new entries if missing
+  std::string group;
+  /// Name of the consumer in the group, must be unique for each instance
+  std::string consumer;
+  /// Maximum number of entries passed to the callback at once
+  size_t batch_size{100};
+  /// Pause between the reads of a stream without new entries
+  std::chrono::milliseconds poll_interval{100};
+  /// Wait for the new entries on the server with XREADGROUP BLOCK instead of
+  /// polling. The connection to the shard is blocked for the duration, use it
+  /// only with a client dedicated to the streams.
+  std::optional<std::chrono::milliseconds> block;
+  /// Pending entries of the other consumers idle for longer are claimed
+  /// (requires redis 6.2+), nothing is claimed if 0
+  std::chrono::milliseconds min_idle_time{std::chrono::seconds{60}};
+  /// Period of the claiming of the idle pending entries
+  std::chrono::milliseconds claim_interval{std::chrono::seconds{10}};
+  CommandControl command_control;
+};
+
+struct StreamConsumerStatistics {
+  std::uint64_t read{0};
+  std::uint64_t claimed{0};
+  std::uint64_t acked{0};
+  std::uint64_t failed_batches{0};
+};
+
+/// @brief Reads redis streams as a member of a consumer group.
+///
+/// A task per stream is started on the task processor. It reads the entries
+/// in batches and passes them to the callback. The entries of a batch are
+/// acknowledged once the callback returns. XACK is not waited for: it is
+/// pipelined with the next read of the stream. If the callback throws, the
+/// batch stays pending and is claimed again by one of the consumers after
+/// `min_idle_time`.
+///
+/// On start the consumer first re-reads its own pending entries left from a
+/// previous run. The pending entries deleted from the stream are not passed
+/// to the callback, they are acknowledged. If the stream or the group is
+/// deleted, the group is created again.
+class StreamConsumer final {
+ public:
+  /// Is called sequentially for the batches of a stream, concurrently for
+  /// different streams. The entries may be moved out.
+  using Callback = std::function<void(const std::string& key,
+                                      std::vector<StreamEntry>& entries)>;
+
+  StreamConsumer(ClientPtr client, std::vector<std::string> keys,
+                 StreamConsumerSettings settings, Callback callback,
+                 engine::TaskProcessor& task_processor);
+  ~StreamConsumer();
+
+  StreamConsumer(const StreamConsumer&) = delete;
+  StreamConsumer& operator=(const StreamConsumer&) = delete;
+
+  /// Stops the reading and waits for the callbacks in progress
+  void Stop();
+
+  StreamConsumerStatistics GetStatistics() const;
+
+ private:
+  void Consume(const std::string& key);
+  void CreateGroup(const std::string& key);
+  bool Claim(const std::string& key, std::optional<RequestXack>& ack);
+  void Process(const std::string& key, std::vector<StreamEntry>& entries,
+               std::optional<RequestXack>& ack);
+  void Ack(const std::string& key, std::vector<std::string> ids,
+           std::optional<RequestXack>& ack);
+  void WaitAck(std::optional<RequestXack>& ack);
+
+  const ClientPtr client_;
+  const StreamConsumerSettings settings_;
+  const Callback callback_;
+  std::atomic<std::uint64_t> read_{0};
+  std::atomic<std::uint64_t> claimed_{0};
+  std::atomic<std::uint64_t> acked_{0};
+  std::atomic<std::uint64_t> failed_batches_{0};
+  std::vector<engine::TaskWithResult<void>> tasks_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
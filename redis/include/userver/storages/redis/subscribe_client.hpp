@@ -46,6 +46,24 @@ class SubscribeClient {
     return Subscribe(std::move(channel), std::move(on_message_cb), {});
   }
 
+  /// @brief Same as Subscribe(), but the callback is called once for a batch
+  /// of the received messages.
+  ///
+  /// Use it for the channels with a high rate of messages. The default
+  /// implementation collects the messages of Subscribe() into the batches in
+  /// a separate task.
+  virtual SubscriptionToken SubscribeBatched(
+      std::string channel, SubscriptionToken::OnMessagesCb on_messages_cb,
+      const SubscriptionBatchSettings& batch_settings,
+      const USERVER_NAMESPACE::redis::CommandControl& command_control);
+
+  SubscriptionToken SubscribeBatched(
+      std::string channel, SubscriptionToken::OnMessagesCb on_messages_cb,
+      const SubscriptionBatchSettings& batch_settings = {}) {
+    return SubscribeBatched(std::move(channel), std::move(on_messages_cb),
+                            batch_settings, {});
+  }
+
   virtual SubscriptionToken Psubscribe(
       std::string pattern, SubscriptionToken::OnPmessageCb on_pmessage_cb,
       const USERVER_NAMESPACE::redis::CommandControl& command_control) = 0;
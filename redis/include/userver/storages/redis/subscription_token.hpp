@@ -1,8 +1,10 @@
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -29,10 +31,22 @@ class SubscriptionTokenImplBase {
   virtual void Unsubscribe() = 0;
 };
 
+/// Settings of the batched delivery of the subscription messages
+struct SubscriptionBatchSettings {
+  /// Maximum number of messages passed to a single callback call
+  size_t max_size{1000};
+  /// Time to wait for more messages if there are less than `max_size` of them,
+  /// a batch is passed to the callback as soon as possible if 0
+  std::chrono::milliseconds max_latency{0};
+};
+
 class SubscriptionToken {
  public:
   using OnMessageCb = std::function<void(const std::string& channel,
                                          const std::string& message)>;
+  /// The callback may move the messages out of the vector
+  using OnMessagesCb = std::function<void(const std::string& channel,
+                                          std::vector<std::string>& messages)>;
   using OnPmessageCb =
       std::function<void(const std::string& pattern, const std::string& channel,
                          const std::string& message)>;
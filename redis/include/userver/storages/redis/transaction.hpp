@@ -110,6 +110,8 @@ class Transaction {
 
   virtual RequestIncr Incr(std::string key) = 0;
 
+  virtual RequestIncrby Incrby(std::string key, int64_t increment) = 0;
+
   virtual RequestKeys Keys(std::string keys_pattern, size_t shard) = 0;
 
   virtual RequestLindex Lindex(std::string key, int64_t index) = 0;
@@ -1,8 +1,11 @@
 #include "client_impl.hpp"
 
+#include <algorithm>
+
 #include <userver/storages/redis/impl/sentinel.hpp>
 #include <userver/utils/assert.hpp>
 
+#include "client_side_cache.hpp"
 #include "request_impl.hpp"
 #include "transaction_impl.hpp"
 
@@ -35,8 +38,11 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
 
 ClientImpl::ClientImpl(
     std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
-    std::optional<size_t> force_shard_idx)
-    : redis_client_(std::move(sentinel)), force_shard_idx_(force_shard_idx) {}
+    std::optional<size_t> force_shard_idx,
+    std::shared_ptr<ClientSideCache> client_side_cache)
+    : redis_client_(std::move(sentinel)),
+      force_shard_idx_(force_shard_idx),
+      client_side_cache_(std::move(client_side_cache)) {}
 
 void ClientImpl::WaitConnectedOnce(
     USERVER_NAMESPACE::redis::RedisWaitConnected wait_connected) {
@@ -54,7 +60,8 @@ const std::string& ClientImpl::GetAnyKeyForShard(size_t shard_idx) const {
 }
 
 std::shared_ptr<Client> ClientImpl::GetClientForShard(size_t shard_idx) {
-  return std::make_shared<ClientImpl>(redis_client_, shard_idx);
+  return std::make_shared<ClientImpl>(redis_client_, shard_idx,
+                                      client_side_cache_);
 }
 
 std::optional<size_t> ClientImpl::GetForcedShardIdx() const {
@@ -187,6 +194,18 @@ RequestGeoradius ClientImpl::Georadius(
 RequestGet ClientImpl::Get(std::string key,
                            const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  if (IsCacheable(key, command_control)) {
+    ClientSideCache::Fill fill;
+    if (auto cached = client_side_cache_->Get(shard, key, fill)) {
+      return CreateDummyRequest<RequestGet>(
+          std::make_shared<Reply>("get", std::move(*cached)));
+    }
+    const bool master = fill.IsActive();
+    return CreateCachingRequest<RequestGet>(
+        MakeRequest(CmdArgs{"get", std::move(key)}, shard, master,
+                    GetCommandControl(command_control)),
+        std::move(fill));
+  }
   return CreateRequest<RequestGet>(
       MakeRequest(CmdArgs{"get", std::move(key)}, shard, false,
                   GetCommandControl(command_control)));
@@ -229,6 +248,18 @@ RequestHexists ClientImpl::Hexists(std::string key, std::string field,
 RequestHget ClientImpl::Hget(std::string key, std::string field,
                              const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  if (IsCacheable(key, command_control)) {
+    ClientSideCache::Fill fill;
+    if (auto cached = client_side_cache_->Hget(shard, key, field, fill)) {
+      return CreateDummyRequest<RequestHget>(
+          std::make_shared<Reply>("hget", std::move(*cached)));
+    }
+    const bool master = fill.IsActive();
+    return CreateCachingRequest<RequestHget>(
+        MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard,
+                    master, GetCommandControl(command_control)),
+        std::move(fill));
+  }
   return CreateRequest<RequestHget>(
       MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard,
                   false, GetCommandControl(command_control)));
@@ -341,6 +372,14 @@ RequestIncr ClientImpl::Incr(std::string key,
                   GetCommandControl(command_control)));
 }
 
+RequestIncrby ClientImpl::Incrby(std::string key, int64_t increment,
+                                 const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestIncrby>(
+      MakeRequest(CmdArgs{"incrby", std::move(key), increment}, shard, true,
+                  GetCommandControl(command_control)));
+}
+
 RequestKeys ClientImpl::Keys(std::string keys_pattern, size_t shard,
                              const CommandControl& command_control) {
   CheckShard(shard, command_control);
@@ -436,6 +475,22 @@ RequestMget ClientImpl::Mget(std::vector<std::string> keys,
     return MakeRequest(CmdArgs{"mget", std::move(keys)}, shard, false, cc);
   };
   if (max_chunk_size >= keys.size()) {
+    const bool cacheable =
+        std::all_of(keys.begin(), keys.end(), [&](const std::string& key) {
+          return IsCacheable(key, command_control);
+        });
+    if (cacheable) {
+      ClientSideCache::Fill fill;
+      if (auto cached = client_side_cache_->Mget(shard, keys, fill)) {
+        return CreateDummyRequest<RequestMget>(
+            std::make_shared<Reply>("mget", std::move(*cached)));
+      }
+      const bool master = fill.IsActive();
+      return CreateCachingRequest<RequestMget>(
+          MakeRequest(CmdArgs{"mget", std::move(keys)}, shard, master,
+                      GetCommandControl(command_control)),
+          std::move(fill));
+    }
     return CreateRequest<RequestMget>(make_request(std::move(keys)));
   }
   return CreateAggregateRequest<RequestMget>(MakeRequestChunks(
@@ -745,6 +800,71 @@ RequestType ClientImpl::Type(std::string key,
                   GetCommandControl(command_control)));
 }
 
+RequestXack ClientImpl::Xack(std::string key, std::string group,
+                             std::vector<std::string> ids,
+                             const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXack>(MakeRequest(
+      CmdArgs{"xack", std::move(key), std::move(group), std::move(ids)}, shard,
+      true, GetCommandControl(command_control)));
+}
+
+RequestXadd ClientImpl::Xadd(
+    std::string key, std::vector<std::pair<std::string, std::string>> fields,
+    const XaddOptions& options, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXadd>(
+      MakeRequest(CmdArgs{"xadd", std::move(key), options, "*",
+                          std::move(fields)},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXautoclaim ClientImpl::Xautoclaim(
+    std::string key, std::string group, std::string consumer,
+    std::chrono::milliseconds min_idle_time, std::string start,
+    const XautoclaimOptions& options, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXautoclaim>(MakeRequest(
+      CmdArgs{"xautoclaim", std::move(key), std::move(group),
+              std::move(consumer), min_idle_time.count(), std::move(start),
+              options},
+      shard, true, GetCommandControl(command_control)));
+}
+
+RequestXdel ClientImpl::Xdel(std::string key, std::vector<std::string> ids,
+                             const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXdel>(
+      MakeRequest(CmdArgs{"xdel", std::move(key), std::move(ids)}, shard, true,
+                  GetCommandControl(command_control)));
+}
+
+RequestXgroupCreate ClientImpl::XgroupCreate(
+    std::string key, std::string group, std::string id,
+    const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXgroupCreate>(
+      MakeRequest(CmdArgs{"xgroup", "CREATE", std::move(key), std::move(group),
+                          std::move(id), "MKSTREAM"},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXreadgroup ClientImpl::Xreadgroup(
+    std::string key, std::string group, std::string consumer, std::string id,
+    const XreadgroupOptions& options, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  auto cc = GetCommandControl(command_control);
+  if (options.block) {
+    // The reply is not expected before the block timeout
+    cc.timeout_single += *options.block;
+    cc.timeout_all += *options.block;
+  }
+  return CreateRequest<RequestXreadgroup>(MakeRequest(
+      CmdArgs{"xreadgroup", "GROUP", std::move(group), std::move(consumer),
+              options, "STREAMS", std::move(key), std::move(id)},
+      shard, true, cc));
+}
+
 RequestZadd ClientImpl::Zadd(std::string key, double score, std::string member,
                              const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
@@ -1020,6 +1140,13 @@ void ClientImpl::CheckShard(size_t shard, const CommandControl& cc) const {
   DoCheckShard(shard, cc.force_shard_idx);
 }
 
+bool ClientImpl::IsCacheable(const std::string& key,
+                             const CommandControl& cc) const {
+  // The requests to a specific server bypass the cache
+  return client_side_cache_ && cc.force_server_id.IsAny() &&
+         client_side_cache_->IsCacheable(key);
+}
+
 template Request<ScanReplyTmpl<ScanTag::kSscan>>
 ClientImpl::MakeScanRequestWithKey(
     std::string key, size_t shard,
@@ -21,6 +21,7 @@ class Sentinel;
 
 namespace storages::redis {
 
+class ClientSideCache;
 class TransactionImpl;
 
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
@@ -29,7 +30,8 @@ class ClientImpl final : public Client,
  public:
   explicit ClientImpl(
       std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
-      std::optional<size_t> force_shard_idx = std::nullopt);
+      std::optional<size_t> force_shard_idx = std::nullopt,
+      std::shared_ptr<ClientSideCache> client_side_cache = nullptr);
 
   void WaitConnectedOnce(
       USERVER_NAMESPACE::redis::RedisWaitConnected wait_connected) override;
@@ -151,6 +153,9 @@ class ClientImpl final : public Client,
   RequestIncr Incr(std::string key,
                    const CommandControl& command_control) override;
 
+  RequestIncrby Incrby(std::string key, int64_t increment,
+                       const CommandControl& command_control) override;
+
   RequestKeys Keys(std::string keys_pattern, size_t shard,
                    const CommandControl& command_control) override;
 
@@ -300,6 +305,33 @@ class ClientImpl final : public Client,
   RequestType Type(std::string key,
                    const CommandControl& command_control) override;
 
+  RequestXack Xack(std::string key, std::string group,
+                   std::vector<std::string> ids,
+                   const CommandControl& command_control) override;
+
+  RequestXadd Xadd(std::string key,
+                   std::vector<std::pair<std::string, std::string>> fields,
+                   const XaddOptions& options,
+                   const CommandControl& command_control) override;
+
+  RequestXautoclaim Xautoclaim(
+      std::string key, std::string group, std::string consumer,
+      std::chrono::milliseconds min_idle_time, std::string start,
+      const XautoclaimOptions& options,
+      const CommandControl& command_control) override;
+
+  RequestXdel Xdel(std::string key, std::vector<std::string> ids,
+                   const CommandControl& command_control) override;
+
+  RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) override;
+
+  RequestXreadgroup Xreadgroup(
+      std::string key, std::string group, std::string consumer,
+      std::string id, const XreadgroupOptions& options,
+      const CommandControl& command_control) override;
+
   RequestZadd Zadd(std::string key, double score, std::string member,
                    const CommandControl& command_control) override;
 
@@ -430,9 +462,12 @@ class ClientImpl final : public Client,
 
   void CheckShard(size_t shard, const CommandControl& cc) const;
 
+  bool IsCacheable(const std::string& key, const CommandControl& cc) const;
+
   std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> redis_client_;
   std::atomic<int> publish_shard_{0};
   const std::optional<size_t> force_shard_idx_;
+  const std::shared_ptr<ClientSideCache> client_side_cache_;
 };
 
 }  // namespace storages::redis
@@ -105,4 +105,96 @@ UTEST(RedisClient, Mget) {
   EXPECT_EQ(*result[1], "bar");
 }
 
+UTEST(RedisClient, Streams) {
+  auto client = GetClient();
+  client->Del("test_stream", {}).Get();
+  UEXPECT_NO_THROW(
+      client->XgroupCreate("test_stream", "group", "$", {}).Get());
+  UEXPECT_THROW(client->XgroupCreate("test_stream", "group", "$", {}).Get(),
+                redis::Exception);
+
+  const auto id1 = client->Xadd("test_stream", {{"f", "a"}}, {}, {}).Get();
+  const auto id2 = client->Xadd("test_stream", {{"f", "b"}}, {}, {}).Get();
+
+  storages::redis::XreadgroupOptions options;
+  options.count = 10;
+  const std::vector<storages::redis::StreamEntry> expected{
+      {id1, {{"f", "a"}}}, {id2, {{"f", "b"}}}};
+  EXPECT_EQ(client->Xreadgroup("test_stream", "group", "c1", ">", options, {})
+                .Get()
+                .entries,
+            expected);
+  // No new entries
+  EXPECT_TRUE(
+      client->Xreadgroup("test_stream", "group", "c1", ">", options, {})
+          .Get()
+          .entries.empty());
+  options.block = std::chrono::milliseconds{10};
+  EXPECT_TRUE(
+      client->Xreadgroup("test_stream", "group", "c1", ">", options, {})
+          .Get()
+          .entries.empty());
+
+  // The pending entries of the consumer
+  EXPECT_EQ(
+      client->Xreadgroup("test_stream", "group", "c1", "0", {}, {})
+          .Get()
+          .entries,
+      expected);
+  EXPECT_EQ(client->Xack("test_stream", "group", {id1}, {}).Get(), 1);
+
+  const auto claimed = client
+                           ->Xautoclaim("test_stream", "group", "c2",
+                                        std::chrono::milliseconds{0}, "0-0",
+                                        {}, {})
+                           .Get();
+  EXPECT_EQ(claimed.next_start_id, "0-0");
+  ASSERT_EQ(claimed.entries.size(), 1);
+  EXPECT_EQ(claimed.entries[0], expected[1]);
+  EXPECT_EQ(client->Xack("test_stream", "group", {id1, id2}, {}).Get(), 1);
+}
+
+UTEST(RedisClient, XautoclaimDeleted) {
+  auto client = GetClient();
+  client->Del("deleted_stream", {}).Get();
+  client->XgroupCreate("deleted_stream", "group", "$", {}).Get();
+
+  const auto id1 = client->Xadd("deleted_stream", {{"f", "a"}}, {}, {}).Get();
+  const auto id2 = client->Xadd("deleted_stream", {{"f", "b"}}, {}, {}).Get();
+  ASSERT_EQ(
+      client->Xreadgroup("deleted_stream", "group", "c1", ">", {}, {})
+          .Get()
+          .entries.size(),
+      2);
+  // Still pending, but no longer in the stream
+  EXPECT_EQ(client->Xdel("deleted_stream", {id1}, {}).Get(), 1);
+
+  const auto claimed = client
+                           ->Xautoclaim("deleted_stream", "group", "c2",
+                                        std::chrono::milliseconds{0}, "0-0",
+                                        {}, {})
+                           .Get();
+  const std::vector<storages::redis::StreamEntry> expected{{id2, {{"f", "b"}}}};
+  EXPECT_EQ(claimed.entries, expected);
+  // Redis 6.2 does not report the deleted ids
+  if (claimed.deleted_ids.empty()) {
+    EXPECT_EQ(claimed.unreported_deleted, 1);
+    // ...but they are reported among the pending entries of the consumer
+    const auto pending =
+        client->Xreadgroup("deleted_stream", "group", "c2", "0", {}, {}).Get();
+    EXPECT_EQ(pending.entries, expected);
+    EXPECT_EQ(pending.deleted_ids, std::vector<std::string>{id1});
+  } else {
+    EXPECT_EQ(claimed.deleted_ids, std::vector<std::string>{id1});
+  }
+}
+
+UTEST(RedisClient, XreadgroupNoGroup) {
+  auto client = GetClient();
+  client->Del("no_group_stream", {}).Get();
+  UEXPECT_THROW(
+      client->Xreadgroup("no_group_stream", "group", "c1", ">", {}, {}).Get(),
+      redis::NoGroupException);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,439 @@
+#include "client_side_cache.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/impl/command.hpp>
+#include <userver/storages/redis/impl/sentinel.hpp>
+#include <userver/storages/redis/impl/thread_pools.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <storages/redis/impl/redis.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+using USERVER_NAMESPACE::redis::CmdArgs;
+using USERVER_NAMESPACE::redis::CommandPtr;
+using USERVER_NAMESPACE::redis::ConnectionInfo;
+using USERVER_NAMESPACE::redis::PrepareCommand;
+using Connection = USERVER_NAMESPACE::redis::Redis;
+
+const std::string kTaskName = "redis-client-side-cache";
+const std::string kInvalidateChannel = "__redis__:invalidate";
+
+struct CachedValue {
+  // Non-zero while the value is requested from the server
+  std::uint64_t fill_id{0};
+  std::optional<std::string> value;
+};
+
+struct Entry {
+  std::optional<CachedValue> string;
+  std::unordered_map<std::string, CachedValue> fields;
+};
+
+ReplyData ToReplyData(const std::optional<std::string>& value) {
+  if (!value) return ReplyData::CreateNil();
+  return ReplyData{*value};
+}
+
+bool IsSameServer(const ConnectionInfo& lhs, const ConnectionInfo& rhs) {
+  return lhs.host == rhs.host && lhs.port == rhs.port;
+}
+
+}  // namespace
+
+struct ClientSideCache::ShardCache {
+  explicit ShardCache(std::size_t max_keys) : entries(max_keys) {}
+
+  std::uint64_t NextFillId() { return ++last_fill_id; }
+
+  void Flush() {
+    if (ready) ++flushes;
+    ready = false;
+    entries.Clear();
+  }
+
+  std::mutex mutex;
+  cache::LruMap<std::string, Entry> entries;
+  std::uint64_t last_fill_id{0};
+  /// Incremented on each reconnection, the callbacks of the previous
+  /// connections are ignored
+  std::uint64_t generation{0};
+  /// The tracking connection is subscribed to the invalidation messages
+  bool ready{false};
+  /// The tracking connection has to be recreated
+  bool broken{false};
+  std::uint64_t invalidations{0};
+  std::uint64_t flushes{0};
+
+  // Accessed by the check task only
+  std::shared_ptr<Connection> connection;
+  std::optional<ConnectionInfo> master;
+};
+
+namespace {
+
+using ShardCachePtr = std::shared_ptr<ClientSideCache::ShardCache>;
+
+class TrackingHandshake final {
+ public:
+  TrackingHandshake(ShardCachePtr shard_cache, std::uint64_t generation,
+                    Connection& connection,
+                    const std::vector<std::string>& prefixes)
+      : shard_cache_(std::move(shard_cache)),
+        generation_(generation),
+        connection_(connection),
+        prefixes_(prefixes) {}
+
+  // The callbacks are called in the event thread of the connection. The
+  // connection is destroyed in the same thread after the generation is
+  // changed, so it is alive while the generation is current.
+  static void OnStateChange(std::shared_ptr<TrackingHandshake> self,
+                            Connection::State state) {
+    if (state == Connection::State::kConnected) {
+      self->SendClientId();
+    } else if (state != Connection::State::kInit) {
+      self->SetBroken();
+    }
+  }
+
+ private:
+  bool IsCurrent() {
+    std::lock_guard lock(shard_cache_->mutex);
+    return shard_cache_->generation == generation_;
+  }
+
+  void SetBroken() {
+    std::lock_guard lock(shard_cache_->mutex);
+    if (shard_cache_->generation != generation_) return;
+    shard_cache_->broken = true;
+    shard_cache_->Flush();
+  }
+
+  void Fail(std::string_view command, const ReplyPtr& reply) {
+    LOG_LIMITED_WARNING() << "Client tracking setup failed on "
+                          << command << ": "
+                          << (reply->IsOk() ? reply->data.ToDebugString()
+                                            : reply->StatusString());
+    SetBroken();
+  }
+
+  void SendClientId() {
+    connection_.AsyncCommand(PrepareCommand(
+        CmdArgs{"CLIENT", "ID"},
+        [self = Self()](const CommandPtr&, ReplyPtr reply) {
+          if (!self->IsCurrent()) return;
+          if (!reply->IsOk() || !reply->data.IsInt()) {
+            self->Fail("CLIENT ID", reply);
+            return;
+          }
+          self->SendClientTracking(reply->data.GetInt());
+        }));
+  }
+
+  void SendClientTracking(std::int64_t client_id) {
+    CmdArgs args{"CLIENT", "TRACKING", "ON", "REDIRECT", client_id, "BCAST"};
+    for (const auto& prefix : prefixes_) {
+      args.args.back().emplace_back("PREFIX");
+      args.args.back().push_back(prefix);
+    }
+    connection_.AsyncCommand(PrepareCommand(
+        std::move(args), [self = Self()](const CommandPtr&, ReplyPtr reply) {
+          if (!self->IsCurrent()) return;
+          if (!reply->IsOk() || !reply->data.IsStatus()) {
+            self->Fail("CLIENT TRACKING", reply);
+            return;
+          }
+          self->SendSubscribe();
+        }));
+  }
+
+  void SendSubscribe() {
+    connection_.AsyncCommand(PrepareCommand(
+        CmdArgs{"SUBSCRIBE", kInvalidateChannel},
+        [self = Self()](const CommandPtr&, ReplyPtr reply) {
+          self->OnMessage(reply);
+        }));
+  }
+
+  void OnMessage(const ReplyPtr& reply) {
+    std::lock_guard lock(shard_cache_->mutex);
+    if (shard_cache_->generation != generation_) return;
+
+    if (!reply->IsOk() || !reply->data.IsArray() ||
+        reply->data.GetArray().size() != 3 || !reply->data[0].IsString()) {
+      shard_cache_->broken = true;
+      shard_cache_->Flush();
+      return;
+    }
+
+    const auto& type = reply->data[0].GetString();
+    const auto& payload = reply->data[2];
+    if (type == "subscribe") {
+      LOG_INFO() << "Client tracking is enabled for "
+                 << connection_.GetServerId().GetDescription();
+      shard_cache_->ready = true;
+    } else if (type == "message") {
+      if (payload.IsArray()) {
+        for (const auto& key : payload.GetArray()) {
+          if (!key.IsString()) continue;
+          shard_cache_->entries.Erase(key.GetString());
+          ++shard_cache_->invalidations;
+        }
+      } else {
+        // FLUSHALL and FLUSHDB invalidate all the keys with a nil message
+        shard_cache_->Flush();
+      }
+    }
+  }
+
+  std::shared_ptr<TrackingHandshake> Self() {
+    return std::shared_ptr<TrackingHandshake>(self_);
+  }
+
+ public:
+  // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+  std::weak_ptr<TrackingHandshake> self_;
+
+ private:
+  const ShardCachePtr shard_cache_;
+  const std::uint64_t generation_;
+  Connection& connection_;
+  const std::vector<std::string> prefixes_;
+};
+
+}  // namespace
+
+void ClientSideCache::Fill::Commit(const ReplyPtr& reply) {
+  if (!shard_cache_ || !reply || !reply->IsOk()) return;
+  const auto& data = reply->data;
+
+  const auto store = [this](Entry& entry, const ReplyData& value) {
+    if (!value.IsString() && !value.IsNil()) return;
+    CachedValue* cached = nullptr;
+    if (command_ == Command::kHget) {
+      auto it = entry.fields.find(field_);
+      if (it != entry.fields.end()) cached = &it->second;
+    } else if (entry.string) {
+      cached = &*entry.string;
+    }
+    // The placeholder is removed or replaced if the key is invalidated
+    if (!cached || cached->fill_id != fill_id_) return;
+    cached->fill_id = 0;
+    if (value.IsString()) cached->value = value.GetString();
+  };
+
+  std::lock_guard lock(shard_cache_->mutex);
+  if (command_ == Command::kMget) {
+    if (!data.IsArray() || data.GetArray().size() != keys_.size()) return;
+    for (size_t i = 0; i < keys_.size(); ++i) {
+      if (auto* entry = shard_cache_->entries.Get(keys_[i])) {
+        store(*entry, data[i]);
+      }
+    }
+  } else if (auto* entry = shard_cache_->entries.Get(keys_.front())) {
+    store(*entry, data);
+  }
+}
+
+ClientSideCache::ClientSideCache(
+    std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
+    std::shared_ptr<USERVER_NAMESPACE::redis::ThreadPools> thread_pools,
+    ClientSideCacheSettings settings)
+    : sentinel_(std::move(sentinel)),
+      thread_pools_(std::move(thread_pools)),
+      settings_(std::move(settings)) {
+  const auto shards_count = sentinel_->ShardsCount();
+  shards_.reserve(shards_count);
+  for (size_t i = 0; i < shards_count; ++i) {
+    shards_.push_back(std::make_shared<ShardCache>(settings_.max_keys));
+  }
+
+  check_task_.Start(kTaskName,
+                    {settings_.check_interval,
+                     {USERVER_NAMESPACE::utils::PeriodicTask::Flags::kNow}},
+                    [this] { CheckConnections(); });
+}
+
+ClientSideCache::~ClientSideCache() {
+  check_task_.Stop();
+  for (size_t shard = 0; shard < shards_.size(); ++shard) {
+    Reconnect(shard, std::nullopt);
+  }
+}
+
+bool ClientSideCache::IsCacheable(const std::string& key) const {
+  if (settings_.prefixes.empty()) return true;
+  for (const auto& prefix : settings_.prefixes) {
+    if (!key.compare(0, prefix.size(), prefix)) return true;
+  }
+  return false;
+}
+
+std::optional<ReplyData> ClientSideCache::Get(size_t shard,
+                                              const std::string& key,
+                                              Fill& fill) {
+  auto& shard_cache = *shards_.at(shard);
+  std::unique_lock lock(shard_cache.mutex);
+  if (!shard_cache.ready) return std::nullopt;
+
+  auto* entry = shard_cache.entries.Emplace(key);
+  if (entry->string && !entry->string->fill_id) {
+    auto result = ToReplyData(entry->string->value);
+    lock.unlock();
+    AccountLookup(true);
+    return result;
+  }
+
+  entry->string = CachedValue{shard_cache.NextFillId(), std::nullopt};
+  fill.shard_cache_ = shards_[shard];
+  fill.command_ = Fill::Command::kGet;
+  fill.keys_ = {key};
+  fill.fill_id_ = entry->string->fill_id;
+  lock.unlock();
+  AccountLookup(false);
+  return std::nullopt;
+}
+
+std::optional<ReplyData> ClientSideCache::Hget(size_t shard,
+                                               const std::string& key,
+                                               const std::string& field,
+                                               Fill& fill) {
+  auto& shard_cache = *shards_.at(shard);
+  std::unique_lock lock(shard_cache.mutex);
+  if (!shard_cache.ready) return std::nullopt;
+
+  auto& fields = shard_cache.entries.Emplace(key)->fields;
+  const auto it = fields.find(field);
+  if (it != fields.end() && !it->second.fill_id) {
+    auto result = ToReplyData(it->second.value);
+    lock.unlock();
+    AccountLookup(true);
+    return result;
+  }
+
+  auto& cached = fields[field];
+  cached = CachedValue{shard_cache.NextFillId(), std::nullopt};
+  fill.shard_cache_ = shards_[shard];
+  fill.command_ = Fill::Command::kHget;
+  fill.keys_ = {key};
+  fill.field_ = field;
+  fill.fill_id_ = cached.fill_id;
+  lock.unlock();
+  AccountLookup(false);
+  return std::nullopt;
+}
+
+std::optional<ReplyData> ClientSideCache::Mget(
+    size_t shard, const std::vector<std::string>& keys, Fill& fill) {
+  auto& shard_cache = *shards_.at(shard);
+  std::unique_lock lock(shard_cache.mutex);
+  if (!shard_cache.ready) return std::nullopt;
+
+  ReplyData::Array values;
+  values.reserve(keys.size());
+  for (const auto& key : keys) {
+    const auto* entry = shard_cache.entries.Get(key);
+    if (!entry || !entry->string || entry->string->fill_id) break;
+    values.push_back(ToReplyData(entry->string->value));
+  }
+  if (values.size() == keys.size()) {
+    lock.unlock();
+    AccountLookup(true);
+    return ReplyData{std::move(values)};
+  }
+
+  // The keys are requested all together, the placeholders are set for the
+  // keys missing in the cache only
+  const auto fill_id = shard_cache.NextFillId();
+  for (const auto& key : keys) {
+    auto* entry = shard_cache.entries.Emplace(key);
+    if (entry->string && !entry->string->fill_id) continue;
+    entry->string = CachedValue{fill_id, std::nullopt};
+  }
+  fill.shard_cache_ = shards_[shard];
+  fill.command_ = Fill::Command::kMget;
+  fill.keys_ = keys;
+  fill.fill_id_ = fill_id;
+  lock.unlock();
+  AccountLookup(false);
+  return std::nullopt;
+}
+
+ClientSideCacheStatistics ClientSideCache::GetStatistics() const {
+  ClientSideCacheStatistics stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  for (const auto& shard_cache : shards_) {
+    std::lock_guard lock(shard_cache->mutex);
+    stats.invalidations += shard_cache->invalidations;
+    stats.flushes += shard_cache->flushes;
+  }
+  return stats;
+}
+
+void ClientSideCache::CheckConnections() {
+  for (size_t shard = 0; shard < shards_.size(); ++shard) {
+    auto& shard_cache = *shards_[shard];
+    const auto master = sentinel_->GetMasterConnectionInfo(shard);
+
+    bool broken = false;
+    {
+      std::lock_guard lock(shard_cache.mutex);
+      broken = shard_cache.broken;
+    }
+    if (!broken && shard_cache.connection && master && shard_cache.master &&
+        IsSameServer(*master, *shard_cache.master)) {
+      continue;
+    }
+    if (!master && !shard_cache.connection) continue;
+
+    Reconnect(shard, master);
+  }
+}
+
+void ClientSideCache::Reconnect(size_t shard,
+                                const std::optional<ConnectionInfo>& master) {
+  const auto& shard_cache = shards_[shard];
+  std::uint64_t generation = 0;
+  {
+    std::lock_guard lock(shard_cache->mutex);
+    generation = ++shard_cache->generation;
+    shard_cache->broken = false;
+    shard_cache->Flush();
+  }
+
+  // Waits for the callbacks of the previous connection in its event thread
+  shard_cache->connection.reset();
+  shard_cache->master = master;
+  if (!master) return;
+
+  LOG_INFO() << "Connecting client tracking for shard " << shard << " to "
+             << master->host << ':' << master->port;
+  auto connection =
+      std::make_shared<Connection>(thread_pools_->GetRedisThreadPool());
+  auto handshake = std::make_shared<TrackingHandshake>(
+      shard_cache, generation, *connection, settings_.prefixes);
+  handshake->self_ = handshake;
+  connection->signal_state_change.connect(
+      [handshake](Connection::State state) {
+        TrackingHandshake::OnStateChange(handshake, state);
+      });
+  connection->Connect(*master);
+  shard_cache->connection = std::move(connection);
+}
+
+void ClientSideCache::AccountLookup(bool hit) {
+  (hit ? hits_ : misses_).fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/storages/redis/impl/base.hpp>
+#include <userver/storages/redis/reply.hpp>
+#include <userver/utils/periodic_task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+class Sentinel;
+class ThreadPools;
+}  // namespace redis
+
+namespace storages::redis {
+
+struct ClientSideCacheSettings {
+  /// Maximum number of cached keys per shard
+  std::size_t max_keys{10000};
+  /// Only the keys starting with one of the prefixes are cached, all the keys
+  /// are cached if empty
+  std::vector<std::string> prefixes;
+  /// Period of the tracking connections check
+  std::chrono::milliseconds check_interval{std::chrono::seconds{1}};
+};
+
+struct ClientSideCacheStatistics {
+  std::uint64_t hits{0};
+  std::uint64_t misses{0};
+  std::uint64_t invalidations{0};
+  std::uint64_t flushes{0};
+};
+
+/// @brief Client-side cache of GET, HGET and MGET replies.
+///
+/// The cache of a shard is kept correct with the invalidation messages of the
+/// redis server tracking (CLIENT TRACKING in BCAST mode). A dedicated
+/// connection to the master of each shard redirects the invalidation messages
+/// to itself and receives them on the `__redis__:invalidate` channel, so no
+/// RESP3 support is required from the hiredis library.
+///
+/// Values are cached only while the tracking connection of the shard is
+/// subscribed, the cache of the shard is flushed when the connection is lost
+/// or the master changes. The cached commands are always sent to the master
+/// as the invalidation messages are received from it.
+class ClientSideCache final {
+ public:
+  struct ShardCache;
+
+  /// Stores the reply of a request in the cache, unless the key was modified
+  /// since the request was sent
+  class Fill final {
+   public:
+    Fill() = default;
+
+    /// @returns true if the reply is to be stored in the cache
+    bool IsActive() const { return shard_cache_ != nullptr; }
+
+    void Commit(const ReplyPtr& reply);
+
+   private:
+    friend class ClientSideCache;
+
+    enum class Command { kGet, kHget, kMget };
+
+    std::shared_ptr<ShardCache> shard_cache_;
+    Command command_{Command::kGet};
+    std::vector<std::string> keys_;
+    std::string field_;
+    std::uint64_t fill_id_{0};
+  };
+
+  ClientSideCache(std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
+                  std::shared_ptr<USERVER_NAMESPACE::redis::ThreadPools>
+                      thread_pools,
+                  ClientSideCacheSettings settings);
+  ~ClientSideCache();
+
+  bool IsCacheable(const std::string& key) const;
+
+  /// @returns the cached reply or std::nullopt, in the latter case `fill` is
+  /// set up to cache the reply of the request
+  std::optional<ReplyData> Get(size_t shard, const std::string& key,
+                               Fill& fill);
+  std::optional<ReplyData> Hget(size_t shard, const std::string& key,
+                                const std::string& field, Fill& fill);
+  std::optional<ReplyData> Mget(size_t shard,
+                                const std::vector<std::string>& keys,
+                                Fill& fill);
+
+  ClientSideCacheStatistics GetStatistics() const;
+
+ private:
+  void CheckConnections();
+  void Reconnect(size_t shard,
+                 const std::optional<USERVER_NAMESPACE::redis::ConnectionInfo>&
+                     master);
+  void AccountLookup(bool hit);
+
+  const std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel_;
+  const std::shared_ptr<USERVER_NAMESPACE::redis::ThreadPools> thread_pools_;
+  const ClientSideCacheSettings settings_;
+  std::vector<std::shared_ptr<ShardCache>> shards_;
+  std::atomic<std::uint64_t> hits_{0};
+  std::atomic<std::uint64_t> misses_{0};
+  USERVER_NAMESPACE::utils::PeriodicTask check_task_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
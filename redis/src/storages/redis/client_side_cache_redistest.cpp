@@ -0,0 +1,129 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <storages/redis/client_impl.hpp>
+#include <storages/redis/client_side_cache.hpp>
+#include <storages/redis/util_redistest.hpp>
+#include <userver/engine/sleep.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::milliseconds kCheckInterval{50};
+
+class ClientSideCacheTest {
+ public:
+  explicit ClientSideCacheTest(std::vector<std::string> prefixes = {}) {
+    auto thread_pools = MakeTestsuiteRedisThreadPools();
+    auto sentinel = MakeTestsuiteRedisSentinel(thread_pools);
+
+    storages::redis::ClientSideCacheSettings settings;
+    settings.prefixes = std::move(prefixes);
+    settings.check_interval = kCheckInterval;
+    cache_ = std::make_shared<storages::redis::ClientSideCache>(
+        sentinel, std::move(thread_pools), std::move(settings));
+    client_ = std::make_shared<storages::redis::ClientImpl>(
+        sentinel, std::nullopt, cache_);
+    // A separate client without the cache to modify the keys
+    writer_ =
+        std::make_shared<storages::redis::ClientImpl>(std::move(sentinel));
+  }
+
+  storages::redis::Client& Client() { return *client_; }
+  storages::redis::Client& Writer() { return *writer_; }
+  storages::redis::ClientSideCacheStatistics Stats() const {
+    return cache_->GetStatistics();
+  }
+
+  // The tracking is set up asynchronously, reads a key until it is served
+  // from the cache
+  void WaitCached(const std::string& key) {
+    const auto deadline = std::chrono::steady_clock::now() + kWaitTimeout;
+    const auto hits = Stats().hits;
+    while (std::chrono::steady_clock::now() < deadline) {
+      client_->Get(key, {}).Get();
+      if (Stats().hits > hits) return;
+      engine::SleepFor(kWaitStep);
+    }
+    FAIL() << "key " << key << " was not cached";
+  }
+
+ private:
+  std::shared_ptr<storages::redis::ClientSideCache> cache_;
+  std::shared_ptr<storages::redis::Client> client_;
+  std::shared_ptr<storages::redis::Client> writer_;
+};
+
+}  // namespace
+
+UTEST(RedisClientSideCache, GetInvalidation) {
+  ClientSideCacheTest test;
+  test.Writer().Set("csc_key", "old", {}).Get();
+  test.WaitCached("csc_key");
+
+  const auto hits = test.Stats().hits;
+  EXPECT_EQ(test.Client().Get("csc_key", {}).Get(), "old");
+  EXPECT_EQ(test.Stats().hits, hits + 1);
+
+  test.Writer().Set("csc_key", "new", {}).Get();
+  EXPECT_TRUE(WaitFor([&] {
+    return test.Client().Get("csc_key", {}).Get() == "new";
+  }));
+  EXPECT_GE(test.Stats().invalidations, 1);
+
+  test.Writer().Del("csc_key", {}).Get();
+  EXPECT_TRUE(WaitFor([&] { return !test.Client().Get("csc_key", {}).Get(); }));
+}
+
+UTEST(RedisClientSideCache, Hget) {
+  ClientSideCacheTest test;
+  test.Writer().Hset("csc_hash", "field", "old", {}).Get();
+  test.WaitCached("csc_hash_ready");
+
+  EXPECT_EQ(test.Client().Hget("csc_hash", "field", {}).Get(), "old");
+  const auto hits = test.Stats().hits;
+  EXPECT_EQ(test.Client().Hget("csc_hash", "field", {}).Get(), "old");
+  EXPECT_EQ(test.Stats().hits, hits + 1);
+
+  test.Writer().Hset("csc_hash", "field", "new", {}).Get();
+  EXPECT_TRUE(WaitFor([&] {
+    return test.Client().Hget("csc_hash", "field", {}).Get() == "new";
+  }));
+}
+
+UTEST(RedisClientSideCache, Mget) {
+  ClientSideCacheTest test;
+  test.Writer().Mset({{"csc_m1", "a"}, {"csc_m2", "b"}}, {}).Get();
+  test.WaitCached("csc_m1");
+
+  const std::vector<std::optional<std::string>> expected{"a", "b"};
+  EXPECT_EQ(test.Client().Mget({"csc_m1", "csc_m2"}, {}).Get(), expected);
+  const auto hits = test.Stats().hits;
+  EXPECT_EQ(test.Client().Mget({"csc_m1", "csc_m2"}, {}).Get(), expected);
+  EXPECT_EQ(test.Stats().hits, hits + 1);
+
+  test.Writer().Set("csc_m2", "c", {}).Get();
+  const std::vector<std::optional<std::string>> updated{"a", "c"};
+  EXPECT_TRUE(WaitFor([&] {
+    return test.Client().Mget({"csc_m1", "csc_m2"}, {}).Get() == updated;
+  }));
+}
+
+UTEST(RedisClientSideCache, Prefixes) {
+  ClientSideCacheTest test({"csc_cached:"});
+  test.Writer().Set("csc_cached:key", "value", {}).Get();
+  test.Writer().Set("csc_other", "value", {}).Get();
+  test.WaitCached("csc_cached:key");
+
+  const auto stats = test.Stats();
+  EXPECT_EQ(test.Client().Get("csc_other", {}).Get(), "value");
+  EXPECT_EQ(test.Client().Get("csc_other", {}).Get(), "value");
+  EXPECT_EQ(test.Stats().hits, stats.hits);
+  EXPECT_EQ(test.Stats().misses, stats.misses);
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <userver/storages/redis/component.hpp>
 
+#include <chrono>
+#include <optional>
 #include <stdexcept>
 #include <vector>
 
@@ -29,6 +31,7 @@
 #include <userver/storages/redis/subscribe_client.hpp>
 
 #include "client_impl.hpp"
+#include "client_side_cache.hpp"
 #include "redis_secdist.hpp"
 #include "subscribe_client_impl.hpp"
 
@@ -62,6 +65,12 @@ formats::json::ValueBuilder InstanceStatisticsToJson(
       utils::statistics::PercentileToJson(stats.timings_percentile);
   utils::statistics::SolomonSkip(result["timings"]["1min"]);
 
+  result["commands-flushes"]["count"] = stats.commands_flushes;
+  result["commands-flushes"]["size"]["1min"] =
+      utils::statistics::PercentileToJson(stats.commands_flush_size_percentile);
+  utils::statistics::SolomonSkip(result["commands-flushes"]["size"]["1min"]);
+  result["socket-writes"] = stats.socket_writes;
+
   result["reconnects"] = stats.reconnects;
 
   for (size_t i = 0; i <= redis::REDIS_ERR_MAX; ++i)
@@ -117,6 +126,9 @@ formats::json::ValueBuilder ShardStatisticsToJson(
           std::chrono::steady_clock::now() - shard_stats.last_ready_time)
           .count();
   result["not_ready_ms"] = shard_stats.is_ready ? 0 : not_ready;
+
+  result["hedged-requests"]["sent"] = shard_stats.hedges_sent;
+  result["hedged-requests"]["won"] = shard_stats.hedges_won;
   return result;
 }
 
@@ -158,6 +170,16 @@ formats::json::ValueBuilder RedisStatisticsToJson(
   return result;
 }
 
+formats::json::ValueBuilder ClientSideCacheStatisticsToJson(
+    const storages::redis::ClientSideCacheStatistics& stats) {
+  formats::json::ValueBuilder json(formats::json::Type::kObject);
+  json["hits"] = stats.hits;
+  json["misses"] = stats.misses;
+  json["invalidations"] = stats.invalidations;
+  json["flushes"] = stats.flushes;
+  return json;
+}
+
 formats::json::ValueBuilder PubsubChannelStatisticsToJson(
     const redis::PubsubChannelStatistics& stats, bool extra) {
   formats::json::ValueBuilder json(formats::json::Type::kObject);
@@ -233,6 +255,7 @@ struct RedisGroup {
   std::string db;
   std::string config_name;
   std::string sharding_strategy;
+  std::optional<storages::redis::ClientSideCacheSettings> client_side_cache;
 };
 
 RedisGroup Parse(const yaml_config::YamlConfig& value,
@@ -241,6 +264,17 @@ RedisGroup Parse(const yaml_config::YamlConfig& value,
   config.db = value["db"].As<std::string>();
   config.config_name = value["config_name"].As<std::string>();
   config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
+
+  const auto& cache = value["client_side_cache"];
+  if (!cache.IsMissing()) {
+    auto& settings = config.client_side_cache.emplace();
+    settings.max_keys = cache["max_keys"].As<size_t>(settings.max_keys);
+    settings.prefixes =
+        cache["prefixes"].As<std::vector<std::string>>(settings.prefixes);
+    settings.check_interval =
+        cache["check_interval"].As<std::chrono::milliseconds>(
+            settings.check_interval);
+  }
   return config;
 }
 
@@ -346,8 +380,14 @@ void Redis::Connect(const ComponentConfig& config,
         testsuite_redis_control);
     if (sentinel) {
       sentinels_.emplace(redis_group.db, sentinel);
-      const auto& client =
-          std::make_shared<storages::redis::ClientImpl>(sentinel);
+      std::shared_ptr<storages::redis::ClientSideCache> client_side_cache;
+      if (redis_group.client_side_cache) {
+        client_side_cache = std::make_shared<storages::redis::ClientSideCache>(
+            sentinel, thread_pools_, *redis_group.client_side_cache);
+        client_side_caches_.emplace(redis_group.db, client_side_cache);
+      }
+      const auto& client = std::make_shared<storages::redis::ClientImpl>(
+          sentinel, std::nullopt, std::move(client_side_cache));
       clients_.emplace(redis_group.db, client);
     } else {
       LOG_WARNING() << "skip redis client for " << redis_group.db;
@@ -411,6 +451,12 @@ formats::json::Value Redis::ExtendStatisticsRedis(
     const auto& name = client.first;
     const auto& redis = client.second;
     json[name] = RedisStatisticsToJson(redis);
+
+    const auto cache_it = client_side_caches_.find(name);
+    if (cache_it != client_side_caches_.end()) {
+      json[name]["client-side-cache"] =
+          ClientSideCacheStatisticsToJson(cache_it->second->GetStatistics());
+    }
   }
   utils::statistics::SolomonChildrenAreLabelValues(json, "redis_database");
   return json.ExtractValue();
@@ -494,6 +540,26 @@ properties:
                       - KeyShardCrc32
                       - KeyShardTaximeterCrc32
                       - KeyShardGpsStorageDriver
+                client_side_cache:
+                    type: object
+                    description: enables caching of GET, HGET and MGET replies invalidated by the server key tracking
+                    additionalProperties: false
+                    properties:
+                        max_keys:
+                            type: integer
+                            description: maximum number of cached keys per shard
+                            defaultDescription: 10000
+                        prefixes:
+                            type: array
+                            description: only the keys with one of the prefixes are cached, all the keys are cached if empty
+                            defaultDescription: "[]"
+                            items:
+                                type: string
+                                description: key prefix
+                        check_interval:
+                            type: string
+                            description: period of the tracking connections check
+                            defaultDescription: 1s
     subscribe_groups:
         type: array
         description: array of redis clusters to work with in subscribe mode
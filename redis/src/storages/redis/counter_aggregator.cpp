@@ -0,0 +1,217 @@
+#include <userver/storages/redis/counter_aggregator.hpp>
+
+#include <functional>
+#include <unordered_map>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+namespace {
+
+const std::string kFlushTaskName = "redis-counter-aggregator";
+
+template <typename Request>
+void WaitRequests(std::vector<Request>& requests,
+                  std::atomic<std::uint64_t>& failed_commands) {
+  for (auto& request : requests) {
+    try {
+      request.Get();
+    } catch (const std::exception& e) {
+      ++failed_commands;
+      LOG_WARNING() << "Failed to flush a redis counter: " << e;
+    }
+  }
+}
+
+}  // namespace
+
+CounterAggregator::CounterAggregator(ClientPtr client,
+                                     CounterAggregatorSettings settings,
+                                     engine::TaskProcessor& task_processor)
+    : client_(std::move(client)),
+      settings_(std::move(settings)),
+      local_shards_(settings_.local_shards) {
+  UASSERT(client_);
+  UINVARIANT(settings_.local_shards > 0, "local_shards must be positive");
+
+  task_ =
+      utils::CriticalAsync(task_processor, kFlushTaskName, [this] { Run(); });
+}
+
+CounterAggregator::~CounterAggregator() { Stop(); }
+
+void CounterAggregator::Incrby(const std::string& key, int64_t increment) {
+  ++increments_;
+  auto& shard = GetLocalShard(key);
+  {
+    std::lock_guard<engine::Mutex> lock(shard.mutex);
+    auto [it, inserted] = shard.counters.keys.try_emplace(key, 0);
+    it->second += increment;
+    if (!inserted) return;
+    ++shard.size;
+  }
+  OnCounterAdded();
+}
+
+void CounterAggregator::Hincrby(const std::string& key,
+                                const std::string& field, int64_t increment) {
+  ++increments_;
+  auto& shard = GetLocalShard(key);
+  {
+    std::lock_guard<engine::Mutex> lock(shard.mutex);
+    auto [it, inserted] = shard.counters.hashes[key].try_emplace(field, 0);
+    it->second += increment;
+    if (!inserted) return;
+    ++shard.size;
+  }
+  OnCounterAdded();
+}
+
+void CounterAggregator::Flush() {
+  std::lock_guard<engine::Mutex> flush_lock(flush_mutex_);
+
+  Counters counters;
+  size_t size = 0;
+  for (auto& shard : local_shards_) {
+    Counters shard_counters;
+    {
+      std::lock_guard<engine::Mutex> lock(shard.mutex);
+      std::swap(shard_counters, shard.counters);
+      size += shard.size;
+      shard.size = 0;
+    }
+    // A key is always accumulated in the same local shard
+    counters.keys.merge(shard_counters.keys);
+    counters.hashes.merge(shard_counters.hashes);
+  }
+  size_ -= size;
+  if (!size) return;
+
+  if (settings_.use_transaction) {
+    SendTransactions(counters);
+  } else {
+    SendPipelined(counters);
+  }
+  ++flushes_;
+}
+
+void CounterAggregator::Stop() {
+  if (!task_.IsValid()) return;
+  task_.SyncCancel();
+  task_ = {};
+  Flush();
+}
+
+CounterAggregatorStatistics CounterAggregator::GetStatistics() const {
+  CounterAggregatorStatistics stats;
+  stats.increments = increments_.load();
+  stats.commands = commands_.load();
+  stats.flushes = flushes_.load();
+  stats.failed_commands = failed_commands_.load();
+  return stats;
+}
+
+CounterAggregator::LocalShard& CounterAggregator::GetLocalShard(
+    const std::string& key) {
+  return local_shards_[std::hash<std::string>{}(key) % local_shards_.size()];
+}
+
+void CounterAggregator::OnCounterAdded() {
+  if (++size_ >= settings_.max_counters) flush_event_.Send();
+}
+
+void CounterAggregator::Run() {
+  while (!engine::current_task::ShouldCancel()) {
+    // Wakes up early if max_counters is reached
+    [[maybe_unused]] const bool sent =
+        flush_event_.WaitForEventFor(settings_.flush_interval);
+    if (engine::current_task::ShouldCancel()) break;
+    try {
+      Flush();
+    } catch (const std::exception& e) {
+      LOG_ERROR() << "Failed to flush redis counters: " << e;
+    }
+  }
+}
+
+void CounterAggregator::SendPipelined(Counters& counters) {
+  std::vector<RequestIncrby> incrby_requests;
+  incrby_requests.reserve(counters.keys.size());
+  for (auto& [key, increment] : counters.keys) {
+    if (!increment) continue;
+    incrby_requests.push_back(
+        client_->Incrby(key, increment, settings_.command_control));
+  }
+
+  std::vector<RequestHincrby> hincrby_requests;
+  for (auto& [key, fields] : counters.hashes) {
+    for (auto& [field, increment] : fields) {
+      if (!increment) continue;
+      hincrby_requests.push_back(
+          client_->Hincrby(key, field, increment, settings_.command_control));
+    }
+  }
+
+  commands_ += incrby_requests.size() + hincrby_requests.size();
+  WaitRequests(incrby_requests, failed_commands_);
+  WaitRequests(hincrby_requests, failed_commands_);
+}
+
+void CounterAggregator::SendTransactions(Counters& counters) {
+  struct ShardTransaction {
+    TransactionPtr transaction;
+    size_t commands{0};
+  };
+  std::unordered_map<size_t, ShardTransaction> transactions;
+  const auto get_transaction = [&](const std::string& key) -> auto& {
+    auto& shard_transaction = transactions[client_->ShardByKey(key)];
+    if (!shard_transaction.transaction) {
+      shard_transaction.transaction =
+          client_->Multi(Transaction::CheckShards::kSame);
+    }
+    ++shard_transaction.commands;
+    return *shard_transaction.transaction;
+  };
+
+  for (auto& [key, increment] : counters.keys) {
+    if (!increment) continue;
+    // The replies are checked with the reply of EXEC
+    [[maybe_unused]] auto request =
+        get_transaction(key).Incrby(key, increment);
+  }
+  for (auto& [key, fields] : counters.hashes) {
+    for (auto& [field, increment] : fields) {
+      if (!increment) continue;
+      [[maybe_unused]] auto request =
+          get_transaction(key).Hincrby(key, field, increment);
+    }
+  }
+
+  std::vector<std::pair<RequestExec, size_t>> requests;
+  requests.reserve(transactions.size());
+  for (auto& [shard, shard_transaction] : transactions) {
+    commands_ += shard_transaction.commands;
+    requests.emplace_back(
+        shard_transaction.transaction->Exec(settings_.command_control),
+        shard_transaction.commands);
+  }
+
+  for (auto& [request, commands] : requests) {
+    try {
+      request.Get();
+    } catch (const std::exception& e) {
+      failed_commands_ += commands;
+      LOG_WARNING() << "Failed to flush " << commands
+                    << " redis counters in a transaction: " << e;
+    }
+  }
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
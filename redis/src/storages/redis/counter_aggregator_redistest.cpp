@@ -0,0 +1,100 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <storages/redis/util_redistest.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/storages/redis/counter_aggregator.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr size_t kIncrementsCount = 100;
+
+storages::redis::CounterAggregatorSettings MakeSettings() {
+  storages::redis::CounterAggregatorSettings settings;
+  // Flushes only on Stop() and on max_counters
+  settings.flush_interval = std::chrono::hours{1};
+  return settings;
+}
+
+void Increment(storages::redis::CounterAggregator& aggregator) {
+  for (size_t i = 0; i < kIncrementsCount; ++i) {
+    aggregator.Incrby("aggregated_counter", 2);
+    aggregator.Hincrby("aggregated_hash", "field", 1);
+    aggregator.Hincrby("aggregated_hash", "zero", i % 2 ? 1 : -1);
+  }
+}
+
+void CheckCounters(storages::redis::Client& client) {
+  EXPECT_EQ(client.Get("aggregated_counter", {}).Get(),
+            std::to_string(2 * kIncrementsCount));
+  EXPECT_EQ(client.Hget("aggregated_hash", "field", {}).Get(),
+            std::to_string(kIncrementsCount));
+  EXPECT_EQ(client.Hget("aggregated_hash", "zero", {}).Get(), std::nullopt);
+}
+
+}  // namespace
+
+UTEST(RedisCounterAggregator, FlushOnStop) {
+  auto client = MakeTestsuiteRedisClient();
+  client->Del("aggregated_counter", {}).Get();
+  client->Del("aggregated_hash", {}).Get();
+
+  storages::redis::CounterAggregator aggregator(
+      client, MakeSettings(), engine::current_task::GetTaskProcessor());
+  Increment(aggregator);
+  EXPECT_EQ(client->Get("aggregated_counter", {}).Get(), std::nullopt);
+
+  aggregator.Stop();
+  CheckCounters(*client);
+
+  const auto stats = aggregator.GetStatistics();
+  EXPECT_EQ(stats.increments, 3 * kIncrementsCount);
+  // The zero increment of the hash field is not sent
+  EXPECT_EQ(stats.commands, 2);
+  EXPECT_EQ(stats.flushes, 1);
+  EXPECT_EQ(stats.failed_commands, 0);
+  EXPECT_EQ(stats.GetReductionFactor(), 1.5 * kIncrementsCount);
+}
+
+UTEST(RedisCounterAggregator, Transaction) {
+  auto client = MakeTestsuiteRedisClient();
+  client->Del("aggregated_counter", {}).Get();
+  client->Del("aggregated_hash", {}).Get();
+
+  auto settings = MakeSettings();
+  settings.use_transaction = true;
+  storages::redis::CounterAggregator aggregator(
+      client, settings, engine::current_task::GetTaskProcessor());
+  Increment(aggregator);
+  aggregator.Flush();
+  CheckCounters(*client);
+
+  const auto stats = aggregator.GetStatistics();
+  EXPECT_EQ(stats.commands, 2);
+  EXPECT_EQ(stats.failed_commands, 0);
+}
+
+UTEST(RedisCounterAggregator, MaxCounters) {
+  auto client = MakeTestsuiteRedisClient();
+  client->Del("aggregated_counter", {}).Get();
+  client->Del("aggregated_hash", {}).Get();
+
+  auto settings = MakeSettings();
+  settings.max_counters = 2;
+  storages::redis::CounterAggregator aggregator(
+      client, settings, engine::current_task::GetTaskProcessor());
+  aggregator.Incrby("aggregated_counter", 1);
+  aggregator.Hincrby("aggregated_hash", "field", 1);
+
+  EXPECT_TRUE(WaitFor([&] { return aggregator.GetStatistics().flushes > 0; }));
+  EXPECT_EQ(aggregator.GetStatistics().flushes, 1);
+  EXPECT_EQ(client->Get("aggregated_counter", {}).Get(), "1");
+}
+
+USERVER_NAMESPACE_END
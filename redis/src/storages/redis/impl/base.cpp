@@ -77,17 +77,33 @@ void PutArg(CmdArgs::CmdArgsArray& args_, std::string&& arg) {
 }
 
 void PutArg(CmdArgs::CmdArgsArray& args_, const std::vector<std::string>& arg) {
+  args_.reserve(args_.size() + arg.size());
   for (const auto& str : arg) args_.emplace_back(str);
 }
 
+void PutArg(CmdArgs::CmdArgsArray& args_, std::vector<std::string>&& arg) {
+  args_.reserve(args_.size() + arg.size());
+  for (auto& str : arg) args_.push_back(std::move(str));
+}
+
 void PutArg(CmdArgs::CmdArgsArray& args_,
             const std::vector<std::pair<std::string, std::string>>& arg) {
+  args_.reserve(args_.size() + arg.size() * 2);
   for (const auto& pair : arg) {
     args_.emplace_back(pair.first);
     args_.emplace_back(pair.second);
   }
 }
 
+void PutArg(CmdArgs::CmdArgsArray& args_,
+            std::vector<std::pair<std::string, std::string>>&& arg) {
+  args_.reserve(args_.size() + arg.size() * 2);
+  for (auto& pair : arg) {
+    args_.push_back(std::move(pair.first));
+    args_.push_back(std::move(pair.second));
+  }
+}
+
 void PutArg(CmdArgs::CmdArgsArray& args_,
             const std::vector<std::pair<double, std::string>>& arg) {
   for (const auto& pair : arg) {
@@ -155,6 +171,8 @@ CommandControl CommandControl::MergeWith(const CommandControl& b) const {
     res.force_retries_to_master_on_nil_reply =
         b.force_retries_to_master_on_nil_reply;
   if (b.force_shard_idx) res.force_shard_idx = b.force_shard_idx;
+  if (b.hedging_budget_percent > 0)
+    res.hedging_budget_percent = b.hedging_budget_percent;
   return res;
 }
 
@@ -177,6 +195,8 @@ std::string CommandControl::ToString() const {
     ss << " force_server_id: " << force_server_id.GetId() << ',';
   if (force_request_to_master) ss << " force_request_to_master: true,";
   if (force_shard_idx) ss << " force_shard_idx: " << *force_shard_idx << ',';
+  if (hedging_budget_percent)
+    ss << " hedging_budget_percent: " << hedging_budget_percent << ',';
   ss << " max ping: " << max_ping_latency.count();
   return ss.str();
 }
@@ -0,0 +1,56 @@
+#include <storages/redis/impl/format_command.hpp>
+
+#include <charconv>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+namespace {
+
+// Enough for any size_t
+constexpr std::size_t kMaxNumberLength = 20;
+
+std::size_t NumberLength(std::size_t value) {
+  std::size_t length = 1;
+  for (; value >= 10; value /= 10) ++length;
+  return length;
+}
+
+std::size_t HeaderLength(std::size_t value) {
+  // type marker, number and CRLF
+  return 1 + NumberLength(value) + 2;
+}
+
+void AppendHeader(std::string& buffer, char type, std::size_t value) {
+  char number[kMaxNumberLength];
+  const auto result = std::to_chars(number, number + sizeof(number), value);
+  UASSERT(result.ec == std::errc{});
+  buffer.push_back(type);
+  buffer.append(number, result.ptr);
+  buffer.append("\r\n", 2);
+}
+
+}  // namespace
+
+void AppendFormattedCommand(std::string& buffer,
+                            const CmdArgs::CmdArgsArray& args) {
+  std::size_t size = HeaderLength(args.size());
+  for (const auto& arg : args) {
+    size += HeaderLength(arg.size()) + arg.size() + 2;
+  }
+  buffer.reserve(buffer.size() + size);
+
+  AppendHeader(buffer, '*', args.size());
+  for (const auto& arg : args) {
+    AppendHeader(buffer, '$', arg.size());
+    buffer.append(arg);
+    buffer.append("\r\n", 2);
+  }
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
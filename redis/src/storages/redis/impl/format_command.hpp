@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+
+#include <userver/storages/redis/impl/base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// Appends the command in the RESP format to the buffer, the result is the
+/// same as of redisFormatCommandArgv() but is written without intermediate
+/// allocations to a buffer that may be reused between commands
+void AppendFormattedCommand(std::string& buffer,
+                            const CmdArgs::CmdArgsArray& args);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hiredis/hiredis.h>
+
+#include <storages/redis/impl/format_command.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::vector<std::pair<std::string, std::string>> MakeKeyValues(
+    std::size_t count, std::size_t size) {
+  std::vector<std::pair<std::string, std::string>> result;
+  result.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    result.emplace_back("key" + std::to_string(i), std::string(size, 'v'));
+  }
+  return result;
+}
+
+}  // namespace
+
+// The way the commands were sent before: argv arrays formatted by hiredis
+void redis_format_command_hiredis(benchmark::State& state) {
+  const auto key_values = MakeKeyValues(state.range(0), state.range(1));
+
+  for (auto _ : state) {
+    redis::CmdArgs args{"mset", key_values};
+    const auto& argv_strings = args.args.front();
+    std::vector<const char*> argv;
+    std::vector<size_t> argv_len;
+    argv.reserve(argv_strings.size());
+    argv_len.reserve(argv_strings.size());
+    for (const auto& arg : argv_strings) {
+      argv.push_back(arg.data());
+      argv_len.push_back(arg.size());
+    }
+    char* cmd = nullptr;
+    const auto len =
+        redisFormatCommandArgv(&cmd, static_cast<int>(argv.size()),
+                               argv.data(), argv_len.data());
+    benchmark::DoNotOptimize(len);
+    redisFreeCommand(cmd);
+  }
+}
+BENCHMARK(redis_format_command_hiredis)
+    ->RangeMultiplier(16)
+    ->Ranges({{1, 4096}, {16, 4096}});
+
+void redis_format_command(benchmark::State& state) {
+  const auto key_values = MakeKeyValues(state.range(0), state.range(1));
+  std::string buffer;
+
+  for (auto _ : state) {
+    redis::CmdArgs args{"mset", key_values};
+    buffer.clear();
+    redis::AppendFormattedCommand(buffer, args.args.front());
+    benchmark::DoNotOptimize(buffer.data());
+  }
+}
+BENCHMARK(redis_format_command)
+    ->RangeMultiplier(16)
+    ->Ranges({{1, 4096}, {16, 4096}});
+
+// The values are moved to the command arguments, as done by the client
+void redis_format_command_moved(benchmark::State& state) {
+  std::string buffer;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto key_values = MakeKeyValues(state.range(0), state.range(1));
+    state.ResumeTiming();
+
+    redis::CmdArgs args{"hset", "hash", std::move(key_values)};
+    buffer.clear();
+    redis::AppendFormattedCommand(buffer, args.args.front());
+    benchmark::DoNotOptimize(buffer.data());
+  }
+}
+BENCHMARK(redis_format_command_moved)
+    ->RangeMultiplier(16)
+    ->Ranges({{1, 4096}, {16, 4096}});
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <hiredis/hiredis.h>
+
+#include <storages/redis/impl/format_command.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string FormatWithHiredis(const redis::CmdArgs::CmdArgsArray& args) {
+  std::vector<const char*> argv;
+  std::vector<size_t> argv_len;
+  for (const auto& arg : args) {
+    argv.push_back(arg.data());
+    argv_len.push_back(arg.size());
+  }
+
+  char* cmd = nullptr;
+  const auto len = redisFormatCommandArgv(&cmd, static_cast<int>(args.size()),
+                                          argv.data(), argv_len.data());
+  EXPECT_GT(len, 0);
+  std::string result(cmd, len);
+  redisFreeCommand(cmd);
+  return result;
+}
+
+}  // namespace
+
+TEST(FormatCommand, Simple) {
+  std::string buffer;
+  redis::AppendFormattedCommand(buffer, {"GET", "key"});
+  EXPECT_EQ(buffer, "*2\r\n$3\r\nGET\r\n$3\r\nkey\r\n");
+
+  redis::AppendFormattedCommand(buffer, {"PING"});
+  EXPECT_EQ(buffer, "*2\r\n$3\r\nGET\r\n$3\r\nkey\r\n*1\r\n$4\r\nPING\r\n");
+}
+
+TEST(FormatCommand, SameAsHiredis) {
+  const std::vector<redis::CmdArgs::CmdArgsArray> commands{
+      {"SET", "", std::string("\0\r\n", 3)},
+      {"MSET", "k1", std::string(12345, 'v'), "k2", "v2"},
+      {"HSET", "hash", "field", std::string(1 << 20, 'x')},
+  };
+  for (const auto& args : commands) {
+    std::string buffer;
+    redis::AppendFormattedCommand(buffer, args);
+    EXPECT_EQ(buffer, FormatWithHiredis(args)) << args[0];
+  }
+}
+
+TEST(FormatCommand, CmdArgsMove) {
+  std::vector<std::pair<std::string, std::string>> key_values{
+      {"key", std::string(1000, 'v')}};
+  const auto* data = key_values[0].second.data();
+
+  redis::CmdArgs args{"mset", std::move(key_values)};
+  ASSERT_EQ(args.args[0].size(), 3);
+  EXPECT_EQ(args.args[0][2].data(), data);
+}
+
+USERVER_NAMESPACE_END
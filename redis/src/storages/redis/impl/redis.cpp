@@ -21,6 +21,7 @@
 #include <userver/storages/redis/impl/redis_stats.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 #include "ev_wrapper.hpp"
+#include "format_command.hpp"
 #include "tcp_socket.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -31,6 +32,8 @@ namespace {
 const auto kPingLatencyExp = 0.7;
 const auto kInitialPingLatencyMs = 1000;
 const size_t kMissedPingStreakThresholdDefault = 3;
+// The buffer of a huge command is not kept for the next commands
+const size_t kMaxCommandBufferCapacity = 1 << 20;
 
 // channel is used for periodic subscribe/unsubscribe to calculate actual RTT
 // instead of sending PING commands which are not supported by hiredis in
@@ -130,6 +133,8 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
                                  int revents) noexcept;
   static void OnRedisReply(redisAsyncContext* c, void* r,
                            void* privdata) noexcept;
+  static void OnSocketWritable(struct ev_loop* loop, ev_io* w,
+                               int revents) noexcept;
   static void OnConnect(const redisAsyncContext* c, int status) noexcept;
   static void OnDisconnect(const redisAsyncContext* c, int status) noexcept;
   static void OnTimerPing(struct ev_loop* loop, ev_timer* w,
@@ -209,6 +214,8 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   size_t cmd_counter_ = 0;
   std::unordered_map<size_t, std::unique_ptr<SingleCommand>> reply_privdata_;
   std::unordered_map<const ev_timer*, size_t> reply_privdata_rev_;
+  // Reused to format the commands without allocations
+  std::string command_buffer_;
   bool subscriber_ = false;
   bool is_ping_in_flight_ = false;
   size_t missed_ping_streak_{0};
@@ -400,6 +407,11 @@ void Redis::RedisImpl::Connect(const std::string& host, int port,
         CheckError(redisLibevAttach(ev_thread_control_.GetEvLoop(), context_) !=
                        REDIS_OK,
                    "error in redisLibevAttach");
+      if (!err) {
+        auto* events = static_cast<redisLibevEvents*>(context_->ev.data);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+        ev_set_cb(&events->wev, OnSocketWritable);
+      }
       if (!err)
         CheckError(
             redisAsyncSetConnectCallback(context_, OnConnect) != REDIS_OK,
@@ -743,7 +755,11 @@ void Redis::RedisImpl::OnNewCommand(struct ev_loop*, ev_async* w,
 
 void Redis::RedisImpl::OnNewCommandImpl() {
   auto commands_buffering_settings = commands_buffering_settings_.Get();
-  if (WatchCommandTimerEnabled(*commands_buffering_settings) &&
+  // With nothing in flight there are no replies to wait for, buffering would
+  // only add latency
+  const bool idle = commands_buffering_settings->adaptive &&
+                    !watch_command_timer_started_ && !sent_count_;
+  if (WatchCommandTimerEnabled(*commands_buffering_settings) && !idle &&
       (!commands_buffering_settings->commands_buffering_threshold ||
        commands_size_.load() <
            commands_buffering_settings->commands_buffering_threshold)) {
@@ -761,6 +777,17 @@ void Redis::RedisImpl::OnNewCommandImpl() {
   }
 }
 
+void Redis::RedisImpl::OnSocketWritable(struct ev_loop*, ev_io* w,
+                                        int) noexcept {
+  // hiredis makes a single write of its output buffer per write event, all
+  // the commands added since the previous write go to the socket at once
+  auto* events = static_cast<redisLibevEvents*>(w->data);
+  auto* impl = static_cast<Redis::RedisImpl*>(events->context->data);
+  UASSERT(impl != nullptr);
+  impl->statistics_.AccountSocketWrite();
+  redisAsyncHandleWrite(events->context);
+}
+
 void Redis::RedisImpl::CommandLoopOnTimer(struct ev_loop*, ev_timer* w,
                                           int) noexcept {
   auto impl = static_cast<Redis::RedisImpl*>(w->data);
@@ -785,6 +812,7 @@ void Redis::RedisImpl::CommandLoopImpl() {
     std::swap(commands_, commands);
   }
   LOG_TRACE() << "commands size=" << commands.size();
+  if (!commands.empty()) statistics_.AccountCommandsFlush(commands.size());
   for (auto& command : commands) {
     ProcessCommand(command);
   }
@@ -1010,16 +1038,8 @@ void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
                  << log_extra_;
     }
 
-    std::vector<const char*> argv;
-    std::vector<size_t> argv_len;
-
-    argv.reserve(argc);
-    argv_len.reserve(argc);
-
-    for (const auto& arg : args) {
-      argv.push_back(arg.data());
-      argv_len.push_back(arg.size());
-    }
+    command_buffer_.clear();
+    AppendFormattedCommand(command_buffer_, args);
 
     {
       if (command->asking && (!multi || IsMultiCommand(args))) {
@@ -1028,16 +1048,20 @@ void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
         redisAsyncCommandArgv(context_, nullptr, nullptr, 1, &asking,
                               &asking_len);
       }
-      if (redisAsyncCommandArgv(context_, OnRedisReply,
-                                reinterpret_cast<void*>(cmd_counter_), argc,
-                                argv.data(), argv_len.data()) != REDIS_OK) {
+      if (redisAsyncFormattedCommand(
+              context_, OnRedisReply, reinterpret_cast<void*>(cmd_counter_),
+              command_buffer_.data(), command_buffer_.size()) != REDIS_OK) {
         LOG_ERROR() << log_extra_
-                    << "redisAsyncCommandArgv() failed on command " << args[0];
+                    << "redisAsyncFormattedCommand() failed on command "
+                    << args[0];
         InvokeCommandError(command, args[0], REDIS_ERR_OTHER);
         continue;
       }
     }
 
+    if (command_buffer_.capacity() > kMaxCommandBufferCapacity) {
+      std::string{}.swap(command_buffer_);
+    }
     if (IsExecCommand(args)) multi = false;
 
     if (!IsUnsubscribeCommand(args)) {
@@ -51,6 +51,13 @@ void Statistics::AccountPing(std::chrono::milliseconds ping) {
   last_ping_ms = ping.count();
 }
 
+void Statistics::AccountCommandsFlush(size_t size) {
+  ++commands_flushes;
+  commands_flush_size_percentile.GetCurrentCounter().Account(size);
+}
+
+void Statistics::AccountSocketWrite() { ++socket_writes; }
+
 InstanceStatistics ShardStatistics::GetShardTotalStatistics() const {
   redis::InstanceStatistics shard_total;
   for (const auto& it2 : instances) {
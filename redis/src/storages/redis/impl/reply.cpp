@@ -20,7 +20,7 @@ ReplyData::ReplyData(const redisReply* reply) {
   switch (reply->type) {
     case REDIS_REPLY_STRING:
       type_ = Type::kString;
-      string_ = std::string(reply->str, reply->len);
+      string_.assign(reply->str, reply->len);
       break;
     case REDIS_REPLY_ARRAY:
       type_ = Type::kArray;
@@ -37,11 +37,11 @@ ReplyData::ReplyData(const redisReply* reply) {
       break;
     case REDIS_REPLY_STATUS:
       type_ = Type::kStatus;
-      string_ = std::string(reply->str, reply->len);
+      string_.assign(reply->str, reply->len);
       break;
     case REDIS_REPLY_ERROR:
       type_ = Type::kError;
-      string_ = std::string(reply->str, reply->len);
+      string_.assign(reply->str, reply->len);
       break;
     default:
       type_ = Type::kNoReply;
@@ -21,3 +21,25 @@ TEST(Reply, IsUnusableInstanceErrorERR) {
   auto data = ReplyData::CreateError("ERR index out of range");
   EXPECT_FALSE(data.IsUnusableInstanceError());
 }
+
+TEST(Reply, StringView) {
+  const ReplyData string{"value"};
+  EXPECT_EQ(string.GetStringView(), "value");
+  EXPECT_EQ(string.GetStringView().data(), string.GetString().data());
+
+  const auto status = ReplyData::CreateStatus("OK");
+  EXPECT_EQ(status.GetStringView(), "OK");
+
+  const auto error = ReplyData::CreateError("ERR");
+  EXPECT_EQ(error.GetStringView(), "ERR");
+}
+
+TEST(Reply, KeyValuesNoCopy) {
+  const ReplyData data{ReplyData::Array{ReplyData{"key"}, ReplyData{"value"}}};
+  const auto key_values = data.GetKeyValues();
+  ASSERT_EQ(key_values.size(), 1);
+  for (const auto& key_value : key_values) {
+    EXPECT_EQ(&key_value.Key(), &data[0].GetString());
+    EXPECT_EQ(&key_value.Value(), &data[1].GetString());
+  }
+}
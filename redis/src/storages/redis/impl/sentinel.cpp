@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <stdexcept>
+#include <utility>
 
 #include <userver/logging/log.hpp>
 
@@ -288,7 +289,7 @@ void Sentinel::OnSubscribeReply(const MessageCallback message_callback,
                                 const UnsubscribeCallback unsubscribe_callback,
                                 ReplyPtr reply) {
   if (!reply->data.IsArray()) return;
-  const auto& reply_array = reply->data.GetArray();
+  auto& reply_array = reply->data.GetArray();
   if (reply_array.size() != 3 || !reply_array[0].IsString()) return;
   if (!strcasecmp(reply_array[0].GetString().c_str(), "SUBSCRIBE")) {
     if (subscribe_callback)
@@ -301,7 +302,7 @@ void Sentinel::OnSubscribeReply(const MessageCallback message_callback,
   } else if (!strcasecmp(reply_array[0].GetString().c_str(), "MESSAGE")) {
     if (message_callback)
       message_callback(reply->server_id, reply_array[1].GetString(),
-                       reply_array[2].GetString());
+                       std::move(reply_array[2].GetString()));
   }
 }
 
@@ -310,7 +311,7 @@ void Sentinel::OnPsubscribeReply(const PmessageCallback pmessage_callback,
                                  const UnsubscribeCallback unsubscribe_callback,
                                  ReplyPtr reply) {
   if (!reply->data.IsArray()) return;
-  const auto& reply_array = reply->data.GetArray();
+  auto& reply_array = reply->data.GetArray();
   if (!reply_array[0].IsString()) return;
   if (!strcasecmp(reply_array[0].GetString().c_str(), "PSUBSCRIBE")) {
     if (reply_array.size() == 3 && subscribe_callback)
@@ -323,7 +324,8 @@ void Sentinel::OnPsubscribeReply(const PmessageCallback pmessage_callback,
   } else if (!strcasecmp(reply_array[0].GetString().c_str(), "PMESSAGE")) {
     if (reply_array.size() == 4 && pmessage_callback)
       pmessage_callback(reply->server_id, reply_array[1].GetString(),
-                        reply_array[2].GetString(), reply_array[3].GetString());
+                        reply_array[2].GetString(),
+                        std::move(reply_array[3].GetString()));
   }
 }
 
@@ -351,6 +353,14 @@ size_t Sentinel::GetPublishShard(PubShard policy) {
   return 0;
 }
 
+std::optional<ConnectionInfo> Sentinel::GetMasterConnectionInfo(
+    size_t shard) const {
+  CheckShardIdx(shard);
+  auto infos = impl_->GetMasterShards().at(shard)->GetConnectionInfos();
+  if (infos.empty()) return std::nullopt;
+  return std::move(infos.front());
+}
+
 std::vector<std::shared_ptr<const Shard>> Sentinel::GetMasterShards() const {
   return impl_->GetMasterShards();
 }
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <sstream>
 #include <thread>
+#include <utility>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/crc.hpp>
@@ -34,6 +35,192 @@ ConnInfoMap ConvertConnectionInfoVectorToMap(
   return res;
 }
 
+// Shared by a read and its hedge, only the first reply is passed further.
+// Counts the requests in flight, zero once a reply is passed.
+class HedgingState {
+ public:
+  HedgingState(ReplyCallback callback, std::weak_ptr<Shard> shard,
+               std::weak_ptr<HedgeTimers> timers)
+      : callback_(std::move(callback)),
+        shard_(std::move(shard)),
+        timers_(std::move(timers)) {}
+
+  // Returns false if a reply is already passed
+  bool TryArm() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!in_flight_) return false;
+    is_armed_ = true;
+    return true;
+  }
+
+  // Returns whether the hedge timer was armed
+  bool Disarm() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::exchange(is_armed_, false);
+  }
+
+  // Copies the args of the original request for a hedge, returns nullopt if
+  // a reply is already passed. The args are moved away by the callback once
+  // the reply is passed, so they are copied under the lock.
+  std::optional<CmdArgs> TryAddRequest(const CmdArgs& args) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!in_flight_) return std::nullopt;
+    ++in_flight_;
+    return args.Clone();
+  }
+
+  // Returns whether to pass the reply: the first successful one, or a failed
+  // one if no other request is in flight
+  bool OnReply(bool ok) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!in_flight_) return false;
+    in_flight_ = ok ? 0 : in_flight_ - 1;
+    return !in_flight_;
+  }
+
+  bool IsDone() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !in_flight_;
+  }
+
+  const ReplyCallback& GetCallback() const { return callback_; }
+  std::shared_ptr<Shard> GetShard() const { return shard_.lock(); }
+  std::shared_ptr<HedgeTimers> GetTimers() const { return timers_.lock(); }
+
+ private:
+  const ReplyCallback callback_;
+  const std::weak_ptr<Shard> shard_;
+  const std::weak_ptr<HedgeTimers> timers_;
+
+  mutable std::mutex mutex_;
+  size_t in_flight_{1};
+  bool is_armed_{false};
+};
+
+ReplyCallback MakeHedgingCallback(std::shared_ptr<HedgingState> state,
+                                  bool is_hedge);
+
+}  // namespace
+
+// Delayed hedges of the reads, the timers run in the sentinel ev thread
+class HedgeTimers final : public std::enable_shared_from_this<HedgeTimers> {
+ public:
+  explicit HedgeTimers(engine::ev::ThreadControl ev_thread)
+      : ev_thread_(ev_thread) {}
+
+  void Start(std::shared_ptr<HedgingState> state, const CommandPtr& command,
+             std::chrono::milliseconds delay) {
+    auto timer = std::make_unique<Timer>();
+    timer->owner = this;
+    timer->state = std::move(state);
+    timer->command = command;
+    timer->instance_idx = command->instance_idx;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    ev_timer_init(&timer->timer, OnTimer, ToEvDuration(delay), 0.0);
+    timer->timer.data = timer.get();
+    ev_thread_.RunInEvLoopAsync(
+        [self = shared_from_this(), timer = std::move(timer)]() mutable {
+          if (self->is_stopped_ || !timer->state->TryArm()) return;
+          auto& watcher = timer->timer;
+          self->timers_.emplace(timer->state.get(), std::move(timer));
+          self->ev_thread_.Start(watcher);
+        });
+  }
+
+  void Cancel(std::shared_ptr<HedgingState> state) {
+    ev_thread_.RunInEvLoopAsync(
+        [self = shared_from_this(), state = std::move(state)] {
+          auto it = self->timers_.find(state.get());
+          if (it == self->timers_.end()) return;
+          self->ev_thread_.Stop(it->second->timer);
+          self->timers_.erase(it);
+        });
+  }
+
+  // Must be called from the ev thread
+  void Stop() {
+    is_stopped_ = true;
+    for (auto& item : timers_) ev_thread_.Stop(item.second->timer);
+    timers_.clear();
+  }
+
+ private:
+  struct Timer {
+    ev_timer timer{};
+    HedgeTimers* owner{nullptr};
+    std::shared_ptr<HedgingState> state;
+    // The original request
+    std::weak_ptr<Command> command;
+    size_t instance_idx{0};
+  };
+
+  static void OnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
+    auto* timer = static_cast<Timer*>(w->data);
+    UASSERT(timer != nullptr);
+    auto& timers = timer->owner->timers_;
+    auto it = timers.find(timer->state.get());
+    UASSERT(it != timers.end());
+    if (it == timers.end()) return;
+    const auto hedge = std::move(it->second);
+    timers.erase(it);
+    SendHedge(*hedge);
+  }
+
+  static void SendHedge(const Timer& hedge) {
+    const auto& state = hedge.state;
+    state->Disarm();
+    if (state->IsDone()) return;
+    const auto original = hedge.command.lock();
+    const auto shard = state->GetShard();
+    if (!original || !shard ||
+        !shard->TryStartHedge(original->control.hedging_budget_percent))
+      return;
+    auto args = state->TryAddRequest(original->args);
+    if (!args) {
+      shard->CancelHedge();
+      return;
+    }
+
+    auto command = PrepareCommand(
+        std::move(*args), MakeHedgingCallback(state, true), original->control,
+        original->counter, original->asking);
+    if (shard->AsyncCommandSkipInstance(command, hedge.instance_idx)) {
+      shard->AccountHedgeSent();
+      return;
+    }
+    shard->CancelHedge();
+    // The original request may have failed while the hedge was being sent
+    command->Callback()(command, std::make_shared<Reply>(
+                                     command->args.args.front().front(),
+                                     nullptr, REDIS_ERR_NOT_READY));
+  }
+
+  engine::ev::ThreadControl ev_thread_;
+  // Accessed from the ev thread only
+  std::unordered_map<const HedgingState*, std::unique_ptr<Timer>> timers_;
+  bool is_stopped_{false};
+};
+
+namespace {
+
+ReplyCallback MakeHedgingCallback(std::shared_ptr<HedgingState> state,
+                                  bool is_hedge) {
+  return [state = std::move(state), is_hedge](const CommandPtr& command,
+                                              ReplyPtr reply) {
+    const bool ok = reply->IsOk();
+    if (!state->OnReply(ok)) return;
+
+    // The hedge is not needed anymore
+    if (state->Disarm()) {
+      if (auto timers = state->GetTimers()) timers->Cancel(state);
+    }
+    if (is_hedge && ok) {
+      if (auto shard = state->GetShard()) shard->AccountHedgeWon();
+    }
+    state->GetCallback()(command, std::move(reply));
+  };
+}
+
 }  // namespace
 
 SentinelImpl::SentinelImpl(
@@ -58,7 +245,8 @@ SentinelImpl::SentinelImpl(
       cluster_mode_failed_(false),
       key_shard_(std::move(key_shard)),
       is_subscriber_(is_subscriber),
-      slot_info_(IsInClusterMode() ? std::make_unique<SlotInfo>() : nullptr) {
+      slot_info_(IsInClusterMode() ? std::make_unique<SlotInfo>() : nullptr),
+      hedge_timers_(std::make_shared<HedgeTimers>(ev_thread_)) {
   for (size_t i = 0; i < init_shards_->size(); ++i) {
     shards_[(*init_shards_)[i]] = i;
     connected_statuses_.push_back(std::make_unique<ConnectedStatus>());
@@ -242,8 +430,7 @@ void SentinelImpl::AsyncCommand(const SentinelCommand& scommand,
 
   auto start = scommand.start;
   auto counter = command->counter;
-  CommandPtr command_check_errors(PrepareCommand(
-      std::move(command->args),
+  ReplyCallback check_errors =
       [this, shard, master, start, counter, command](const CommandPtr& ccommand,
                                                      ReplyPtr reply) {
         if (counter != command->counter) return;
@@ -309,11 +496,20 @@ void SentinelImpl::AsyncCommand(const SentinelCommand& scommand,
         command->args = std::move(ccommand->args);
         InvokeCommand(command, std::move(reply));
         ccommand->args = std::move(command->args);
-      },
-      command->control, command->counter, command->asking, prev_instance_idx));
+      };
 
   if (!master) {
     UASSERT(shard < slaves_shards_.size());
+    if (AsyncHedgedCommand(check_errors, command, prev_instance_idx,
+                           slaves_shards_[shard]))
+      return;
+  }
+
+  CommandPtr command_check_errors(PrepareCommand(
+      std::move(command->args), std::move(check_errors), command->control,
+      command->counter, command->asking, prev_instance_idx));
+
+  if (!master) {
     auto slaves_shard = slaves_shards_[shard];
     if (slaves_shard->AsyncCommand(
             command_check_errors,
@@ -332,6 +528,35 @@ void SentinelImpl::AsyncCommand(const SentinelCommand& scommand,
   }
 }
 
+bool SentinelImpl::AsyncHedgedCommand(const ReplyCallback& check_errors,
+                                      const CommandPtr& command,
+                                      size_t prev_instance_idx,
+                                      const std::shared_ptr<Shard>& shard) {
+  const auto budget_percent = command->control.hedging_budget_percent;
+  if (!budget_percent || !command->control.force_server_id.IsAny() ||
+      shard->InstancesSize() < 2)
+    return false;
+  const auto delay = shard->GetHedgingDelay();
+  if (!delay.count()) return false;
+
+  auto state =
+      std::make_shared<HedgingState>(check_errors, shard, hedge_timers_);
+  CommandPtr command_check_errors(PrepareCommand(
+      std::move(command->args), MakeHedgingCallback(state, false),
+      command->control, command->counter, command->asking,
+      prev_instance_idx));
+  if (!shard->AsyncCommand(command_check_errors,
+                           &command_check_errors->instance_idx)) {
+    command->args = std::move(command_check_errors->args);
+    return false;
+  }
+  shard->AccountHedgeableRequest(budget_percent);
+
+  // The args are copied only if the hedge is sent
+  hedge_timers_->Start(std::move(state), command_check_errors, delay);
+  return true;
+}
+
 void SentinelImpl::AsyncCommandToSentinel(CommandPtr command) {
   UASSERT(sentinels_);
   sentinels_->AsyncCommand(std::move(command));
@@ -442,6 +667,7 @@ void SentinelImpl::RefreshConnectionInfo() {
 
     ProcessCreationOfShards(track_masters_, true, master_shards_);
     ProcessCreationOfShards(track_slaves_, false, slaves_shards_);
+    for (const auto& shard : slaves_shards_) shard->UpdateHedgingDelay();
     if (IsInClusterMode())
       ReadClusterHosts();
     else
@@ -466,6 +692,7 @@ void SentinelImpl::RefreshConnectionInfo() {
 void SentinelImpl::Stop() {
   ev_thread_.RunInEvLoopBlocking([this] {
     ev_thread_.Stop(check_timer_);
+    hedge_timers_->Stop();
     ev_thread_.Stop(watch_state_);
     ev_thread_.Stop(watch_update_);
     ev_thread_.Stop(watch_create_);
@@ -4,6 +4,7 @@
 #include <atomic>
 #include <chrono>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
@@ -33,6 +34,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+class HedgeTimers;
+
 class SentinelImpl {
  public:
   using ReadyChangeCallback = std::function<void(
@@ -177,6 +180,11 @@ class SentinelImpl {
                          std::vector<std::shared_ptr<Shard>>& shards,
                          bool master);
   void EnqueueCommand(const SentinelCommand& command);
+  // Sends a read to a slave and schedules its hedge, returns false if the
+  // command is not hedged and is not sent
+  bool AsyncHedgedCommand(const ReplyCallback& check_errors,
+                          const CommandPtr& command, size_t prev_instance_idx,
+                          const std::shared_ptr<Shard>& shard);
   size_t ParseMovedShard(const std::string& err_string);
   void RequestUpdateClusterSlots(size_t shard);
   void UpdateClusterSlots(size_t shard);
@@ -225,6 +233,7 @@ class SentinelImpl {
   utils::SwappingSmart<KeyShard> key_shard_;
   bool is_subscriber_;
   std::unique_ptr<SlotInfo> slot_info_;
+  std::shared_ptr<HedgeTimers> hedge_timers_;
   SentinelStatisticsInternal statistics_internal_;
   utils::SwappingSmart<KeysForShards> keys_for_shards_;
   std::optional<CommandsBufferingSettings> commands_buffering_settings_;
@@ -17,6 +17,29 @@ auto MakeGetRequest(redis::Sentinel& sentinel, const std::string& key,
                               sentinel.GetCommandControl(cc));
 }
 
+// Reply times of the replicas in the hedging tests
+const auto kWarmUpReplyTime = std::chrono::milliseconds(10);
+const auto kSlowReplyTime = std::chrono::milliseconds(300);
+
+redis::CommandControl MakeHedgingCc(size_t budget_percent) {
+  redis::CommandControl cc;
+  cc.timeout_single = std::chrono::seconds(5);
+  cc.timeout_all = std::chrono::seconds(5);
+  cc.max_retries = 1;
+  cc.hedging_budget_percent = budget_percent;
+  return cc;
+}
+
+// Hedging starts once the reply times of the shard are known
+void WarmUpHedging(redis::Sentinel& sentinel, const std::string& key,
+                   size_t requests_count) {
+  for (size_t i = 0; i < requests_count; i++) {
+    MakeGetRequest(sentinel, key, MakeHedgingCc(0)).Get();
+  }
+  sentinel.ForceUpdateHosts();
+  std::this_thread::sleep_for(kSmallPeriod);
+}
+
 template <typename Predicate>
 void PeriodicCheck(int check_count, std::chrono::milliseconds wait_period,
                    Predicate predicate) {
@@ -259,4 +282,70 @@ UTEST(Redis, SentinelForceShardIdx) {
   }
 }
 
+UTEST(Redis, SentinelHedgedReadWins) {
+  const size_t master_count = 1;
+  const size_t slave_count = 2;
+  const size_t sentinel_count = 1;
+  const int magic_value_slave = 1000;
+
+  SentinelTest sentinel_test(sentinel_count, master_count, slave_count, 0,
+                             magic_value_slave);
+  auto& sentinel = sentinel_test.SentinelClient();
+  for (size_t i = 0; i < slave_count; i++) {
+    EXPECT_TRUE(sentinel_test.Slave(i).WaitForFirstPingReply(kSmallPeriod));
+    // The hedging delay is well above the reply time of the fast replica
+    sentinel_test.Slave(i).RegisterTimeoutHandler("GET", {"warmup"},
+                                                  kWarmUpReplyTime);
+  }
+  WarmUpHedging(sentinel, "warmup", 20);
+
+  sentinel_test.Slave(0).RegisterTimeoutHandler("GET", {"slow"},
+                                                kSlowReplyTime);
+  const auto get_stats = [&] {
+    return sentinel.GetStatistics().slaves.at(sentinel_test.RedisName());
+  };
+  // The reads sent to the slow replica are answered by their hedges
+  for (size_t i = 0; i < 10 && !get_stats().hedges_won; i++) {
+    auto res = MakeGetRequest(sentinel, "slow", MakeHedgingCc(100)).Get();
+    ASSERT_TRUE(res->data.IsInt());
+    EXPECT_EQ(res->data.GetInt(), magic_value_slave + 1);
+  }
+
+  const auto stats = get_stats();
+  EXPECT_GE(stats.hedges_won, 1);
+  EXPECT_LE(stats.hedges_won, stats.hedges_sent);
+}
+
+UTEST(Redis, SentinelHedgingBudget) {
+  const size_t master_count = 1;
+  const size_t slave_count = 2;
+  const size_t sentinel_count = 1;
+  const size_t budget_percent = 10;
+  const size_t requests_count = 20;
+
+  SentinelTest sentinel_test(sentinel_count, master_count, slave_count, 0, 0);
+  auto& sentinel = sentinel_test.SentinelClient();
+  for (size_t i = 0; i < slave_count; i++) {
+    EXPECT_TRUE(sentinel_test.Slave(i).WaitForFirstPingReply(kSmallPeriod));
+    // Slower than the hedging delay, every read is worth a hedge
+    sentinel_test.Slave(i).RegisterTimeoutHandler("GET", {"slow"},
+                                                  kWarmUpReplyTime * 3);
+  }
+  // Enough fast reads to keep the delay low with the slow ones accounted
+  WarmUpHedging(sentinel, "fast", 1000);
+
+  const auto get_stats = [&] {
+    return sentinel.GetStatistics().slaves.at(sentinel_test.RedisName());
+  };
+  EXPECT_EQ(get_stats().hedges_sent, 0);
+
+  for (size_t i = 0; i < requests_count; i++) {
+    MakeGetRequest(sentinel, "slow", MakeHedgingCc(budget_percent)).Get();
+  }
+
+  const auto stats = get_stats();
+  EXPECT_EQ(stats.hedges_sent, requests_count * budget_percent / 100);
+  EXPECT_LE(stats.hedges_won, stats.hedges_sent);
+}
+
 USERVER_NAMESPACE_END
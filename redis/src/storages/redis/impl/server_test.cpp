@@ -169,4 +169,55 @@ TEST_P(RedisDisconnectingReplies, X) {
   PeriodicWait([&] { return !IsConnected(*redis); });
 }
 
+TEST(Redis, CommandsBuffering) {
+  constexpr size_t kCommands = 10;
+  MockRedisServer server;
+  auto ping_handler = server.RegisterPingHandler();
+  auto get_handler = server.RegisterNilReplyHandler("GET");
+
+  auto pool = std::make_shared<redis::ThreadPools>(1, 1);
+  auto redis =
+      std::make_shared<redis::Redis>(pool->GetRedisThreadPool(), false);
+  redis::CommandsBufferingSettings buffering_settings;
+  buffering_settings.buffering_enabled = true;
+  buffering_settings.watch_command_timer_interval = kSmallPeriod;
+  redis->SetCommandsBufferingSettings(buffering_settings);
+  redis->Connect(kLocalhost, server.GetPort(), redis::Password(""));
+  PeriodicWait([&] { return IsConnected(*redis); });
+
+  const long long writes_before = redis->GetStatistics().socket_writes;
+  for (size_t i = 0; i < kCommands; ++i) {
+    redis->AsyncCommand(redis::PrepareCommand(
+        {"GET", "key"}, [](const redis::CommandPtr&, redis::ReplyPtr) {}));
+  }
+  PeriodicWait([&] { return get_handler->GetReplyCount() == kCommands; });
+
+  EXPECT_EQ(redis->GetStatistics().commands_flushes, 1);
+  // The buffered commands are written together
+  EXPECT_LT(redis->GetStatistics().socket_writes - writes_before,
+            static_cast<long long>(kCommands));
+}
+
+TEST(Redis, CommandsBufferingAdaptive) {
+  MockRedisServer server;
+  auto ping_handler = server.RegisterPingHandler();
+  auto get_handler = server.RegisterNilReplyHandler("GET");
+
+  auto pool = std::make_shared<redis::ThreadPools>(1, 1);
+  auto redis =
+      std::make_shared<redis::Redis>(pool->GetRedisThreadPool(), false);
+  redis::CommandsBufferingSettings buffering_settings;
+  buffering_settings.buffering_enabled = true;
+  // Longer than the wait, the command is sent without buffering
+  buffering_settings.watch_command_timer_interval = std::chrono::seconds{60};
+  buffering_settings.adaptive = true;
+  redis->SetCommandsBufferingSettings(buffering_settings);
+  redis->Connect(kLocalhost, server.GetPort(), redis::Password(""));
+  PeriodicWait([&] { return IsConnected(*redis); });
+
+  redis->AsyncCommand(redis::PrepareCommand(
+      {"GET", "key"}, [](const redis::CommandPtr&, redis::ReplyPtr) {}));
+  EXPECT_TRUE(get_handler->WaitForFirstReply(kSmallPeriod));
+}
+
 USERVER_NAMESPACE_END
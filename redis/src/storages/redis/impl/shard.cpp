@@ -1,5 +1,7 @@
 #include "shard.hpp"
 
+#include <algorithm>
+
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
@@ -7,6 +9,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+namespace {
+
+constexpr double kHedgingDelayPercentile = 95;
+constexpr std::chrono::seconds kHedgingDelayPeriod{60};
+// Budget of a hedge in percents of a request
+constexpr std::int64_t kHedgeCost = 100;
+// Up to 10 hedges in a burst
+constexpr std::int64_t kMaxHedgingBudget = 10 * kHedgeCost;
+
+}  // namespace
+
 Shard::Shard(Options options)
     : shard_name_(std::move(options.shard_name)),
       shard_group_name_(std::move(options.shard_group_name)),
@@ -146,6 +159,15 @@ std::vector<ServerId> Shard::GetAllInstancesServerId() const {
 }
 
 bool Shard::AsyncCommand(CommandPtr command, size_t* pinstance_idx) {
+  return AsyncCommandImpl(std::move(command), pinstance_idx, false);
+}
+
+bool Shard::AsyncCommandSkipInstance(CommandPtr command, size_t skip_idx) {
+  return AsyncCommandImpl(std::move(command), &skip_idx, true);
+}
+
+bool Shard::AsyncCommandImpl(CommandPtr command, size_t* pinstance_idx,
+                             bool always_skip) {
   std::shared_ptr<Redis> instance;
   size_t idx = 0;
 
@@ -154,9 +176,10 @@ bool Shard::AsyncCommand(CommandPtr command, size_t* pinstance_idx) {
 
   const auto& available_servers = GetAvailableServers(command->control);
 
+  const size_t prev_idx = pinstance_idx ? *pinstance_idx : -1;
   auto max_attempts = instances_.size() + 1;
   for (size_t attempt = 0; attempt < max_attempts; attempt++) {
-    size_t skip_idx = (attempt == 0) && pinstance_idx ? *pinstance_idx : -1;
+    size_t skip_idx = (attempt == 0 || always_skip) ? prev_idx : -1;
 
     /* If we force specific server, use it, don't fallback to any other server.
      * If we don't force specific server:
@@ -322,10 +345,64 @@ ShardStatistics Shard::GetStatistics() const {
     }
   }
   stats.last_ready_time = last_ready_time_;
+  stats.hedges_sent = hedges_sent_.load(std::memory_order_relaxed);
+  stats.hedges_won = hedges_won_.load(std::memory_order_relaxed);
 
   return stats;
 }
 
+std::chrono::milliseconds Shard::GetHedgingDelay() const {
+  return hedging_delay_.load(std::memory_order_relaxed);
+}
+
+void Shard::UpdateHedgingDelay() {
+  Statistics::Percentile timings;
+  {
+    std::shared_lock lock(mutex_);
+    for (const auto& instance : instances_) {
+      if (!instance.instance) continue;
+      timings.Add(instance.instance->GetStatistics()
+                      .timings_percentile.GetStatsForPeriod(
+                          kHedgingDelayPeriod, /*with_current_epoch=*/true));
+    }
+  }
+  // No hedges until the reply times are known
+  const auto delay =
+      timings.Count() ? std::chrono::milliseconds{std::max<size_t>(
+                            timings.GetPercentile(kHedgingDelayPercentile), 1)}
+                      : std::chrono::milliseconds::zero();
+  hedging_delay_.store(delay, std::memory_order_relaxed);
+}
+
+bool Shard::TryStartHedge(size_t budget_percent) {
+  if (!budget_percent) return false;
+  auto budget = hedging_budget_.load(std::memory_order_relaxed);
+  do {
+    if (budget < kHedgeCost) return false;
+  } while (!hedging_budget_.compare_exchange_weak(budget, budget - kHedgeCost,
+                                                  std::memory_order_relaxed));
+  return true;
+}
+
+void Shard::CancelHedge() { AddHedgingBudget(kHedgeCost); }
+
+void Shard::AccountHedgeableRequest(size_t budget_percent) {
+  AddHedgingBudget(static_cast<std::int64_t>(budget_percent));
+}
+
+void Shard::AccountHedgeSent() { ++hedges_sent_; }
+
+void Shard::AccountHedgeWon() { ++hedges_won_; }
+
+void Shard::AddHedgingBudget(std::int64_t budget_delta) {
+  auto budget = hedging_budget_.load(std::memory_order_relaxed);
+  std::int64_t new_budget = 0;
+  do {
+    new_budget = std::min(budget + budget_delta, kMaxHedgingBudget);
+  } while (!hedging_budget_.compare_exchange_weak(budget, new_budget,
+                                                  std::memory_order_relaxed));
+}
+
 size_t Shard::InstancesSize() const {
   std::shared_lock lock(mutex_);
   return instances_.size();
@@ -363,6 +440,11 @@ void Shard::SetCommandsBufferingSettings(
       std::make_shared<CommandsBufferingSettings>(commands_buffering_settings));
 }
 
+std::vector<ConnectionInfo> Shard::GetConnectionInfos() const {
+  std::shared_lock lock(mutex_);
+  return {connection_infos_.begin(), connection_infos_.end()};
+}
+
 std::set<ConnectionInfoInt> Shard::GetConnectionInfosToCreate() const {
   std::shared_lock lock(mutex_);
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <set>
 #include <shared_mutex>
 #include <string>
@@ -72,6 +75,9 @@ class Shard {
   std::vector<ServerId> GetAllInstancesServerId() const;
 
   bool AsyncCommand(CommandPtr command, size_t* pinstance_idx = nullptr);
+  // Never sends the command to the skip_idx instance, unlike AsyncCommand()
+  // that skips the previous instance only if another one is available
+  bool AsyncCommandSkipInstance(CommandPtr command, size_t skip_idx);
   std::shared_ptr<Redis> GetInstance(
       const std::vector<unsigned char>& available_servers,
       bool may_fallback_to_any, size_t skip_idx, size_t* pinstance_idx);
@@ -80,6 +86,7 @@ class Shard {
       const std::shared_ptr<engine::ev::ThreadPool>& redis_thread_pool);
   bool ProcessStateUpdate();
   bool SetConnectionInfo(const std::vector<ConnectionInfoInt>& info_array);
+  std::vector<ConnectionInfo> GetConnectionInfos() const;
   bool IsConnectedToAllServersDebug(bool allow_empty);
   ShardStatistics GetStatistics() const;
   size_t InstancesSize() const;
@@ -92,7 +99,22 @@ class Shard {
   void SetCommandsBufferingSettings(
       CommandsBufferingSettings commands_buffering_settings);
 
+  // Hedged requests: a read is repeated on another instance if there is no
+  // reply after the delay, the recent p95 reply time of the shard. Hedges are
+  // limited to budget_percent of the hedgeable reads.
+  std::chrono::milliseconds GetHedgingDelay() const;
+  void UpdateHedgingDelay();
+  bool TryStartHedge(size_t budget_percent);
+  // Returns the budget of a hedge that was not sent
+  void CancelHedge();
+  void AccountHedgeableRequest(size_t budget_percent);
+  void AccountHedgeSent();
+  void AccountHedgeWon();
+
  private:
+  bool AsyncCommandImpl(CommandPtr command, size_t* pinstance_idx,
+                        bool always_skip);
+  void AddHedgingBudget(std::int64_t budget_delta);
   std::set<ConnectionInfoInt> GetConnectionInfosToCreate() const;
   bool UpdateCleanWaitQueue(std::vector<ConnectionStatus>&& add_clean_wait);
 
@@ -118,6 +140,12 @@ class Shard {
 
   utils::SwappingSmart<CommandsBufferingSettings> commands_buffering_settings_;
 
+  std::atomic<std::chrono::milliseconds> hedging_delay_{};
+  // In percents of a hedge
+  std::atomic<std::int64_t> hedging_budget_{0};
+  std::atomic_llong hedges_sent_{0};
+  std::atomic_llong hedges_won_{0};
+
   bool prev_connected_ = false;
   const bool cluster_mode_ = false;
   const bool read_only_ = false;
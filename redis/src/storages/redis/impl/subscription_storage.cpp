@@ -602,20 +602,22 @@ CommandPtr SubscriptionStorage::PrepareSubscribeCommand(
 
 void SubscriptionStorage::OnMessage(ServerId server_id,
                                     const std::string& channel,
-                                    const std::string& message,
-                                    size_t shard_idx) {
+                                    std::string message, size_t shard_idx) {
   try {
     std::lock_guard<std::mutex> lock(mutex_);
     auto& m = callback_map_.at(channel);
-    for (const auto& it : m.callbacks) {
+    m.info[shard_idx].AccountMessage(server_id, message.size());
+
+    // The last subscriber takes the message, the others get a copy
+    for (auto it = m.callbacks.begin(); it != m.callbacks.end();) {
+      const auto& callback = it->second;
+      const bool is_last = ++it == m.callbacks.end();
       try {
-        it.second(channel, message);
+        callback(channel, is_last ? std::move(message) : message);
       } catch (const std::exception& e) {
         LOG_ERROR() << "Unhandled exception in subscriber: " << e.what();
       }
     }
-
-    m.info[shard_idx].AccountMessage(server_id, message.size());
   } catch (const std::out_of_range& e) {
     LOG_ERROR() << "Got MESSAGE while not subscribed on it, channel="
                 << channel;
@@ -625,20 +627,22 @@ void SubscriptionStorage::OnMessage(ServerId server_id,
 void SubscriptionStorage::OnPmessage(ServerId server_id,
                                      const std::string& pattern,
                                      const std::string& channel,
-                                     const std::string& message,
-                                     size_t shard_idx) {
+                                     std::string message, size_t shard_idx) {
   try {
     std::lock_guard<std::mutex> lock(mutex_);
     auto& m = pattern_callback_map_.at(pattern);
-    for (const auto& it : m.callbacks) {
+    m.info[shard_idx].AccountMessage(server_id, message.size());
+
+    // The last subscriber takes the message, the others get a copy
+    for (auto it = m.callbacks.begin(); it != m.callbacks.end();) {
+      const auto& callback = it->second;
+      const bool is_last = ++it == m.callbacks.end();
       try {
-        it.second(pattern, channel, message);
+        callback(pattern, channel, is_last ? std::move(message) : message);
       } catch (const std::exception& e) {
         LOG_ERROR() << "Unhandled exception in subscriber: " << e.what();
       }
     }
-
-    m.info[shard_idx].AccountMessage(server_id, message.size());
   } catch (const std::out_of_range& e) {
     LOG_ERROR() << "Got PMESSAGE while not subscribed on it, channel="
                 << channel;
@@ -138,9 +138,9 @@ class SubscriptionStorage
                                      SubscribeCb cb, size_t shard_idx);
 
   void OnMessage(ServerId server_id, const std::string& channel,
-                 const std::string& message, size_t shard_idx);
+                 std::string message, size_t shard_idx);
   void OnPmessage(ServerId server_id, const std::string& pattern,
-                  const std::string& channel, const std::string& message,
+                  const std::string& channel, std::string message,
                   size_t shard_idx);
 
   static void UnsubscribeCallbackNone(ServerId, const std::string& /*channel*/,
@@ -165,10 +165,10 @@ class SubscriptionStorage
     void AccountMessage(ServerId server_id, size_t message_size);
   };
   using MessageCallback = std::function<void(
-      ServerId, const std::string& channel, const std::string& message)>;
-  using PmessageCallback = std::function<void(
-      ServerId, const std::string& pattern, const std::string& channel,
-      const std::string& message)>;
+      ServerId, const std::string& channel, std::string message)>;
+  using PmessageCallback =
+      std::function<void(ServerId, const std::string& pattern,
+                         const std::string& channel, std::string message)>;
 
   /* We could use Fsm per shard (single Fsm for all channels), but in
    * this case it would be hard to create new subsciptions for shards
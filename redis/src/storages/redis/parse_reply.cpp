@@ -65,6 +65,64 @@ Point ParsePointArray(const redis::ReplyData& elem,
   }
 }
 
+void ParseStreamEntry(ReplyData& elem, const std::string& request_description,
+                      std::vector<StreamEntry>& entries,
+                      std::vector<std::string>& deleted_ids) {
+  elem.ExpectArray(request_description);
+  auto& array = elem.GetArray();
+  if (array.size() != 2) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected reply to '" + request_description +
+        "'. Expected 2 elements in stream entry, got " +
+        std::to_string(array.size()));
+  }
+
+  auto id = ExtractStringElem(elem, 0, request_description);
+  // The fields of a pending entry that was deleted from the stream are nil
+  if (array[1].IsNil()) {
+    deleted_ids.push_back(std::move(id));
+    return;
+  }
+  array[1].ExpectArray(request_description);
+  entries.emplace_back(
+      std::move(id),
+      ParseReplyDataArray(
+          std::move(array[1]), request_description,
+          To<std::vector<std::pair<std::string, std::string>>>{}));
+}
+
+// Returns the number of nil elements: redis 6.2 XAUTOCLAIM replies with nil
+// in place of the pending entries deleted from the stream
+size_t ParseStreamEntries(ReplyData& array_data,
+                          const std::string& request_description,
+                          std::vector<StreamEntry>& entries,
+                          std::vector<std::string>& deleted_ids) {
+  array_data.ExpectArray(request_description);
+  auto& array = array_data.GetArray();
+  entries.reserve(array.size());
+
+  size_t nil_count = 0;
+  for (auto& elem : array) {
+    if (elem.IsNil()) {
+      ++nil_count;
+      continue;
+    }
+    ParseStreamEntry(elem, request_description, entries, deleted_ids);
+  }
+  return nil_count;
+}
+
+// The stream or the group may be deleted after the group creation
+void ExpectGroupExists(const ReplyData& reply_data,
+                       const std::string& request_description) {
+  if (reply_data.IsError() &&
+      !reply_data.GetError().compare(0, 8, "NOGROUP ")) {
+    throw USERVER_NAMESPACE::redis::NoGroupException(
+        "Error reply to '" + request_description +
+        "': " + reply_data.GetError());
+  }
+}
+
 }  // namespace
 
 namespace impl {
@@ -180,13 +238,13 @@ std::vector<GeoPoint> ParseReplyDataArray(
     if (elem.IsString()) {
       geo_point.member = std::move(elem.GetString());
     } else if (elem.IsArray()) {
-      auto additional_infos = elem.GetArray();
+      auto& additional_infos = elem.GetArray();
       if (additional_infos.empty()) {
         throw USERVER_NAMESPACE::redis::ParseReplyException(
             "Can't parse value from reply to '" + request_description +
             ", additional_info item is empty array");
       }
-      geo_point.member = additional_infos[0].GetString();
+      geo_point.member = std::move(additional_infos[0].GetString());
 
       for (size_t i = 1; i < additional_infos.size(); ++i) {
         const auto& sub_elem = additional_infos[i];
@@ -379,6 +437,67 @@ std::unordered_map<std::string, std::string> Parse(
   return result;
 }
 
+XreadgroupReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XreadgroupReply>) {
+  XreadgroupReply result;
+  // nil if there are no new entries before the BLOCK timeout
+  if (reply_data.IsNil()) return result;
+
+  // [[key, [entry...]]] as a single stream is read
+  ExpectGroupExists(reply_data, request_description);
+  reply_data.ExpectArray(request_description);
+  auto& streams = reply_data.GetArray();
+  if (streams.empty()) return result;
+  if (streams.size() != 1) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected reply to '" + request_description +
+        "'. Expected 1 stream, got " + std::to_string(streams.size()));
+  }
+
+  auto& stream = streams[0];
+  stream.ExpectArray(request_description);
+  auto& key_entries = stream.GetArray();
+  if (key_entries.size() != 2) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected reply to '" + request_description +
+        "'. Expected 2 elements in stream reply, got " +
+        std::to_string(key_entries.size()));
+  }
+  ParseStreamEntries(key_entries[1], request_description, result.entries,
+                     result.deleted_ids);
+  return result;
+}
+
+XautoclaimReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XautoclaimReply>) {
+  ExpectGroupExists(reply_data, request_description);
+  reply_data.ExpectArray(request_description);
+  auto& array = reply_data.GetArray();
+  // The deleted ids are returned since redis 7.0
+  if (array.size() != 2 && array.size() != 3) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected reply to '" + request_description +
+        "'. Expected 2 or 3 elements in array, got " +
+        std::to_string(array.size()));
+  }
+
+  XautoclaimReply result;
+  result.next_start_id = ExtractStringElem(reply_data, 0, request_description);
+  result.unreported_deleted = ParseStreamEntries(
+      array[1], request_description, result.entries, result.deleted_ids);
+  if (array.size() == 3) {
+    array[2].ExpectArray(request_description);
+    for (auto& id : ParseReplyDataArray(std::move(array[2]),
+                                        request_description,
+                                        To<std::vector<std::string>>{})) {
+      result.deleted_ids.push_back(std::move(id));
+    }
+  }
+  return result;
+}
+
 ReplyData Parse(ReplyData&& reply_data, const std::string&, To<ReplyData>) {
   return std::move(reply_data);
 }
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <hiredis/hiredis.h>
+
+#include <userver/storages/redis/impl/reply.hpp>
+#include <userver/storages/redis/parse_reply.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const std::string kRequestDescription = "benchmark";
+
+std::string MakeBulkString(std::size_t index, std::size_t size) {
+  auto value = std::to_string(index);
+  value.resize(size, 'a');
+  return '$' + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+}
+
+// RESP encoded array of bulk strings, as returned by MGET or HGETALL
+std::string MakeArrayReply(std::size_t elements, std::size_t size) {
+  std::string reply = '*' + std::to_string(elements) + "\r\n";
+  for (std::size_t i = 0; i < elements; ++i) {
+    reply += MakeBulkString(i, size);
+  }
+  return reply;
+}
+
+// Reads the reply with hiredis the same way the connection does and converts
+// it to the driver representation
+redis::ReplyData ReadReply(redisReader* reader, const std::string& resp) {
+  redisReaderFeed(reader, resp.data(), resp.size());
+  void* reply = nullptr;
+  [[maybe_unused]] const auto status = redisReaderGetReply(reader, &reply);
+  UASSERT(status == REDIS_OK && reply);
+  redis::ReplyData data{static_cast<redisReply*>(reply)};
+  freeReplyObject(reply);
+  return data;
+}
+
+}  // namespace
+
+void redis_reply_parse_array(benchmark::State& state) {
+  const auto resp = MakeArrayReply(state.range(0), state.range(1));
+  auto* reader = redisReaderCreate();
+
+  for (auto _ : state) {
+    auto result = storages::redis::ParseReplyDataArray(
+        ReadReply(reader, resp), kRequestDescription,
+        storages::redis::To<std::vector<std::string>>{});
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * resp.size());
+
+  redisReaderFree(reader);
+}
+BENCHMARK(redis_reply_parse_array)
+    ->RangeMultiplier(16)
+    ->Ranges({{1, 4096}, {16, 4096}});
+
+void redis_reply_parse_key_values(benchmark::State& state) {
+  const auto resp = MakeArrayReply(state.range(0) * 2, state.range(1));
+  auto* reader = redisReaderCreate();
+
+  for (auto _ : state) {
+    auto result = storages::redis::Parse(
+        ReadReply(reader, resp), kRequestDescription,
+        storages::redis::To<std::unordered_map<std::string, std::string>>{});
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * resp.size());
+
+  redisReaderFree(reader);
+}
+BENCHMARK(redis_reply_parse_key_values)
+    ->RangeMultiplier(16)
+    ->Ranges({{1, 4096}, {16, 4096}});
+
+USERVER_NAMESPACE_END
@@ -52,6 +52,8 @@ USERVER_NAMESPACE::redis::CommandControl Parse(
         throw ParseConfigException(
             "Invalid max_ping_latency in redis CommandControl");
       }
+    } else if (name == "hedging_budget_percent") {
+      response.hedging_budget_percent = it->As<size_t>();
     } else {
       LOG_WARNING() << "unknown key for CommandControl map: " << name;
     }
@@ -89,6 +91,7 @@ USERVER_NAMESPACE::redis::CommandsBufferingSettings Parse(
       elem["commands_buffering_threshold"].As<size_t>(0);
   result.watch_command_timer_interval = std::chrono::microseconds(
       elem["watch_command_timer_interval_us"].As<size_t>());
+  result.adaptive = elem["adaptive"].As<bool>(false);
   return result;
 }
 
@@ -12,6 +12,7 @@
 #include <userver/storages/redis/request_data_base.hpp>
 
 #include "client_impl.hpp"
+#include "client_side_cache.hpp"
 #include "scan_reply.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -73,6 +74,32 @@ class RequestDataImpl final : public RequestDataImplBase,
   ReplyPtr GetRaw() override { return GetReply(); }
 };
 
+template <typename Result, typename ReplyType>
+class CachingRequestDataImpl final : public RequestDataImplBase,
+                                     public RequestDataBase<Result, ReplyType> {
+ public:
+  CachingRequestDataImpl(USERVER_NAMESPACE::redis::Request&& request,
+                         ClientSideCache::Fill&& fill)
+      : RequestDataImplBase(std::move(request)), fill_(std::move(fill)) {}
+
+  void Wait() override { impl::Wait(GetRequest()); }
+
+  ReplyType Get(const std::string& request_description) override {
+    auto reply = GetReply();
+    fill_.Commit(reply);
+    return ParseReply<Result, ReplyType>(std::move(reply), request_description);
+  }
+
+  ReplyPtr GetRaw() override {
+    auto reply = GetReply();
+    fill_.Commit(reply);
+    return reply;
+  }
+
+ private:
+  ClientSideCache::Fill fill_;
+};
+
 template <typename Result, typename ReplyType>
 class AggregateRequestDataImpl final
     : public RequestDataBase<Result, ReplyType> {
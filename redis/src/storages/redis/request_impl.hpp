@@ -34,6 +34,15 @@ Request<Result, ReplyType> CreateAggregateRequest(
           std::move(req_data)));
 }
 
+template <typename Result, typename ReplyType = DefaultReplyType<Result>>
+Request<Result, ReplyType> CreateCachingRequest(
+    USERVER_NAMESPACE::redis::Request&& request, ClientSideCache::Fill&& fill,
+    Request<Result, ReplyType>* /* for ADL */) {
+  return Request<Result, ReplyType>(
+      std::make_unique<CachingRequestDataImpl<Result, ReplyType>>(
+          std::move(request), std::move(fill)));
+}
+
 template <typename Result, typename ReplyType = DefaultReplyType<Result>>
 Request<Result, ReplyType> CreateDummyRequest(
     ReplyPtr&& reply, Request<Result, ReplyType>* /* for ADL */) {
@@ -59,6 +68,14 @@ Request CreateAggregateRequest(
   return impl::CreateAggregateRequest(std::move(requests), tmp);
 }
 
+template <typename Request>
+Request CreateCachingRequest(USERVER_NAMESPACE::redis::Request&& request,
+                             ClientSideCache::Fill&& fill) {
+  Request* tmp = nullptr;
+  // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
+  return impl::CreateCachingRequest(std::move(request), std::move(fill), tmp);
+}
+
 template <typename Request>
 Request CreateDummyRequest(ReplyPtr reply) {
   Request* tmp = nullptr;
@@ -0,0 +1,216 @@
+#include <userver/storages/redis/stream_consumer.hpp>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+namespace {
+
+const std::string kConsumeStreamPrefix = "redis-stream-consumer-";
+// XREADGROUP id to read the pending entries of the consumer
+const std::string kPendingEntriesId = "0";
+// XREADGROUP id to read the entries never delivered to the group
+const std::string kNewEntriesId = ">";
+// XGROUP CREATE id to read the entries added after the group creation
+const std::string kLastEntryId = "$";
+// XAUTOCLAIM start id of the pending entries list
+const std::string kStartEntryId = "0-0";
+
+}  // namespace
+
+StreamConsumer::StreamConsumer(ClientPtr client, std::vector<std::string> keys,
+                               StreamConsumerSettings settings,
+                               Callback callback,
+                               engine::TaskProcessor& task_processor)
+    : client_(std::move(client)),
+      settings_(std::move(settings)),
+      callback_(std::move(callback)) {
+  UASSERT(client_);
+  UASSERT(callback_);
+  UINVARIANT(settings_.batch_size > 0, "batch_size must be positive");
+
+  tasks_.reserve(keys.size());
+  for (auto& key : keys) {
+    tasks_.push_back(utils::CriticalAsync(
+        task_processor, kConsumeStreamPrefix + key,
+        [this, key = std::move(key)] { Consume(key); }));
+  }
+}
+
+StreamConsumer::~StreamConsumer() { Stop(); }
+
+void StreamConsumer::Stop() {
+  for (auto& task : tasks_) {
+    if (task.IsValid()) task.SyncCancel();
+  }
+}
+
+StreamConsumerStatistics StreamConsumer::GetStatistics() const {
+  StreamConsumerStatistics stats;
+  stats.read = read_.load();
+  stats.claimed = claimed_.load();
+  stats.acked = acked_.load();
+  stats.failed_batches = failed_batches_.load();
+  return stats;
+}
+
+void StreamConsumer::Consume(const std::string& key) {
+  CreateGroup(key);
+
+  XreadgroupOptions options;
+  options.count = settings_.batch_size;
+  options.block = settings_.block;
+
+  std::optional<RequestXack> ack;
+  std::string read_id = kPendingEntriesId;
+  auto next_claim = std::chrono::steady_clock::now();
+
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      if (settings_.min_idle_time.count() > 0 &&
+          std::chrono::steady_clock::now() >= next_claim) {
+        if (Claim(key, ack)) {
+          // The claimed entries deleted from the stream are found among the
+          // pending entries of the consumer
+          WaitAck(ack);
+          read_id = kPendingEntriesId;
+        }
+        next_claim =
+            std::chrono::steady_clock::now() + settings_.claim_interval;
+      }
+
+      auto reply =
+          client_
+              ->Xreadgroup(key, settings_.group, settings_.consumer, read_id,
+                           options, settings_.command_control)
+              .Get();
+      if (!reply.deleted_ids.empty()) {
+        Ack(key, std::move(reply.deleted_ids), ack);
+        if (reply.entries.empty()) {
+          // Read the rest of the pending entries once these are acknowledged
+          WaitAck(ack);
+          continue;
+        }
+      }
+
+      auto& entries = reply.entries;
+      if (entries.empty()) {
+        if (read_id != kNewEntriesId) {
+          // All the pending entries of the consumer are processed
+          read_id = kNewEntriesId;
+          continue;
+        }
+        WaitAck(ack);
+        if (!settings_.block) {
+          engine::InterruptibleSleepFor(settings_.poll_interval);
+        }
+        continue;
+      }
+
+      if (read_id != kNewEntriesId) read_id = entries.back().id;
+      Process(key, entries, ack);
+    } catch (const USERVER_NAMESPACE::redis::NoGroupException& e) {
+      LOG_WARNING() << "Consumer group '" << settings_.group
+                    << "' of redis stream '" << key
+                    << "' is missing, creating it: " << e;
+      CreateGroup(key);
+    } catch (const std::exception& e) {
+      if (engine::current_task::ShouldCancel()) break;
+      LOG_ERROR() << "Failed to read redis stream '" << key
+                  << "' of group '" << settings_.group << "': " << e;
+      engine::InterruptibleSleepFor(settings_.poll_interval);
+    }
+  }
+
+  WaitAck(ack);
+}
+
+void StreamConsumer::CreateGroup(const std::string& key) {
+  try {
+    client_
+        ->XgroupCreate(key, settings_.group, kLastEntryId,
+                       settings_.command_control)
+        .Get();
+  } catch (const USERVER_NAMESPACE::redis::Exception& e) {
+    // Most probably the group already exists (BUSYGROUP), otherwise the reads
+    // fail and are retried
+    LOG_DEBUG() << "XGROUP CREATE of redis stream '" << key << "' failed: "
+                << e;
+  }
+}
+
+bool StreamConsumer::Claim(const std::string& key,
+                           std::optional<RequestXack>& ack) {
+  XautoclaimOptions options;
+  options.count = settings_.batch_size;
+
+  bool has_unreported_deleted = false;
+  std::string start = kStartEntryId;
+  do {
+    auto reply = client_
+                     ->Xautoclaim(key, settings_.group, settings_.consumer,
+                                  settings_.min_idle_time, std::move(start),
+                                  options, settings_.command_control)
+                     .Get();
+    start = std::move(reply.next_start_id);
+    if (reply.unreported_deleted) has_unreported_deleted = true;
+    if (!reply.deleted_ids.empty()) {
+      Ack(key, std::move(reply.deleted_ids), ack);
+    }
+    if (!reply.entries.empty()) {
+      claimed_ += reply.entries.size();
+      Process(key, reply.entries, ack);
+    }
+  } while (start != kStartEntryId && !engine::current_task::ShouldCancel());
+  return has_unreported_deleted;
+}
+
+void StreamConsumer::Process(const std::string& key,
+                             std::vector<StreamEntry>& entries,
+                             std::optional<RequestXack>& ack) {
+  read_ += entries.size();
+
+  std::vector<std::string> ids;
+  ids.reserve(entries.size());
+  for (const auto& entry : entries) ids.push_back(entry.id);
+
+  try {
+    callback_(key, entries);
+  } catch (const std::exception& e) {
+    ++failed_batches_;
+    LOG_ERROR() << "Failed to process " << ids.size()
+                << " entries of redis stream '" << key << "': " << e;
+    return;
+  }
+
+  Ack(key, std::move(ids), ack);
+}
+
+void StreamConsumer::Ack(const std::string& key, std::vector<std::string> ids,
+                         std::optional<RequestXack>& ack) {
+  // The previous XACK is most probably done by now as it was sent before the
+  // read of the current batch
+  WaitAck(ack);
+  ack.emplace(client_->Xack(key, settings_.group, std::move(ids),
+                            settings_.command_control));
+}
+
+void StreamConsumer::WaitAck(std::optional<RequestXack>& ack) {
+  if (!ack) return;
+  try {
+    acked_ += ack->Get();
+  } catch (const USERVER_NAMESPACE::redis::Exception& e) {
+    // The entries stay pending and are claimed later
+    LOG_WARNING() << "XACK failed: " << e;
+  }
+  ack.reset();
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,150 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <storages/redis/client_impl.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/storages/redis/impl/sentinel.hpp>
+#include <userver/storages/redis/impl/thread_pools.hpp>
+#include <userver/storages/redis/stream_consumer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+// The benchmarks require a local redis-server behind a sentinel, as set up
+// for the redis tests: sentinel port from TESTSUITE_REDIS_SENTINEL_PORT
+// (26379 by default) and the master named test_master0.
+
+namespace {
+
+constexpr std::chrono::seconds kConnectTimeout{2};
+const std::string kStreamKey = "benchmark_stream";
+const std::string kGroup = "benchmark_group";
+
+std::shared_ptr<storages::redis::Client> MakeClient() {
+  secdist::RedisSettings settings;
+  settings.shards = {"test_master0"};
+  const auto* port = std::getenv("TESTSUITE_REDIS_SENTINEL_PORT");
+  settings.sentinels.emplace_back("localhost", port ? std::atoi(port) : 26379);
+
+  auto sentinel = redis::Sentinel::CreateSentinel(
+      std::make_shared<redis::ThreadPools>(
+          redis::kDefaultSentinelThreadPoolSize,
+          redis::kDefaultRedisThreadPoolSize),
+      settings, "benchmark", "benchmark", redis::KeyShardFactory{""}, {});
+  sentinel->WaitConnectedOnce(
+      {redis::WaitConnectedMode::kMaster, true, kConnectTimeout});
+  return std::make_shared<storages::redis::ClientImpl>(std::move(sentinel));
+}
+
+// Recreates the stream with `count` entries and a consumer group to read
+// them from the start
+void FillStream(storages::redis::Client& client, size_t count) {
+  client.Del(kStreamKey, {}).Get();
+  client.XgroupCreate(kStreamKey, kGroup, "0", {}).Get();
+
+  std::vector<storages::redis::RequestXadd> requests;
+  requests.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    requests.push_back(client.Xadd(
+        kStreamKey, {{"value", std::to_string(i)}}, {}, {}));
+  }
+  for (auto& request : requests) request.Get();
+}
+
+template <typename Function>
+void RunWithClient(benchmark::State& state, Function function) {
+  engine::RunStandalone(2, [&] {
+    std::shared_ptr<storages::redis::Client> client;
+    try {
+      client = MakeClient();
+    } catch (const std::exception& e) {
+      state.SkipWithError(e.what());
+      return;
+    }
+    function(*client, client);
+  });
+}
+
+void StreamXadd(benchmark::State& state) {
+  RunWithClient(state, [&](storages::redis::Client& client, const auto&) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+      FillStream(client, count);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+  });
+}
+BENCHMARK(StreamXadd)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+// The baseline: a read and an acknowledgement round trip per entry
+void StreamReadAckOneByOne(benchmark::State& state) {
+  RunWithClient(state, [&](storages::redis::Client& client, const auto&) {
+    const auto count = static_cast<size_t>(state.range(0));
+    storages::redis::XreadgroupOptions options;
+    options.count = 1;
+    for (auto _ : state) {
+      state.PauseTiming();
+      FillStream(client, count);
+      state.ResumeTiming();
+
+      for (size_t i = 0; i < count; ++i) {
+        auto reply =
+            client.Xreadgroup(kStreamKey, kGroup, "c", ">", options, {}).Get();
+        client.Xack(kStreamKey, kGroup, {reply.entries.at(0).id}, {}).Get();
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+  });
+}
+BENCHMARK(StreamReadAckOneByOne)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+void StreamConsumer(benchmark::State& state) {
+  RunWithClient(state, [&](storages::redis::Client& client,
+                           const std::shared_ptr<storages::redis::Client>&
+                               client_ptr) {
+    const auto count = static_cast<size_t>(state.range(0));
+    storages::redis::StreamConsumerSettings settings;
+    settings.group = kGroup;
+    settings.consumer = "c";
+    settings.batch_size = state.range(1);
+    settings.poll_interval = std::chrono::milliseconds{1};
+    settings.min_idle_time = std::chrono::milliseconds{0};
+
+    for (auto _ : state) {
+      state.PauseTiming();
+      FillStream(client, count);
+      std::atomic<size_t> processed{0};
+      state.ResumeTiming();
+
+      storages::redis::StreamConsumer consumer(
+          client_ptr, {kStreamKey}, settings,
+          [&](const std::string&,
+              std::vector<storages::redis::StreamEntry>& entries) {
+            processed += entries.size();
+          },
+          engine::current_task::GetTaskProcessor());
+      while (consumer.GetStatistics().acked < count) {
+        engine::SleepFor(std::chrono::microseconds{100});
+      }
+      consumer.Stop();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+  });
+}
+BENCHMARK(StreamConsumer)
+    ->Args({1000, 10})
+    ->Args({1000, 100})
+    ->Args({10000, 100})
+    ->Args({10000, 1000})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,224 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <storages/redis/util_redistest.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/storages/redis/stream_consumer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr size_t kEntriesCount = 50;
+
+storages::redis::StreamConsumerSettings MakeSettings(std::string consumer) {
+  storages::redis::StreamConsumerSettings settings;
+  settings.group = "group";
+  settings.consumer = std::move(consumer);
+  settings.batch_size = 10;
+  settings.poll_interval = kWaitStep;
+  settings.min_idle_time = std::chrono::milliseconds{100};
+  settings.claim_interval = std::chrono::milliseconds{50};
+  return settings;
+}
+
+void AddEntries(storages::redis::Client& client, const std::string& key) {
+  for (size_t i = 0; i < kEntriesCount; ++i) {
+    client.Xadd(key, {{"value", std::to_string(i)}}, {}, {}).Get();
+  }
+}
+
+struct Consumed {
+  engine::Mutex mutex;
+  std::vector<std::string> values;
+
+  void Add(std::vector<storages::redis::StreamEntry>& entries) {
+    std::lock_guard<engine::Mutex> lock(mutex);
+    for (auto& entry : entries) {
+      values.push_back(std::move(entry.fields.at(0).second));
+    }
+  }
+
+  size_t Size() {
+    std::lock_guard<engine::Mutex> lock(mutex);
+    return values.size();
+  }
+};
+
+std::vector<std::string> ExpectedValues() {
+  std::vector<std::string> expected;
+  for (size_t i = 0; i < kEntriesCount; ++i) {
+    expected.push_back(std::to_string(i));
+  }
+  return expected;
+}
+
+}  // namespace
+
+UTEST(RedisStreamConsumer, ConsumeAndAck) {
+  auto client = MakeTestsuiteRedisClient();
+  client->Del("consumer_stream", {}).Get();
+  client->XgroupCreate("consumer_stream", "group", "$", {}).Get();
+
+  Consumed consumed;
+  storages::redis::StreamConsumer consumer(
+      client, {"consumer_stream"}, MakeSettings("c1"),
+      [&](const std::string& key,
+          std::vector<storages::redis::StreamEntry>& entries) {
+        EXPECT_EQ(key, "consumer_stream");
+        EXPECT_LE(entries.size(), 10);
+        consumed.Add(entries);
+      },
+      engine::current_task::GetTaskProcessor());
+
+  AddEntries(*client, "consumer_stream");
+  EXPECT_TRUE(WaitFor([&] { return consumed.Size() == kEntriesCount; }));
+  EXPECT_TRUE(WaitFor(
+      [&] { return consumer.GetStatistics().acked == kEntriesCount; }));
+  consumer.Stop();
+
+  std::lock_guard<engine::Mutex> lock(consumed.mutex);
+  EXPECT_EQ(consumed.values, ExpectedValues());
+  EXPECT_EQ(consumer.GetStatistics().read, kEntriesCount);
+  EXPECT_EQ(consumer.GetStatistics().failed_batches, 0);
+}
+
+UTEST(RedisStreamConsumer, ClaimFailed) {
+  auto client = MakeTestsuiteRedisClient();
+  client->Del("claim_stream", {}).Get();
+  client->XgroupCreate("claim_stream", "group", "$", {}).Get();
+  AddEntries(*client, "claim_stream");
+
+  // Reads the entries and fails to process them
+  auto failing_settings = MakeSettings("failing");
+  failing_settings.min_idle_time = std::chrono::milliseconds{0};
+  storages::redis::StreamConsumer failing(
+      client, {"claim_stream"}, failing_settings,
+      [](const std::string&, std::vector<storages::redis::StreamEntry>&) {
+        throw std::runtime_error("processing failed");
+      },
+      engine::current_task::GetTaskProcessor());
+  EXPECT_TRUE(WaitFor(
+      [&] { return failing.GetStatistics().read == kEntriesCount; }));
+  failing.Stop();
+
+  Consumed consumed;
+  storages::redis::StreamConsumer consumer(
+      client, {"claim_stream"}, MakeSettings("c2"),
+      [&](const std::string&,
+          std::vector<storages::redis::StreamEntry>& entries) {
+        consumed.Add(entries);
+      },
+      engine::current_task::GetTaskProcessor());
+  EXPECT_TRUE(WaitFor([&] { return consumed.Size() == kEntriesCount; }));
+  consumer.Stop();
+
+  std::lock_guard<engine::Mutex> lock(consumed.mutex);
+  EXPECT_EQ(consumed.values, ExpectedValues());
+  EXPECT_EQ(consumer.GetStatistics().claimed, kEntriesCount);
+}
+
+UTEST(RedisStreamConsumer, PendingAfterRestart) {
+  auto client = MakeTestsuiteRedisClient();
+  client->Del("restart_stream", {}).Get();
+  client->XgroupCreate("restart_stream", "group", "$", {}).Get();
+  AddEntries(*client, "restart_stream");
+
+  // Delivered to the consumer, but not acknowledged
+  storages::redis::XreadgroupOptions options;
+  options.count = kEntriesCount;
+  ASSERT_EQ(client
+                ->Xreadgroup("restart_stream", "group", "c1", ">", options, {})
+                .Get()
+                .entries.size(),
+            kEntriesCount);
+
+  auto settings = MakeSettings("c1");
+  settings.min_idle_time = std::chrono::milliseconds{0};
+  Consumed consumed;
+  storages::redis::StreamConsumer consumer(
+      client, {"restart_stream"}, settings,
+      [&](const std::string&,
+          std::vector<storages::redis::StreamEntry>& entries) {
+        consumed.Add(entries);
+      },
+      engine::current_task::GetTaskProcessor());
+  EXPECT_TRUE(WaitFor([&] { return consumed.Size() == kEntriesCount; }));
+  consumer.Stop();
+
+  std::lock_guard<engine::Mutex> lock(consumed.mutex);
+  EXPECT_EQ(consumed.values, ExpectedValues());
+}
+
+UTEST(RedisStreamConsumer, DeletedPending) {
+  auto client = MakeTestsuiteRedisClient();
+  client->Del("deleted_pending_stream", {}).Get();
+  client->XgroupCreate("deleted_pending_stream", "group", "$", {}).Get();
+  AddEntries(*client, "deleted_pending_stream");
+
+  storages::redis::XreadgroupOptions options;
+  options.count = kEntriesCount;
+  auto reply = client
+                   ->Xreadgroup("deleted_pending_stream", "group", "failing",
+                                ">", options, {})
+                   .Get();
+  ASSERT_EQ(reply.entries.size(), kEntriesCount);
+  std::vector<std::string> ids;
+  for (const auto& entry : reply.entries) ids.push_back(entry.id);
+  // Pending, but no longer in the stream
+  client->Xdel("deleted_pending_stream", ids, {}).Get();
+
+  Consumed consumed;
+  storages::redis::StreamConsumer consumer(
+      client, {"deleted_pending_stream"}, MakeSettings("c2"),
+      [&](const std::string&,
+          std::vector<storages::redis::StreamEntry>& entries) {
+        consumed.Add(entries);
+      },
+      engine::current_task::GetTaskProcessor());
+  const auto pending_count = [&](const std::string& consumer_name) {
+    auto pending = client
+                       ->Xreadgroup("deleted_pending_stream", "group",
+                                    consumer_name, "0", {}, {})
+                       .Get();
+    return pending.entries.size() + pending.deleted_ids.size();
+  };
+  // Claimed from the failing consumer and acknowledged
+  EXPECT_TRUE(WaitFor(
+      [&] { return !pending_count("failing") && !pending_count("c2"); }));
+  consumer.Stop();
+
+  EXPECT_EQ(consumed.Size(), 0);
+}
+
+UTEST(RedisStreamConsumer, GroupRecreated) {
+  auto client = MakeTestsuiteRedisClient();
+  client->Del("recreated_stream", {}).Get();
+
+  Consumed consumed;
+  storages::redis::StreamConsumer consumer(
+      client, {"recreated_stream"}, MakeSettings("c1"),
+      [&](const std::string&,
+          std::vector<storages::redis::StreamEntry>& entries) {
+        consumed.Add(entries);
+      },
+      engine::current_task::GetTaskProcessor());
+  AddEntries(*client, "recreated_stream");
+  EXPECT_TRUE(WaitFor([&] { return consumed.Size() == kEntriesCount; }));
+
+  // The group is lost with the stream
+  client->Del("recreated_stream", {}).Get();
+  EXPECT_TRUE(WaitFor([&] {
+    client->Xadd("recreated_stream", {{"value", "new"}}, {}, {}).Get();
+    return consumed.Size() > kEntriesCount;
+  }));
+  consumer.Stop();
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,101 @@
+#include <userver/storages/redis/subscribe_client.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/async.hpp>
+
+#include "subscription_batch_queue.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+namespace {
+
+const std::string kBatchSubscribeToChannelPrefix =
+    "redis-channel-batch-subscriber-";
+const std::string kProcessRedisSubscriptionMessages =
+    "process redis subscription messages";
+
+// Collects the messages delivered one by one by SubscribeClient::Subscribe()
+// into the batches for the SubscribeBatched() callback
+class BatchedSubscriptionTokenImpl final : public SubscriptionTokenImplBase {
+ public:
+  BatchedSubscriptionTokenImpl(
+      SubscribeClient& client, std::string channel,
+      SubscriptionToken::OnMessagesCb on_messages_cb,
+      const SubscriptionBatchSettings& batch_settings,
+      const USERVER_NAMESPACE::redis::CommandControl& command_control)
+      : channel_(std::move(channel)),
+        on_messages_cb_(std::move(on_messages_cb)),
+        batch_settings_(batch_settings),
+        token_(client.Subscribe(
+            channel_,
+            [this](const std::string& channel, const std::string& message) {
+              PushMessage(channel, message);
+            },
+            command_control)),
+        consumer_task_(utils::Async(kBatchSubscribeToChannelPrefix + channel_,
+                                    [this] { ProcessMessages(); })) {}
+
+  ~BatchedSubscriptionTokenImpl() override { Unsubscribe(); }
+
+  void SetMaxQueueLength(size_t length) override {
+    token_.SetMaxQueueLength(length);
+    queue_.SetMaxLength(length);
+  }
+
+  void Unsubscribe() override {
+    token_.Unsubscribe();
+    consumer_task_.SyncCancel();
+  }
+
+ private:
+  void PushMessage(const std::string& channel, const std::string& message) {
+    if (!queue_.PushMessage(message)) {
+      // Use SubscriptionToken::SetMaxQueueLength() if limit is too low
+      LOG_ERROR() << "failed to push message '" << message
+                  << "' from channel '" << channel
+                  << "' into subscription batch due to overflow (max length="
+                  << queue_.GetMaxLength() << ')';
+    }
+  }
+
+  void ProcessMessages() {
+    const auto max_size = std::max<size_t>(batch_settings_.max_size, 1);
+    std::vector<std::string> messages;
+    while (
+        queue_.PopMessages(messages, max_size, batch_settings_.max_latency)) {
+      tracing::Span span(kProcessRedisSubscriptionMessages);
+      span.AddTag("messages", messages.size());
+      on_messages_cb_(channel_, messages);
+    }
+  }
+
+  const std::string channel_;
+  const SubscriptionToken::OnMessagesCb on_messages_cb_;
+  const SubscriptionBatchSettings batch_settings_;
+  SubscriptionBatchQueue<std::string> queue_;
+  SubscriptionToken token_;
+  engine::TaskWithResult<void> consumer_task_;
+};
+
+}  // namespace
+
+SubscriptionToken SubscribeClient::SubscribeBatched(
+    std::string channel, SubscriptionToken::OnMessagesCb on_messages_cb,
+    const SubscriptionBatchSettings& batch_settings,
+    const USERVER_NAMESPACE::redis::CommandControl& command_control) {
+  return SubscriptionToken{std::make_unique<BatchedSubscriptionTokenImpl>(
+      *this, std::move(channel), std::move(on_messages_cb), batch_settings,
+      command_control)};
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -20,6 +20,15 @@ SubscriptionToken SubscribeClientImpl::Subscribe(
       command_control)};
 }
 
+SubscriptionToken SubscribeClientImpl::SubscribeBatched(
+    std::string channel, SubscriptionToken::OnMessagesCb on_messages_cb,
+    const SubscriptionBatchSettings& batch_settings,
+    const USERVER_NAMESPACE::redis::CommandControl& command_control) {
+  return {std::make_unique<SubscriptionTokenImpl>(
+      *redis_client_, std::move(channel), std::move(on_messages_cb),
+      batch_settings, command_control)};
+}
+
 SubscriptionToken SubscribeClientImpl::Psubscribe(
     std::string pattern, SubscriptionToken::OnPmessageCb on_pmessage_cb,
     const USERVER_NAMESPACE::redis::CommandControl& command_control) {
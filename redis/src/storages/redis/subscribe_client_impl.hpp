@@ -40,6 +40,11 @@ class SubscribeClientImpl final : public SubscribeClient {
       std::string channel, SubscriptionToken::OnMessageCb on_message_cb,
       const USERVER_NAMESPACE::redis::CommandControl& command_control) override;
 
+  SubscriptionToken SubscribeBatched(
+      std::string channel, SubscriptionToken::OnMessagesCb on_messages_cb,
+      const SubscriptionBatchSettings& batch_settings,
+      const USERVER_NAMESPACE::redis::CommandControl& command_control) override;
+
   SubscriptionToken Psubscribe(
       std::string pattern, SubscriptionToken::OnPmessageCb on_pmessage_cb,
       const USERVER_NAMESPACE::redis::CommandControl& command_control) override;
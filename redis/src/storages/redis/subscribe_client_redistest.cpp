@@ -0,0 +1,164 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <storages/redis/client_impl.hpp>
+#include <storages/redis/impl/subscribe_sentinel.hpp>
+#include <storages/redis/subscribe_client_impl.hpp>
+#include <storages/redis/util_redistest.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr size_t kMessagesCount = 20;
+
+class SubscribeClientTest {
+ public:
+  SubscribeClientTest() {
+    auto thread_pools = MakeTestsuiteRedisThreadPools();
+    client_ = std::make_shared<storages::redis::ClientImpl>(
+        MakeTestsuiteRedisSentinel(thread_pools));
+
+    auto subscribe_sentinel = redis::SubscribeSentinel::Create(
+        thread_pools, GetTestsuiteRedisSettings(), "none", "sub", false, {});
+    subscribe_sentinel->WaitConnectedDebug();
+    subscribe_client_ = std::make_shared<storages::redis::SubscribeClientImpl>(
+        std::move(subscribe_sentinel));
+  }
+
+  storages::redis::SubscribeClient& SubscribeClient() {
+    return *subscribe_client_;
+  }
+
+  // Subscribes the client to the channel and publishes the messages until
+  // the first one is received
+  void PublishMessages(const std::string& channel,
+                       const std::function<size_t()>& received) {
+    const auto deadline = std::chrono::steady_clock::now() + kWaitTimeout;
+    while (!received() && std::chrono::steady_clock::now() < deadline) {
+      client_->Publish(channel, "ping", {});
+      engine::SleepFor(kWaitStep);
+    }
+    ASSERT_GT(received(), 0) << "subscription to " << channel << " failed";
+
+    for (size_t i = 0; i < kMessagesCount; ++i) {
+      client_->Publish(channel, std::to_string(i), {});
+    }
+  }
+
+ private:
+  std::shared_ptr<storages::redis::Client> client_;
+  std::shared_ptr<storages::redis::SubscribeClient> subscribe_client_;
+};
+
+struct ReceivedMessages {
+  engine::Mutex mutex;
+  std::vector<std::string> messages;
+  std::vector<size_t> batch_sizes;
+
+  size_t Size() {
+    std::lock_guard<engine::Mutex> lock(mutex);
+    return messages.size();
+  }
+};
+
+std::vector<std::string> ExpectedMessages() {
+  std::vector<std::string> expected;
+  for (size_t i = 0; i < kMessagesCount; ++i) {
+    expected.push_back(std::to_string(i));
+  }
+  return expected;
+}
+
+}  // namespace
+
+UTEST(RedisSubscribeClient, SubscribeBatched) {
+  SubscribeClientTest test;
+  ReceivedMessages received;
+
+  storages::redis::SubscriptionBatchSettings batch_settings;
+  batch_settings.max_latency = std::chrono::milliseconds{100};
+  auto token = test.SubscribeClient().SubscribeBatched(
+      "batched_channel",
+      [&](const std::string& channel, std::vector<std::string>& messages) {
+        EXPECT_EQ(channel, "batched_channel");
+        std::lock_guard<engine::Mutex> lock(received.mutex);
+        for (auto& message : messages) {
+          if (message != "ping") received.messages.push_back(message);
+        }
+        received.batch_sizes.push_back(messages.size());
+      },
+      batch_settings);
+
+  test.PublishMessages("batched_channel", [&] {
+    std::lock_guard<engine::Mutex> lock(received.mutex);
+    return received.batch_sizes.size();
+  });
+  EXPECT_TRUE(WaitFor([&] { return received.Size() == kMessagesCount; }));
+
+  std::lock_guard<engine::Mutex> lock(received.mutex);
+  EXPECT_EQ(received.messages, ExpectedMessages());
+  // The messages published in a row are delivered in the batches
+  EXPECT_LT(received.batch_sizes.size(), kMessagesCount);
+}
+
+UTEST(RedisSubscribeClient, SubscribeBatchedMaxSize) {
+  SubscribeClientTest test;
+  ReceivedMessages received;
+
+  storages::redis::SubscriptionBatchSettings batch_settings;
+  batch_settings.max_size = 3;
+  batch_settings.max_latency = std::chrono::milliseconds{100};
+  auto token = test.SubscribeClient().SubscribeBatched(
+      "batched_max_size_channel",
+      [&](const std::string&, std::vector<std::string>& messages) {
+        std::lock_guard<engine::Mutex> lock(received.mutex);
+        for (auto& message : messages) {
+          if (message != "ping") received.messages.push_back(message);
+        }
+        received.batch_sizes.push_back(messages.size());
+      },
+      batch_settings);
+
+  test.PublishMessages("batched_max_size_channel", [&] {
+    std::lock_guard<engine::Mutex> lock(received.mutex);
+    return received.batch_sizes.size();
+  });
+  EXPECT_TRUE(WaitFor([&] { return received.Size() == kMessagesCount; }));
+
+  std::lock_guard<engine::Mutex> lock(received.mutex);
+  EXPECT_EQ(received.messages, ExpectedMessages());
+  for (const auto size : received.batch_sizes) EXPECT_LE(size, 3);
+}
+
+UTEST(RedisSubscribeClient, SubscribePerMessage) {
+  SubscribeClientTest test;
+  ReceivedMessages received;
+
+  auto token = test.SubscribeClient().Subscribe(
+      "per_message_channel",
+      [&](const std::string& channel, const std::string& message) {
+        EXPECT_EQ(channel, "per_message_channel");
+        std::lock_guard<engine::Mutex> lock(received.mutex);
+        if (message != "ping") received.messages.push_back(message);
+        received.batch_sizes.push_back(1);
+      });
+
+  test.PublishMessages("per_message_channel", [&] {
+    std::lock_guard<engine::Mutex> lock(received.mutex);
+    return received.batch_sizes.size();
+  });
+  EXPECT_TRUE(WaitFor([&] { return received.Size() == kMessagesCount; }));
+
+  std::lock_guard<engine::Mutex> lock(received.mutex);
+  EXPECT_EQ(received.messages, ExpectedMessages());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// Messages are appended by the producer to a pending batch that is taken by
+/// the consumer as a whole, so a burst of messages needs neither an allocation
+/// per message nor a wakeup per message.
+template <typename Item>
+class SubscriptionBatchQueue {
+ public:
+  void SetMaxLength(size_t length) { max_length_ = length; }
+
+  size_t GetMaxLength() const { return max_length_.load(); }
+
+  /// @returns false if the queue is full, the arguments are left intact then
+  template <typename... Args>
+  bool PushMessage(Args&&... args) {
+    bool was_empty = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (pending_.size() >= max_length_) return false;
+      was_empty = pending_.empty();
+      pending_.emplace_back(std::forward<Args>(args)...);
+    }
+    // The consumer takes all the pending messages or stops waiting until the
+    // batch is full, so it has to be woken up on the first message only
+    if (was_empty) nonempty_event_.Send();
+    return true;
+  }
+
+  /// Waits for the messages and moves at most `max_size` of them into
+  /// `batch`. If there are less than `max_size` messages, waits up to
+  /// `max_latency` for more.
+  /// @returns false if the task was cancelled
+  bool PopMessages(std::vector<Item>& batch, size_t max_size,
+                   std::chrono::milliseconds max_latency) {
+    UASSERT(max_size > 0);
+    batch.clear();
+    while (!TakeMessages(batch, max_size)) {
+      if (!nonempty_event_.WaitForEvent()) return false;
+    }
+
+    if (max_latency.count() > 0) {
+      const auto deadline = engine::Deadline::FromDuration(max_latency);
+      while (batch.size() < max_size &&
+             nonempty_event_.WaitForEventUntil(deadline)) {
+        TakeMessages(batch, max_size);
+      }
+    }
+    return true;
+  }
+
+ private:
+  // Appends the pending messages to `batch`, returns false if there are none
+  bool TakeMessages(std::vector<Item>& batch, size_t max_size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pending_.empty()) return false;
+
+    if (batch.empty() && pending_.size() <= max_size) {
+      // The buffer of the consumer is reused for the next messages
+      batch.swap(pending_);
+      return true;
+    }
+
+    const auto count = std::min(pending_.size(), max_size - batch.size());
+    const auto end = pending_.begin() + count;
+    batch.insert(batch.end(), std::make_move_iterator(pending_.begin()),
+                 std::make_move_iterator(end));
+    pending_.erase(pending_.begin(), end);
+    return true;
+  }
+
+  std::mutex mutex_;
+  std::vector<Item> pending_;
+  std::atomic<size_t> max_length_{std::numeric_limits<size_t>::max()};
+  engine::SingleConsumerEvent nonempty_event_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -11,10 +11,7 @@ SubscriptionQueue<Item>::SubscriptionQueue(
     USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
     std::string channel,
     const USERVER_NAMESPACE::redis::CommandControl& command_control)
-    : queue_(Queue::Create()),
-      producer_(queue_->GetProducer()),
-      consumer_(queue_->GetConsumer()),
-      token_(std::make_unique<USERVER_NAMESPACE::redis::SubscriptionToken>(
+    : token_(std::make_unique<USERVER_NAMESPACE::redis::SubscriptionToken>(
           GetSubscriptionToken(subscribe_sentinel, std::move(channel),
                                command_control))) {}
 
@@ -25,14 +22,14 @@ SubscriptionQueue<Item>::~SubscriptionQueue() {
 
 template <typename Item>
 void SubscriptionQueue<Item>::SetMaxLength(size_t length) {
-  queue_->SetSoftMaxSize(length);
+  batch_queue_.SetMaxLength(length);
 }
 
 template <typename Item>
-bool SubscriptionQueue<Item>::PopMessage(std::unique_ptr<Item>& msg_ptr) {
-  // boost.lockfree pointer magic (FP?)
-  // NOLINTNEXTLINE(clang-analyzer-core.UndefinedBinaryOperatorResult)
-  return consumer_.Pop(msg_ptr);
+bool SubscriptionQueue<Item>::PopMessages(
+    std::vector<Item>& batch, size_t max_size,
+    std::chrono::milliseconds max_latency) {
+  return batch_queue_.PopMessages(batch, max_size, max_latency);
 }
 
 template <typename Item>
@@ -50,15 +47,15 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
     const USERVER_NAMESPACE::redis::CommandControl& command_control) {
   return subscribe_sentinel.Subscribe(
       channel,
-      [this](const std::string& channel, const std::string& message) {
-        if (!producer_.PushNoblock(std::make_unique<Item>(message))) {
+      [this](const std::string& channel, std::string message) {
+        if (!batch_queue_.PushMessage(std::move(message))) {
           // Use SubscriptionQueue::SetMaxLength() or
           // SubscriptionToken::SetMaxQueueLength() if limit is too low
           LOG_ERROR()
               << "failed to push message '" << message << "' from channel '"
               << channel
               << "' into subscription queue due to overflow (max length="
-              << queue_->GetSoftMaxSize() << ')';
+              << batch_queue_.GetMaxLength() << ')';
         }
       },
       command_control);
@@ -75,15 +72,15 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
   return subscribe_sentinel.Psubscribe(
       pattern,
       [this](const std::string& pattern, const std::string& channel,
-             const std::string& message) {
-        if (!producer_.PushNoblock(std::make_unique<Item>(channel, message))) {
+             std::string message) {
+        if (!batch_queue_.PushMessage(channel, std::move(message))) {
           // Use SubscriptionQueue::SetMaxLength() or
           // SubscriptionToken::SetMaxQueueLength() if limit is too low
           LOG_ERROR()
               << "failed to push pmessage '" << message << "' from channel '"
               << channel << "' from pattern '" << pattern
               << "' into subscription queue due to overflow (max length="
-              << queue_->GetSoftMaxSize() << ')';
+              << batch_queue_.GetMaxLength() << ')';
         }
       },
       command_control);
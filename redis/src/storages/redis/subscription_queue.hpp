@@ -1,10 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <storages/redis/impl/subscribe_sentinel.hpp>
-#include <userver/engine/mpsc_queue.hpp>
+
+#include "subscription_batch_queue.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -28,6 +31,8 @@ struct PatternSubscriptionQueueItem {
       : channel(std::move(channel)), message(std::move(message)) {}
 };
 
+/// Messages of a subscription are moved out of the pub/sub replies by the
+/// redis thread straight into a SubscriptionBatchQueue.
 template <typename Item>
 class SubscriptionQueue {
  public:
@@ -42,7 +47,12 @@ class SubscriptionQueue {
 
   void SetMaxLength(size_t length);
 
-  bool PopMessage(std::unique_ptr<Item>& msg_ptr);
+  /// Waits for the messages and moves at most `max_size` of them into
+  /// `batch`. If there are less than `max_size` messages, waits up to
+  /// `max_latency` for more.
+  /// @returns false if the task was cancelled
+  bool PopMessages(std::vector<Item>& batch, size_t max_size,
+                   std::chrono::milliseconds max_latency);
 
   void Unsubscribe();
 
@@ -63,11 +73,7 @@ class SubscriptionQueue {
       std::string pattern,
       const USERVER_NAMESPACE::redis::CommandControl& command_control);
 
-  using Queue = engine::MpscQueue<std::unique_ptr<Item>>;
-
-  std::shared_ptr<Queue> queue_;
-  typename Queue::Producer producer_;
-  typename Queue::Consumer consumer_;
+  SubscriptionBatchQueue<Item> batch_queue_;
   std::unique_ptr<USERVER_NAMESPACE::redis::SubscriptionToken> token_;
 };
 
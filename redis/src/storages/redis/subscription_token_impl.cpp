@@ -1,6 +1,8 @@
 #include "subscription_token_impl.hpp"
 
+#include <algorithm>
 #include <stdexcept>
+#include <vector>
 
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/tracing/span.hpp>
@@ -15,6 +17,8 @@ const std::string kSubscribeToChannelPrefix = "redis-channel-subscriber-";
 const std::string kSubscribeToPatternPrefix = "redis-pattern-subscriber-";
 const std::string kProcessRedisSubscriptionMessage =
     "process redis subscription message";
+const std::string kProcessRedisSubscriptionMessages =
+    "process redis subscription messages";
 
 }  // namespace
 
@@ -29,6 +33,19 @@ SubscriptionTokenImpl::SubscriptionTokenImpl(
       subscriber_task_(utils::Async(kSubscribeToChannelPrefix + channel_,
                                     [this] { ProcessMessages(); })) {}
 
+SubscriptionTokenImpl::SubscriptionTokenImpl(
+    USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
+    std::string channel, OnMessagesCb on_messages_cb,
+    const SubscriptionBatchSettings& batch_settings,
+    const USERVER_NAMESPACE::redis::CommandControl& command_control)
+    : channel_(std::move(channel)),
+      queue_(std::make_unique<SubscriptionQueue<ChannelSubscriptionQueueItem>>(
+          subscribe_sentinel, channel_, command_control)),
+      on_messages_cb_(std::move(on_messages_cb)),
+      batch_settings_(batch_settings),
+      subscriber_task_(utils::Async(kSubscribeToChannelPrefix + channel_,
+                                    [this] { ProcessMessages(); })) {}
+
 SubscriptionTokenImpl::~SubscriptionTokenImpl() { Unsubscribe(); }
 
 void SubscriptionTokenImpl::SetMaxQueueLength(size_t length) {
@@ -41,10 +58,22 @@ void SubscriptionTokenImpl::Unsubscribe() {
 }
 
 void SubscriptionTokenImpl::ProcessMessages() {
-  std::unique_ptr<ChannelSubscriptionQueueItem> msg;
-  while (queue_->PopMessage(msg)) {
-    tracing::Span span(kProcessRedisSubscriptionMessage);
-    if (on_message_cb_) on_message_cb_(channel_, msg->message);
+  const auto max_size = std::max<size_t>(batch_settings_.max_size, 1);
+  std::vector<ChannelSubscriptionQueueItem> batch;
+  std::vector<std::string> messages;
+  while (queue_->PopMessages(batch, max_size, batch_settings_.max_latency)) {
+    if (on_message_cb_) {
+      for (const auto& msg : batch) {
+        tracing::Span span(kProcessRedisSubscriptionMessage);
+        on_message_cb_(channel_, msg.message);
+      }
+    } else if (on_messages_cb_) {
+      tracing::Span span(kProcessRedisSubscriptionMessages);
+      span.AddTag("messages", batch.size());
+      messages.clear();
+      for (auto& msg : batch) messages.push_back(std::move(msg.message));
+      on_messages_cb_(channel_, messages);
+    }
   }
 }
 
@@ -71,10 +100,13 @@ void PsubscriptionTokenImpl::Unsubscribe() {
 }
 
 void PsubscriptionTokenImpl::ProcessMessages() {
-  std::unique_ptr<PatternSubscriptionQueueItem> msg;
-  while (queue_->PopMessage(msg)) {
-    tracing::Span span(kProcessRedisSubscriptionMessage);
-    if (on_pmessage_cb_) on_pmessage_cb_(pattern_, msg->channel, msg->message);
+  std::vector<PatternSubscriptionQueueItem> batch;
+  while (queue_->PopMessages(batch, SubscriptionBatchSettings{}.max_size,
+                             std::chrono::milliseconds{0})) {
+    for (const auto& msg : batch) {
+      tracing::Span span(kProcessRedisSubscriptionMessage);
+      if (on_pmessage_cb_) on_pmessage_cb_(pattern_, msg.channel, msg.message);
+    }
   }
 }
 
@@ -15,12 +15,19 @@ namespace redis {
 class SubscriptionTokenImpl : public SubscriptionTokenImplBase {
  public:
   using OnMessageCb = SubscriptionToken::OnMessageCb;
+  using OnMessagesCb = SubscriptionToken::OnMessagesCb;
 
   SubscriptionTokenImpl(
       USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
       std::string channel, OnMessageCb on_message_cb,
       const USERVER_NAMESPACE::redis::CommandControl& command_control);
 
+  SubscriptionTokenImpl(
+      USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
+      std::string channel, OnMessagesCb on_messages_cb,
+      const SubscriptionBatchSettings& batch_settings,
+      const USERVER_NAMESPACE::redis::CommandControl& command_control);
+
   ~SubscriptionTokenImpl() override;
 
   void SetMaxQueueLength(size_t length) override;
@@ -33,6 +40,8 @@ class SubscriptionTokenImpl : public SubscriptionTokenImplBase {
   std::string channel_;
   std::unique_ptr<SubscriptionQueue<ChannelSubscriptionQueueItem>> queue_;
   OnMessageCb on_message_cb_;
+  OnMessagesCb on_messages_cb_;
+  SubscriptionBatchSettings batch_settings_;
   engine::TaskWithResult<void> subscriber_task_;
 };
 
@@ -1,5 +1,9 @@
 #include <userver/storages/redis/mock_subscribe_client.hpp>
 
+#include <vector>
+
+#include <userver/engine/single_consumer_event.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis::test {
@@ -71,6 +75,50 @@ TEST(MockSubscribeClientTest, SubscriptionToken) {
   //! [SbTknExmpl1]
 }
 
+/// Here, we test the batching of the default SubscribeBatched()
+UTEST(MockSubscribeClientTest, SubscribeBatched) {
+  std::shared_ptr<MockSubscribeClient> client_mock =
+      std::make_shared<MockSubscribeClient>();
+
+  using testing::_;
+
+  SubscriptionToken::OnMessageCb on_message_cb;
+  EXPECT_CALL(*client_mock, Subscribe("test_subscribe", _, _))
+      .Times(1)
+      .WillOnce([&on_message_cb](
+                    std::string, SubscriptionToken::OnMessageCb callback,
+                    const USERVER_NAMESPACE::redis::CommandControl&) {
+        on_message_cb = std::move(callback);
+        return SubscriptionToken{};
+      });
+
+  constexpr size_t kMessages = 7;
+  std::vector<size_t> batch_sizes;
+  size_t received = 0;
+  engine::SingleConsumerEvent received_all;
+
+  SubscriptionBatchSettings batch_settings;
+  batch_settings.max_size = 3;
+  auto token = client_mock->SubscribeBatched(
+      "test_subscribe",
+      [&](const std::string& channel, std::vector<std::string>& messages) {
+        EXPECT_EQ(channel, "test_subscribe");
+        batch_sizes.push_back(messages.size());
+        received += messages.size();
+        if (received == kMessages) received_all.Send();
+      },
+      batch_settings);
+
+  ASSERT_TRUE(on_message_cb);
+  for (size_t i = 0; i < kMessages; ++i) {
+    on_message_cb("test_subscribe", "message" + std::to_string(i));
+  }
+
+  ASSERT_TRUE(received_all.WaitForEventFor(utest::kMaxTestWaitTime));
+  EXPECT_EQ(batch_sizes, (std::vector<size_t>{3, 3, 1}));
+  token.Unsubscribe();
+}
+
 }  // namespace storages::redis::test
 
 USERVER_NAMESPACE_END
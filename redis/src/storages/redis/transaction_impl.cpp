@@ -212,6 +212,11 @@ RequestIncr TransactionImpl::Incr(std::string key) {
   return AddCmd<RequestIncr>("incr", std::move(key));
 }
 
+RequestIncrby TransactionImpl::Incrby(std::string key, int64_t increment) {
+  UpdateShard(key);
+  return AddCmd<RequestIncrby>("incrby", std::move(key), increment);
+}
+
 RequestKeys TransactionImpl::Keys(std::string keys_pattern, size_t shard) {
   UpdateShard(shard);
   return AddCmd<RequestKeys>("keys", std::move(keys_pattern));
@@ -141,6 +141,8 @@ class TransactionImpl final : public Transaction {
 
   RequestIncr Incr(std::string key) override;
 
+  RequestIncrby Incrby(std::string key, int64_t increment) override;
+
   RequestKeys Keys(std::string keys_pattern, size_t shard) override;
 
   RequestLindex Lindex(std::string key, int64_t index) override;
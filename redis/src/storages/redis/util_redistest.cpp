@@ -4,6 +4,7 @@
 
 #include <fmt/format.h>
 
+#include <storages/redis/client_impl.hpp>
 #include <storages/redis/redis_secdist.hpp>
 #include <userver/formats/json/serialize.hpp>
 
@@ -72,4 +73,24 @@ const secdist::RedisSettings& GetTestsuiteRedisClusterSettings() {
   return settings_map.GetSettings("cluster-test");
 }
 
+std::shared_ptr<redis::ThreadPools> MakeTestsuiteRedisThreadPools() {
+  return std::make_shared<redis::ThreadPools>(
+      redis::kDefaultSentinelThreadPoolSize,
+      redis::kDefaultRedisThreadPoolSize);
+}
+
+std::shared_ptr<redis::Sentinel> MakeTestsuiteRedisSentinel(
+    std::shared_ptr<redis::ThreadPools> thread_pools) {
+  auto sentinel = redis::Sentinel::CreateSentinel(
+      std::move(thread_pools), GetTestsuiteRedisSettings(), "none", "pub",
+      redis::KeyShardFactory{""}, {});
+  sentinel->WaitConnectedDebug();
+  return sentinel;
+}
+
+std::shared_ptr<storages::redis::Client> MakeTestsuiteRedisClient() {
+  return std::make_shared<storages::redis::ClientImpl>(
+      MakeTestsuiteRedisSentinel(MakeTestsuiteRedisThreadPools()));
+}
+
 USERVER_NAMESPACE_END
@@ -1,11 +1,43 @@
 #pragma once
 
+#include <chrono>
+#include <memory>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/redis/client.hpp>
 #include <userver/storages/redis/impl/secdist_redis.hpp>
+#include <userver/storages/redis/impl/sentinel.hpp>
+#include <userver/storages/redis/impl/thread_pools.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+inline constexpr std::chrono::milliseconds kWaitStep{10};
+inline constexpr std::chrono::seconds kWaitTimeout{5};
+
 const secdist::RedisSettings& GetTestsuiteRedisSettings();
 
 const secdist::RedisSettings& GetTestsuiteRedisClusterSettings();
 
+/// Thread pools of the default sizes
+std::shared_ptr<redis::ThreadPools> MakeTestsuiteRedisThreadPools();
+
+/// Sentinel of the testsuite redis, waits for the connection
+std::shared_ptr<redis::Sentinel> MakeTestsuiteRedisSentinel(
+    std::shared_ptr<redis::ThreadPools> thread_pools);
+
+/// Client of the testsuite redis with its own thread pools
+std::shared_ptr<storages::redis::Client> MakeTestsuiteRedisClient();
+
+/// Checks the predicate every kWaitStep for up to kWaitTimeout, returns
+/// whether it became true. For effects redis delivers asynchronously.
+template <typename Predicate>
+bool WaitFor(Predicate predicate) {
+  const auto deadline = std::chrono::steady_clock::now() + kWaitTimeout;
+  while (std::chrono::steady_clock::now() < deadline) {
+    if (predicate()) return true;
+    engine::SleepFor(kWaitStep);
+  }
+  return predicate();
+}
+
 USERVER_NAMESPACE_END
@@ -154,6 +154,9 @@ class MockClientBase : public Client,
   RequestIncr Incr(std::string key,
                    const CommandControl& command_control) override;
 
+  RequestIncrby Incrby(std::string key, int64_t increment,
+                       const CommandControl& command_control) override;
+
   RequestKeys Keys(std::string keys_pattern, size_t shard,
                    const CommandControl& command_control) override;
 
@@ -294,6 +297,33 @@ class MockClientBase : public Client,
   RequestType Type(std::string key,
                    const CommandControl& command_control) override;
 
+  RequestXack Xack(std::string key, std::string group,
+                   std::vector<std::string> ids,
+                   const CommandControl& command_control) override;
+
+  RequestXadd Xadd(std::string key,
+                   std::vector<std::pair<std::string, std::string>> fields,
+                   const XaddOptions& options,
+                   const CommandControl& command_control) override;
+
+  RequestXautoclaim Xautoclaim(
+      std::string key, std::string group, std::string consumer,
+      std::chrono::milliseconds min_idle_time, std::string start,
+      const XautoclaimOptions& options,
+      const CommandControl& command_control) override;
+
+  RequestXdel Xdel(std::string key, std::vector<std::string> ids,
+                   const CommandControl& command_control) override;
+
+  RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) override;
+
+  RequestXreadgroup Xreadgroup(
+      std::string key, std::string group, std::string consumer,
+      std::string id, const XreadgroupOptions& options,
+      const CommandControl& command_control) override;
+
   RequestZadd Zadd(std::string key, double score, std::string member,
                    const CommandControl& command_control) override;
 
@@ -145,6 +145,11 @@ class GMockClient : public MockClientBase {
               (std::string key, const CommandControl& command_control),
               (override));
 
+  MOCK_METHOD(RequestIncrby, Incrby,
+              (std::string key, int64_t increment,
+               const CommandControl& command_control),
+              (override));
+
   MOCK_METHOD(RequestKeys, Keys,
               (std::string keys_pattern, size_t shard,
                const CommandControl& command_control),
@@ -342,6 +347,41 @@ class GMockClient : public MockClientBase {
               (std::string key, const CommandControl& command_control),
               (override));
 
+  MOCK_METHOD(RequestXack, Xack,
+              (std::string key, std::string group, std::vector<std::string> ids,
+               const CommandControl& command_control),
+              (override));
+
+  MOCK_METHOD(RequestXadd, Xadd,
+              (std::string key,
+               (std::vector<std::pair<std::string, std::string>>)fields,
+               const XaddOptions& options,
+               const CommandControl& command_control),
+              (override));
+
+  MOCK_METHOD(RequestXautoclaim, Xautoclaim,
+              (std::string key, std::string group, std::string consumer,
+               std::chrono::milliseconds min_idle_time, std::string start,
+               const XautoclaimOptions& options,
+               const CommandControl& command_control),
+              (override));
+
+  MOCK_METHOD(RequestXdel, Xdel,
+              (std::string key, std::vector<std::string> ids,
+               const CommandControl& command_control),
+              (override));
+
+  MOCK_METHOD(RequestXgroupCreate, XgroupCreate,
+              (std::string key, std::string group, std::string id,
+               const CommandControl& command_control),
+              (override));
+
+  MOCK_METHOD(RequestXreadgroup, Xreadgroup,
+              (std::string key, std::string group, std::string consumer,
+               std::string id, const XreadgroupOptions& options,
+               const CommandControl& command_control),
+              (override));
+
   MOCK_METHOD(RequestZadd, Zadd,
               (std::string key, double score, std::string member,
                const CommandControl& command_control),
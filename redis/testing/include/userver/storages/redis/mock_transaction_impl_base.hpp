@@ -78,6 +78,8 @@ class MockTransactionImplBase {
 
   virtual RequestIncr Incr(std::string key);
 
+  virtual RequestIncrby Incrby(std::string key, int64_t increment);
+
   virtual RequestKeys Keys(std::string keys_pattern, size_t shard);
 
   virtual RequestLindex Lindex(std::string key, int64_t index);
@@ -240,6 +240,13 @@ RequestIncr MockClientBase::Incr(std::string /*key*/,
   return RequestIncr{nullptr};
 }
 
+RequestIncrby MockClientBase::Incrby(
+    std::string /*key*/, int64_t /*increment*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestIncrby{nullptr};
+}
+
 RequestKeys MockClientBase::Keys(std::string /*keys_pattern*/, size_t /*shard*/,
                                  const CommandControl& /*command_control*/) {
   UASSERT_MSG(false, "redis method not mocked");
@@ -529,6 +536,53 @@ RequestType MockClientBase::Type(std::string /*key*/,
   return RequestType{nullptr};
 }
 
+RequestXack MockClientBase::Xack(std::string /*key*/, std::string /*group*/,
+                                 std::vector<std::string> /*ids*/,
+                                 const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXack{nullptr};
+}
+
+RequestXadd MockClientBase::Xadd(
+    std::string /*key*/,
+    std::vector<std::pair<std::string, std::string>> /*fields*/,
+    const XaddOptions& /*options*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXadd{nullptr};
+}
+
+RequestXautoclaim MockClientBase::Xautoclaim(
+    std::string /*key*/, std::string /*group*/, std::string /*consumer*/,
+    std::chrono::milliseconds /*min_idle_time*/, std::string /*start*/,
+    const XautoclaimOptions& /*options*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXautoclaim{nullptr};
+}
+
+RequestXdel MockClientBase::Xdel(std::string /*key*/,
+                                 std::vector<std::string> /*ids*/,
+                                 const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXdel{nullptr};
+}
+
+RequestXgroupCreate MockClientBase::XgroupCreate(
+    std::string /*key*/, std::string /*group*/, std::string /*id*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXgroupCreate{nullptr};
+}
+
+RequestXreadgroup MockClientBase::Xreadgroup(
+    std::string /*key*/, std::string /*group*/, std::string /*consumer*/,
+    std::string /*id*/, const XreadgroupOptions& /*options*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXreadgroup{nullptr};
+}
+
 RequestZadd MockClientBase::Zadd(std::string /*key*/, double /*score*/,
                                  std::string /*member*/,
                                  const CommandControl& /*command_control*/) {
@@ -263,6 +263,11 @@ RequestIncr MockTransaction::Incr(std::string key) {
   return AddSubrequest(impl_->Incr(std::move(key)));
 }
 
+RequestIncrby MockTransaction::Incrby(std::string key, int64_t increment) {
+  UpdateShard(key);
+  return AddSubrequest(impl_->Incrby(std::move(key), increment));
+}
+
 RequestKeys MockTransaction::Keys(std::string keys_pattern, size_t shard) {
   UpdateShard(shard);
   return AddSubrequest(impl_->Keys(std::move(keys_pattern), shard));
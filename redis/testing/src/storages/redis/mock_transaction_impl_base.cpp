@@ -165,6 +165,12 @@ RequestIncr MockTransactionImplBase::Incr(std::string /*key*/) {
   return RequestIncr{nullptr};
 }
 
+RequestIncrby MockTransactionImplBase::Incrby(std::string /*key*/,
+                                              int64_t /*increment*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestIncrby{nullptr};
+}
+
 RequestKeys MockTransactionImplBase::Keys(std::string /*keys_pattern*/,
                                           size_t /*shard*/) {
   UASSERT_MSG(false, "redis method not mocked");
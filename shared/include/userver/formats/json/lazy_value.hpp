@@ -0,0 +1,283 @@
+#pragma once
+
+/// @file userver/formats/json/lazy_value.hpp
+/// @brief @copybrief formats::json::LazyValue
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+struct LazyDocument;
+}  // namespace impl
+
+class LazyValue;
+
+/// @brief Builds a structural index of the JSON document without decoding
+/// any values. Strings are validated while indexing, numbers are decoded and
+/// validated on access.
+/// @throw ParseException if the document is not a well-formed JSON.
+LazyValue FromStringLazy(std::string doc);
+
+// clang-format off
+
+/// @ingroup userver_containers userver_formats
+///
+/// @brief Non-mutable on-demand JSON value representation.
+///
+/// Unlike formats::json::Value no DOM is built for the document. On
+/// construction (see formats::json::FromStringLazy) a single pass over the
+/// input records the positions of structural tokens and the matching closing
+/// bracket of each object and array. Member lookup skips over nested
+/// containers in O(1) per member and scalars are decoded only when they are
+/// requested through As<T>().
+///
+/// Use it for large documents from which only a few fields are read, or with
+/// `Parse(const formats::json::LazyValue&, formats::parse::To<T>)` overloads
+/// that fill user structs directly from the document. Types that have
+/// only a `Parse(const formats::json::Value&, ...)` overload are parsed from a
+/// DOM built for the requested subtree only.
+///
+/// Keys are looked up linearly, so prefer formats::json::Value for documents
+/// that are accessed repeatedly by key.
+///
+/// ## Example usage:
+///
+/// @snippet formats/json/lazy_value_test.cpp  Sample formats::json::LazyValue usage
+///
+/// @see @ref md_en_userver_formats
+
+// clang-format on
+
+class LazyValue final {
+ public:
+  using Exception = formats::json::Exception;
+  using ParseException = formats::json::ParseException;
+
+  /// @brief Forward iterator over members of an object or items of an array
+  class Iterator;
+
+  using const_iterator = Iterator;
+
+  /// @brief Constructs a Value that holds a null.
+  LazyValue() noexcept;
+
+  /// @brief Access member by key for read. Members are searched linearly.
+  /// @throw TypeMismatchException if not a missing value, an object or null.
+  LazyValue operator[](std::string_view key) const;
+
+  /// @brief Access array member by index for read.
+  /// @throw TypeMismatchException if not an array value.
+  /// @throw OutOfBoundsException if index is greater or equal
+  /// than size.
+  LazyValue operator[](std::size_t index) const;
+
+  /// @brief Returns an iterator to the beginning of the held array or map.
+  /// @throw TypeMismatchException if not an array, object, or null.
+  const_iterator begin() const;
+
+  /// @brief Returns an iterator to the end of the held array or map.
+  /// @throw TypeMismatchException if not an array, object, or null.
+  const_iterator end() const;
+
+  /// @brief Returns whether the array or object is empty.
+  /// Returns true for null.
+  /// @throw TypeMismatchException if not an array, object, or null.
+  bool IsEmpty() const;
+
+  /// @brief Returns array size, object members count, or 0 for null.
+  /// Complexity is linear in the count of direct children.
+  /// @throw TypeMismatchException if not an array, object, or null.
+  std::size_t GetSize() const;
+
+  /// @brief Returns true if *this holds nothing.
+  bool IsMissing() const noexcept;
+
+  bool IsNull() const;
+  bool IsBool() const;
+  bool IsInt() const;
+  bool IsInt64() const;
+  bool IsUInt64() const;
+  bool IsDouble() const;
+  bool IsString() const;
+  bool IsArray() const;
+  bool IsObject() const;
+
+  /// @brief Returns value of *this converted to T.
+  ///
+  /// Uses `Parse(const LazyValue&, formats::parse::To<T>)` if there is one,
+  /// otherwise builds a formats::json::Value for the subtree and parses it.
+  /// @throw Anything derived from std::exception.
+  template <typename T>
+  T As() const;
+
+  /// @brief Returns value of *this converted to T or T(args) if
+  /// this->IsMissing() or this->IsNull().
+  /// @throw Anything derived from std::exception.
+  template <typename T, typename First, typename... Rest>
+  T As(First&& default_arg, Rest&&... more_default_args) const;
+
+  /// @brief Returns value of *this converted to T or T() if this->IsMissing()
+  /// or this->IsNull().
+  /// @note Use as `value.As<T>({})`
+  template <typename T>
+  T As(Value::DefaultConstructed) const;
+
+  /// @brief Returns true if *this holds a `key`.
+  /// @throw TypeMismatchException if `*this` is not a map or null.
+  bool HasMember(std::string_view key) const;
+
+  /// @brief Returns full path to this value. Complexity is linear in the
+  /// document size, use only for diagnostics.
+  std::string GetPath() const;
+
+  /// @brief Returns the unparsed JSON text of the value.
+  /// @throw MemberMissingException if `this->IsMissing()`.
+  std::string_view GetRawJson() const;
+
+  /// @brief Builds a formats::json::Value DOM of this subtree.
+  /// @throw MemberMissingException if `this->IsMissing()`.
+  Value ToValue() const;
+
+  /// @throw MemberMissingException if `this->IsMissing()`.
+  void CheckNotMissing() const;
+
+  /// @throw TypeMismatchException if `*this` is not an array or null.
+  void CheckArrayOrNull() const;
+
+  /// @throw TypeMismatchException if `*this` is not a map or null.
+  void CheckObjectOrNull() const;
+
+  /// @throw TypeMismatchException if `*this` is not a map, array or null.
+  void CheckObjectOrArrayOrNull() const;
+
+  /// @brief Returns true if *this is a first (root) value.
+  bool IsRoot() const noexcept;
+
+ private:
+  static constexpr std::uint32_t kMissingIndex = -1;
+
+  LazyValue(std::shared_ptr<const impl::LazyDocument> doc,
+            std::uint32_t index) noexcept;
+  LazyValue(std::shared_ptr<const impl::LazyDocument> doc,
+            std::string&& detached_path) noexcept;
+
+  char GetTokenChar() const;
+  int GetExtendedType() const;
+
+  std::shared_ptr<const impl::LazyDocument> doc_;
+  /// Index of the value token in the structural tape
+  std::uint32_t index_{0};
+  /// Full path of node (only for missing nodes)
+  std::string detached_path_;
+
+  friend LazyValue FromStringLazy(std::string);
+};
+
+class LazyValue::Iterator final {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = LazyValue;
+  using reference = const LazyValue&;
+  using pointer = const LazyValue*;
+
+  Iterator operator++(int);
+  Iterator& operator++();
+  reference operator*() const { return current_; }
+  pointer operator->() const { return &current_; }
+
+  bool operator==(const Iterator& other) const {
+    return current_.index_ == other.current_.index_;
+  }
+  bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+  /// @brief Returns name of the referenced field
+  /// @throws `TypeMismatchException` if iterated value is not an object
+  std::string GetName() const;
+
+  /// @brief Returns index of the referenced field
+  /// @throws `TypeMismatchException` if iterated value is not an array
+  std::size_t GetIndex() const;
+
+ private:
+  Iterator(const LazyValue& container, std::uint32_t index, std::size_t pos);
+
+  void UpdateValue();
+
+  bool is_object_;
+  /// Tape index of the key for objects, of the item for arrays
+  std::uint32_t index_;
+  std::size_t pos_;
+  LazyValue current_;
+
+  friend class LazyValue;
+};
+
+template <typename T>
+T LazyValue::As() const {
+  if constexpr (formats::common::impl::kHasParse<LazyValue, T>) {
+    return Parse(*this, formats::parse::To<T>{});
+  } else {
+    static_assert(formats::common::impl::kHasParse<Value, T>,
+                  "There is no `Parse(const LazyValue&, "
+                  "formats::parse::To<T>)` or `Parse(const Value&, "
+                  "formats::parse::To<T>)` in namespace of `T` or "
+                  "`formats::parse`. Probably you forgot to include the "
+                  "<userver/formats/parse/common_containers.hpp> or you "
+                  "have not provided a `Parse` function overload.");
+    return ToValue().As<T>();
+  }
+}
+
+template <>
+bool LazyValue::As<bool>() const;
+
+template <>
+int64_t LazyValue::As<int64_t>() const;
+
+template <>
+uint64_t LazyValue::As<uint64_t>() const;
+
+template <>
+double LazyValue::As<double>() const;
+
+template <>
+std::string LazyValue::As<std::string>() const;
+
+template <typename T, typename First, typename... Rest>
+T LazyValue::As(First&& default_arg, Rest&&... more_default_args) const {
+  if (IsMissing() || IsNull()) {
+    return T(std::forward<First>(default_arg),
+             std::forward<Rest>(more_default_args)...);
+  }
+  return As<T>();
+}
+
+template <typename T>
+T LazyValue::As(Value::DefaultConstructed) const {
+  return (IsMissing() || IsNull()) ? T() : As<T>();
+}
+
+inline LazyValue Parse(const LazyValue& value, parse::To<LazyValue>) {
+  return value;
+}
+
+inline Value Parse(const LazyValue& value, parse::To<Value>) {
+  return value.ToValue();
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
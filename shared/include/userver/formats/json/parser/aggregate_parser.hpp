@@ -0,0 +1,429 @@
+#pragma once
+
+/// @file userver/formats/json/parser/aggregate_parser.hpp
+/// @brief SAX parser for aggregates described by formats::json::AggregateFields
+
+#include <bitset>
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/tuple_size.hpp>
+
+#include <userver/formats/json/parser/array_parser.hpp>
+#include <userver/formats/json/parser/bool_parser.hpp>
+#include <userver/formats/json/parser/int_parser.hpp>
+#include <userver/formats/json/parser/map_parser.hpp>
+#include <userver/formats/json/parser/number_parser.hpp>
+#include <userver/formats/json/parser/parser_json.hpp>
+#include <userver/formats/json/parser/string_parser.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
+#include <userver/formats/json/sax_aggregates.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+
+template <typename T>
+class AggregateParser;
+
+namespace impl {
+
+template <typename T, typename = void>
+struct ParserForImpl;
+
+}  // namespace impl
+
+/// Parser type that is used for the aggregate member of type `T`:
+/// - bool, int32_t, int64_t, float, double and std::string are parsed by the
+///   corresponding typed parsers;
+/// - std::optional, std::vector and std::map / std::unordered_map with string
+///   keys are parsed by parsers of their items;
+/// - aggregates with formats::json::AggregateFields are parsed by
+///   formats::json::parser::AggregateParser;
+/// - other types are parsed into a formats::json::Value first and then
+///   converted with `formats::json::Value::As<T>()`.
+template <typename T>
+using ParserFor = typename impl::ParserForImpl<T>::type;
+
+namespace impl {
+
+// Skips a value of any type, used for unknown members of aggregates
+class SkipParser final : public BaseParser {
+ public:
+  void Reset() { depth_ = 0; }
+
+  void Null() override { MaybePopSelf(); }
+  void Bool(bool) override { MaybePopSelf(); }
+  void Int64(int64_t) override { MaybePopSelf(); }
+  void Uint64(uint64_t) override { MaybePopSelf(); }
+  void Double(double) override { MaybePopSelf(); }
+  void String(std::string_view) override { MaybePopSelf(); }
+  void StartObject() override { ++depth_; }
+  void Key(std::string_view) override {}
+  void EndObject() override { EndContainer(); }
+  void StartArray() override { ++depth_; }
+  void EndArray() override { EndContainer(); }
+
+  std::string GetPathItem() const override { return {}; }
+
+ protected:
+  std::string Expected() const override { return "value"; }
+
+ private:
+  void MaybePopSelf() {
+    if (depth_ == 0) parser_state_->PopMe(*this);
+  }
+
+  void EndContainer() {
+    --depth_;
+    MaybePopSelf();
+  }
+
+  std::size_t depth_{0};
+};
+
+// Parses `null` into std::nullopt and delegates other values to ItemParser
+template <typename T>
+class OptionalParser final : public TypedParser<std::optional<T>>,
+                             public Subscriber<T> {
+ public:
+  OptionalParser() { item_parser_.Subscribe(*this); }
+
+  OptionalParser(const OptionalParser&) = delete;
+  OptionalParser& operator=(const OptionalParser&) = delete;
+
+  void Null() override { this->SetResult(std::nullopt); }
+  void Bool(bool b) override { PushItemParser().Bool(b); }
+  void Int64(int64_t i) override { PushItemParser().Int64(i); }
+  void Uint64(uint64_t i) override { PushItemParser().Uint64(i); }
+  void Double(double d) override { PushItemParser().Double(d); }
+  void String(std::string_view sw) override { PushItemParser().String(sw); }
+  void StartObject() override { PushItemParser().StartObject(); }
+  void StartArray() override { PushItemParser().StartArray(); }
+
+  std::string GetPathItem() const override { return {}; }
+
+ protected:
+  std::string Expected() const override { return "value or null"; }
+
+ private:
+  BaseParser& PushItemParser() {
+    item_parser_.Reset();
+    this->parser_state_->PushParser(item_parser_.GetParser());
+    return item_parser_.GetParser();
+  }
+
+  void OnSend(T&& value) override { this->SetResult(std::move(value)); }
+
+  ParserFor<T> item_parser_;
+};
+
+// Proxy parser that owns the item parser of an ArrayParser
+template <typename T>
+class VectorParser final {
+ public:
+  using ResultType = std::vector<T>;
+
+  VectorParser() = default;
+  VectorParser(const VectorParser&) = delete;
+  VectorParser& operator=(const VectorParser&) = delete;
+
+  void Reset() { array_parser_.Reset(); }
+
+  void Subscribe(Subscriber<ResultType>& subscriber) {
+    array_parser_.Subscribe(subscriber);
+  }
+
+  auto& GetParser() { return array_parser_.GetParser(); }
+
+ private:
+  ParserFor<T> item_parser_;
+  ArrayParser<T, ParserFor<T>> array_parser_{item_parser_};
+};
+
+// Proxy parser that owns the value parser of a MapParser
+template <typename Map>
+class DictParser final {
+ public:
+  using ResultType = Map;
+
+  DictParser() = default;
+  DictParser(const DictParser&) = delete;
+  DictParser& operator=(const DictParser&) = delete;
+
+  void Reset() { map_parser_.Reset(); }
+
+  void Subscribe(Subscriber<ResultType>& subscriber) {
+    map_parser_.Subscribe(subscriber);
+  }
+
+  auto& GetParser() { return map_parser_.GetParser(); }
+
+ private:
+  using ValueParser = ParserFor<typename Map::mapped_type>;
+
+  ValueParser value_parser_;
+  MapParser<Map, ValueParser> map_parser_{value_parser_};
+};
+
+// Proxy parser that builds a DOM and converts it with Value::As<T>()
+template <typename T>
+class DomParser final : public Subscriber<Value> {
+ public:
+  using ResultType = T;
+
+  DomParser() { value_parser_.Subscribe(*this); }
+  DomParser(const DomParser&) = delete;
+  DomParser& operator=(const DomParser&) = delete;
+
+  void Reset() { value_parser_.Reset(); }
+
+  void Subscribe(Subscriber<ResultType>& subscriber) {
+    subscriber_ = &subscriber;
+  }
+
+  auto& GetParser() { return value_parser_.GetParser(); }
+
+ private:
+  void OnSend(Value&& value) override {
+    if (subscriber_) subscriber_->OnSend(value.As<T>());
+  }
+
+  JsonValueParser value_parser_;
+  Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+template <typename T, typename>
+struct ParserForImpl {
+  using type = DomParser<T>;
+};
+
+template <>
+struct ParserForImpl<bool> {
+  using type = BoolParser;
+};
+
+template <>
+struct ParserForImpl<std::int32_t> {
+  using type = Int32Parser;
+};
+
+template <>
+struct ParserForImpl<std::int64_t> {
+  using type = Int64Parser;
+};
+
+template <>
+struct ParserForImpl<float> {
+  using type = FloatParser;
+};
+
+template <>
+struct ParserForImpl<double> {
+  using type = DoubleParser;
+};
+
+template <>
+struct ParserForImpl<std::string> {
+  using type = StringParser;
+};
+
+template <typename T>
+struct ParserForImpl<std::optional<T>> {
+  using type = OptionalParser<T>;
+};
+
+template <typename T>
+struct ParserForImpl<std::vector<T>> {
+  using type = VectorParser<T>;
+};
+
+template <typename T>
+struct ParserForImpl<std::map<std::string, T>> {
+  using type = DictParser<std::map<std::string, T>>;
+};
+
+template <typename T>
+struct ParserForImpl<std::unordered_map<std::string, T>> {
+  using type = DictParser<std::unordered_map<std::string, T>>;
+};
+
+template <typename T>
+struct ParserForImpl<T, std::enable_if_t<formats::json::impl::kIsSaxAggregate<T>>> {
+  using type = AggregateParser<T>;
+};
+
+template <typename T, std::size_t Index>
+class FieldSink final
+    : public Subscriber<boost::pfr::tuple_element_t<Index, T>> {
+ public:
+  explicit FieldSink(T& aggregate) : aggregate_(aggregate) {}
+
+  void OnSend(boost::pfr::tuple_element_t<Index, T>&& value) override {
+    boost::pfr::get<Index>(aggregate_) = std::move(value);
+  }
+
+ private:
+  T& aggregate_;
+};
+
+template <typename T, typename Indices>
+struct AggregateMembers;
+
+template <typename T, std::size_t... Indices>
+struct AggregateMembers<T, std::index_sequence<Indices...>> {
+  using Parsers =
+      std::tuple<ParserFor<boost::pfr::tuple_element_t<Indices, T>>...>;
+  using Sinks = std::tuple<FieldSink<T, Indices>...>;
+
+  static constexpr std::bitset<sizeof...(Indices)> kRequired{[] {
+    unsigned long long result = 0;
+    ((result |= meta::kIsOptional<boost::pfr::tuple_element_t<Indices, T>>
+                    ? 0
+                    : 1ULL << Indices),
+     ...);
+    return result;
+  }()};
+};
+
+}  // namespace impl
+
+// clang-format off
+
+/// @brief SAX parser for aggregates described by
+/// formats::json::AggregateFields
+///
+/// Fields are parsed directly into the aggregate members, no DOM is built.
+/// Unknown keys are skipped, missing non-optional members are reported as
+/// parse errors.
+///
+/// ## Example usage:
+///
+/// @snippet formats/json/sax_aggregates_test.cpp  Sample formats::json::parser::AggregateParser usage
+
+// clang-format on
+
+template <typename T>
+class AggregateParser final : public TypedParser<T> {
+ public:
+  static_assert(formats::json::impl::kIsSaxAggregate<T>,
+                "Specialize formats::json::AggregateFields for the type");
+  static_assert(boost::pfr::tuple_size_v<T> <= 64,
+                "Aggregates with more than 64 members are not supported");
+
+  AggregateParser() { SubscribeFields(kIndices); }
+
+  AggregateParser(const AggregateParser&) = delete;
+  AggregateParser& operator=(const AggregateParser&) = delete;
+
+  void Reset() override {
+    state_ = State::kStart;
+    current_field_ = kUnknownField;
+    seen_.reset();
+    result_ = T{};
+  }
+
+ protected:
+  void StartObject() override {
+    if (state_ != State::kStart) this->Throw("object");
+    state_ = State::kInside;
+  }
+
+  void Key(std::string_view key) override {
+    if (state_ != State::kInside) this->Throw("field '" + std::string{key} + "'");
+
+    current_field_ = FindField(key);
+    if (current_field_ == kUnknownField) {
+      skip_parser_.Reset();
+      this->parser_state_->PushParser(skip_parser_);
+      return;
+    }
+
+    seen_.set(current_field_);
+    PushFieldParser(current_field_, kIndices);
+  }
+
+  void EndObject() override {
+    if (state_ != State::kInside) this->Throw("'}'");
+    current_field_ = kUnknownField;
+
+    const auto missing = Members::kRequired & ~seen_;
+    if (missing.any()) {
+      for (std::size_t i = 0; i < kSize; ++i) {
+        if (missing.test(i)) {
+          throw InternalParseError(fmt::format(
+              "Missing required field '{}'", AggregateFields<T>::kNames[i]));
+        }
+      }
+    }
+
+    this->SetResult(std::move(result_));
+  }
+
+  std::string Expected() const override {
+    return state_ == State::kInside ? "string" : "object";
+  }
+
+  std::string GetPathItem() const override {
+    if (current_field_ == kUnknownField) return {};
+    return std::string{AggregateFields<T>::kNames[current_field_]};
+  }
+
+ private:
+  static constexpr std::size_t kSize = boost::pfr::tuple_size_v<T>;
+  static constexpr std::size_t kUnknownField = kSize;
+  static constexpr auto kIndices = std::make_index_sequence<kSize>{};
+
+  using Members = impl::AggregateMembers<T, std::make_index_sequence<kSize>>;
+
+  enum class State {
+    kStart,
+    kInside,
+  };
+
+  static std::size_t FindField(std::string_view key) {
+    for (std::size_t i = 0; i < kSize; ++i) {
+      if (AggregateFields<T>::kNames[i] == key) return i;
+    }
+    return kUnknownField;
+  }
+
+  template <std::size_t... Indices>
+  void SubscribeFields(std::index_sequence<Indices...>) {
+    (std::get<Indices>(parsers_).Subscribe(std::get<Indices>(sinks_)), ...);
+  }
+
+  template <std::size_t... Indices>
+  void PushFieldParser(std::size_t index, std::index_sequence<Indices...>) {
+    const auto push = [this](auto& parser) {
+      parser.Reset();
+      this->parser_state_->PushParser(parser.GetParser());
+    };
+    ((index == Indices ? push(std::get<Indices>(parsers_)) : void()), ...);
+  }
+
+  template <std::size_t... Indices>
+  static typename Members::Sinks MakeSinks(T& result,
+                                           std::index_sequence<Indices...>) {
+    return {impl::FieldSink<T, Indices>{result}...};
+  }
+
+  State state_{State::kStart};
+  std::size_t current_field_{kUnknownField};
+  std::bitset<kSize> seen_;
+  T result_{};
+  typename Members::Parsers parsers_;
+  typename Members::Sinks sinks_{MakeSinks(result_, kIndices)};
+  impl::SkipParser skip_parser_;
+};
+
+}  // namespace formats::json::parser
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,90 @@
+#pragma once
+
+/// @file userver/formats/json/sax_aggregates.hpp
+/// @brief Streaming serialization of aggregates into
+/// formats::json::StringBuilder
+/// @ingroup userver_formats_serialize_sax
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/tuple_size.hpp>
+
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+/// @brief Field names of an aggregate for streaming (de)serialization
+///
+/// To enable formats::json::StringBuilder serialization and
+/// formats::json::parser::AggregateParser parsing of an aggregate without
+/// building a DOM, specialize the template within `USERVER_NAMESPACE_BEGIN` /
+/// `USERVER_NAMESPACE_END` and list JSON keys of the aggregate members in the
+/// order of declaration:
+///
+/// @snippet formats/json/sax_aggregates_test.cpp  Sample formats::json::AggregateFields usage
+///
+/// Members of type std::optional are not written if they hold no value and
+/// are not required on parsing.
+template <typename T>
+struct AggregateFields;
+
+namespace impl {
+
+template <typename T>
+using AggregateFieldNames = decltype(AggregateFields<T>::kNames);
+
+template <typename T>
+constexpr bool IsSaxAggregate() {
+  if constexpr (std::is_aggregate_v<T> &&
+                meta::kIsDetected<AggregateFieldNames, T>) {
+    static_assert(std::size(AggregateFields<T>::kNames) ==
+                      boost::pfr::tuple_size_v<T>,
+                  "Count of names in formats::json::AggregateFields<T> "
+                  "differs from the count of the aggregate members");
+    return true;
+  } else {
+    return false;
+  }
+}
+
+template <typename T>
+inline constexpr bool kIsSaxAggregate = IsSaxAggregate<T>();
+
+template <typename T, std::size_t... Indices>
+void WriteAggregateFields(const T& value, StringBuilder& sw,
+                          std::index_sequence<Indices...>) {
+  const auto write_field = [&sw](std::string_view name, const auto& field) {
+    if constexpr (meta::kIsOptional<std::decay_t<decltype(field)>>) {
+      if (!field) return;
+    }
+    sw.Key(name);
+    WriteToStream(field, sw);
+  };
+
+  (write_field(AggregateFields<T>::kNames[Indices],
+               boost::pfr::get<Indices>(value)),
+   ...);
+}
+
+}  // namespace impl
+
+/// Aggregates serialization, see formats::json::AggregateFields
+template <typename T>
+std::enable_if_t<impl::kIsSaxAggregate<T>> WriteToStream(const T& value,
+                                                         StringBuilder& sw) {
+  StringBuilder::ObjectGuard guard{sw};
+  impl::WriteAggregateFields(
+      value, sw, std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
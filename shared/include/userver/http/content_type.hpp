@@ -80,6 +80,7 @@ std::ostream& operator<<(std::ostream&, const ContentType&);
 namespace content_type {
 
 extern const ContentType kApplicationJson;
+extern const ContentType kTextPlain;
 
 }  // namespace content_type
 }  // namespace http
@@ -0,0 +1,841 @@
+#include <userver/formats/json/lazy_value.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <fmt/format.h>
+#include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
+
+#include <userver/formats/common/path.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+#include <formats/json/impl/exttypes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+
+/// Structural index of a JSON document.
+///
+/// `offsets[i]` is the position in `json` of the i-th token, a token being
+/// either an opening or closing bracket or a scalar (including keys). For
+/// opening brackets `links[i]` is the tape index of the matching closing
+/// bracket, for scalars it is the end position of the token in `json`.
+struct LazyDocument {
+  std::string json;
+  std::vector<std::uint32_t> offsets;
+  std::vector<std::uint32_t> links;
+};
+
+}  // namespace impl
+
+namespace {
+
+constexpr std::uint64_t kOnes = 0x0101010101010101ULL;
+constexpr std::uint64_t kHighs = 0x8080808080808080ULL;
+
+// Sets the high bit of every byte of `word` that equals `c`. The lowest set
+// bit is always exact, higher ones may be false positives.
+inline std::uint64_t MatchBytes(std::uint64_t word, char c) noexcept {
+  const auto x = word ^ (kOnes * static_cast<unsigned char>(c));
+  return (x - kOnes) & ~x & kHighs;
+}
+
+// Sets the high bit of every byte of `word` that is less than `c`, with the
+// same precision guarantees as MatchBytes. `c` must not exceed 0x80.
+inline std::uint64_t MatchBytesLess(std::uint64_t word, char c) noexcept {
+  return (word - kOnes * static_cast<unsigned char>(c)) & ~word & kHighs;
+}
+
+inline bool IsStringSpecial(char c) noexcept {
+  const auto uc = static_cast<unsigned char>(c);
+  return c == '"' || c == '\\' || uc < 0x20 || uc >= 0x80;
+}
+
+// Returns the position of the first '"', '\\', control character or non-ASCII
+// byte at or after `pos`, or the size of `s`. Processes 8 bytes per
+// iteration.
+std::size_t FindStringSpecial(std::string_view s, std::size_t pos) noexcept {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  while (pos + sizeof(std::uint64_t) <= s.size()) {
+    std::uint64_t word;
+    std::memcpy(&word, s.data() + pos, sizeof(word));
+    const auto mask = MatchBytes(word, '"') | MatchBytes(word, '\\') |
+                      MatchBytesLess(word, 0x20) | (word & kHighs);
+    if (mask) return pos + __builtin_ctzll(mask) / 8;
+    pos += sizeof(word);
+  }
+#endif
+  while (pos < s.size() && !IsStringSpecial(s[pos])) ++pos;
+  return pos;
+}
+
+enum CharClass : std::uint8_t {
+  kOther = 0,
+  kWhitespace = 1,
+  kDelimiter = 2,
+  kNumberChar = 4,
+};
+
+constexpr std::array<std::uint8_t, 256> MakeCharClasses() {
+  std::array<std::uint8_t, 256> result{};
+  for (const char c : {' ', '\t', '\n', '\r'}) {
+    result[static_cast<unsigned char>(c)] = kWhitespace | kDelimiter;
+  }
+  for (const char c : {',', ':', '[', ']', '{', '}', '"'}) {
+    result[static_cast<unsigned char>(c)] = kDelimiter;
+  }
+  for (char c = '0'; c <= '9'; ++c) {
+    result[static_cast<unsigned char>(c)] = kNumberChar;
+  }
+  for (const char c : {'-', '+', '.', 'e', 'E'}) {
+    result[static_cast<unsigned char>(c)] = kNumberChar;
+  }
+  return result;
+}
+
+constexpr auto kCharClasses = MakeCharClasses();
+
+inline bool Is(char c, CharClass cls) noexcept {
+  return kCharClasses[static_cast<unsigned char>(c)] & cls;
+}
+
+class Indexer final {
+ public:
+  explicit Indexer(impl::LazyDocument& doc) : doc_(doc), s_(doc.json) {}
+
+  void Run() {
+    if (s_.empty()) throw ParseException("JSON document is empty");
+    if (s_.size() >= std::numeric_limits<std::uint32_t>::max()) {
+      throw ParseException("JSON document is too large for lazy parsing");
+    }
+    // A rough estimate that avoids most of the reallocations
+    doc_.offsets.reserve(s_.size() / 8 + 1);
+    doc_.links.reserve(s_.size() / 8 + 1);
+
+    State state = State::kValue;
+    while (true) {
+      SkipWhitespace();
+      if (pos_ == s_.size()) break;
+      const char c = s_[pos_];
+
+      switch (state) {
+        case State::kValue:
+        case State::kValueOrClose:
+          if (c == ']' && state == State::kValueOrClose) {
+            state = Close(c);
+          } else if (c == '{') {
+            Open();
+            state = State::kKeyOrClose;
+          } else if (c == '[') {
+            Open();
+            state = State::kValueOrClose;
+          } else if (c == '"') {
+            String();
+            state = AfterValue();
+          } else {
+            Scalar();
+            state = AfterValue();
+          }
+          break;
+        case State::kKey:
+        case State::kKeyOrClose:
+          if (c == '}' && state == State::kKeyOrClose) {
+            state = Close(c);
+          } else if (c == '"') {
+            String();
+            state = State::kColon;
+          } else {
+            Fail("object member name expected");
+          }
+          break;
+        case State::kColon:
+          if (c != ':') Fail("':' expected");
+          ++pos_;
+          state = State::kValue;
+          break;
+        case State::kCommaOrClose:
+          if (c == ',') {
+            ++pos_;
+            state = IsInObject() ? State::kKey : State::kValue;
+          } else if (c == '}' || c == ']') {
+            state = Close(c);
+          } else {
+            Fail("',' or closing bracket expected");
+          }
+          break;
+        case State::kEnd:
+          Fail("the document root must not be followed by other values");
+      }
+    }
+
+    if (state != State::kEnd) Fail("unexpected end of document");
+  }
+
+ private:
+  enum class State {
+    kValue,
+    kValueOrClose,
+    kKey,
+    kKeyOrClose,
+    kColon,
+    kCommaOrClose,
+    kEnd,
+  };
+
+  [[noreturn]] void Fail(std::string_view what) const { FailAt(pos_, what); }
+
+  [[noreturn]] void FailAt(std::size_t pos, std::string_view what) const {
+    const auto line = 1 + std::count(s_.begin(), s_.begin() + pos, '\n');
+    const auto from_pos = s_.substr(0, pos).find_last_of('\n');
+    const auto column = (from_pos == std::string_view::npos)
+                            ? pos + 1
+                            : pos - from_pos;
+    throw ParseException(fmt::format("JSON parse error at line {} column {}: {}",
+                                     line, column, what));
+  }
+
+  void SkipWhitespace() noexcept {
+    while (pos_ < s_.size() && Is(s_[pos_], kWhitespace)) ++pos_;
+  }
+
+  std::uint32_t Push(std::size_t link) {
+    doc_.offsets.push_back(pos_);
+    doc_.links.push_back(link);
+    return doc_.offsets.size() - 1;
+  }
+
+  bool IsInObject() const { return s_[doc_.offsets[stack_.back()]] == '{'; }
+
+  State AfterValue() const {
+    return stack_.empty() ? State::kEnd : State::kCommaOrClose;
+  }
+
+  void Open() {
+    stack_.push_back(Push(0));
+    ++pos_;
+  }
+
+  State Close(char c) {
+    const auto open = stack_.back();
+    if ((c == '}') != IsInObject()) Fail("mismatched closing bracket");
+    doc_.links[open] = Push(open);
+    stack_.pop_back();
+    ++pos_;
+    return AfterValue();
+  }
+
+  // Validates the string the same way rapidjson does with
+  // kParseValidateEncodingFlag, so the unescaped values may be returned as is
+  void String() {
+    auto pos = pos_ + 1;
+    while (true) {
+      pos = FindStringSpecial(s_, pos);
+      if (pos >= s_.size()) Fail("missing a closing quotation mark in string");
+      const auto c = static_cast<unsigned char>(s_[pos]);
+      if (c == '"') break;
+      if (c == '\\') {
+        pos = SkipEscape(pos);
+      } else if (c < 0x20) {
+        FailAt(pos, "invalid encoding in string");
+      } else {
+        pos = SkipUtf8(pos);
+      }
+    }
+    Push(pos + 1);
+    pos_ = pos + 1;
+  }
+
+  // Returns the position after the escape sequence at `pos`
+  std::size_t SkipEscape(std::size_t pos) const {
+    if (pos + 1 >= s_.size()) {
+      FailAt(pos, "missing a closing quotation mark in string");
+    }
+    switch (s_[pos + 1]) {
+      case '"':
+      case '\\':
+      case '/':
+      case 'b':
+      case 'f':
+      case 'n':
+      case 'r':
+      case 't':
+        return pos + 2;
+      case 'u':
+        break;
+      default:
+        FailAt(pos, "invalid escape character in string");
+    }
+
+    const auto code_point = ParseHex4(pos + 2);
+    pos += 6;
+    if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+      if (pos + 1 >= s_.size() || s_[pos] != '\\' || s_[pos + 1] != 'u') {
+        FailAt(pos, "the surrogate pair in string is invalid");
+      }
+      const auto low = ParseHex4(pos + 2);
+      if (low < 0xDC00 || low > 0xDFFF) {
+        FailAt(pos, "the surrogate pair in string is invalid");
+      }
+      pos += 6;
+    }
+    return pos;
+  }
+
+  unsigned ParseHex4(std::size_t pos) const {
+    if (pos + 4 > s_.size()) {
+      FailAt(pos, "incorrect hex digit after \\u escape in string");
+    }
+    unsigned result = 0;
+    for (std::size_t i = pos; i < pos + 4; ++i) {
+      const char c = s_[i];
+      result <<= 4;
+      if (c >= '0' && c <= '9') {
+        result |= c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        result |= c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        result |= c - 'A' + 10;
+      } else {
+        FailAt(i, "incorrect hex digit after \\u escape in string");
+      }
+    }
+    return result;
+  }
+
+  // Returns the position after the well-formed UTF-8 sequence at `pos`,
+  // overlong encodings and surrogates are rejected
+  std::size_t SkipUtf8(std::size_t pos) const {
+    const auto lead = static_cast<unsigned char>(s_[pos]);
+    std::size_t size = 0;
+    unsigned char min = 0x80;
+    unsigned char max = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+      size = 2;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+      size = 3;
+      if (lead == 0xE0) min = 0xA0;
+      if (lead == 0xED) max = 0x9F;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+      size = 4;
+      if (lead == 0xF0) min = 0x90;
+      if (lead == 0xF4) max = 0x8F;
+    } else {
+      FailAt(pos, "invalid encoding in string");
+    }
+
+    if (pos + size > s_.size()) FailAt(pos, "invalid encoding in string");
+    for (std::size_t i = 1; i < size; ++i) {
+      const auto c = static_cast<unsigned char>(s_[pos + i]);
+      if (c < min || c > max) FailAt(pos, "invalid encoding in string");
+      min = 0x80;
+      max = 0xBF;
+    }
+    return pos + size;
+  }
+
+  void Scalar() {
+    const auto begin = pos_;
+    auto end = pos_;
+    while (end < s_.size() && !Is(s_[end], kDelimiter)) ++end;
+
+    const auto token = s_.substr(begin, end - begin);
+    if (token != "true" && token != "false" && token != "null") {
+      if (token.empty() || (token[0] != '-' && (token[0] < '0' || token[0] > '9'))) {
+        Fail("invalid value");
+      }
+      for (const char c : token) {
+        if (!Is(c, kNumberChar)) Fail("invalid value");
+      }
+    }
+
+    Push(end);
+    pos_ = end;
+  }
+
+  impl::LazyDocument& doc_;
+  const std::string_view s_;
+  std::size_t pos_{0};
+  std::vector<std::uint32_t> stack_;
+};
+
+class NumberHandler final
+    : public ::rapidjson::BaseReaderHandler<impl::UTF8, NumberHandler> {
+ public:
+  bool Int(int i) { return value.SetInt(i), true; }
+  bool Uint(unsigned u) { return value.SetUint(u), true; }
+  bool Int64(int64_t i) { return value.SetInt64(i), true; }
+  bool Uint64(uint64_t u) { return value.SetUint64(u), true; }
+  bool Double(double d) { return value.SetDouble(d), true; }
+  bool Default() { return false; }
+
+  impl::Value value;
+};
+
+class StringHandler final
+    : public ::rapidjson::BaseReaderHandler<impl::UTF8, StringHandler> {
+ public:
+  bool String(const char* str, ::rapidjson::SizeType length, bool) {
+    value.assign(str, length);
+    return true;
+  }
+  bool Default() { return false; }
+
+  std::string value;
+};
+
+template <typename Handler>
+void DecodeToken(std::string_view token, Handler& handler,
+                 const LazyValue& value) {
+  ::rapidjson::MemoryStream ms(token.data(), token.size());
+  ::rapidjson::Reader reader;
+  const auto ok =
+      reader.Parse<::rapidjson::kParseStopWhenDoneFlag |
+                   ::rapidjson::kParseValidateEncodingFlag |
+                   ::rapidjson::kParseFullPrecisionFlag>(ms, handler);
+  if (!ok) {
+    throw ParseException(fmt::format("JSON parse error at '{}': {}",
+                                     value.GetPath(),
+                                     ::rapidjson::GetParseError_En(ok.Code())));
+  }
+  if (ms.Tell() != token.size()) {
+    throw ParseException(
+        fmt::format("JSON parse error at '{}': invalid value", value.GetPath()));
+  }
+}
+
+impl::Value DecodeNumber(std::string_view token, const LazyValue& value) {
+  NumberHandler handler;
+  DecodeToken(token, handler, value);
+  return std::move(handler.value);
+}
+
+bool IsIntegral(const double val) {
+  double integral_part;
+  return modf(val, &integral_part) == 0.0;
+}
+
+constexpr int64_t kMaxIntDouble{int64_t{1}
+                                << std::numeric_limits<double>::digits};
+
+template <typename Int>
+bool IsNonOverflowingIntegral(const double val) {
+  if constexpr (sizeof(Int) >= sizeof(double)) {
+    return val > -kMaxIntDouble && val < kMaxIntDouble && IsIntegral(val);
+  } else {
+    return val >= std::numeric_limits<Int>::min() &&
+           val <= std::numeric_limits<Int>::max() && IsIntegral(val);
+  }
+}
+
+bool IsOpen(char c) noexcept { return c == '{' || c == '['; }
+
+bool IsNumberStart(char c) noexcept {
+  return c == '-' || (c >= '0' && c <= '9');
+}
+
+// Tape index of the token that follows the value at `index`
+std::uint32_t NextIndex(const impl::LazyDocument& doc,
+                        std::uint32_t index) noexcept {
+  return IsOpen(doc.json[doc.offsets[index]]) ? doc.links[index] + 1
+                                              : index + 1;
+}
+
+std::string_view RawToken(const impl::LazyDocument& doc, std::uint32_t index) {
+  const auto begin = doc.offsets[index];
+  const auto end = IsOpen(doc.json[begin])
+                       ? doc.offsets[doc.links[index]] + 1
+                       : doc.links[index];
+  return std::string_view{doc.json}.substr(begin, end - begin);
+}
+
+bool KeyEquals(std::string_view raw_key, std::string_view key) {
+  // raw_key is quoted
+  const auto unquoted = raw_key.substr(1, raw_key.size() - 2);
+  if (unquoted.find('\\') == std::string_view::npos) return unquoted == key;
+
+  StringHandler handler;
+  DecodeToken(raw_key, handler, LazyValue{});
+  return handler.value == key;
+}
+
+std::string DecodeKey(std::string_view raw_key) {
+  const auto unquoted = raw_key.substr(1, raw_key.size() - 2);
+  if (unquoted.find('\\') == std::string_view::npos) {
+    return std::string{unquoted};
+  }
+
+  StringHandler handler;
+  DecodeToken(raw_key, handler, LazyValue{});
+  return std::move(handler.value);
+}
+
+// Shared by all the default constructed values
+const std::shared_ptr<const impl::LazyDocument>& GetNullDocument() {
+  static const auto kNullDocument = [] {
+    auto doc = std::make_shared<impl::LazyDocument>();
+    doc->json = "null";
+    Indexer{*doc}.Run();
+    return std::shared_ptr<const impl::LazyDocument>{std::move(doc)};
+  }();
+  return kNullDocument;
+}
+
+}  // namespace
+
+LazyValue FromStringLazy(std::string doc) {
+  auto lazy_doc = std::make_shared<impl::LazyDocument>();
+  lazy_doc->json = std::move(doc);
+  Indexer{*lazy_doc}.Run();
+  return LazyValue{std::move(lazy_doc), 0};
+}
+
+LazyValue::LazyValue() noexcept : doc_(GetNullDocument()) {}
+
+LazyValue::LazyValue(std::shared_ptr<const impl::LazyDocument> doc,
+                     std::uint32_t index) noexcept
+    : doc_(std::move(doc)), index_(index) {}
+
+LazyValue::LazyValue(std::shared_ptr<const impl::LazyDocument> doc,
+                     std::string&& detached_path) noexcept
+    : doc_(std::move(doc)),
+      index_(kMissingIndex),
+      detached_path_(std::move(detached_path)) {}
+
+LazyValue LazyValue::operator[](std::string_view key) const {
+  if (!IsMissing()) {
+    CheckObjectOrNull();
+    if (IsObject()) {
+      const auto& doc = *doc_;
+      const auto end = doc.links[index_];
+      for (auto i = index_ + 1; i < end; i = NextIndex(doc, i + 1)) {
+        if (KeyEquals(RawToken(doc, i), key)) return {doc_, i + 1};
+      }
+    }
+  }
+  return {doc_, formats::common::MakeChildPath(GetPath(), key)};
+}
+
+LazyValue LazyValue::operator[](std::size_t index) const {
+  CheckArrayOrNull();
+  if (IsArray()) {
+    const auto& doc = *doc_;
+    const auto end = doc.links[index_];
+    std::size_t pos = 0;
+    for (auto i = index_ + 1; i < end; i = NextIndex(doc, i), ++pos) {
+      if (pos == index) return {doc_, i};
+    }
+  }
+  throw OutOfBoundsException(index, GetSize(), GetPath());
+}
+
+LazyValue::const_iterator LazyValue::begin() const {
+  CheckObjectOrArrayOrNull();
+  if (IsNull()) return end();
+  return const_iterator{*this, index_ + 1, 0};
+}
+
+LazyValue::const_iterator LazyValue::end() const {
+  CheckObjectOrArrayOrNull();
+  if (IsNull()) return const_iterator{*this, kMissingIndex, 0};
+  return const_iterator{*this, doc_->links[index_], 0};
+}
+
+bool LazyValue::IsEmpty() const {
+  CheckObjectOrArrayOrNull();
+  return IsNull() || doc_->links[index_] == index_ + 1;
+}
+
+std::size_t LazyValue::GetSize() const {
+  CheckObjectOrArrayOrNull();
+  if (IsNull()) return 0;  // nulls are "empty arrays"
+
+  const auto& doc = *doc_;
+  const auto end = doc.links[index_];
+  const auto step = IsObject() ? 1 : 0;
+  std::size_t size = 0;
+  for (auto i = index_ + 1; i < end; i = NextIndex(doc, i + step)) ++size;
+  return size;
+}
+
+bool LazyValue::IsMissing() const noexcept { return index_ == kMissingIndex; }
+
+char LazyValue::GetTokenChar() const {
+  CheckNotMissing();
+  return doc_->json[doc_->offsets[index_]];
+}
+
+bool LazyValue::IsNull() const {
+  return !IsMissing() && GetTokenChar() == 'n';
+}
+
+bool LazyValue::IsBool() const {
+  if (IsMissing()) return false;
+  const auto c = GetTokenChar();
+  return c == 't' || c == 'f';
+}
+
+bool LazyValue::IsInt() const {
+  if (IsMissing() || !IsNumberStart(GetTokenChar())) return false;
+  const auto native = DecodeNumber(GetRawJson(), *this);
+  if (native.IsInt()) return true;
+  if (native.IsDouble()) {
+    return IsNonOverflowingIntegral<int>(native.GetDouble());
+  }
+  return false;
+}
+
+bool LazyValue::IsInt64() const {
+  if (IsMissing() || !IsNumberStart(GetTokenChar())) return false;
+  const auto native = DecodeNumber(GetRawJson(), *this);
+  if (native.IsInt64()) return true;
+  if (native.IsDouble()) {
+    return IsNonOverflowingIntegral<int64_t>(native.GetDouble());
+  }
+  return false;
+}
+
+bool LazyValue::IsUInt64() const {
+  if (IsMissing() || !IsNumberStart(GetTokenChar())) return false;
+  const auto native = DecodeNumber(GetRawJson(), *this);
+  if (native.IsUint64()) return true;
+  if (native.IsDouble()) {
+    return IsNonOverflowingIntegral<uint64_t>(native.GetDouble());
+  }
+  return false;
+}
+
+bool LazyValue::IsDouble() const {
+  return !IsMissing() && IsNumberStart(GetTokenChar());
+}
+
+bool LazyValue::IsString() const {
+  return !IsMissing() && GetTokenChar() == '"';
+}
+
+bool LazyValue::IsArray() const {
+  return !IsMissing() && GetTokenChar() == '[';
+}
+
+bool LazyValue::IsObject() const {
+  return !IsMissing() && GetTokenChar() == '{';
+}
+
+template <>
+bool LazyValue::As<bool>() const {
+  const auto c = GetTokenChar();
+  if (c == 't') return true;
+  if (c == 'f') return false;
+  throw TypeMismatchException(GetExtendedType(), impl::booleanValue, GetPath());
+}
+
+template <>
+int64_t LazyValue::As<int64_t>() const {
+  if (IsNumberStart(GetTokenChar())) {
+    const auto native = DecodeNumber(GetRawJson(), *this);
+    if (native.IsInt64()) return native.GetInt64();
+    if (native.IsDouble()) {
+      double val = native.GetDouble();
+      if (IsNonOverflowingIntegral<int64_t>(val))
+        return static_cast<int64_t>(val);
+    }
+  }
+  throw TypeMismatchException(GetExtendedType(), impl::intValue, GetPath());
+}
+
+template <>
+uint64_t LazyValue::As<uint64_t>() const {
+  if (IsNumberStart(GetTokenChar())) {
+    const auto native = DecodeNumber(GetRawJson(), *this);
+    if (native.IsUint64()) return native.GetUint64();
+    if (native.IsDouble()) {
+      double val = native.GetDouble();
+      if (IsNonOverflowingIntegral<uint64_t>(val))
+        return static_cast<uint64_t>(val);
+    }
+  }
+  throw TypeMismatchException(GetExtendedType(), impl::uintValue, GetPath());
+}
+
+template <>
+double LazyValue::As<double>() const {
+  if (IsNumberStart(GetTokenChar())) {
+    const auto native = DecodeNumber(GetRawJson(), *this);
+    if (native.IsDouble()) return native.GetDouble();
+    if (native.IsInt64()) return static_cast<double>(native.GetInt64());
+    if (native.IsUint64()) return static_cast<double>(native.GetUint64());
+  }
+  throw TypeMismatchException(GetExtendedType(), impl::realValue, GetPath());
+}
+
+template <>
+std::string LazyValue::As<std::string>() const {
+  if (GetTokenChar() != '"') {
+    throw TypeMismatchException(GetExtendedType(), impl::stringValue,
+                                GetPath());
+  }
+
+  const auto raw = GetRawJson();
+  const auto unquoted = raw.substr(1, raw.size() - 2);
+  if (unquoted.find('\\') == std::string_view::npos) {
+    return std::string{unquoted};
+  }
+
+  StringHandler handler;
+  DecodeToken(raw, handler, *this);
+  return std::move(handler.value);
+}
+
+bool LazyValue::HasMember(std::string_view key) const {
+  return !(*this)[key].IsMissing();
+}
+
+std::string LazyValue::GetPath() const {
+  if (IsMissing()) {
+    return detached_path_.empty() ? formats::common::kPathRoot : detached_path_;
+  }
+
+  // Descend from the root to the value, skipping the unrelated subtrees
+  const auto& doc = *doc_;
+  std::string path;
+  std::uint32_t current = 0;
+  while (current != index_) {
+    const bool is_object = doc.json[doc.offsets[current]] == '{';
+    const auto end = doc.links[current];
+    std::size_t pos = 0;
+    auto i = current + 1;
+    for (; i < end; ++pos) {
+      const auto value_index = is_object ? i + 1 : i;
+      const auto next = NextIndex(doc, value_index);
+      if (index_ < next) {
+        if (is_object) {
+          formats::common::AppendPath(path, DecodeKey(RawToken(doc, i)));
+        } else {
+          formats::common::AppendPath(path, pos);
+        }
+        current = value_index;
+        break;
+      }
+      i = next;
+    }
+    if (i >= end) break;  // unreachable for a valid index
+  }
+  return path.empty() ? formats::common::kPathRoot : path;
+}
+
+std::string_view LazyValue::GetRawJson() const {
+  CheckNotMissing();
+  return RawToken(*doc_, index_);
+}
+
+Value LazyValue::ToValue() const {
+  CheckNotMissing();
+  return FromString(GetRawJson());
+}
+
+void LazyValue::CheckNotMissing() const {
+  if (IsMissing()) {
+    throw MemberMissingException(GetPath());
+  }
+}
+
+void LazyValue::CheckArrayOrNull() const {
+  if (!IsNull() && !IsArray()) {
+    throw TypeMismatchException(GetExtendedType(), impl::arrayValue, GetPath());
+  }
+}
+
+void LazyValue::CheckObjectOrNull() const {
+  if (!IsNull() && !IsObject()) {
+    throw TypeMismatchException(GetExtendedType(), impl::objectValue,
+                                GetPath());
+  }
+}
+
+void LazyValue::CheckObjectOrArrayOrNull() const {
+  if (!IsNull() && !IsObject() && !IsArray()) {
+    throw TypeMismatchException(GetExtendedType(), impl::objectValue,
+                                GetPath());
+  }
+}
+
+bool LazyValue::IsRoot() const noexcept { return index_ == 0; }
+
+int LazyValue::GetExtendedType() const {
+  switch (GetTokenChar()) {
+    case 'n':
+      return impl::nullValue;
+    case '{':
+      return impl::objectValue;
+    case '[':
+      return impl::arrayValue;
+    case '"':
+      return impl::stringValue;
+    case 't':
+    case 'f':
+      return impl::booleanValue;
+    default:
+      return impl::GetExtendedType(DecodeNumber(GetRawJson(), *this));
+  }
+}
+
+LazyValue::Iterator::Iterator(const LazyValue& container, std::uint32_t index,
+                              std::size_t pos)
+    : is_object_(container.IsObject()),
+      index_(index),
+      pos_(pos),
+      current_(container.doc_, kMissingIndex) {
+  UpdateValue();
+}
+
+LazyValue::Iterator LazyValue::Iterator::operator++(int) {
+  Iterator it{*this};
+  ++*this;
+  return it;
+}
+
+LazyValue::Iterator& LazyValue::Iterator::operator++() {
+  index_ = NextIndex(*current_.doc_, current_.index_);
+  ++pos_;
+  UpdateValue();
+  return *this;
+}
+
+void LazyValue::Iterator::UpdateValue() {
+  const auto& doc = *current_.doc_;
+  if (index_ == kMissingIndex ||
+      doc.json[doc.offsets[index_]] == (is_object_ ? '}' : ']')) {
+    current_.index_ = kMissingIndex;
+  } else {
+    current_.index_ = is_object_ ? index_ + 1 : index_;
+  }
+}
+
+std::string LazyValue::Iterator::GetName() const {
+  if (!is_object_) {
+    throw TypeMismatchException(impl::arrayValue, impl::objectValue,
+                                current_.GetPath());
+  }
+  return DecodeKey(RawToken(*current_.doc_, index_));
+}
+
+std::size_t LazyValue::Iterator::GetIndex() const {
+  if (is_object_) {
+    throw TypeMismatchException(impl::objectValue, impl::arrayValue,
+                                current_.GetPath());
+  }
+  return pos_;
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
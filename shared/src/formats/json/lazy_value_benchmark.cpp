@@ -0,0 +1,148 @@
+#include <benchmark/benchmark.h>
+
+#include <userver/formats/json/lazy_value.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Header {
+  std::string id;
+  int64_t version;
+  bool dry_run;
+};
+
+template <typename Value>
+Header ParseHeader(const Value& value) {
+  return Header{value["id"].template As<std::string>(),
+                value["version"].template As<int64_t>(),
+                value["dry_run"].template As<bool>()};
+}
+
+struct Item {
+  int64_t id;
+  std::string name;
+  double price;
+};
+
+template <typename Value>
+Item ParseItem(const Value& value) {
+  return Item{value["id"].template As<int64_t>(),
+              value["name"].template As<std::string>(),
+              value["price"].template As<double>()};
+}
+
+Item Parse(const formats::json::Value& value, formats::parse::To<Item>) {
+  return ParseItem(value);
+}
+
+Item Parse(const formats::json::LazyValue& value, formats::parse::To<Item>) {
+  return ParseItem(value);
+}
+
+// {"items": [{...}, ...], "id": ..., "version": ..., "dry_run": ...}
+std::string MakeLargeDocument(std::size_t items_count) {
+  formats::json::StringBuilder sb;
+  {
+    formats::json::StringBuilder::ObjectGuard guard{sb};
+    sb.Key("items");
+    {
+      formats::json::StringBuilder::ArrayGuard items_guard{sb};
+      for (std::size_t i = 0; i < items_count; ++i) {
+        formats::json::StringBuilder::ObjectGuard item_guard{sb};
+        sb.Key("id");
+        sb.WriteInt64(i);
+        sb.Key("name");
+        sb.WriteString("item name that is long enough to be noticed " +
+                       std::to_string(i));
+        sb.Key("price");
+        sb.WriteDouble(i * 1.5);
+        sb.Key("tags");
+        formats::json::StringBuilder::ArrayGuard tags_guard{sb};
+        sb.WriteString("tag-a");
+        sb.WriteString("tag-b");
+      }
+    }
+    sb.Key("id");
+    sb.WriteString("request-id");
+    sb.Key("version");
+    sb.WriteInt64(42);
+    sb.Key("dry_run");
+    sb.WriteBool(false);
+  }
+  return sb.GetString();
+}
+
+// {"a": {"a": ... {"a": {}, "value": 1} ..., "value": 1}, "value": 1}
+std::string MakeDeepDocument(std::size_t depth) {
+  std::string result;
+  for (std::size_t i = 0; i < depth; ++i) result += R"({"padding": [1, 2, 3], "a": )";
+  result += "{}";
+  for (std::size_t i = 0; i < depth; ++i) result += R"(, "value": 1})";
+  return result;
+}
+
+}  // namespace
+
+void JsonDomFewFields(benchmark::State& state) {
+  const auto doc = MakeLargeDocument(state.range(0));
+  for (auto _ : state) {
+    const auto json = formats::json::FromString(doc);
+    benchmark::DoNotOptimize(ParseHeader(json));
+  }
+  state.SetBytesProcessed(state.iterations() * doc.size());
+}
+BENCHMARK(JsonDomFewFields)->RangeMultiplier(8)->Range(8, 32768);
+
+void JsonLazyFewFields(benchmark::State& state) {
+  const auto doc = MakeLargeDocument(state.range(0));
+  for (auto _ : state) {
+    const auto json = formats::json::FromStringLazy(doc);
+    benchmark::DoNotOptimize(ParseHeader(json));
+  }
+  state.SetBytesProcessed(state.iterations() * doc.size());
+}
+BENCHMARK(JsonLazyFewFields)->RangeMultiplier(8)->Range(8, 32768);
+
+void JsonDomTypedParse(benchmark::State& state) {
+  const auto doc = MakeLargeDocument(state.range(0));
+  for (auto _ : state) {
+    const auto json = formats::json::FromString(doc);
+    benchmark::DoNotOptimize(json["items"].As<std::vector<Item>>());
+  }
+  state.SetBytesProcessed(state.iterations() * doc.size());
+}
+BENCHMARK(JsonDomTypedParse)->RangeMultiplier(8)->Range(8, 32768);
+
+void JsonLazyTypedParse(benchmark::State& state) {
+  const auto doc = MakeLargeDocument(state.range(0));
+  for (auto _ : state) {
+    const auto json = formats::json::FromStringLazy(doc);
+    benchmark::DoNotOptimize(json["items"].As<std::vector<Item>>());
+  }
+  state.SetBytesProcessed(state.iterations() * doc.size());
+}
+BENCHMARK(JsonLazyTypedParse)->RangeMultiplier(8)->Range(8, 32768);
+
+void JsonDomDeep(benchmark::State& state) {
+  const auto doc = MakeDeepDocument(state.range(0));
+  for (auto _ : state) {
+    const auto json = formats::json::FromString(doc);
+    benchmark::DoNotOptimize(json["value"].As<int>());
+  }
+}
+BENCHMARK(JsonDomDeep)->RangeMultiplier(4)->Range(4, 1024);
+
+void JsonLazyDeep(benchmark::State& state) {
+  const auto doc = MakeDeepDocument(state.range(0));
+  for (auto _ : state) {
+    const auto json = formats::json::FromStringLazy(doc);
+    benchmark::DoNotOptimize(json["value"].As<int>());
+  }
+}
+BENCHMARK(JsonLazyDeep)->RangeMultiplier(4)->Range(4, 1024);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <vector>
+
+#include <userver/formats/json/lazy_value.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+/// [Sample formats::json::LazyValue usage]
+struct Point {
+  int64_t x;
+  int64_t y;
+};
+
+Point Parse(const formats::json::LazyValue& value,
+            formats::parse::To<Point>) {
+  return Point{value["x"].As<int64_t>(), value["y"].As<int64_t>()};
+}
+/// [Sample formats::json::LazyValue usage]
+
+struct DomOnly {
+  std::string name;
+};
+
+DomOnly Parse(const formats::json::Value& value, formats::parse::To<DomOnly>) {
+  return DomOnly{value["name"].As<std::string>()};
+}
+
+constexpr char kDoc[] = R"({
+  "int": -42,
+  "uint": 18446744073709551615,
+  "double": 1.5,
+  "bool": true,
+  "null": null,
+  "str": "hello",
+  "escaped": "a\"b\\cA\n",
+  "long": "0123456789abcdef0123456789abcdef\"quoted\"",
+  "point": {"y": 2, "x": 1},
+  "points": [{"x": 1, "y": 2}, {"x": 3, "y": 4}],
+  "nested": {"deep": {"deeper": [1, [2, [3]], {"k": "v"}]}},
+  "empty_obj": {},
+  "empty_arr": [],
+  "dom": {"name": "from dom"}
+})";
+
+}  // namespace
+
+TEST(FormatsJsonLazy, Scalars) {
+  const auto json = formats::json::FromStringLazy(kDoc);
+
+  EXPECT_TRUE(json.IsObject());
+  EXPECT_TRUE(json.IsRoot());
+  EXPECT_EQ(json["int"].As<int64_t>(), -42);
+  EXPECT_EQ(json["int"].As<int>(), -42);
+  EXPECT_TRUE(json["int"].IsInt());
+  EXPECT_EQ(json["uint"].As<uint64_t>(),
+            std::numeric_limits<uint64_t>::max());
+  EXPECT_FALSE(json["uint"].IsInt64());
+  EXPECT_TRUE(json["uint"].IsUInt64());
+  EXPECT_DOUBLE_EQ(json["double"].As<double>(), 1.5);
+  EXPECT_TRUE(json["bool"].As<bool>());
+  EXPECT_TRUE(json["null"].IsNull());
+  EXPECT_EQ(json["str"].As<std::string>(), "hello");
+  EXPECT_EQ(json["escaped"].As<std::string>(), "a\"b\\cA\n");
+  EXPECT_EQ(json["long"].As<std::string>(),
+            "0123456789abcdef0123456789abcdef\"quoted\"");
+  EXPECT_EQ(json["null"].As<std::string>("default"), "default");
+  EXPECT_EQ(json["missing"].As<int>(5), 5);
+}
+
+TEST(FormatsJsonLazy, Containers) {
+  const auto json = formats::json::FromStringLazy(kDoc);
+
+  EXPECT_EQ(json.GetSize(), 14);
+  EXPECT_TRUE(json["empty_obj"].IsEmpty());
+  EXPECT_TRUE(json["empty_arr"].IsEmpty());
+  EXPECT_EQ(json["points"].GetSize(), 2);
+  EXPECT_EQ(json["points"][1]["y"].As<int>(), 4);
+  EXPECT_EQ(json["nested"]["deep"]["deeper"][1][1][0].As<int>(), 3);
+  EXPECT_EQ(json["nested"]["deep"]["deeper"][2]["k"].As<std::string>(), "v");
+  EXPECT_TRUE(json.HasMember("dom"));
+  EXPECT_FALSE(json.HasMember("nope"));
+  EXPECT_EQ(json["point"].GetRawJson(), R"({"y": 2, "x": 1})");
+
+  std::vector<std::string> names;
+  for (auto it = json["point"].begin(); it != json["point"].end(); ++it) {
+    names.push_back(it.GetName());
+  }
+  EXPECT_EQ(names, (std::vector<std::string>{"y", "x"}));
+
+  std::size_t count = 0;
+  for (const auto& item : json["nested"]["deep"]["deeper"]) {
+    EXPECT_FALSE(item.IsMissing());
+    ++count;
+  }
+  EXPECT_EQ(count, 3);
+}
+
+TEST(FormatsJsonLazy, TypedParse) {
+  const auto json = formats::json::FromStringLazy(kDoc);
+
+  const auto point = json["point"].As<Point>();
+  EXPECT_EQ(point.x, 1);
+  EXPECT_EQ(point.y, 2);
+
+  const auto points = json["points"].As<std::vector<Point>>();
+  ASSERT_EQ(points.size(), 2);
+  EXPECT_EQ(points[1].x, 3);
+
+  const auto map = json["point"].As<std::map<std::string, int>>();
+  EXPECT_EQ(map.at("x"), 1);
+
+  EXPECT_FALSE(json["missing"].As<std::optional<Point>>());
+  EXPECT_EQ(json["dom"].As<DomOnly>().name, "from dom");
+  EXPECT_EQ(json["dom"].As<formats::json::Value>(),
+            formats::json::FromString(R"({"name": "from dom"})"));
+}
+
+TEST(FormatsJsonLazy, Errors) {
+  using formats::json::FromStringLazy;
+  using ParseException = formats::json::ParseException;
+
+  const auto json = FromStringLazy(kDoc);
+  EXPECT_THROW(json["str"].As<int>(), formats::json::TypeMismatchException);
+  EXPECT_THROW(json["missing"].As<int>(),
+               formats::json::MemberMissingException);
+  EXPECT_THROW(json["points"][2], formats::json::OutOfBoundsException);
+  EXPECT_EQ(json["nested"]["deep"]["deeper"][2]["k"].GetPath(),
+            "nested.deep.deeper[2].k");
+  EXPECT_EQ(json["nested"]["nope"].GetPath(), "nested.nope");
+
+  EXPECT_NO_THROW(FromStringLazy("{}"));
+  EXPECT_NO_THROW(FromStringLazy("[]"));
+  EXPECT_NO_THROW(FromStringLazy("null"));
+  EXPECT_NO_THROW(FromStringLazy(R"("string")"));
+
+  EXPECT_THROW(FromStringLazy(""), ParseException);
+  EXPECT_THROW(FromStringLazy("NULL"), ParseException);
+  EXPECT_THROW(FromStringLazy("{}{}"), ParseException);
+  EXPECT_THROW(FromStringLazy("[1,]"), ParseException);
+  EXPECT_THROW(FromStringLazy("[1 2]"), ParseException);
+  EXPECT_THROW(FromStringLazy(R"({"a" 1})"), ParseException);
+  EXPECT_THROW(FromStringLazy(R"({"a": 1])"), ParseException);
+  EXPECT_THROW(FromStringLazy(R"({"a": "1})"), ParseException);
+  EXPECT_THROW(FromStringLazy(R"({"field": 'string'})"), ParseException);
+
+  // Numbers are validated on access
+  EXPECT_THROW(FromStringLazy("[1-2]")[0].As<int>(), ParseException);
+}
+
+TEST(FormatsJsonLazy, StringValidation) {
+  using formats::json::FromString;
+  using formats::json::FromStringLazy;
+  using ParseException = formats::json::ParseException;
+
+  // Unescaped control character
+  EXPECT_THROW(FromString("{\"a\":\"x\ny\"}"), ParseException);
+  EXPECT_THROW(FromStringLazy("{\"a\":\"x\ny\"}"), ParseException);
+  EXPECT_THROW(FromStringLazy("{\"\x01\":1}"), ParseException);
+  EXPECT_THROW(FromStringLazy("[\"0123456789abcdef\t\"]"), ParseException);
+
+  // Invalid escape
+  EXPECT_THROW(FromString(R"(["\x"])"), ParseException);
+  EXPECT_THROW(FromStringLazy(R"(["\x"])"), ParseException);
+  EXPECT_THROW(FromStringLazy(R"({"\x": 1})"), ParseException);
+
+  // Invalid \u escape
+  EXPECT_THROW(FromString(R"(["\u12G4"])"), ParseException);
+  EXPECT_THROW(FromStringLazy(R"(["\u12G4"])"), ParseException);
+  EXPECT_THROW(FromStringLazy(R"(["\u12"])"), ParseException);
+
+  // Unpaired high surrogate
+  EXPECT_THROW(FromString(R"(["\uD83D"])"), ParseException);
+  EXPECT_THROW(FromStringLazy(R"(["\uD83D"])"), ParseException);
+  EXPECT_THROW(FromStringLazy(R"(["\uD83D\u0041"])"), ParseException);
+
+  // Invalid UTF-8: stray continuation byte, truncated sequence, overlong
+  // encoding, encoded surrogate and a code point above U+10FFFF
+  EXPECT_THROW(FromStringLazy("[\"\x80\"]"), ParseException);
+  EXPECT_THROW(FromStringLazy("[\"\xD0\"]"), ParseException);
+  EXPECT_THROW(FromStringLazy("[\"\xC0\xAF\"]"), ParseException);
+  EXPECT_THROW(FromStringLazy("[\"\xED\xA0\x80\"]"), ParseException);
+  EXPECT_THROW(FromStringLazy("[\"\xF4\x90\x80\x80\"]"), ParseException);
+
+  const auto json = FromStringLazy(
+      "[\"\xD0\xBF\xF0\x9F\x98\x80\", \"\\uD83D\\uDE00\", \"\\u00e9\", "
+      "\"0123456789abcdef\xC3\xA9\"]");
+  EXPECT_EQ(json[0].As<std::string>(), "\xD0\xBF\xF0\x9F\x98\x80");
+  EXPECT_EQ(json[1].As<std::string>(), "\xF0\x9F\x98\x80");
+  EXPECT_EQ(json[2].As<std::string>(), "\xC3\xA9");
+  EXPECT_EQ(json[3].As<std::string>(), "0123456789abcdef\xC3\xA9");
+}
+
+TEST(FormatsJsonLazy, DefaultConstructed) {
+  const formats::json::LazyValue value;
+  EXPECT_TRUE(value.IsNull());
+  EXPECT_FALSE(value.IsMissing());
+  EXPECT_TRUE(value.IsRoot());
+  EXPECT_EQ(value.GetRawJson(), "null");
+  EXPECT_EQ(value.GetPath(), "/");
+  EXPECT_TRUE(value.ToValue().IsNull());
+  EXPECT_TRUE(value.IsEmpty());
+  EXPECT_EQ(value.begin(), value.end());
+
+  const auto member = value["x"];
+  EXPECT_TRUE(member.IsMissing());
+  EXPECT_FALSE(member.IsNull());
+  EXPECT_FALSE(member.IsRoot());
+  EXPECT_EQ(member.GetPath(), "x");
+  EXPECT_THROW(member.As<int>(), formats::json::MemberMissingException);
+  EXPECT_EQ(member.As<int>(42), 42);
+}
+
+USERVER_NAMESPACE_END
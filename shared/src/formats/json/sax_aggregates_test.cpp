@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/formats/json/parser/aggregate_parser.hpp>
+#include <userver/formats/json/sax_aggregates.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// [Sample formats::json::AggregateFields usage]
+namespace my_namespace {
+
+struct Item {
+  std::int64_t id;
+  std::string name;
+  std::optional<double> price;
+};
+
+struct Response {
+  std::string status;
+  std::vector<Item> items;
+  std::map<std::string, int> counters;
+  bool has_more;
+};
+
+}  // namespace my_namespace
+
+template <>
+struct formats::json::AggregateFields<my_namespace::Item> {
+  static constexpr std::string_view kNames[] = {"id", "name", "price"};
+};
+
+template <>
+struct formats::json::AggregateFields<my_namespace::Response> {
+  static constexpr std::string_view kNames[] = {"status", "items", "counters",
+                                                "has_more"};
+};
+/// [Sample formats::json::AggregateFields usage]
+
+namespace {
+
+struct WithDomField {
+  std::uint64_t unsigned_value;
+  formats::json::Value raw;
+};
+
+}  // namespace
+
+template <>
+struct formats::json::AggregateFields<WithDomField> {
+  static constexpr std::string_view kNames[] = {"unsigned", "raw"};
+};
+
+TEST(JsonSaxAggregates, WriteToStream) {
+  const my_namespace::Response response{
+      "ok",
+      {{1, "first", 1.5}, {2, "second", std::nullopt}},
+      {{"a", 1}},
+      true,
+  };
+
+  formats::json::StringBuilder sb;
+  WriteToStream(response, sb);
+
+  EXPECT_EQ(sb.GetString(),
+            R"({"status":"ok","items":[{"id":1,"name":"first","price":1.5},)"
+            R"({"id":2,"name":"second"}],"counters":{"a":1},"has_more":true})");
+}
+
+TEST(JsonSaxAggregates, Parse) {
+  /// [Sample formats::json::parser::AggregateParser usage]
+  using formats::json::parser::AggregateParser;
+  using formats::json::parser::ParseToType;
+
+  const auto response =
+      ParseToType<my_namespace::Response,
+                  AggregateParser<my_namespace::Response>>(
+          R"({"status": "ok", "unknown": {"a": [1, {}]},
+              "items": [{"id": 1, "name": "first", "price": 1.5},
+                        {"id": 2, "name": "second", "price": null},
+                        {"name": "third", "id": 3}],
+              "counters": {"a": 1, "b": 2}, "has_more": false})");
+  /// [Sample formats::json::parser::AggregateParser usage]
+
+  EXPECT_EQ(response.status, "ok");
+  ASSERT_EQ(response.items.size(), 3);
+  EXPECT_EQ(response.items[0].id, 1);
+  EXPECT_EQ(response.items[0].price, 1.5);
+  EXPECT_EQ(response.items[1].name, "second");
+  EXPECT_EQ(response.items[1].price, std::nullopt);
+  EXPECT_EQ(response.items[2].id, 3);
+  EXPECT_EQ(response.items[2].price, std::nullopt);
+  EXPECT_EQ(response.counters, (std::map<std::string, int>{{"a", 1}, {"b", 2}}));
+  EXPECT_FALSE(response.has_more);
+}
+
+TEST(JsonSaxAggregates, Roundtrip) {
+  const my_namespace::Response response{"ok", {{1, "first", 1.5}}, {}, true};
+
+  formats::json::StringBuilder sb;
+  WriteToStream(response, sb);
+
+  using formats::json::parser::AggregateParser;
+  const auto parsed =
+      formats::json::parser::ParseToType<my_namespace::Response,
+                                         AggregateParser<my_namespace::Response>>(
+          sb.GetString());
+  EXPECT_EQ(parsed.status, response.status);
+  ASSERT_EQ(parsed.items.size(), 1);
+  EXPECT_EQ(parsed.items[0].name, "first");
+  EXPECT_TRUE(parsed.has_more);
+}
+
+TEST(JsonSaxAggregates, DomFallback) {
+  using formats::json::parser::AggregateParser;
+  const auto parsed =
+      formats::json::parser::ParseToType<WithDomField,
+                                         AggregateParser<WithDomField>>(
+          R"({"unsigned": 18446744073709551615, "raw": {"a": [1]}})");
+  EXPECT_EQ(parsed.unsigned_value, std::numeric_limits<std::uint64_t>::max());
+  EXPECT_EQ(parsed.raw, formats::json::FromString(R"({"a": [1]})"));
+
+  formats::json::StringBuilder sb;
+  WriteToStream(parsed, sb);
+  EXPECT_EQ(sb.GetString(),
+            R"({"unsigned":18446744073709551615,"raw":{"a":[1]}})");
+}
+
+TEST(JsonSaxAggregates, Errors) {
+  using formats::json::parser::AggregateParser;
+  using formats::json::parser::ParseError;
+  using formats::json::parser::ParseToType;
+  using Item = my_namespace::Item;
+
+  EXPECT_THROW((ParseToType<Item, AggregateParser<Item>>(R"({"id": 1})")),
+               ParseError);
+  EXPECT_THROW(
+      (ParseToType<Item, AggregateParser<Item>>(R"({"id": "1", "name": ""})")),
+      ParseError);
+  EXPECT_THROW((ParseToType<Item, AggregateParser<Item>>("[]")), ParseError);
+
+  try {
+    ParseToType<my_namespace::Response,
+                AggregateParser<my_namespace::Response>>(
+        R"({"status": "ok", "items": [{"id": 1, "name": 2}]})");
+    FAIL() << "ParseError expected";
+  } catch (const ParseError& e) {
+    EXPECT_NE(std::string{e.what()}.find("path 'items.[0].name'"),
+              std::string::npos)
+        << e.what();
+  }
+}
+
+USERVER_NAMESPACE_END
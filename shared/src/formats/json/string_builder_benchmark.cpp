@@ -1,10 +1,106 @@
 #include <benchmark/benchmark.h>
 
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/formats/json/parser/aggregate_parser.hpp>
+#include <userver/formats/json/sax_aggregates.hpp>
+#include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace dto {
+
+struct Offer {
+  std::int64_t id;
+  std::string title;
+  double price;
+  std::optional<std::string> promo;
+  std::vector<std::string> tags;
+};
+
+struct Response {
+  std::string request_id;
+  std::vector<Offer> offers;
+  bool has_more;
+};
+
+}  // namespace dto
+
+template <>
+struct formats::json::AggregateFields<dto::Offer> {
+  static constexpr std::string_view kNames[] = {"id", "title", "price", "promo",
+                                                "tags"};
+};
+
+template <>
+struct formats::json::AggregateFields<dto::Response> {
+  static constexpr std::string_view kNames[] = {"request_id", "offers",
+                                                "has_more"};
+};
+
+namespace dto {
+
+formats::json::Value Serialize(const Offer& offer,
+                               formats::serialize::To<formats::json::Value>) {
+  formats::json::ValueBuilder builder;
+  builder["id"] = offer.id;
+  builder["title"] = offer.title;
+  builder["price"] = offer.price;
+  if (offer.promo) builder["promo"] = *offer.promo;
+  builder["tags"] = offer.tags;
+  return builder.ExtractValue();
+}
+
+formats::json::Value Serialize(const Response& response,
+                               formats::serialize::To<formats::json::Value>) {
+  formats::json::ValueBuilder builder;
+  builder["request_id"] = response.request_id;
+  builder["offers"] = response.offers;
+  builder["has_more"] = response.has_more;
+  return builder.ExtractValue();
+}
+
+Offer Parse(const formats::json::Value& value, formats::parse::To<Offer>) {
+  return Offer{
+      value["id"].As<std::int64_t>(),
+      value["title"].As<std::string>(),
+      value["price"].As<double>(),
+      value["promo"].As<std::optional<std::string>>(),
+      value["tags"].As<std::vector<std::string>>(),
+  };
+}
+
+Response Parse(const formats::json::Value& value,
+               formats::parse::To<Response>) {
+  return Response{
+      value["request_id"].As<std::string>(),
+      value["offers"].As<std::vector<Offer>>(),
+      value["has_more"].As<bool>(),
+  };
+}
+
+Response MakeResponse(std::size_t offers_count) {
+  Response response{"9f86d081884c7d659a2feaa0c55ad015", {}, true};
+  for (std::size_t i = 0; i < offers_count; ++i) {
+    response.offers.push_back(Offer{
+        static_cast<std::int64_t>(i),
+        "Offer title number " + std::to_string(i),
+        i * 10.5,
+        i % 2 ? std::optional<std::string>{"PROMO"} : std::nullopt,
+        {"new", "popular"},
+    });
+  }
+  return response;
+}
+
+}  // namespace dto
+
 using namespace formats::json;
 
 Value Build(int level) {
@@ -73,4 +169,48 @@ void JsonStringBuilder(benchmark::State& state) {
 }
 BENCHMARK(JsonStringBuilder)->RangeMultiplier(4)->Range(1, 1024);
 
+void JsonDtoValueBuilder(benchmark::State& state) {
+  const auto response = dto::MakeResponse(state.range(0));
+  for (auto _ : state) {
+    auto str = ToString(ValueBuilder{response}.ExtractValue());
+    benchmark::DoNotOptimize(str);
+  }
+}
+BENCHMARK(JsonDtoValueBuilder)->RangeMultiplier(4)->Range(1, 1024);
+
+void JsonDtoStringBuilder(benchmark::State& state) {
+  const auto response = dto::MakeResponse(state.range(0));
+  for (auto _ : state) {
+    StringBuilder sb;
+    WriteToStream(response, sb);
+    auto str = sb.GetString();
+    benchmark::DoNotOptimize(str);
+  }
+}
+BENCHMARK(JsonDtoStringBuilder)->RangeMultiplier(4)->Range(1, 1024);
+
+void JsonDtoParseDom(benchmark::State& state) {
+  StringBuilder sb;
+  WriteToStream(dto::MakeResponse(state.range(0)), sb);
+  const auto input = sb.GetString();
+  for (auto _ : state) {
+    auto response = FromString(input).As<dto::Response>();
+    benchmark::DoNotOptimize(response);
+  }
+}
+BENCHMARK(JsonDtoParseDom)->RangeMultiplier(4)->Range(1, 1024);
+
+void JsonDtoParseSax(benchmark::State& state) {
+  StringBuilder sb;
+  WriteToStream(dto::MakeResponse(state.range(0)), sb);
+  const auto input = sb.GetString();
+  for (auto _ : state) {
+    auto response =
+        parser::ParseToType<dto::Response,
+                            parser::AggregateParser<dto::Response>>(input);
+    benchmark::DoNotOptimize(response);
+  }
+}
+BENCHMARK(JsonDtoParseSax)->RangeMultiplier(4)->Range(1, 1024);
+
 USERVER_NAMESPACE_END
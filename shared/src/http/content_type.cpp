@@ -260,6 +260,7 @@ std::ostream& operator<<(std::ostream& os, const ContentType& content_type) {
 namespace content_type {
 
 extern const ContentType kApplicationJson = "application/json; charset=utf-8";
+extern const ContentType kTextPlain = "text/plain; charset=utf-8";
 
 }  // namespace content_type
 }  // namespace http